@@ -27,6 +27,12 @@
 // Revision 2 11/5/2022
 // Swapped incorrect stacking order for exception handler and RTE opcode
 //
+// Revision 3 10/18/2026
+// Opcode decode now uses a 64K entry table built at startup from the original decode rules
+//
+// Revision 4 10/18/2026
+// Added code and data caches for the 68000's accesses to motherboard memory
+//
 //
 //------------------------------------------------------------------------
 //
@@ -247,6 +253,109 @@ unsigned long  num=0;
 unsigned long  original_mc68k_pc;
 
 
+// Opcode decode table - holds one handler number for each of the 64K opcode words.
+// Filled in at startup by Build_Opcode_Table() so the main loop dispatches with a single lookup.
+//
+DMAMEM uint8_t opcode_table[0x10000];   // 64KB in RAM2
+
+#define OPC_ILLEGAL            0
+#define OPC_BOOL_I_TO_CCR_1    1
+#define OPC_BOOL_I_TO_SR_1     2
+#define OPC_BOOL_I_TO_CCR_3    3
+#define OPC_BOOL_I_TO_SR_3     4
+#define OPC_BOOL_I_TO_CCR_2    5
+#define OPC_BOOL_I_TO_SR_2     6
+#define OPC_BMOD_31            7
+#define OPC_BMOD_21            8
+#define OPC_BMOD_11            9
+#define OPC_BMOD_01            10
+#define OPC_MOVEP              11
+#define OPC_BOOL_I_3           12
+#define OPC_BOOL_I_1           13
+#define OPC_BOOL_I_2           14
+#define OPC_ADDSUBI_0          15
+#define OPC_ADDSUBI_1          16
+#define OPC_BOOL_I_4           17
+#define OPC_BMOD_30            18
+#define OPC_BMOD_20            19
+#define OPC_BMOD_10            20
+#define OPC_BMOD_00            21
+#define OPC_MOVE               22
+#define OPC_MOVE_FROM_SR       23
+#define OPC_MOVE_TO_CCR        24
+#define OPC_MOVE_TO_SR         25
+#define OPC_NEGS_3             26
+#define OPC_NEGS_4             27
+#define OPC_NEGS_2             28
+#define OPC_NEGS_1             29
+#define OPC_EXT                30
+#define OPC_NBCD               31
+#define OPC_SWAP               32
+#define OPC_PEA                33
+#define OPC_TAS                34
+#define OPC_TST                35
+#define OPC_TRAP               36
+#define OPC_LINK               37
+#define OPC_UNLK               38
+#define OPC_MOVE_USP           39
+#define OPC_NOP                40
+#define OPC_RESET              41
+#define OPC_STOP               42
+#define OPC_RTE                43
+#define OPC_RTS                44
+#define OPC_TRAPV              45
+#define OPC_RTR                46
+#define OPC_JSR                47
+#define OPC_JMP                48
+#define OPC_MOVEM              49
+#define OPC_LEA                50
+#define OPC_CHK                51
+#define OPC_DBCC               52
+#define OPC_SCC                53
+#define OPC_ADDSUBQ_1          54
+#define OPC_ADDSUBQ_0          55
+#define OPC_BSR                56
+#define OPC_BCC                57
+#define OPC_MOVEQ              58
+#define OPC_DIVU               59
+#define OPC_DIVS               60
+#define OPC_XBCD_1             61
+#define OPC_BOOL_1             62
+#define OPC_ADDSUBA_0          63
+#define OPC_ADDSUBX_0          64
+#define OPC_ADDSUB_0           65
+#define OPC_LINE_A             66
+#define OPC_CMPA               67
+#define OPC_CMPM               68
+#define OPC_BOOL_3             69
+#define OPC_BOOL_4             70
+#define OPC_MULU               71
+#define OPC_MULS               72
+#define OPC_XBCD_0             73
+#define OPC_EXG                74
+#define OPC_BOOL_2             75
+#define OPC_ADDSUBA_1          76
+#define OPC_ADDSUBX_1          77
+#define OPC_ADDSUB_1           78
+#define OPC_XSL_0_1            79
+#define OPC_XSL_0_2            80
+#define OPC_ROXL_0             81
+#define OPC_ROL_0              82
+#define OPC_XSR_1_2            83
+#define OPC_XSR_2_2            84
+#define OPC_ROXR_0             85
+#define OPC_ROR_0              86
+#define OPC_XSL_1_1            87
+#define OPC_XSL_1_2            88
+#define OPC_ROXL_1             89
+#define OPC_ROL_1              90
+#define OPC_XSR_1_1            91
+#define OPC_XSR_2_1            92
+#define OPC_ROXR_1             93
+#define OPC_ROR_1              94
+#define OPC_LINE_F             95
+
+
 int16_t  clock_counter=0;
 uint16_t nmi_d=1;
 uint16_t nmi_latched=0;
@@ -717,6 +826,79 @@ uint16_t Biu_Operation(uint8_t biu_operation , uint8_t segment_overridable ,uint
    
 
 
+// ------------------------------------------------------
+// Motherboard memory cache
+// ------------------------------------------------------
+//
+// Each byte of motherboard memory costs a full 8088 bus cycle, so the 68000's instruction
+// fetches and data reads are held in two direct-mapped caches in Teensy RAM.
+// Writes go through to the motherboard and update any cached copy of the byte.
+// Only the 64KB regions marked in cacheable_region[] are cached, so video RAM and
+// the adapter ROM/IO areas are always accessed on the bus.
+//
+#define CODE_CACHE_LINES        1024      // 16KB code cache
+#define CODE_CACHE_LINE_SIZE    16
+#define DATA_CACHE_LINES        1024      // 4KB data cache
+#define DATA_CACHE_LINE_SIZE    4
+#define CACHE_VALID             0x1       // Stored in bit[0] of the tag since line addresses are aligned
+
+uint32_t code_cache_tag[CODE_CACHE_LINES];
+uint8_t  code_cache_data[CODE_CACHE_LINES*CODE_CACHE_LINE_SIZE];
+uint32_t data_cache_tag[DATA_CACHE_LINES];
+uint8_t  data_cache_data[DATA_CACHE_LINES*DATA_CACHE_LINE_SIZE];
+
+// One entry per 64KB region - 0x00000-0x9FFFF is DRAM, 0xA0000-0xFFFFF is video, adapter ROM/IO and BIOS
+uint8_t  cacheable_region[16] = { 1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0 };
+
+
+void Cache_Invalidate()  {
+
+  memset(code_cache_tag, 0, sizeof(code_cache_tag));
+  memset(data_cache_tag, 0, sizeof(data_cache_tag));
+  return;
+}
+
+
+inline uint8_t Cache_Read(uint32_t local_address, uint32_t * cache_tag, uint8_t * cache_data, uint32_t line_size, uint32_t num_lines)  {
+  uint32_t line_address;
+  uint32_t line;
+  uint8_t * line_data;
+
+  local_address = 0xFFFFF & local_address;                                                  // 8088 bus is 20 bits
+  if (cacheable_region[local_address>>16]==0)  return BIU_Bus_Cycle(MEM_READ_BYTE, local_address, 0x0);
+
+  line_address = local_address & ~(line_size-1);
+  line         = (local_address/line_size) & (num_lines-1);
+  line_data    = cache_data + (line*line_size);
+
+  if (cache_tag[line] != (line_address|CACHE_VALID))  {                                     // Miss - fill the whole line
+    for (uint32_t i=0 ; i<line_size ; i++)  {  line_data[i] = BIU_Bus_Cycle(MEM_READ_BYTE, line_address+i, 0x0);  }
+    cache_tag[line] = line_address|CACHE_VALID;
+  }
+  return line_data[local_address & (line_size-1)];
+}
+
+
+inline uint8_t Code_Cache_Read(uint32_t local_address)  {  return Cache_Read(local_address, code_cache_tag, code_cache_data, CODE_CACHE_LINE_SIZE, CODE_CACHE_LINES);  }
+inline uint8_t Data_Cache_Read(uint32_t local_address)  {  return Cache_Read(local_address, data_cache_tag, data_cache_data, DATA_CACHE_LINE_SIZE, DATA_CACHE_LINES);  }
+
+
+inline void Cache_Write(uint32_t local_address, uint8_t local_data)  {
+  uint32_t line;
+
+  local_address = 0xFFFFF & local_address;
+  if (cacheable_region[local_address>>16]==1)  {
+    line = (local_address/CODE_CACHE_LINE_SIZE) & (CODE_CACHE_LINES-1);
+    if (code_cache_tag[line] == ((local_address & ~(CODE_CACHE_LINE_SIZE-1))|CACHE_VALID))  code_cache_data[local_address & ((CODE_CACHE_LINES*CODE_CACHE_LINE_SIZE)-1)] = local_data;
+
+    line = (local_address/DATA_CACHE_LINE_SIZE) & (DATA_CACHE_LINES-1);
+    if (data_cache_tag[line] == ((local_address & ~(DATA_CACHE_LINE_SIZE-1))|CACHE_VALID))  data_cache_data[local_address & ((DATA_CACHE_LINES*DATA_CACHE_LINE_SIZE)-1)] = local_data;
+  }
+  BIU_Bus_Cycle(MEM_WRITE_BYTE, local_address, local_data);
+  return;
+}
+
+
 // 68000 Bus Interface Unit - BIU
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -728,7 +910,7 @@ unsigned long IORD_32DIRECT(unsigned long base_address , unsigned long reg_addre
     else if (reg_address==BIU_REG_DONE         )   { return 0x1; }      // always return "Done"
     else if (reg_address==BIU_REG_FAIL_TYPE    )   { return 0x0; }
     //else if (reg_address==BIU_REG_PFQ_TOP      )   { return (PROGRAM_MEMORY_ARRAY[mc68k_pc]<<8) | (PROGRAM_MEMORY_ARRAY[mc68k_pc+1]); }
-    else if (reg_address==BIU_REG_PFQ_TOP      )   { return (BIU_Bus_Cycle(MEM_READ_BYTE, mc68k_pc ,0x0)<<8) | BIU_Bus_Cycle(MEM_READ_BYTE, mc68k_pc+1 ,0x0); }
+    else if (reg_address==BIU_REG_PFQ_TOP      )   { return (Code_Cache_Read(mc68k_pc)<<8) | Code_Cache_Read(mc68k_pc+1); }
     else if (reg_address==BIU_REG_DATAIN       )   { return  biu_read_data; }
     else if (reg_address==BIU_REG_BUS_ERROR    )   { return  0x0; }
     return 0;
@@ -753,10 +935,10 @@ void IOWR_32DIRECT(unsigned long base_address , unsigned long reg_address , unsi
     else if (reg_address==BIU_REG_COMMAND && write_data==0x1 && biu_size==8)      { PROGRAM_MEMORY_ARRAY[biu_address]=biu_dataout; } // command: BIU Write Data - Byte
     else if (reg_address==BIU_REG_COMMAND && write_data==0x1 && biu_size==16)     { PROGRAM_MEMORY_ARRAY[biu_address]=((biu_dataout&0xFF00)>>8); PROGRAM_MEMORY_ARRAY[biu_address+1]=(biu_dataout&0xFF); } // command: BIU Write Data - Word
 */
-    else if (reg_address==BIU_REG_COMMAND && write_data==0x2 && biu_size==8)      { biu_read_data=BIU_Bus_Cycle(MEM_READ_BYTE, biu_address ,0x0); } // command: execute BIU Read Cycle - Byte
-    else if (reg_address==BIU_REG_COMMAND && write_data==0x2 && biu_size==16)     { biu_read_data=(BIU_Bus_Cycle(MEM_READ_BYTE, biu_address ,0x0)<<8) | BIU_Bus_Cycle(MEM_READ_BYTE, biu_address+1 ,0x0); } // command: execute BIU Read Cycle - Word
-    else if (reg_address==BIU_REG_COMMAND && write_data==0x1 && biu_size==8)      { BIU_Bus_Cycle(MEM_WRITE_BYTE, biu_address,biu_dataout); } // command: BIU Write Data - Byte
-    else if (reg_address==BIU_REG_COMMAND && write_data==0x1 && biu_size==16)     { BIU_Bus_Cycle(MEM_WRITE_BYTE, biu_address,((biu_dataout&0xFF00)>>8)); BIU_Bus_Cycle(MEM_WRITE_BYTE, biu_address+1,((biu_dataout&0xFF))); } // command: BIU Write Data - Word
+    else if (reg_address==BIU_REG_COMMAND && write_data==0x2 && biu_size==8)      { biu_read_data=Data_Cache_Read(biu_address); } // command: execute BIU Read Cycle - Byte
+    else if (reg_address==BIU_REG_COMMAND && write_data==0x2 && biu_size==16)     { biu_read_data=(Data_Cache_Read(biu_address)<<8) | Data_Cache_Read(biu_address+1); } // command: execute BIU Read Cycle - Word
+    else if (reg_address==BIU_REG_COMMAND && write_data==0x1 && biu_size==8)      { Cache_Write(biu_address,biu_dataout); } // command: BIU Write Data - Byte
+    else if (reg_address==BIU_REG_COMMAND && write_data==0x1 && biu_size==16)     { Cache_Write(biu_address,((biu_dataout&0xFF00)>>8)); Cache_Write(biu_address+1,((biu_dataout&0xFF))); } // command: BIU Write Data - Word
 
 
  
@@ -787,7 +969,7 @@ void IOWR_32DIRECT(unsigned long base_address , unsigned long reg_address , unsi
       
       if ((translated_keystroke<0x80) && ( (new_keystroke!=0x2A) || (new_keystroke!=0x36) || (new_keystroke!=0xA6A) || (new_keystroke!=0xB6) )) {
         //PROGRAM_MEMORY_ARRAY[0x22] = 0xFF;                          // Let BASIC know a keystroke is available
-        BIU_Bus_Cycle(MEM_WRITE_BYTE, 0x22 , 0xFF);
+        Cache_Write(0x22 , 0xFF);
       }
       Biu_Operation(INTERRUPT_ACK , SEGMENT_OVERRIDABLE_FALSE , SEGMENT_00 , 0x00000 , 0x00 );   // Debounce the interrupt from the 8259
       BIU_Bus_Cycle(IO_WRITE_BYTE  , 0x61, 0x8c );                                               // Debounce the serial shift register
@@ -798,13 +980,13 @@ void IOWR_32DIRECT(unsigned long base_address , unsigned long reg_address , unsi
     //
       if (Serial.available() ) { 
         translated_keystroke = Serial.read();   
-        BIU_Bus_Cycle(MEM_WRITE_BYTE, 0x22 , 0xFF);
+        Cache_Write(0x22 , 0xFF);
       }
 
     
     // UART Receive character
     //if (reg_address==BIU_REG_COMMAND && write_data==0x2 &&  biu_size==8 && biu_address==0x23)  { biu_read_data = translated_keystroke;  PROGRAM_MEMORY_ARRAY[0x22] = 0x00;  }
-    if (reg_address==BIU_REG_COMMAND && write_data==0x2 &&  biu_size==8 && biu_address==0x23)  { biu_read_data = translated_keystroke;  BIU_Bus_Cycle(MEM_WRITE_BYTE, 0x22 , 0x00);  }
+    if (reg_address==BIU_REG_COMMAND && write_data==0x2 &&  biu_size==8 && biu_address==0x23)  { biu_read_data = translated_keystroke;  Cache_Write(0x22 , 0x00);  }
 
 
     // UART Transmit character
@@ -1165,6 +1347,7 @@ void Reset_routine()
 {
   unsigned long  pc_temp=0;
 
+  Cache_Invalidate();                                                                   // DRAM may have been written without the caches
   Update_System_Flags(0x2700);                                                          // Initialize flags T=0, S=1, Mask=111
                                
   BIU_Jump(0x000000);                                                                   // Flush prefetch queue and start fetching data at address 0x00
@@ -3161,6 +3344,158 @@ void Copy_BASIC_To_DRAM() {
 
 
 
+// Opcode Decoder
+// ----------------------------------------------------------------------
+// Returns the handler number for an opcode word using the 68000 decode rules.
+// Called once per opcode word by Build_Opcode_Table() rather than on every instruction.
+//
+uint8_t Decode_Opcode(uint16_t opcode)  {
+
+  switch (opcode&0xF000)
+    {
+      case (0x0000):
+        if ((opcode&0x0FFF)==0x003C)  return OPC_BOOL_I_TO_CCR_1;
+        if ((opcode&0x0FFF)==0x007C)  return OPC_BOOL_I_TO_SR_1;
+        if ((opcode&0x0FFF)==0x0A3C)  return OPC_BOOL_I_TO_CCR_3;
+        if ((opcode&0x0FFF)==0x0A7C)  return OPC_BOOL_I_TO_SR_3;
+        if ((opcode&0x0FFF)==0x023C)  return OPC_BOOL_I_TO_CCR_2;
+        if ((opcode&0x0FFF)==0x027C)  return OPC_BOOL_I_TO_SR_2;
+        if ((opcode&0x0FC0)==0x0800)  return OPC_BMOD_31;
+        if ((opcode&0x0FC0)==0x0840)  return OPC_BMOD_21;
+        if ((opcode&0x0FC0)==0x0880)  return OPC_BMOD_11;
+        if ((opcode&0x0FC0)==0x08C0)  return OPC_BMOD_01;
+        if ((opcode&0x0138)==0x0108)  return OPC_MOVEP;
+        if ((opcode&0x0F00)==0x0A00)  return OPC_BOOL_I_3;
+        if ((opcode&0x0F00)==0x0000)  return OPC_BOOL_I_1;
+        if ((opcode&0x0F00)==0x0200)  return OPC_BOOL_I_2;
+        if ((opcode&0x0F00)==0x0400)  return OPC_ADDSUBI_0;
+        if ((opcode&0x0F00)==0x0600)  return OPC_ADDSUBI_1;
+        if ((opcode&0x0F00)==0x0C00)  return OPC_BOOL_I_4;
+        if ((opcode&0x01C0)==0x0100)  return OPC_BMOD_30;
+        if ((opcode&0x01C0)==0x0140)  return OPC_BMOD_20;
+        if ((opcode&0x01C0)==0x0180)  return OPC_BMOD_10;
+        if ((opcode&0x01C0)==0x01C0)  return OPC_BMOD_00;
+        return OPC_ILLEGAL;
+
+      case (0x1000):  case (0x2000):  case (0x3000):  return OPC_MOVE;
+
+      case (0x4000):
+        if ((opcode&0x0FC0)==0x00C0)  return OPC_MOVE_FROM_SR;
+        if ((opcode&0x0FC0)==0x04C0)  return OPC_MOVE_TO_CCR;
+        if ((opcode&0x0FC0)==0x06C0)  return OPC_MOVE_TO_SR;
+        if ((opcode&0x0F00)==0x0000)  return OPC_NEGS_3;
+        if ((opcode&0x0F00)==0x0200)  return OPC_NEGS_4;
+        if ((opcode&0x0F00)==0x0400)  return OPC_NEGS_2;
+        if ((opcode&0x0F00)==0x0600)  return OPC_NEGS_1;
+        if ((opcode&0x0FB8)==0x0880)  return OPC_EXT;
+        if ((opcode&0x0FC0)==0x0800)  return OPC_NBCD;
+        if ((opcode&0x0FF8)==0x0840)  return OPC_SWAP;
+        if ((opcode&0x0FC0)==0x0840)  return OPC_PEA;
+        if ((opcode&0x0FFF)==0x0AFC)  return OPC_ILLEGAL;
+        if ((opcode&0x0FC0)==0x0AC0)  return OPC_TAS;
+        if ((opcode&0x0F00)==0x0A00)  return OPC_TST;
+        if ((opcode&0x0FF0)==0x0E40)  return OPC_TRAP;
+        if ((opcode&0x0FF8)==0x0E50)  return OPC_LINK;
+        if ((opcode&0x0FF8)==0x0E58)  return OPC_UNLK;
+        if ((opcode&0x0FF0)==0x0E60)  return OPC_MOVE_USP;
+        if ((opcode&0x0FFF)==0x0E71)  return OPC_NOP;
+        if ((opcode&0x0FFF)==0x0E70)  return OPC_RESET;
+        if ((opcode&0x0FFF)==0x0E72)  return OPC_STOP;
+        if ((opcode&0x0FFF)==0x0E73)  return OPC_RTE;
+        if ((opcode&0x0FFF)==0x0E75)  return OPC_RTS;
+        if ((opcode&0x0FFF)==0x0E76)  return OPC_TRAPV;
+        if ((opcode&0x0FFF)==0x0E77)  return OPC_RTR;
+        if ((opcode&0x0FC0)==0x0E80)  return OPC_JSR;
+        if ((opcode&0x0FC0)==0x0EC0)  return OPC_JMP;
+        if ((opcode&0x0B80)==0x0880)  return OPC_MOVEM;
+        if ((opcode&0x01C0)==0x01C0)  return OPC_LEA;
+        if ((opcode&0x01C0)==0x0180)  return OPC_CHK;
+        return OPC_ILLEGAL;
+
+      case (0x5000):
+        if ((opcode&0x00F8)==0x00C8)  return OPC_DBCC;
+        if ((opcode&0x00C0)==0x00C0)  return OPC_SCC;
+        if ((opcode&0x0100)==0x0000)  return OPC_ADDSUBQ_1;
+        if ((opcode&0x0100)==0x0100)  return OPC_ADDSUBQ_0;
+        return OPC_ILLEGAL;
+
+      case (0x6000):
+        if ((opcode&0x0F00)==0x0100)  return OPC_BSR;
+        if ((opcode&0x0000)==0x0000)  return OPC_BCC;
+        return OPC_ILLEGAL;
+
+      case (0x7000):
+        if ((opcode&0x0100)==0x0000)  return OPC_MOVEQ;
+        return OPC_ILLEGAL;
+
+      case (0x8000):
+        if ((opcode&0x01C0)==0x00C0)  return OPC_DIVU;
+        if ((opcode&0x01C0)==0x01C0)  return OPC_DIVS;
+        if ((opcode&0x01F0)==0x0100)  return OPC_XBCD_1;
+        if ((opcode&0x0000)==0x0000)  return OPC_BOOL_1;
+        return OPC_ILLEGAL;
+
+      case (0x9000):
+        if ((opcode&0x00C0)==0x00C0)  return OPC_ADDSUBA_0;
+        if ((opcode&0x0130)==0x0100)  return OPC_ADDSUBX_0;
+        if ((opcode&0x0000)==0x0000)  return OPC_ADDSUB_0;
+        return OPC_ILLEGAL;
+
+      case (0xA000):  return OPC_LINE_A;
+
+      case (0xB000):
+        if ((opcode&0x00C0)==0x00C0)  return OPC_CMPA;
+        if ((opcode&0x0138)==0x0108)  return OPC_CMPM;
+        if ((opcode&0x0100)==0x0100)  return OPC_BOOL_3;
+        if ((opcode&0x0100)==0x0000)  return OPC_BOOL_4;
+        return OPC_ILLEGAL;
+
+      case (0xC000):
+        if ((opcode&0x01C0)==0x00C0)  return OPC_MULU;
+        if ((opcode&0x01C0)==0x01C0)  return OPC_MULS;
+        if ((opcode&0x01F0)==0x0100)  return OPC_XBCD_0;
+        if ((opcode&0x0130)==0x0100)  return OPC_EXG;
+        if ((opcode&0x0000)==0x0000)  return OPC_BOOL_2;
+        return OPC_ILLEGAL;
+
+      case (0xD000):
+        if ((opcode&0x00C0)==0x00C0)  return OPC_ADDSUBA_1;
+        if ((opcode&0x0130)==0x0100)  return OPC_ADDSUBX_1;
+        if ((opcode&0x0000)==0x0000)  return OPC_ADDSUB_1;
+        return OPC_ILLEGAL;
+
+      case (0xE000):
+        if ((opcode&0x0FC0)==0x01C0)  return OPC_XSL_0_1;               // MEMORY Left
+        if ((opcode&0x0FC0)==0x03C0)  return OPC_XSL_0_2;
+        if ((opcode&0x0FC0)==0x05C0)  return OPC_ROXL_0;
+        if ((opcode&0x0FC0)==0x07C0)  return OPC_ROL_0;
+        if ((opcode&0x0FC0)==0x00C0)  return OPC_XSR_1_2;               // MEMORY Right
+        if ((opcode&0x0FC0)==0x02C0)  return OPC_XSR_2_2;
+        if ((opcode&0x0FC0)==0x04C0)  return OPC_ROXR_0;
+        if ((opcode&0x0FC0)==0x06C0)  return OPC_ROR_0;
+        if ((opcode&0x0118)==0x0100)  return OPC_XSL_1_1;               // REGISTER Left
+        if ((opcode&0x0118)==0x0108)  return OPC_XSL_1_2;
+        if ((opcode&0x0118)==0x0110)  return OPC_ROXL_1;
+        if ((opcode&0x0118)==0x0118)  return OPC_ROL_1;
+        if ((opcode&0x0118)==0x0000)  return OPC_XSR_1_1;               // REGISTER Right
+        if ((opcode&0x0118)==0x0008)  return OPC_XSR_2_1;
+        if ((opcode&0x0118)==0x0010)  return OPC_ROXR_1;
+        if ((opcode&0x0118)==0x0018)  return OPC_ROR_1;
+        return OPC_ILLEGAL;
+
+      case (0xF000):  return OPC_LINE_F;
+    }
+  return OPC_ILLEGAL;
+}
+
+
+void Build_Opcode_Table()  {
+
+  for (uint32_t i=0 ; i<=0xFFFF ; i++)  {  opcode_table[i] = Decode_Opcode(i);  }
+  return;
+}
+
+
 // Main MCL68 loop
 // ----------------------------------------------------------------------
  void loop() {
@@ -3180,6 +3515,8 @@ void Copy_BASIC_To_DRAM() {
   
   Copy_BASIC_To_DRAM();         // Copy BASIC to motherboard DRAM and chedk it
 
+  Build_Opcode_Table();        // Predecode every 16-bit opcode word into opcode_table[]
+
    Reset_routine();
 
   delay (2000);
@@ -3202,157 +3539,104 @@ void Copy_BASIC_To_DRAM() {
  
       first_opcode = BIU_PFQ_Fetch();
          
-      switch (first_opcode&0xF000)
+      switch (opcode_table[first_opcode])
       {
-        case (0x0000):
-          if ((first_opcode&0x0FFF)==0x003C) { op_BOOL_I_TO_CCR(1);       break; }// Checked   
-          if ((first_opcode&0x0FFF)==0x007C) { op_BOOL_I_TO_SR(1);        break; }// Checked     
-          if ((first_opcode&0x0FFF)==0x0A3C) { op_BOOL_I_TO_CCR(3);       break; }// Checked
-          if ((first_opcode&0x0FFF)==0x0A7C) { op_BOOL_I_TO_SR(3);        break; }// Checked
-          if ((first_opcode&0x0FFF)==0x023C) { op_BOOL_I_TO_CCR(2);       break; }// Checked
-          if ((first_opcode&0x0FFF)==0x027C) { op_BOOL_I_TO_SR(2);        break; }// Checked
-          if ((first_opcode&0x0FC0)==0x0800) { op_BMOD(0x31);             break; }// Checked
-          if ((first_opcode&0x0FC0)==0x0840) { op_BMOD(0x21);             break; }// Checked
-          if ((first_opcode&0x0FC0)==0x0880) { op_BMOD(0x11);             break; }// Checked
-          if ((first_opcode&0x0FC0)==0x08C0) { op_BMOD(0x01);             break; }// Checked
-          if ((first_opcode&0x0138)==0x0108) { op_MOVEP();                break; }// Checked
-          if ((first_opcode&0x0F00)==0x0A00) { op_BOOL_I(3);              break; }// Checked
-          if ((first_opcode&0x0F00)==0x0000) { op_BOOL_I(1);              break; }// Checked
-          if ((first_opcode&0x0F00)==0x0200) { op_BOOL_I(2);              break; }// Checked
-          if ((first_opcode&0x0F00)==0x0400) { op_ADDSUBI(0);             break; }// Checked
-          if ((first_opcode&0x0F00)==0x0600) { op_ADDSUBI(1);             break; }// Checked
-          if ((first_opcode&0x0F00)==0x0C00) { op_BOOL_I(4);              break; }// Checked         
-          if ((first_opcode&0x01C0)==0x0100) { op_BMOD(0x30);             break; }// Checked
-          if ((first_opcode&0x01C0)==0x0140) { op_BMOD(0x20);             break; }// Checked
-          if ((first_opcode&0x01C0)==0x0180) { op_BMOD(0x10);             break; }// Checked
-          if ((first_opcode&0x01C0)==0x01C0) { op_BMOD(0x00);             break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x1000):  case (0x2000):  case (0x3000):                                                                             
-                                             {   op_MOVE();               break; }// Checked
-                                                                                                                                   
-                                                                                                                                   
-         case (0x4000):                                                                                                             
-           if ((first_opcode&0x0FC0)==0x00C0) { op_MOVE_FROM_SR();          break; }// Checked
-           if ((first_opcode&0x0FC0)==0x04C0) { op_MOVE_TO_CCR();           break; }// Checked
-           if ((first_opcode&0x0FC0)==0x06C0) { op_MOVE_TO_SR();            break; }// Checked
-           if ((first_opcode&0x0F00)==0x0000) { op_NEGS(3);                 break; }// Checked
-           if ((first_opcode&0x0F00)==0x0200) { op_NEGS(4);                 break; }// Checked
-           if ((first_opcode&0x0F00)==0x0400) { op_NEGS(2);                 break; }// Checked
-           if ((first_opcode&0x0F00)==0x0600) { op_NEGS(1);                 break; }// Checked
-           if ((first_opcode&0x0FB8)==0x0880) { op_EXT();                   break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0800) { op_NBCD();                  break; }// Checked
-           if ((first_opcode&0x0FF8)==0x0840) { op_SWAP();                  break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0840) { op_PEA();                   break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0AFC) { Exception_Handler(4);       break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0AC0) { op_TAS();                   break; }// Checked
-           if ((first_opcode&0x0F00)==0x0A00) { op_TST();                   break; }// Checked
-           if ((first_opcode&0x0FF0)==0x0E40) { op_TRAP();                  break; }// Checked
-           if ((first_opcode&0x0FF8)==0x0E50) { op_LINK();                  break; }// Checked
-           if ((first_opcode&0x0FF8)==0x0E58) { op_UNLK();                  break; }// Checked
-           if ((first_opcode&0x0FF0)==0x0E60) { op_MOVE_USP();              break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E71) { /* Do Nothing */            break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E70) { op_RESET();                 break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E72) { op_STOP();                  break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E73) { op_RTE();                   break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E75) { op_RTS();                   break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E76) { op_TRAPV();                 break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E77) { op_RTR();                   break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0E80) { op_JSR();                   break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0EC0) { op_JMP();                   break; }// Checked
-           if ((first_opcode&0x0B80)==0x0880) { op_MOVEM();                 break; }// Checked
-           if ((first_opcode&0x01C0)==0x01C0) { op_LEA();                   break; }// Checked
-           if ((first_opcode&0x01C0)==0x0180) { op_CHK();                   break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x5000):                                                                                                             
-           if ((first_opcode&0x00F8)==0x00C8) { op_dBCC();                  break; }// Checked
-           if ((first_opcode&0x00C0)==0x00C0) { op_SCC();                   break; }// Checked
-           if ((first_opcode&0x0100)==0x0000) { op_ADDSUBQ(1);              break; }// Checked
-           if ((first_opcode&0x0100)==0x0100) { op_ADDSUBQ(0);              break; }// Checked
-           Exception_Handler(4);                                                     
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x6000):                                                                                                             
-           if ((first_opcode&0x0F00)==0x0100) { op_BSR();                   break; }// Checked         
-           if ((first_opcode&0x0000)==0x0000) { op_BCC();                   break; }// Checked 
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x7000):                                                                                                             
-           if ((first_opcode&0x0100)==0x0000) { op_MOVEQ();                 break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x8000):                                                                                                             
-           if ((first_opcode&0x01C0)==0x00C0) { op_DIVU();                  break; }// Checked
-           if ((first_opcode&0x01C0)==0x01C0) { op_DIVS();                  break; }// Checked
-           if ((first_opcode&0x01F0)==0x0100) { op_xBCD(1);                 break; }// Checked
-           if ((first_opcode&0x0000)==0x0000) { op_BOOL(1);                 break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x9000):                                                                                                             
-           if ((first_opcode&0x00C0)==0x00C0) { op_ADDSUBA(0);              break; }// Checked
-           if ((first_opcode&0x0130)==0x0100) { op_ADDSUBX(0);              break; }// Checked         
-           if ((first_opcode&0x0000)==0x0000) { op_ADDSUB(0);               break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                     
-         case (0xA000):   {  Exception_Handler(10);                         break; }// Checked
-                                                                                                                                   
-         case (0xB000):                                                                                                             
-           if ((first_opcode&0x00C0)==0x00C0) { op_CMPA();                  break; }// Checked
-           if ((first_opcode&0x0138)==0x0108) { op_CMPM();                  break; }// Checked
-           if ((first_opcode&0x0100)==0x0100) { op_BOOL(3);                 break; }// Checked
-           if ((first_opcode&0x0100)==0x0000) { op_BOOL(4);                 break; }// Checked
-           Exception_Handler(4);                                                   
-           break;                                                                   
-                                                                                   
-         case (0xC000):                                                             
-           if ((first_opcode&0x01C0)==0x00C0) { op_MULU();                  break; }// Checked
-           if ((first_opcode&0x01C0)==0x01C0) { op_MULS();                  break; }// Checked
-           if ((first_opcode&0x01F0)==0x0100) { op_xBCD(0);                 break; }// Checked
-           if ((first_opcode&0x0130)==0x0100) { op_EXG();                   break; }// Checked
-           if ((first_opcode&0x0000)==0x0000) { op_BOOL(2);                 break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0xD000):                                                                                                             
-           if ((first_opcode&0x00C0)==0x00C0) { op_ADDSUBA(1);              break; }// Checked
-           if ((first_opcode&0x0130)==0x0100) { op_ADDSUBX(1);              break; }// Checked
-           if ((first_opcode&0x0000)==0x0000) { op_ADDSUB(1);               break; }// Checked
-           Exception_Handler(4);                                                   
-           break;                                                                   
-                                                                                   
-         case (0xE000):                                                             
-           if ((first_opcode&0x0FC0)==0x01C0) { op_xSL(0,1);                break; }// Checked  // MEMORY Left
-           if ((first_opcode&0x0FC0)==0x03C0) { op_xSL(0,2);                break; }// Checked
-           if ((first_opcode&0x0FC0)==0x05C0) { op_ROXL(0);                 break; }// Checked
-           if ((first_opcode&0x0FC0)==0x07C0) { op_ROL(0);                  break; }// Checked
-       
-           if ((first_opcode&0x0FC0)==0x00C0) { op_xSR(1,2);                break; }// Checked  // MEMORY Right
-           if ((first_opcode&0x0FC0)==0x02C0) { op_xSR(2,2);                break; }// Checked
-           if ((first_opcode&0x0FC0)==0x04C0) { op_ROXR(0);                 break; }// Checked
-           if ((first_opcode&0x0FC0)==0x06C0) { op_ROR(0);                  break; }// Checked
-                                                                                   
-           if ((first_opcode&0x0118)==0x0100) { op_xSL(1,1);                break; }// Checked  // REGISTER Left
-           if ((first_opcode&0x0118)==0x0108) { op_xSL(1,2);                break; }// Checked
-           if ((first_opcode&0x0118)==0x0110) { op_ROXL(1);                 break; }// Checked
-           if ((first_opcode&0x0118)==0x0118) { op_ROL(1);                  break; }// Checked 
-       
-           if ((first_opcode&0x0118)==0x0000) { op_xSR(1,1);                break; }// Checked  // REGISTER Right 
-           if ((first_opcode&0x0118)==0x0008) { op_xSR(2,1);                break; }// Checked
-           if ((first_opcode&0x0118)==0x0010) { op_ROXR(1);                 break; }// Checked
-           if ((first_opcode&0x0118)==0x0018) { op_ROR(1);                  break; }// Checked 
-           Exception_Handler(4);       
-           break;
-           
-         case (0xF000):                       { Exception_Handler(11);      break; }// Checked
-   
-      default: ;
+        case OPC_BOOL_I_TO_CCR_1:     op_BOOL_I_TO_CCR(1);       break;
+        case OPC_BOOL_I_TO_SR_1:      op_BOOL_I_TO_SR(1);        break;
+        case OPC_BOOL_I_TO_CCR_3:     op_BOOL_I_TO_CCR(3);       break;
+        case OPC_BOOL_I_TO_SR_3:      op_BOOL_I_TO_SR(3);        break;
+        case OPC_BOOL_I_TO_CCR_2:     op_BOOL_I_TO_CCR(2);       break;
+        case OPC_BOOL_I_TO_SR_2:      op_BOOL_I_TO_SR(2);        break;
+        case OPC_BMOD_31:             op_BMOD(0x31);             break;
+        case OPC_BMOD_21:             op_BMOD(0x21);             break;
+        case OPC_BMOD_11:             op_BMOD(0x11);             break;
+        case OPC_BMOD_01:             op_BMOD(0x01);             break;
+        case OPC_MOVEP:               op_MOVEP();                break;
+        case OPC_BOOL_I_3:            op_BOOL_I(3);              break;
+        case OPC_BOOL_I_1:            op_BOOL_I(1);              break;
+        case OPC_BOOL_I_2:            op_BOOL_I(2);              break;
+        case OPC_ADDSUBI_0:           op_ADDSUBI(0);             break;
+        case OPC_ADDSUBI_1:           op_ADDSUBI(1);             break;
+        case OPC_BOOL_I_4:            op_BOOL_I(4);              break;
+        case OPC_BMOD_30:             op_BMOD(0x30);             break;
+        case OPC_BMOD_20:             op_BMOD(0x20);             break;
+        case OPC_BMOD_10:             op_BMOD(0x10);             break;
+        case OPC_BMOD_00:             op_BMOD(0x00);             break;
+        case OPC_MOVE:                op_MOVE();                 break;
+        case OPC_MOVE_FROM_SR:        op_MOVE_FROM_SR();         break;
+        case OPC_MOVE_TO_CCR:         op_MOVE_TO_CCR();          break;
+        case OPC_MOVE_TO_SR:          op_MOVE_TO_SR();           break;
+        case OPC_NEGS_3:              op_NEGS(3);                break;
+        case OPC_NEGS_4:              op_NEGS(4);                break;
+        case OPC_NEGS_2:              op_NEGS(2);                break;
+        case OPC_NEGS_1:              op_NEGS(1);                break;
+        case OPC_EXT:                 op_EXT();                  break;
+        case OPC_NBCD:                op_NBCD();                 break;
+        case OPC_SWAP:                op_SWAP();                 break;
+        case OPC_PEA:                 op_PEA();                  break;
+        case OPC_TAS:                 op_TAS();                  break;
+        case OPC_TST:                 op_TST();                  break;
+        case OPC_TRAP:                op_TRAP();                 break;
+        case OPC_LINK:                op_LINK();                 break;
+        case OPC_UNLK:                op_UNLK();                 break;
+        case OPC_MOVE_USP:            op_MOVE_USP();             break;
+        case OPC_NOP:                 /* Do Nothing */           break;
+        case OPC_RESET:               op_RESET();                break;
+        case OPC_STOP:                op_STOP();                 break;
+        case OPC_RTE:                 op_RTE();                  break;
+        case OPC_RTS:                 op_RTS();                  break;
+        case OPC_TRAPV:               op_TRAPV();                break;
+        case OPC_RTR:                 op_RTR();                  break;
+        case OPC_JSR:                 op_JSR();                  break;
+        case OPC_JMP:                 op_JMP();                  break;
+        case OPC_MOVEM:               op_MOVEM();                break;
+        case OPC_LEA:                 op_LEA();                  break;
+        case OPC_CHK:                 op_CHK();                  break;
+        case OPC_DBCC:                op_dBCC();                 break;
+        case OPC_SCC:                 op_SCC();                  break;
+        case OPC_ADDSUBQ_1:           op_ADDSUBQ(1);             break;
+        case OPC_ADDSUBQ_0:           op_ADDSUBQ(0);             break;
+        case OPC_BSR:                 op_BSR();                  break;
+        case OPC_BCC:                 op_BCC();                  break;
+        case OPC_MOVEQ:               op_MOVEQ();                break;
+        case OPC_DIVU:                op_DIVU();                 break;
+        case OPC_DIVS:                op_DIVS();                 break;
+        case OPC_XBCD_1:              op_xBCD(1);                break;
+        case OPC_BOOL_1:              op_BOOL(1);                break;
+        case OPC_ADDSUBA_0:           op_ADDSUBA(0);             break;
+        case OPC_ADDSUBX_0:           op_ADDSUBX(0);             break;
+        case OPC_ADDSUB_0:            op_ADDSUB(0);              break;
+        case OPC_LINE_A:              Exception_Handler(10);     break;
+        case OPC_CMPA:                op_CMPA();                 break;
+        case OPC_CMPM:                op_CMPM();                 break;
+        case OPC_BOOL_3:              op_BOOL(3);                break;
+        case OPC_BOOL_4:              op_BOOL(4);                break;
+        case OPC_MULU:                op_MULU();                 break;
+        case OPC_MULS:                op_MULS();                 break;
+        case OPC_XBCD_0:              op_xBCD(0);                break;
+        case OPC_EXG:                 op_EXG();                  break;
+        case OPC_BOOL_2:              op_BOOL(2);                break;
+        case OPC_ADDSUBA_1:           op_ADDSUBA(1);             break;
+        case OPC_ADDSUBX_1:           op_ADDSUBX(1);             break;
+        case OPC_ADDSUB_1:            op_ADDSUB(1);              break;
+        case OPC_XSL_0_1:             op_xSL(0,1);               break;
+        case OPC_XSL_0_2:             op_xSL(0,2);               break;
+        case OPC_ROXL_0:              op_ROXL(0);                break;
+        case OPC_ROL_0:               op_ROL(0);                 break;
+        case OPC_XSR_1_2:             op_xSR(1,2);               break;
+        case OPC_XSR_2_2:             op_xSR(2,2);               break;
+        case OPC_ROXR_0:              op_ROXR(0);                break;
+        case OPC_ROR_0:               op_ROR(0);                 break;
+        case OPC_XSL_1_1:             op_xSL(1,1);               break;
+        case OPC_XSL_1_2:             op_xSL(1,2);               break;
+        case OPC_ROXL_1:              op_ROXL(1);                break;
+        case OPC_ROL_1:               op_ROL(1);                 break;
+        case OPC_XSR_1_1:             op_xSR(1,1);               break;
+        case OPC_XSR_2_1:             op_xSR(2,1);               break;
+        case OPC_ROXR_1:              op_ROXR(1);                break;
+        case OPC_ROR_1:               op_ROR(1);                 break;
+        case OPC_LINE_F:              Exception_Handler(11);     break;
+        default:                      Exception_Handler(4);      break;
      }
 
 
@@ -0,0 +1,115 @@
+//
+//
+//  File Name   :  host_bus.h
+//  Used on     :  MCL64 host benchmark build
+//  Author      :  Ted Fried, MicroCore Labs
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//   
+//  Host_Bus replaces Teensy_Bus when MCL64.ino is compiled on Linux with
+//  -DHOST_BUILD. The timing policies in timing.h inherit these hooks, so the 
+//  6510 core performs exactly the bus cycles it would on the board and each 
+//  CLK rising edge is one cycle of a simulated C64 in host_main.cpp.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Ted Fried
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#ifndef HOST_BUS_H
+#define HOST_BUS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#define FASTRUN
+
+
+// --------------------------------------------------------------------------------------------------
+// Simulated C64 - implemented in host_main.cpp
+// --------------------------------------------------------------------------------------------------
+
+extern uint8_t   direct_datain;                     // Declared in MCL64.ino
+extern uint8_t   direct_reset;
+extern uint8_t   direct_ready_n;
+extern uint8_t   direct_irq;
+extern uint8_t   direct_nmi;
+
+extern uint16_t  host_address;
+extern uint8_t   host_rdwr_n;
+extern uint8_t   host_data;
+extern uint8_t   host_port;                         // 6510 processor port P2:P0 as seen by the PLA
+extern uint8_t   host_irq;
+extern uint64_t  host_clocks;
+
+uint8_t  host_bus_read(uint16_t local_address);
+void     host_bus_write(uint16_t local_address, uint8_t local_data);
+void     host_instruction();                        // Counts instructions, raises the timer IRQ and ends the run
+
+
+struct Host_Bus {
+
+  static inline void setup()  {  host_port = 0x7;  return;  }
+
+  static inline void wait_for_CLK_rising_edge()  {
+    host_clocks++;
+    if (host_rdwr_n==1) direct_datain = host_bus_read(host_address);
+    direct_irq     = host_irq;
+    direct_ready_n = 0;
+    direct_reset   = 0;
+    direct_nmi     = 0;
+    return;
+  }
+
+  static inline void wait_for_CLK_falling_edge()                {  return;  }
+  static inline void send_address(uint32_t local_address)       {  host_address = local_address;  return;  }
+  static inline void drive_RDWR_n(uint8_t local_data)           {  host_rdwr_n = local_data;  return;  }
+  static inline void drive_data(uint8_t local_data)             {  host_data = local_data;  return;  }
+  static inline void drive_processor_port(uint8_t local_data)   {  host_port = local_data & 0x7;  return;  }
+  static inline uint8_t reset_asserted()                        {  return 0;  }
+
+  // The C64 latches the write data while the bus drivers are enabled
+  //
+  static inline void drive_data_OE_n(uint8_t local_data)  {
+    if (local_data==0 && host_rdwr_n==0) host_bus_write(host_address, host_data);
+    return;
+  }
+
+  static inline void startup_delay()                  {  return;  }
+  static inline void instruction_boundary()           {  host_instruction();  return;  }
+  static inline int  uart_read()                      {  return -1;  }
+  static inline void uart_println(const char * text)  {  printf("%s\n", text);  return;  }
+};
+
+#endif
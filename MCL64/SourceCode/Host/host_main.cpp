@@ -0,0 +1,231 @@
+//
+//
+//  File Name   :  host_main.cpp
+//  Used on     :  MCL64 host benchmark build
+//  Author      :  Ted Fried, MicroCore Labs
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//   
+//  Runs the MCL64 6510 core on Linux against a simulated C64 and reports
+//  emulated instructions per second and clocks per instruction. The C64 boots
+//  its KERNAL and BASIC from the ROM images in MCL64.ino, and the run passes
+//  when the BASIC READY. prompt is on the screen at the end.
+//
+//  Build:   g++ -O2 -DHOST_BUILD -I. host_main.cpp -o mcl64_host
+//           g++ -O2 -DHOST_BUILD -DMCL64_TIMING=Cycle_Accurate_Timing -I. host_main.cpp -o mcl64_host_ca
+//
+//  Usage:   ./mcl64_host [-n instructions] [-m mode] [-t] [-s]
+//
+//      -n   Number of 6510 instructions to run             (default 3000000)
+//      -m   Acceleration mode 0,1,2,3                       (default from the timing policy)
+//      -t   Raise IRQ every 16421 clocks like the CIA1 timer and acknowledge it on DC0D reads
+//      -s   Print the screen at the end of the run
+//
+//  Exit status is 0 when READY. is found in screen memory and 1 otherwise.
+//
+//  Simulated C64:
+//      64KB RAM, BASIC and KERNAL ROMs banked by the processor port like the PLA
+//      D000-DFFF    I/O - registers read back the last value written except:
+//        D011/D012  Raster line counts 0-311 at 63 clocks per line
+//        DC01       No keys pressed
+//        DC0D       Returns and clears the timer interrupt from -t
+//      Character ROM reads return 0x00 and cartridges are not modelled
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Ted Fried
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_bus.h"
+#include "../MCL64/MCL64.ino"
+
+
+#define HOST_TIMER_PERIOD   16421                   // CIA1 timer A as set by the KERNAL for PAL
+#define HOST_RASTER_CLOCKS  63
+#define HOST_RASTER_LINES   312
+
+uint8_t  host_ram[0x10000];
+uint8_t  host_io[0x1000];
+
+uint16_t host_address=0;
+uint8_t  host_rdwr_n=1;
+uint8_t  host_data=0;
+uint8_t  host_port=0x7;
+uint8_t  host_irq=0;
+uint8_t  host_timer_enable=0;
+uint8_t  host_show_screen=0;
+uint64_t host_clocks=0;
+uint64_t host_instructions=0;
+uint64_t host_instruction_budget=3000000;
+uint64_t host_next_tick=HOST_TIMER_PERIOD;
+
+struct timespec host_start_time;
+
+
+// -------------------------------------------------
+// Simulated C64 memory map
+// -------------------------------------------------
+uint8_t host_io_visible(uint16_t local_address) {
+
+  if (local_address<0xD000 || local_address>0xDFFF)  return 0;
+  if ((host_port&0x3)==0x0)                           return 0;       // All RAM
+  return 1;
+}
+
+uint8_t host_bus_read(uint16_t local_address) {
+  uint16_t raster;
+
+  if (local_address>=0xA000 && local_address<=0xBFFF && (host_port&0x3)==0x3)  return BASIC_ROM[local_address&0x1FFF];
+  if (local_address>=0xE000 && (host_port&0x2)==0x2)                            return KERNAL_ROM[local_address&0x1FFF];
+  if (host_io_visible(local_address)==0)                                        return host_ram[local_address];
+  if ((host_port&0x4)==0x0)                                                     return 0x00;    // Character ROM
+  
+  raster = (host_clocks/HOST_RASTER_CLOCKS) % HOST_RASTER_LINES;
+  switch (local_address)  {
+    case 0xD011:  return (host_io[0x011]&0x7F) | ((raster>>1)&0x80);
+    case 0xD012:  return raster&0xFF;
+    case 0xDC01:  return 0xFF;
+    case 0xDC0D:  if (host_irq==1)  {  host_irq=0;  return 0x81;  }  else return 0x00;
+    default:      return host_io[local_address&0xFFF];
+  }
+}
+
+void host_bus_write(uint16_t local_address, uint8_t local_data) {
+
+  if (host_io_visible(local_address)==1 && (host_port&0x4)==0x4)  host_io[local_address&0xFFF] = local_data;
+  else                                                            host_ram[local_address] = local_data;
+  return;
+}
+
+
+// -------------------------------------------------
+// Look for the BASIC prompt in screen memory at 0x0400
+// -------------------------------------------------
+uint8_t host_screen_ready(const uint8_t * screen) {
+  const uint8_t ready[6] = { 0x12, 0x05, 0x01, 0x04, 0x19, 0x2E };        // READY. in screen codes
+
+  for (int i=0 ; i<1000-6 ; i++)  {
+    if (memcmp(screen+i, ready, 6)==0)  return 1;
+  }
+  return 0;
+}
+
+void host_print_screen(const uint8_t * screen) {
+  uint8_t code;
+
+  for (int row=0 ; row<25 ; row++)  {
+    printf("  |");
+    for (int col=0 ; col<40 ; col++)  {
+      code = screen[row*40+col] & 0x7F;
+      if      (code==0x00)   putchar('@');
+      else if (code<=0x1A)   putchar('A'+code-1);
+      else if (code<=0x3F)   putchar(code);
+      else                   putchar('.');
+    }
+    printf("|\n");
+  }
+  return;
+}
+
+
+// -------------------------------------------------
+// Report at the end of the instruction budget
+// -------------------------------------------------
+void host_finish() {
+  struct timespec end_time;
+  double seconds;
+  uint8_t bus_ready, internal_ready;
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+  seconds = (end_time.tv_sec-host_start_time.tv_sec) + (end_time.tv_nsec-host_start_time.tv_nsec)/1e9;
+
+  bus_ready      = host_screen_ready(host_ram+0x400);
+  internal_ready = host_screen_ready(internal_RAM+0x400);       // Mode 3 keeps screen writes internal
+
+  printf("MCL64 host benchmark\n");
+  printf("  timing policy           : %s\n",   TIMING::cycle_accurate ? "Cycle_Accurate_Timing" : "Accelerated_Timing");
+  printf("  acceleration mode       : %u\n",   mode);
+  printf("  clocks                  : %llu\n", (unsigned long long)host_clocks);
+  printf("  instructions            : %llu\n", (unsigned long long)host_instructions);
+  printf("  host seconds            : %.3f\n", seconds);
+  printf("  instructions per second : %.0f\n", host_instructions/seconds);
+  printf("  clocks per instruction  : %.2f\n", (double)host_clocks/host_instructions);
+  printf("  final PC                : %04X\n", register_pc);
+  printf("  READY. on screen        : bus %s, internal %s\n", bus_ready ? "yes" : "no", internal_ready ? "yes" : "no");
+
+  if (host_show_screen==1)  host_print_screen(mode==3 ? internal_RAM+0x400 : host_ram+0x400);
+
+  exit((bus_ready || internal_ready) ? 0 : 1);
+}
+
+void host_instruction() {
+
+  host_instructions++;
+  
+  if (host_timer_enable==1 && host_clocks+host_instructions >= host_next_tick)  {
+    host_irq = 1;
+    host_next_tick = host_next_tick + HOST_TIMER_PERIOD;
+  }
+  direct_irq = host_irq;                                         // Also seen when mode 3 runs without CLK edges
+
+  if (host_instructions >= host_instruction_budget)  host_finish();
+  return;
+}
+
+
+// -------------------------------------------------
+// Benchmark driver
+// -------------------------------------------------
+int main(int argc, char *argv[]) {
+  int host_mode = -1;
+
+  for (int i=1 ; i<argc ; i++)  {
+         if (strcmp(argv[i],"-n")==0 && i+1<argc)  host_instruction_budget = strtoull(argv[++i], NULL, 0);
+    else if (strcmp(argv[i],"-m")==0 && i+1<argc)  host_mode = atoi(argv[++i]) & 0x3;
+    else if (strcmp(argv[i],"-t")==0)              host_timer_enable = 1;
+    else if (strcmp(argv[i],"-s")==0)              host_show_screen = 1;
+    else  {  printf("Usage: %s [-n instructions] [-m mode] [-t] [-s]\n", argv[0]);  return 1;  }
+  }
+
+  if (host_mode>=0)  mode = host_mode;
+
+  setup();
+  
+  clock_gettime(CLOCK_MONOTONIC, &host_start_time);
+  loop();                                                        // Returns through host_finish()
+  return 1;
+}
@@ -1,6 +1,6 @@
 //
 //
-//  File Name   :  MCL64_Fastest.c
+//  File Name   :  MCL64.ino
 //  Used on     :  
 //  Author      :  Ted Fried, MicroCore Labs
 //  Creation    :  3/12/2021
@@ -10,8 +10,10 @@
 //   
 //  MOS 6510 emulator with bus interface.
 //
-// This code has most of the code to support 6502 cycle accuracy removed
-// to allow for an additional accelertaion boost. 
+// The cycle accurate and accelerated versions share this one core. The
+// timing policy selected below decides at compile time whether the 6502's
+// discarded bus cycles are performed - see timing.h. The same core builds
+// on Linux with -DHOST_BUILD for benchmarking and regression tests - see ../Host
 //
 // The acceleration modes can be changed via the UART from the host.
 // Entering a 0,1,2,3 will change the acceleration mode to this value
@@ -34,6 +36,12 @@
 // Revision 3 12/10/2021
 // Made optimiations for acceleration and UART control
 //
+// Revision 4 10/18/2026
+// Memory accesses use a 256-entry page table rebuilt on processor port, mode and EXROM/GAME changes
+//
+// Revision 5 10/18/2026
+// Merged the Cycle_Accurate_6510 and Maximum_Acceleration_6510 versions into one core with compile-time timing policies
+//
 //
 //------------------------------------------------------------------------
 //
@@ -61,53 +69,25 @@
 
 #include <stdint.h>
 
-// Teensy 4.1 pin assignments
+#ifdef HOST_BUILD
+#include "host_bus.h"       // Simulated C64 used by the Linux benchmark build
+#define MCL64_BUS  Host_Bus
+#else
+#include "teensy_bus.h"
+#define MCL64_BUS  Teensy_Bus
+#endif
+
+#include "timing.h"
+
+
+// Timing policy:  Cycle_Accurate_Timing  or  Accelerated_Timing
 //
-#define PIN_CLK0            24
-#define PIN_READY_n         26
-#define PIN_IRQ             25
-#define PIN_NMI             41
-#define PIN_RESET           40
-#define PIN_RDWR_n          12
-#define PIN_P0              22
-#define PIN_P1              13
-#define PIN_P2              39
-                    
-#define PIN_ADDR0           27 
-#define PIN_ADDR1           38 
-#define PIN_ADDR2           28 
-#define PIN_ADDR3           37 
-#define PIN_ADDR4           29 
-#define PIN_ADDR5           36 
-#define PIN_ADDR6           30 
-#define PIN_ADDR7           35         
-#define PIN_ADDR8           31 
-#define PIN_ADDR9           34 
-#define PIN_ADDR10          32 
-#define PIN_ADDR11          33 
-#define PIN_ADDR12          1  
-#define PIN_ADDR13          0  
-#define PIN_ADDR14          2  
-#define PIN_ADDR15          23 
-        
-#define PIN_DATAIN0         14 
-#define PIN_DATAIN1         15 
-#define PIN_DATAIN2         16 
-#define PIN_DATAIN3         17 
-#define PIN_DATAIN4         18 
-#define PIN_DATAIN5         19 
-#define PIN_DATAIN6         20 
-#define PIN_DATAIN7         21 
-        
-#define PIN_DATAOUT0        11 
-#define PIN_DATAOUT1        10 
-#define PIN_DATAOUT2        9 
-#define PIN_DATAOUT3        8 
-#define PIN_DATAOUT4        7 
-#define PIN_DATAOUT5        6 
-#define PIN_DATAOUT6        5 
-#define PIN_DATAOUT7        4 
-#define PIN_DATAOUT_OE_n    3 
+#ifndef MCL64_TIMING
+#define MCL64_TIMING  Accelerated_Timing
+#endif
+
+typedef MCL64_TIMING<MCL64_BUS>  TIMING;
+
 
 
 // 6502 Flags
@@ -122,11 +102,11 @@
 
 
 
-#define Page_128_159  ( (current_address >= 0x8000) && (current_address <= 0x9FFF) ) ? 0x1 : 0x0 
-#define Page_160_191  ( (current_address >= 0xA000) && (current_address <= 0xBFFF) ) ? 0x1 : 0x0 
-#define Page_224_255  ( (current_address >= 0xE000) && (current_address <= 0xFFFF) ) ? 0x1 : 0x0 
-
-#define bank_mode  ( 0x18 | (current_p&0x7)  )
+// Processor port bits at address 0x1
+//
+#define port_loram   (current_p & 0x1)
+#define port_hiram   (current_p & 0x2)
+#define port_charen  (current_p & 0x4)
 
 
 // 6502 stack always in Page 1
@@ -154,13 +134,28 @@ uint8_t   assert_sync=0;
 uint8_t   global_temp=0;
 uint8_t   last_access_internal_RAM=0;
 uint8_t   ea_data=0;
-uint8_t   mode=1;
+uint8_t   mode=TIMING::initial_mode;
+
+// C64 cartridge port lines, high when no cartridge is installed. These are not 
+// wired to the MCL64 so set them to match the cartridge and call Rebuild_Page_Table()
+//
+uint8_t   cartridge_exrom=1;
+uint8_t   cartridge_game=1;
 
 uint16_t  register_pc=0;
 uint16_t  current_address=0;
 uint16_t  effective_address=0;
 
 uint8_t   internal_RAM[65536];
+uint8_t   discard_page[256];
+
+// Memory map for each 256 byte page, rebuilt only when the processor port, mode or cartridge lines change
+//
+uint8_t * page_read[256];
+uint8_t * page_write[256];
+uint8_t   page_mode[256];
+
+void Rebuild_Page_Table();
 uint8_t   BASIC_ROM[0x2000]={ 0x94,0xe3,0x7b,0xe3,0x43,0x42,0x4d,0x42,0x41,0x53,0x49,0x43,0x30,0xa8,0x41,0xa7,0x1d,0xad,0xf7,0xa8,0xa4,0xab,0xbe,0xab,0x80,0xb0,0x5,0xac,0xa4,0xa9,0x9f,0xa8,0x70,0xa8,0x27,0xa9,0x1c,0xa8,0x82,0xa8,0xd1,0xa8,0x3a,0xa9,0x2e,0xa8,0x4a,0xa9,0x2c,0xb8,0x67,0xe1,0x55,0xe1,0x64,0xe1,0xb2,0xb3,0x23,0xb8,0x7f,0xaa,0x9f,0xaa,0x56,0xa8,0x9b,0xa6,0x5d,0xa6,0x85,0xaa,0x29,0xe1,0xbd,0xe1,0xc6,0xe1,0x7a,0xab,0x41,0xa6,0x39,0xbc,0xcc,0xbc,0x58,0xbc,0x10,0x3,0x7d,0xb3,0x9e,0xb3,0x71,0xbf,0x97,0xe0,0xea,0xb9,0xed,0xbf,0x64,0xe2,0x6b,0xe2,0xb4,0xe2,0xe,0xe3,0xd,0xb8,0x7c,0xb7,0x65,0xb4,0xad,0xb7,0x8b,0xb7,0xec,0xb6,0x0,0xb7,0x2c,0xb7,0x37,0xb7,0x79,0x69,0xb8,0x79,0x52,0xb8,0x7b,0x2a,0xba,0x7b,0x11,0xbb,0x7f,0x7a,0xbf,0x50,0xe8,0xaf,0x46,0xe5,0xaf,0x7d,0xb3,0xbf,0x5a,0xd3,0xae,0x64,0x15,0xb0,0x45,0x4e,0xc4,0x46,0x4f,0xd2,0x4e,0x45,0x58,0xd4,0x44,0x41,0x54,0xc1,0x49,0x4e,0x50,0x55,0x54,0xa3,0x49,0x4e,0x50,0x55,0xd4,0x44,0x49,0xcd,0x52,0x45,0x41,0xc4,0x4c,0x45,0xd4,0x47,0x4f,0x54,0xcf,0x52,0x55,0xce,0x49,0xc6,0x52,0x45,0x53,0x54,0x4f,0x52,0xc5,0x47,0x4f,0x53,0x55,0xc2,0x52,0x45,0x54,0x55,0x52,0xce,0x52,0x45,0xcd,0x53,0x54,0x4f,0xd0,0x4f,0xce,0x57,0x41,0x49,0xd4,0x4c,0x4f,0x41,0xc4,0x53,0x41,0x56,0xc5,0x56,0x45,0x52,0x49,0x46,0xd9,0x44,0x45,0xc6,0x50,0x4f,0x4b,0xc5,0x50,0x52,0x49,0x4e,0x54,0xa3,0x50,0x52,0x49,0x4e,0xd4,0x43,0x4f,0x4e,0xd4,0x4c,0x49,0x53,0xd4,0x43,0x4c,0xd2,0x43,0x4d,0xc4,0x53,0x59,0xd3,0x4f,0x50,0x45,0xce,0x43,0x4c,0x4f,0x53,0xc5,0x47,0x45,0xd4,0x4e,0x45,0xd7,0x54,0x41,0x42,0xa8,0x54,0xcf,0x46,0xce,0x53,0x50,0x43,0xa8,0x54,0x48,0x45,0xce,0x4e,0x4f,0xd4,0x53,0x54,0x45,0xd0,0xab,0xad,0xaa,0xaf,0xde,0x41,0x4e,0xc4,0x4f,0xd2,0xbe,0xbd,0xbc,0x53,0x47,0xce,0x49,0x4e,0xd4,0x41,0x42,0xd3,0x55,0x53,0xd2,0x46,0x52,0xc5,0x50,0x4f,0xd3,0x53,0x51,0xd2,0x52,0x4e,0xc4,0x4c,0x4f,0xc7,0x45,0x58,0xd0,0x43,0x4f,0xd3,0x53,0x49,0xce,0x54,0x41,0xce,0x41,0x54,0xce,0x50,0x45,0x45,0xcb,0x4c,0x45,0xce,0x53,0x54,0x52,0xa4,0x56,0x41,0xcc,0x41,0x53,0xc3,0x43,0x48,0x52,0xa4,0x4c,0x45,0x46,0x54,0xa4,0x52,0x49,0x47,0x48,0x54,0xa4,0x4d,0x49,0x44,0xa4,0x47,0xcf,0x0,0x54,0x4f,0x4f,0x20,0x4d,0x41,0x4e,0x59,0x20,0x46,0x49,0x4c,0x45,0xd3,0x46,0x49,0x4c,0x45,0x20,0x4f,0x50,0x45,0xce,0x46,0x49,0x4c,0x45,0x20,0x4e,0x4f,0x54,0x20,0x4f,0x50,0x45,0xce,0x46,0x49,0x4c,0x45,0x20,0x4e,0x4f,0x54,0x20,0x46,0x4f,0x55,0x4e,0xc4,0x44,0x45,0x56,0x49,0x43,0x45,0x20,0x4e,0x4f,0x54,0x20,0x50,0x52,0x45,0x53,0x45,0x4e,0xd4,0x4e,0x4f,0x54,0x20,0x49,0x4e,0x50,0x55,0x54,0x20,0x46,0x49,0x4c,0xc5,0x4e,0x4f,0x54,0x20,0x4f,0x55,0x54,0x50,0x55,0x54,0x20,0x46,0x49,0x4c,0xc5,0x4d,0x49,0x53,0x53,0x49,0x4e,0x47,0x20,0x46,0x49,0x4c,0x45,0x20,0x4e,0x41,0x4d,0xc5,0x49,0x4c,0x4c,0x45,0x47,0x41,0x4c,0x20,0x44,0x45,0x56,0x49,0x43,0x45,0x20,0x4e,0x55,0x4d,0x42,0x45,0xd2,0x4e,0x45,0x58,0x54,0x20,0x57,0x49,0x54,0x48,0x4f,0x55,0x54,0x20,0x46,0x4f,0xd2,0x53,0x59,0x4e,0x54,0x41,0xd8,0x52,0x45,0x54,0x55,0x52,0x4e,0x20,0x57,0x49,0x54,0x48,0x4f,0x55,0x54,0x20,0x47,0x4f,0x53,0x55,0xc2,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x44,0x41,0x54,0xc1,0x49,0x4c,0x4c,0x45,0x47,0x41,0x4c,0x20,0x51,0x55,0x41,0x4e,0x54,0x49,0x54,0xd9,0x4f,0x56,0x45,0x52,0x46,0x4c,0x4f,0xd7,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x4d,0x45,0x4d,0x4f,0x52,0xd9,0x55,0x4e,0x44,0x45,0x46,0x27,0x44,0x20,0x53,0x54,0x41,0x54,0x45,0x4d,0x45,0x4e,0xd4,0x42,0x41,0x44,0x20,0x53,0x55,0x42,0x53,0x43,0x52,0x49,0x50,0xd4,0x52,0x45,0x44,0x49,0x4d,0x27,0x44,0x20,0x41,0x52,0x52,0x41,0xd9,0x44,0x49,0x56,0x49,0x53,0x49,0x4f,0x4e,0x20,0x42,0x59,0x20,0x5a,0x45,0x52,0xcf,0x49,0x4c,0x4c,0x45,0x47,0x41,0x4c,0x20,0x44,0x49,0x52,0x45,0x43,0xd4,0x54,0x59,0x50,0x45,0x20,0x4d,0x49,0x53,0x4d,0x41,0x54,0x43,0xc8,0x53,0x54,0x52,0x49,0x4e,0x47,0x20,0x54,0x4f,0x4f,0x20,0x4c,0x4f,0x4e,0xc7,0x46,0x49,0x4c,0x45,0x20,0x44,0x41,0x54,0xc1,0x46,0x4f,0x52,0x4d,0x55,0x4c,0x41,0x20,0x54,0x4f,0x4f,0x20,0x43,0x4f,0x4d,0x50,0x4c,0x45,0xd8,0x43,0x41,0x4e,0x27,0x54,0x20,0x43,0x4f,0x4e,0x54,0x49,0x4e,0x55,0xc5,0x55,0x4e,0x44,0x45,0x46,0x27,0x44,0x20,0x46,0x55,0x4e,0x43,0x54,0x49,0x4f,0xce,0x56,0x45,0x52,0x49,0x46,0xd9,0x4c,0x4f,0x41,0xc4,0x9e,0xa1,0xac,0xa1,0xb5,0xa1,0xc2,0xa1,0xd0,0xa1,0xe2,0xa1,0xf0,0xa1,0xff,0xa1,0x10,0xa2,0x25,0xa2,0x35,0xa2,0x3b,0xa2,0x4f,0xa2,0x5a,0xa2,0x6a,0xa2,0x72,0xa2,0x7f,0xa2,0x90,0xa2,0x9d,0xa2,0xaa,0xa2,0xba,0xa2,0xc8,0xa2,0xd5,0xa2,0xe4,0xa2,0xed,0xa2,0x0,0xa3,0xe,0xa3,0x1e,0xa3,0x24,0xa3,0x83,0xa3,0xd,0x4f,0x4b,0xd,0x0,0x20,0x20,0x45,0x52,0x52,0x4f,0x52,0x0,0x20,0x49,0x4e,0x20,0x0,0xd,0xa,0x52,0x45,0x41,0x44,0x59,0x2e,0xd,0xa,0x0,0xd,0xa,0x42,0x52,0x45,0x41,0x4b,0x0,0xa0,0xba,0xe8,0xe8,0xe8,0xe8,0xbd,0x1,0x1,0xc9,0x81,0xd0,0x21,0xa5,0x4a,0xd0,0xa,0xbd,0x2,0x1,0x85,0x49,0xbd,0x3,0x1,0x85,0x4a,0xdd,0x3,0x1,0xd0,0x7,0xa5,0x49,0xdd,0x2,0x1,0xf0,0x7,0x8a,0x18,0x69,0x12,0xaa,0xd0,0xd8,0x60,0x20,0x8,0xa4,0x85,0x31,0x84,0x32,0x38,0xa5,0x5a,0xe5,0x5f,0x85,0x22,0xa8,0xa5,0x5b,0xe5,0x60,0xaa,0xe8,0x98,0xf0,0x23,0xa5,0x5a,0x38,0xe5,0x22,0x85,0x5a,0xb0,0x3,0xc6,0x5b,0x38,0xa5,0x58,0xe5,0x22,0x85,0x58,0xb0,0x8,0xc6,0x59,0x90,0x4,0xb1,0x5a,0x91,0x58,0x88,0xd0,0xf9,0xb1,0x5a,0x91,0x58,0xc6,0x5b,0xc6,0x59,0xca,0xd0,0xf2,0x60,0xa,0x69,0x3e,0xb0,0x35,0x85,0x22,0xba,0xe4,0x22,0x90,0x2e,0x60,0xc4,0x34,0x90,0x28,0xd0,0x4,0xc5,0x33,0x90,0x22,0x48,0xa2,0x9,0x98,0x48,0xb5,0x57,0xca,0x10,0xfa,0x20,0x26,0xb5,0xa2,0xf7,0x68,0x95,0x61,0xe8,0x30,0xfa,0x68,0xa8,0x68,0xc4,0x34,0x90,0x6,0xd0,0x5,0xc5,0x33,0xb0,0x1,0x60,0xa2,0x10,0x6c,0x0,0x3,0x8a,0xa,0xaa,0xbd,0x26,0xa3,0x85,0x22,0xbd,0x27,0xa3,0x85,0x23,0x20,0xcc,0xff,0xa9,0x0,0x85,0x13,0x20,0xd7,0xaa,0x20,0x45,0xab,0xa0,0x0,0xb1,0x22,0x48,0x29,0x7f,0x20,0x47,0xab,0xc8,0x68,0x10,0xf4,0x20,0x7a,0xa6,0xa9,0x69,0xa0,0xa3,0x20,0x1e,0xab,0xa4,0x3a,0xc8,0xf0,0x3,0x20,0xc2,0xbd,0xa9,0x76,0xa0,0xa3,0x20,0x1e,0xab,0xa9,0x80,0x20,0x90,0xff,0x6c,0x2,0x3,0x20,0x60,0xa5,0x86,0x7a,0x84,0x7b,0x20,0x73,0x0,0xaa,0xf0,0xf0,0xa2,0xff,0x86,0x3a,0x90,0x6,0x20,0x79,0xa5,0x4c,0xe1,0xa7,0x20,0x6b,0xa9,0x20,0x79,0xa5,0x84,0xb,0x20,0x13,0xa6,0x90,0x44,0xa0,0x1,0xb1,0x5f,0x85,0x23,0xa5,0x2d,0x85,0x22,0xa5,0x60,0x85,0x25,0xa5,0x5f,0x88,0xf1,0x5f,0x18,0x65,0x2d,0x85,0x2d,0x85,0x24,0xa5,0x2e,0x69,0xff,0x85,0x2e,0xe5,0x60,0xaa,0x38,0xa5,0x5f,0xe5,0x2d,0xa8,0xb0,0x3,0xe8,0xc6,0x25,0x18,0x65,0x22,0x90,0x3,0xc6,0x23,0x18,0xb1,0x22,0x91,0x24,0xc8,0xd0,0xf9,0xe6,0x23,0xe6,0x25,0xca,0xd0,0xf2,0x20,0x59,0xa6,0x20,0x33,0xa5,0xad,0x0,0x2,0xf0,0x88,0x18,0xa5,0x2d,0x85,0x5a,0x65,0xb,0x85,0x58,0xa4,0x2e,0x84,0x5b,0x90,0x1,0xc8,0x84,0x59,0x20,0xb8,0xa3,0xa5,0x14,0xa4,0x15,0x8d,0xfe,0x1,0x8c,0xff,0x1,0xa5,0x31,0xa4,0x32,0x85,0x2d,0x84,0x2e,0xa4,0xb,0x88,0xb9,0xfc,0x1,0x91,0x5f,0x88,0x10,0xf8,0x20,0x59,0xa6,0x20,0x33,0xa5,0x4c,0x80,0xa4,0xa5,0x2b,0xa4,0x2c,0x85,0x22,0x84,0x23,0x18,0xa0,0x1,0xb1,0x22,0xf0,0x1d,0xa0,0x4,0xc8,0xb1,0x22,0xd0,0xfb,0xc8,0x98,0x65,0x22,0xaa,0xa0,0x0,0x91,0x22,0xa5,0x23,0x69,0x0,0xc8,0x91,0x22,0x86,0x22,0x85,0x23,0x90,0xdd,0x60,0xa2,0x0,0x20,0x12,0xe1,0xc9,0xd,0xf0,0xd,0x9d,0x0,0x2,0xe8,0xe0,0x59,0x90,0xf1,0xa2,0x17,0x4c,0x37,0xa4,0x4c,0xca,0xaa,0x6c,0x4,0x3,0xa6,0x7a,0xa0,0x4,0x84,0xf,0xbd,0x0,0x2,0x10,0x7,0xc9,0xff,0xf0,0x3e,0xe8,0xd0,0xf4,0xc9,0x20,0xf0,0x37,0x85,0x8,0xc9,0x22,0xf0,0x56,0x24,0xf,0x70,0x2d,0xc9,0x3f,0xd0,0x4,0xa9,0x99,0xd0,0x25,0xc9,0x30,0x90,0x4,0xc9,0x3c,0x90,0x1d,0x84,0x71,0xa0,0x0,0x84,0xb,0x88,0x86,0x7a,0xca,0xc8,0xe8,0xbd,0x0,0x2,0x38,0xf9,0x9e,0xa0,0xf0,0xf5,0xc9,0x80,0xd0,0x30,0x5,0xb,0xa4,0x71,0xe8,0xc8,0x99,0xfb,0x1,0xb9,0xfb,0x1,0xf0,0x36,0x38,0xe9,0x3a,0xf0,0x4,0xc9,0x49,0xd0,0x2,0x85,0xf,0x38,0xe9,0x55,0xd0,0x9f,0x85,0x8,0xbd,0x0,0x2,0xf0,0xdf,0xc5,0x8,0xf0,0xdb,0xc8,0x99,0xfb,0x1,0xe8,0xd0,0xf0,0xa6,0x7a,0xe6,0xb,0xc8,0xb9,0x9d,0xa0,0x10,0xfa,0xb9,0x9e,0xa0,0xd0,0xb4,0xbd,0x0,0x2,0x10,0xbe,0x99,0xfd,0x1,0xc6,0x7b,0xa9,0xff,0x85,0x7a,0x60,0xa5,0x2b,0xa6,0x2c,0xa0,0x1,0x85,0x5f,0x86,0x60,0xb1,0x5f,0xf0,0x1f,0xc8,0xc8,0xa5,0x15,0xd1,0x5f,0x90,0x18,0xf0,0x3,0x88,0xd0,0x9,0xa5,0x14,0x88,0xd1,0x5f,0x90,0xc,0xf0,0xa,0x88,0xb1,0x5f,0xaa,0x88,0xb1,0x5f,0xb0,0xd7,0x18,0x60,0xd0,0xfd,0xa9,0x0,0xa8,0x91,0x2b,0xc8,0x91,0x2b,0xa5,0x2b,0x18,0x69,0x2,0x85,0x2d,0xa5,0x2c,0x69,0x0,0x85,0x2e,0x20,0x8e,0xa6,0xa9,0x0,0xd0,0x2d,0x20,0xe7,0xff,0xa5,0x37,0xa4,0x38,0x85,0x33,0x84,0x34,0xa5,0x2d,0xa4,0x2e,0x85,0x2f,0x84,0x30,0x85,0x31,0x84,0x32,0x20,0x1d,0xa8,0xa2,0x19,0x86,0x16,0x68,0xa8,0x68,0xa2,0xfa,0x9a,0x48,0x98,0x48,0xa9,0x0,0x85,0x3e,0x85,0x10,0x60,0x18,0xa5,0x2b,0x69,0xff,0x85,0x7a,0xa5,0x2c,0x69,0xff,0x85,0x7b,0x60,0x90,0x6,0xf0,0x4,0xc9,0xab,0xd0,0xe9,0x20,0x6b,0xa9,0x20,0x13,0xa6,0x20,0x79,0x0,0xf0,0xc,0xc9,0xab,0xd0,0x8e,0x20,0x73,0x0,0x20,0x6b,0xa9,0xd0,0x86,0x68,0x68,0xa5,0x14,0x5,0x15,0xd0,0x6,0xa9,0xff,0x85,0x14,0x85,0x15,0xa0,0x1,0x84,0xf,0xb1,0x5f,0xf0,0x43,0x20,0x2c,0xa8,0x20,0xd7,0xaa,0xc8,0xb1,0x5f,0xaa,0xc8,0xb1,0x5f,0xc5,0x15,0xd0,0x4,0xe4,0x14,0xf0,0x2,0xb0,0x2c,0x84,0x49,0x20,0xcd,0xbd,0xa9,0x20,0xa4,0x49,0x29,0x7f,0x20,0x47,0xab,0xc9,0x22,0xd0,0x6,0xa5,0xf,0x49,0xff,0x85,0xf,0xc8,0xf0,0x11,0xb1,0x5f,0xd0,0x10,0xa8,0xb1,0x5f,0xaa,0xc8,0xb1,0x5f,0x86,0x5f,0x85,0x60,0xd0,0xb5,0x4c,0x86,0xe3,0x6c,0x6,0x3,0x10,0xd7,0xc9,0xff,0xf0,0xd3,0x24,0xf,0x30,0xcf,0x38,0xe9,0x7f,0xaa,0x84,0x49,0xa0,0xff,0xca,0xf0,0x8,0xc8,0xb9,0x9e,0xa0,0x10,0xfa,0x30,0xf5,0xc8,0xb9,0x9e,0xa0,0x30,0xb2,0x20,0x47,0xab,0xd0,0xf5,0xa9,0x80,0x85,0x10,0x20,0xa5,0xa9,0x20,0x8a,0xa3,0xd0,0x5,0x8a,0x69,0xf,0xaa,0x9a,0x68,0x68,0xa9,0x9,0x20,0xfb,0xa3,0x20,0x6,0xa9,0x18,0x98,0x65,0x7a,0x48,0xa5,0x7b,0x69,0x0,0x48,0xa5,0x3a,0x48,0xa5,0x39,0x48,0xa9,0xa4,0x20,0xff,0xae,0x20,0x8d,0xad,0x20,0x8a,0xad,0xa5,0x66,0x9,0x7f,0x25,0x62,0x85,0x62,0xa9,0x8b,0xa0,0xa7,0x85,0x22,0x84,0x23,0x4c,0x43,0xae,0xa9,0xbc,0xa0,0xb9,0x20,0xa2,0xbb,0x20,0x79,0x0,0xc9,0xa9,0xd0,0x6,0x20,0x73,0x0,0x20,0x8a,0xad,0x20,0x2b,0xbc,0x20,0x38,0xae,0xa5,0x4a,0x48,0xa5,0x49,0x48,0xa9,0x81,0x48,0x20,0x2c,0xa8,0xa5,0x7a,0xa4,0x7b,0xc0,0x2,0xea,0xf0,0x4,0x85,0x3d,0x84,0x3e,0xa0,0x0,0xb1,0x7a,0xd0,0x43,0xa0,0x2,0xb1,0x7a,0x18,0xd0,0x3,0x4c,0x4b,0xa8,0xc8,0xb1,0x7a,0x85,0x39,0xc8,0xb1,0x7a,0x85,0x3a,0x98,0x65,0x7a,0x85,0x7a,0x90,0x2,0xe6,0x7b,0x6c,0x8,0x3,0x20,0x73,0x0,0x20,0xed,0xa7,0x4c,0xae,0xa7,0xf0,0x3c,0xe9,0x80,0x90,0x11,0xc9,0x23,0xb0,0x17,0xa,0xa8,0xb9,0xd,0xa0,0x48,0xb9,0xc,0xa0,0x48,0x4c,0x73,0x0,0x4c,0xa5,0xa9,0xc9,0x3a,0xf0,0xd6,0x4c,0x8,0xaf,0xc9,0x4b,0xd0,0xf9,0x20,0x73,0x0,0xa9,0xa4,0x20,0xff,0xae,0x4c,0xa0,0xa8,0x38,0xa5,0x2b,0xe9,0x1,0xa4,0x2c,0xb0,0x1,0x88,0x85,0x41,0x84,0x42,0x60,0x20,0xe1,0xff,0xb0,0x1,0x18,0xd0,0x3c,0xa5,0x7a,0xa4,0x7b,0xa6,0x3a,0xe8,0xf0,0xc,0x85,0x3d,0x84,0x3e,0xa5,0x39,0xa4,0x3a,0x85,0x3b,0x84,0x3c,0x68,0x68,0xa9,0x81,0xa0,0xa3,0x90,0x3,0x4c,0x69,0xa4,0x4c,0x86,0xe3,0xd0,0x17,0xa2,0x1a,0xa4,0x3e,0xd0,0x3,0x4c,0x37,0xa4,0xa5,0x3d,0x85,0x7a,0x84,0x7b,0xa5,0x3b,0xa4,0x3c,0x85,0x39,0x84,0x3a,0x60,0x8,0xa9,0x0,0x20,0x90,0xff,0x28,0xd0,0x3,0x4c,0x59,0xa6,0x20,0x60,0xa6,0x4c,0x97,0xa8,0xa9,0x3,0x20,0xfb,0xa3,0xa5,0x7b,0x48,0xa5,0x7a,0x48,0xa5,0x3a,0x48,0xa5,0x39,0x48,0xa9,0x8d,0x48,0x20,0x79,0x0,0x20,0xa0,0xa8,0x4c,0xae,0xa7,0x20,0x6b,0xa9,0x20,0x9,0xa9,0x38,0xa5,0x39,0xe5,0x14,0xa5,0x3a,0xe5,0x15,0xb0,0xb,0x98,0x38,0x65,0x7a,0xa6,0x7b,0x90,0x7,0xe8,0xb0,0x4,0xa5,0x2b,0xa6,0x2c,0x20,0x17,0xa6,0x90,0x1e,0xa5,0x5f,0xe9,0x1,0x85,0x7a,0xa5,0x60,0xe9,0x0,0x85,0x7b,0x60,0xd0,0xfd,0xa9,0xff,0x85,0x4a,0x20,0x8a,0xa3,0x9a,0xc9,0x8d,0xf0,0xb,0xa2,0xc,0x2c,0xa2,0x11,0x4c,0x37,0xa4,0x4c,0x8,0xaf,0x68,0x68,0x85,0x39,0x68,0x85,0x3a,0x68,0x85,0x7a,0x68,0x85,0x7b,0x20,0x6,0xa9,0x98,0x18,0x65,0x7a,0x85,0x7a,0x90,0x2,0xe6,0x7b,0x60,0xa2,0x3a,0x2c,0xa2,0x0,0x86,0x7,0xa0,0x0,0x84,0x8,0xa5,0x8,0xa6,0x7,0x85,0x7,0x86,0x8,0xb1,0x7a,0xf0,0xe8,0xc5,0x8,0xf0,0xe4,0xc8,0xc9,0x22,0xd0,0xf3,0xf0,0xe9,0x20,0x9e,0xad,0x20,0x79,0x0,0xc9,0x89,0xf0,0x5,0xa9,0xa7,0x20,0xff,0xae,0xa5,0x61,0xd0,0x5,0x20,0x9,0xa9,0xf0,0xbb,0x20,0x79,0x0,0xb0,0x3,0x4c,0xa0,0xa8,0x4c,0xed,0xa7,0x20,0x9e,0xb7,0x48,0xc9,0x8d,0xf0,0x4,0xc9,0x89,0xd0,0x91,0xc6,0x65,0xd0,0x4,0x68,0x4c,0xef,0xa7,0x20,0x73,0x0,0x20,0x6b,0xa9,0xc9,0x2c,0xf0,0xee,0x68,0x60,0xa2,0x0,0x86,0x14,0x86,0x15,0xb0,0xf7,0xe9,0x2f,0x85,0x7,0xa5,0x15,0x85,0x22,0xc9,0x19,0xb0,0xd4,0xa5,0x14,0xa,0x26,0x22,0xa,0x26,0x22,0x65,0x14,0x85,0x14,0xa5,0x22,0x65,0x15,0x85,0x15,0x6,0x14,0x26,0x15,0xa5,0x14,0x65,0x7,0x85,0x14,0x90,0x2,0xe6,0x15,0x20,0x73,0x0,0x4c,0x71,0xa9,0x20,0x8b,0xb0,0x85,0x49,0x84,0x4a,0xa9,0xb2,0x20,0xff,0xae,0xa5,0xe,0x48,0xa5,0xd,0x48,0x20,0x9e,0xad,0x68,0x2a,0x20,0x90,0xad,0xd0,0x18,0x68,0x10,0x12,0x20,0x1b,0xbc,0x20,0xbf,0xb1,0xa0,0x0,0xa5,0x64,0x91,0x49,0xc8,0xa5,0x65,0x91,0x49,0x60,0x4c,0xd0,0xbb,0x68,0xa4,0x4a,0xc0,0xbf,0xd0,0x4c,0x20,0xa6,0xb6,0xc9,0x6,0xd0,0x3d,0xa0,0x0,0x84,0x61,0x84,0x66,0x84,0x71,0x20,0x1d,0xaa,0x20,0xe2,0xba,0xe6,0x71,0xa4,0x71,0x20,0x1d,0xaa,0x20,0xc,0xbc,0xaa,0xf0,0x5,0xe8,0x8a,0x20,0xed,0xba,0xa4,0x71,0xc8,0xc0,0x6,0xd0,0xdf,0x20,0xe2,0xba,0x20,0x9b,0xbc,0xa6,0x64,0xa4,0x63,0xa5,0x65,0x4c,0xdb,0xff,0xb1,0x22,0x20,0x80,0x0,0x90,0x3,0x4c,0x48,0xb2,0xe9,0x2f,0x4c,0x7e,0xbd,0xa0,0x2,0xb1,0x64,0xc5,0x34,0x90,0x17,0xd0,0x7,0x88,0xb1,0x64,0xc5,0x33,0x90,0xe,0xa4,0x65,0xc4,0x2e,0x90,0x8,0xd0,0xd,0xa5,0x64,0xc5,0x2d,0xb0,0x7,0xa5,0x64,0xa4,0x65,0x4c,0x68,0xaa,0xa0,0x0,0xb1,0x64,0x20,0x75,0xb4,0xa5,0x50,0xa4,0x51,0x85,0x6f,0x84,0x70,0x20,0x7a,0xb6,0xa9,0x61,0xa0,0x0,0x85,0x50,0x84,0x51,0x20,0xdb,0xb6,0xa0,0x0,0xb1,0x50,0x91,0x49,0xc8,0xb1,0x50,0x91,0x49,0xc8,0xb1,0x50,0x91,0x49,0x60,0x20,0x86,0xaa,0x4c,0xb5,0xab,0x20,0x9e,0xb7,0xf0,0x5,0xa9,0x2c,0x20,0xff,0xae,0x8,0x86,0x13,0x20,0x18,0xe1,0x28,0x4c,0xa0,0xaa,0x20,0x21,0xab,0x20,0x79,0x0,0xf0,0x35,0xf0,0x43,0xc9,0xa3,0xf0,0x50,0xc9,0xa6,0x18,0xf0,0x4b,0xc9,0x2c,0xf0,0x37,0xc9,0x3b,0xf0,0x5e,0x20,0x9e,0xad,0x24,0xd,0x30,0xde,0x20,0xdd,0xbd,0x20,0x87,0xb4,0x20,0x21,0xab,0x20,0x3b,0xab,0xd0,0xd3,0xa9,0x0,0x9d,0x0,0x2,0xa2,0xff,0xa0,0x1,0xa5,0x13,0xd0,0x10,0xa9,0xd,0x20,0x47,0xab,0x24,0x13,0x10,0x5,0xa9,0xa,0x20,0x47,0xab,0x49,0xff,0x60,0x38,0x20,0xf0,0xff,0x98,0x38,0xe9,0xa,0xb0,0xfc,0x49,0xff,0x69,0x1,0xd0,0x16,0x8,0x38,0x20,0xf0,0xff,0x84,0x9,0x20,0x9b,0xb7,0xc9,0x29,0xd0,0x59,0x28,0x90,0x6,0x8a,0xe5,0x9,0x90,0x5,0xaa,0xe8,0xca,0xd0,0x6,0x20,0x73,0x0,0x4c,0xa2,0xaa,0x20,0x3b,0xab,0xd0,0xf2,0x20,0x87,0xb4,0x20,0xa6,0xb6,0xaa,0xa0,0x0,0xe8,0xca,0xf0,0xbc,0xb1,0x22,0x20,0x47,0xab,0xc8,0xc9,0xd,0xd0,0xf3,0x20,0xe5,0xaa,0x4c,0x28,0xab,0xa5,0x13,0xf0,0x3,0xa9,0x20,0x2c,0xa9,0x1d,0x2c,0xa9,0x3f,0x20,0xc,0xe1,0x29,0xff,0x60,0xa5,0x11,0xf0,0x11,0x30,0x4,0xa0,0xff,0xd0,0x4,0xa5,0x3f,0xa4,0x40,0x85,0x39,0x84,0x3a,0x4c,0x8,0xaf,0xa5,0x13,0xf0,0x5,0xa2,0x18,0x4c,0x37,0xa4,0xa9,0xc,0xa0,0xad,0x20,0x1e,0xab,0xa5,0x3d,0xa4,0x3e,0x85,0x7a,0x84,0x7b,0x60,0x20,0xa6,0xb3,0xc9,0x23,0xd0,0x10,0x20,0x73,0x0,0x20,0x9e,0xb7,0xa9,0x2c,0x20,0xff,0xae,0x86,0x13,0x20,0x1e,0xe1,0xa2,0x1,0xa0,0x2,0xa9,0x0,0x8d,0x1,0x2,0xa9,0x40,0x20,0xf,0xac,0xa6,0x13,0xd0,0x13,0x60,0x20,0x9e,0xb7,0xa9,0x2c,0x20,0xff,0xae,0x86,0x13,0x20,0x1e,0xe1,0x20,0xce,0xab,0xa5,0x13,0x20,0xcc,0xff,0xa2,0x0,0x86,0x13,0x60,0xc9,0x22,0xd0,0xb,0x20,0xbd,0xae,0xa9,0x3b,0x20,0xff,0xae,0x20,0x21,0xab,0x20,0xa6,0xb3,0xa9,0x2c,0x8d,0xff,0x1,0x20,0xf9,0xab,0xa5,0x13,0xf0,0xd,0x20,0xb7,0xff,0x29,0x2,0xf0,0x6,0x20,0xb5,0xab,0x4c,0xf8,0xa8,0xad,0x0,0x2,0xd0,0x1e,0xa5,0x13,0xd0,0xe3,0x20,0x6,0xa9,0x4c,0xfb,0xa8,0xa5,0x13,0xd0,0x6,0x20,0x45,0xab,0x20,0x3b,0xab,0x4c,0x60,0xa5,0xa6,0x41,0xa4,0x42,0xa9,0x98,0x2c,0xa9,0x0,0x85,0x11,0x86,0x43,0x84,0x44,0x20,0x8b,0xb0,0x85,0x49,0x84,0x4a,0xa5,0x7a,0xa4,0x7b,0x85,0x4b,0x84,0x4c,0xa6,0x43,0xa4,0x44,0x86,0x7a,0x84,0x7b,0x20,0x79,0x0,0xd0,0x20,0x24,0x11,0x50,0xc,0x20,0x24,0xe1,0x8d,0x0,0x2,0xa2,0xff,0xa0,0x1,0xd0,0xc,0x30,0x75,0xa5,0x13,0xd0,0x3,0x20,0x45,0xab,0x20,0xf9,0xab,0x86,0x7a,0x84,0x7b,0x20,0x73,0x0,0x24,0xd,0x10,0x31,0x24,0x11,0x50,0x9,0xe8,0x86,0x7a,0xa9,0x0,0x85,0x7,0xf0,0xc,0x85,0x7,0xc9,0x22,0xf0,0x7,0xa9,0x3a,0x85,0x7,0xa9,0x2c,0x18,0x85,0x8,0xa5,0x7a,0xa4,0x7b,0x69,0x0,0x90,0x1,0xc8,0x20,0x8d,0xb4,0x20,0xe2,0xb7,0x20,0xda,0xa9,0x4c,0x91,0xac,0x20,0xf3,0xbc,0xa5,0xe,0x20,0xc2,0xa9,0x20,0x79,0x0,0xf0,0x7,0xc9,0x2c,0xf0,0x3,0x4c,0x4d,0xab,0xa5,0x7a,0xa4,0x7b,0x85,0x43,0x84,0x44,0xa5,0x4b,0xa4,0x4c,0x85,0x7a,0x84,0x7b,0x20,0x79,0x0,0xf0,0x2d,0x20,0xfd,0xae,0x4c,0x15,0xac,0x20,0x6,0xa9,0xc8,0xaa,0xd0,0x12,0xa2,0xd,0xc8,0xb1,0x7a,0xf0,0x6c,0xc8,0xb1,0x7a,0x85,0x3f,0xc8,0xb1,0x7a,0xc8,0x85,0x40,0x20,0xfb,0xa8,0x20,0x79,0x0,0xaa,0xe0,0x83,0xd0,0xdc,0x4c,0x51,0xac,0xa5,0x43,0xa4,0x44,0xa6,0x11,0x10,0x3,0x4c,0x27,0xa8,0xa0,0x0,0xb1,0x43,0xf0,0xb,0xa5,0x13,0xd0,0x7,0xa9,0xfc,0xa0,0xac,0x4c,0x1e,0xab,0x60,0x3f,0x45,0x58,0x54,0x52,0x41,0x20,0x49,0x47,0x4e,0x4f,0x52,0x45,0x44,0xd,0x0,0x3f,0x52,0x45,0x44,0x4f,0x20,0x46,0x52,0x4f,0x4d,0x20,0x53,0x54,0x41,0x52,0x54,0xd,0x0,0xd0,0x4,0xa0,0x0,0xf0,0x3,0x20,0x8b,0xb0,0x85,0x49,0x84,0x4a,0x20,0x8a,0xa3,0xf0,0x5,0xa2,0xa,0x4c,0x37,0xa4,0x9a,0x8a,0x18,0x69,0x4,0x48,0x69,0x6,0x85,0x24,0x68,0xa0,0x1,0x20,0xa2,0xbb,0xba,0xbd,0x9,0x1,0x85,0x66,0xa5,0x49,0xa4,0x4a,0x20,0x67,0xb8,0x20,0xd0,0xbb,0xa0,0x1,0x20,0x5d,0xbc,0xba,0x38,0xfd,0x9,0x1,0xf0,0x17,0xbd,0xf,0x1,0x85,0x39,0xbd,0x10,0x1,0x85,0x3a,0xbd,0x12,0x1,0x85,0x7a,0xbd,0x11,0x1,0x85,0x7b,0x4c,0xae,0xa7,0x8a,0x69,0x11,0xaa,0x9a,0x20,0x79,0x0,0xc9,0x2c,0xd0,0xf1,0x20,0x73,0x0,0x20,0x24,0xad,0x20,0x9e,0xad,0x18,0x24,0x38,0x24,0xd,0x30,0x3,0xb0,0x3,0x60,0xb0,0xfd,0xa2,0x16,0x4c,0x37,0xa4,0xa6,0x7a,0xd0,0x2,0xc6,0x7b,0xc6,0x7a,0xa2,0x0,0x24,0x48,0x8a,0x48,0xa9,0x1,0x20,0xfb,0xa3,0x20,0x83,0xae,0xa9,0x0,0x85,0x4d,0x20,0x79,0x0,0x38,0xe9,0xb1,0x90,0x17,0xc9,0x3,0xb0,0x13,0xc9,0x1,0x2a,0x49,0x1,0x45,0x4d,0xc5,0x4d,0x90,0x61,0x85,0x4d,0x20,0x73,0x0,0x4c,0xbb,0xad,0xa6,0x4d,0xd0,0x2c,0xb0,0x7b,0x69,0x7,0x90,0x77,0x65,0xd,0xd0,0x3,0x4c,0x3d,0xb6,0x69,0xff,0x85,0x22,0xa,0x65,0x22,0xa8,0x68,0xd9,0x80,0xa0,0xb0,0x67,0x20,0x8d,0xad,0x48,0x20,0x20,0xae,0x68,0xa4,0x4b,0x10,0x17,0xaa,0xf0,0x56,0xd0,0x5f,0x46,0xd,0x8a,0x2a,0xa6,0x7a,0xd0,0x2,0xc6,0x7b,0xc6,0x7a,0xa0,0x1b,0x85,0x4d,0xd0,0xd7,0xd9,0x80,0xa0,0xb0,0x48,0x90,0xd9,0xb9,0x82,0xa0,0x48,0xb9,0x81,0xa0,0x48,0x20,0x33,0xae,0xa5,0x4d,0x4c,0xa9,0xad,0x4c,0x8,0xaf,0xa5,0x66,0xbe,0x80,0xa0,0xa8,0x68,0x85,0x22,0xe6,0x22,0x68,0x85,0x23,0x98,0x48,0x20,0x1b,0xbc,0xa5,0x65,0x48,0xa5,0x64,0x48,0xa5,0x63,0x48,0xa5,0x62,0x48,0xa5,0x61,0x48,0x6c,0x22,0x0,0xa0,0xff,0x68,0xf0,0x23,0xc9,0x64,0xf0,0x3,0x20,0x8d,0xad,0x84,0x4b,0x68,0x4a,0x85,0x12,0x68,0x85,0x69,0x68,0x85,0x6a,0x68,0x85,0x6b,0x68,0x85,0x6c,0x68,0x85,0x6d,0x68,0x85,0x6e,0x45,0x66,0x85,0x6f,0xa5,0x61,0x60,0x6c,0xa,0x3,0xa9,0x0,0x85,0xd,0x20,0x73,0x0,0xb0,0x3,0x4c,0xf3,0xbc,0x20,0x13,0xb1,0x90,0x3,0x4c,0x28,0xaf,0xc9,0xff,0xd0,0xf,0xa9,0xa8,0xa0,0xae,0x20,0xa2,0xbb,0x4c,0x73,0x0,0x82,0x49,0xf,0xda,0xa1,0xc9,0x2e,0xf0,0xde,0xc9,0xab,0xf0,0x58,0xc9,0xaa,0xf0,0xd1,0xc9,0x22,0xd0,0xf,0xa5,0x7a,0xa4,0x7b,0x69,0x0,0x90,0x1,0xc8,0x20,0x87,0xb4,0x4c,0xe2,0xb7,0xc9,0xa8,0xd0,0x13,0xa0,0x18,0xd0,0x3b,0x20,0xbf,0xb1,0xa5,0x65,0x49,0xff,0xa8,0xa5,0x64,0x49,0xff,0x4c,0x91,0xb3,0xc9,0xa5,0xd0,0x3,0x4c,0xf4,0xb3,0xc9,0xb4,0x90,0x3,0x4c,0xa7,0xaf,0x20,0xfa,0xae,0x20,0x9e,0xad,0xa9,0x29,0x2c,0xa9,0x28,0x2c,0xa9,0x2c,0xa0,0x0,0xd1,0x7a,0xd0,0x3,0x4c,0x73,0x0,0xa2,0xb,0x4c,0x37,0xa4,0xa0,0x15,0x68,0x68,0x4c,0xfa,0xad,0x38,0xa5,0x64,0xe9,0x0,0xa5,0x65,0xe9,0xa0,0x90,0x8,0xa9,0xa2,0xe5,0x64,0xa9,0xe3,0xe5,0x65,0x60,0x20,0x8b,0xb0,0x85,0x64,0x84,0x65,0xa6,0x45,0xa4,0x46,0xa5,0xd,0xf0,0x26,0xa9,0x0,0x85,0x70,0x20,0x14,0xaf,0x90,0x1c,0xe0,0x54,0xd0,0x18,0xc0,0xc9,0xd0,0x14,0x20,0x84,0xaf,0x84,0x5e,0x88,0x84,0x71,0xa0,0x6,0x84,0x5d,0xa0,0x24,0x20,0x68,0xbe,0x4c,0x6f,0xb4,0x60,0x24,0xe,0x10,0xd,0xa0,0x0,0xb1,0x64,0xaa,0xc8,0xb1,0x64,0xa8,0x8a,0x4c,0x91,0xb3,0x20,0x14,0xaf,0x90,0x2d,0xe0,0x54,0xd0,0x1b,0xc0,0x49,0xd0,0x25,0x20,0x84,0xaf,0x98,0xa2,0xa0,0x4c,0x4f,0xbc,0x20,0xde,0xff,0x86,0x64,0x84,0x63,0x85,0x65,0xa0,0x0,0x84,0x62,0x60,0xe0,0x53,0xd0,0xa,0xc0,0x54,0xd0,0x6,0x20,0xb7,0xff,0x4c,0x3c,0xbc,0xa5,0x64,0xa4,0x65,0x4c,0xa2,0xbb,0xa,0x48,0xaa,0x20,0x73,0x0,0xe0,0x8f,0x90,0x20,0x20,0xfa,0xae,0x20,0x9e,0xad,0x20,0xfd,0xae,0x20,0x8f,0xad,0x68,0xaa,0xa5,0x65,0x48,0xa5,0x64,0x48,0x8a,0x48,0x20,0x9e,0xb7,0x68,0xa8,0x8a,0x48,0x4c,0xd6,0xaf,0x20,0xf1,0xae,0x68,0xa8,0xb9,0xea,0x9f,0x85,0x55,0xb9,0xeb,0x9f,0x85,0x56,0x20,0x54,0x0,0x4c,0x8d,0xad,0xa0,0xff,0x2c,0xa0,0x0,0x84,0xb,0x20,0xbf,0xb1,0xa5,0x64,0x45,0xb,0x85,0x7,0xa5,0x65,0x45,0xb,0x85,0x8,0x20,0xfc,0xbb,0x20,0xbf,0xb1,0xa5,0x65,0x45,0xb,0x25,0x8,0x45,0xb,0xa8,0xa5,0x64,0x45,0xb,0x25,0x7,0x45,0xb,0x4c,0x91,0xb3,0x20,0x90,0xad,0xb0,0x13,0xa5,0x6e,0x9,0x7f,0x25,0x6a,0x85,0x6a,0xa9,0x69,0xa0,0x0,0x20,0x5b,0xbc,0xaa,0x4c,0x61,0xb0,0xa9,0x0,0x85,0xd,0xc6,0x4d,0x20,0xa6,0xb6,0x85,0x61,0x86,0x62,0x84,0x63,0xa5,0x6c,0xa4,0x6d,0x20,0xaa,0xb6,0x86,0x6c,0x84,0x6d,0xaa,0x38,0xe5,0x61,0xf0,0x8,0xa9,0x1,0x90,0x4,0xa6,0x61,0xa9,0xff,0x85,0x66,0xa0,0xff,0xe8,0xc8,0xca,0xd0,0x7,0xa6,0x66,0x30,0xf,0x18,0x90,0xc,0xb1,0x6c,0xd1,0x62,0xf0,0xef,0xa2,0xff,0xb0,0x2,0xa2,0x1,0xe8,0x8a,0x2a,0x25,0x12,0xf0,0x2,0xa9,0xff,0x4c,0x3c,0xbc,0x20,0xfd,0xae,0xaa,0x20,0x90,0xb0,0x20,0x79,0x0,0xd0,0xf4,0x60,0xa2,0x0,0x20,0x79,0x0,0x86,0xc,0x85,0x45,0x20,0x79,0x0,0x20,0x13,0xb1,0xb0,0x3,0x4c,0x8,0xaf,0xa2,0x0,0x86,0xd,0x86,0xe,0x20,0x73,0x0,0x90,0x5,0x20,0x13,0xb1,0x90,0xb,0xaa,0x20,0x73,0x0,0x90,0xfb,0x20,0x13,0xb1,0xb0,0xf6,0xc9,0x24,0xd0,0x6,0xa9,0xff,0x85,0xd,0xd0,0x10,0xc9,0x25,0xd0,0x13,0xa5,0x10,0xd0,0xd0,0xa9,0x80,0x85,0xe,0x5,0x45,0x85,0x45,0x8a,0x9,0x80,0xaa,0x20,0x73,0x0,0x86,0x46,0x38,0x5,0x10,0xe9,0x28,0xd0,0x3,0x4c,0xd1,0xb1,0xa0,0x0,0x84,0x10,0xa5,0x2d,0xa6,0x2e,0x86,0x60,0x85,0x5f,0xe4,0x30,0xd0,0x4,0xc5,0x2f,0xf0,0x22,0xa5,0x45,0xd1,0x5f,0xd0,0x8,0xa5,0x46,0xc8,0xd1,0x5f,0xf0,0x7d,0x88,0x18,0xa5,0x5f,0x69,0x7,0x90,0xe1,0xe8,0xd0,0xdc,0xc9,0x41,0x90,0x5,0xe9,0x5b,0x38,0xe9,0xa5,0x60,0x68,0x48,0xc9,0x2a,0xd0,0x5,0xa9,0x13,0xa0,0xbf,0x60,0xa5,0x45,0xa4,0x46,0xc9,0x54,0xd0,0xb,0xc0,0xc9,0xf0,0xef,0xc0,0x49,0xd0,0x3,0x4c,0x8,0xaf,0xc9,0x53,0xd0,0x4,0xc0,0x54,0xf0,0xf5,0xa5,0x2f,0xa4,0x30,0x85,0x5f,0x84,0x60,0xa5,0x31,0xa4,0x32,0x85,0x5a,0x84,0x5b,0x18,0x69,0x7,0x90,0x1,0xc8,0x85,0x58,0x84,0x59,0x20,0xb8,0xa3,0xa5,0x58,0xa4,0x59,0xc8,0x85,0x2f,0x84,0x30,0xa0,0x0,0xa5,0x45,0x91,0x5f,0xc8,0xa5,0x46,0x91,0x5f,0xa9,0x0,0xc8,0x91,0x5f,0xc8,0x91,0x5f,0xc8,0x91,0x5f,0xc8,0x91,0x5f,0xc8,0x91,0x5f,0xa5,0x5f,0x18,0x69,0x2,0xa4,0x60,0x90,0x1,0xc8,0x85,0x47,0x84,0x48,0x60,0xa5,0xb,0xa,0x69,0x5,0x65,0x5f,0xa4,0x60,0x90,0x1,0xc8,0x85,0x58,0x84,0x59,0x60,0x90,0x80,0x0,0x0,0x0,0x20,0xbf,0xb1,0xa5,0x64,0xa4,0x65,0x60,0x20,0x73,0x0,0x20,0x9e,0xad,0x20,0x8d,0xad,0xa5,0x66,0x30,0xd,0xa5,0x61,0xc9,0x90,0x90,0x9,0xa9,0xa5,0xa0,0xb1,0x20,0x5b,0xbc,0xd0,0x7a,0x4c,0x9b,0xbc,0xa5,0xc,0x5,0xe,0x48,0xa5,0xd,0x48,0xa0,0x0,0x98,0x48,0xa5,0x46,0x48,0xa5,0x45,0x48,0x20,0xb2,0xb1,0x68,0x85,0x45,0x68,0x85,0x46,0x68,0xa8,0xba,0xbd,0x2,0x1,0x48,0xbd,0x1,0x1,0x48,0xa5,0x64,0x9d,0x2,0x1,0xa5,0x65,0x9d,0x1,0x1,0xc8,0x20,0x79,0x0,0xc9,0x2c,0xf0,0xd2,0x84,0xb,0x20,0xf7,0xae,0x68,0x85,0xd,0x68,0x85,0xe,0x29,0x7f,0x85,0xc,0xa6,0x2f,0xa5,0x30,0x86,0x5f,0x85,0x60,0xc5,0x32,0xd0,0x4,0xe4,0x31,0xf0,0x39,0xa0,0x0,0xb1,0x5f,0xc8,0xc5,0x45,0xd0,0x6,0xa5,0x46,0xd1,0x5f,0xf0,0x16,0xc8,0xb1,0x5f,0x18,0x65,0x5f,0xaa,0xc8,0xb1,0x5f,0x65,0x60,0x90,0xd7,0xa2,0x12,0x2c,0xa2,0xe,0x4c,0x37,0xa4,0xa2,0x13,0xa5,0xc,0xd0,0xf7,0x20,0x94,0xb1,0xa5,0xb,0xa0,0x4,0xd1,0x5f,0xd0,0xe7,0x4c,0xea,0xb2,0x20,0x94,0xb1,0x20,0x8,0xa4,0xa0,0x0,0x84,0x72,0xa2,0x5,0xa5,0x45,0x91,0x5f,0x10,0x1,0xca,0xc8,0xa5,0x46,0x91,0x5f,0x10,0x2,0xca,0xca,0x86,0x71,0xa5,0xb,0xc8,0xc8,0xc8,0x91,0x5f,0xa2,0xb,0xa9,0x0,0x24,0xc,0x50,0x8,0x68,0x18,0x69,0x1,0xaa,0x68,0x69,0x0,0xc8,0x91,0x5f,0xc8,0x8a,0x91,0x5f,0x20,0x4c,0xb3,0x86,0x71,0x85,0x72,0xa4,0x22,0xc6,0xb,0xd0,0xdc,0x65,0x59,0xb0,0x5d,0x85,0x59,0xa8,0x8a,0x65,0x58,0x90,0x3,0xc8,0xf0,0x52,0x20,0x8,0xa4,0x85,0x31,0x84,0x32,0xa9,0x0,0xe6,0x72,0xa4,0x71,0xf0,0x5,0x88,0x91,0x58,0xd0,0xfb,0xc6,0x59,0xc6,0x72,0xd0,0xf5,0xe6,0x59,0x38,0xa5,0x31,0xe5,0x5f,0xa0,0x2,0x91,0x5f,0xa5,0x32,0xc8,0xe5,0x60,0x91,0x5f,0xa5,0xc,0xd0,0x62,0xc8,0xb1,0x5f,0x85,0xb,0xa9,0x0,0x85,0x71,0x85,0x72,0xc8,0x68,0xaa,0x85,0x64,0x68,0x85,0x65,0xd1,0x5f,0x90,0xe,0xd0,0x6,0xc8,0x8a,0xd1,0x5f,0x90,0x7,0x4c,0x45,0xb2,0x4c,0x35,0xa4,0xc8,0xa5,0x72,0x5,0x71,0x18,0xf0,0xa,0x20,0x4c,0xb3,0x8a,0x65,0x64,0xaa,0x98,0xa4,0x22,0x65,0x65,0x86,0x71,0xc6,0xb,0xd0,0xca,0x85,0x72,0xa2,0x5,0xa5,0x45,0x10,0x1,0xca,0xa5,0x46,0x10,0x2,0xca,0xca,0x86,0x28,0xa9,0x0,0x20,0x55,0xb3,0x8a,0x65,0x58,0x85,0x47,0x98,0x65,0x59,0x85,0x48,0xa8,0xa5,0x47,0x60,0x84,0x22,0xb1,0x5f,0x85,0x28,0x88,0xb1,0x5f,0x85,0x29,0xa9,0x10,0x85,0x5d,0xa2,0x0,0xa0,0x0,0x8a,0xa,0xaa,0x98,0x2a,0xa8,0xb0,0xa4,0x6,0x71,0x26,0x72,0x90,0xb,0x18,0x8a,0x65,0x28,0xaa,0x98,0x65,0x29,0xa8,0xb0,0x93,0xc6,0x5d,0xd0,0xe3,0x60,0xa5,0xd,0xf0,0x3,0x20,0xa6,0xb6,0x20,0x26,0xb5,0x38,0xa5,0x33,0xe5,0x31,0xa8,0xa5,0x34,0xe5,0x32,0xa2,0x0,0x86,0xd,0x85,0x62,0x84,0x63,0xa2,0x90,0x4c,0x44,0xbc,0x38,0x20,0xf0,0xff,0xa9,0x0,0xf0,0xeb,0xa6,0x3a,0xe8,0xd0,0xa0,0xa2,0x15,0x2c,0xa2,0x1b,0x4c,0x37,0xa4,0x20,0xe1,0xb3,0x20,0xa6,0xb3,0x20,0xfa,0xae,0xa9,0x80,0x85,0x10,0x20,0x8b,0xb0,0x20,0x8d,0xad,0x20,0xf7,0xae,0xa9,0xb2,0x20,0xff,0xae,0x48,0xa5,0x48,0x48,0xa5,0x47,0x48,0xa5,0x7b,0x48,0xa5,0x7a,0x48,0x20,0xf8,0xa8,0x4c,0x4f,0xb4,0xa9,0xa5,0x20,0xff,0xae,0x9,0x80,0x85,0x10,0x20,0x92,0xb0,0x85,0x4e,0x84,0x4f,0x4c,0x8d,0xad,0x20,0xe1,0xb3,0xa5,0x4f,0x48,0xa5,0x4e,0x48,0x20,0xf1,0xae,0x20,0x8d,0xad,0x68,0x85,0x4e,0x68,0x85,0x4f,0xa0,0x2,0xb1,0x4e,0x85,0x47,0xaa,0xc8,0xb1,0x4e,0xf0,0x99,0x85,0x48,0xc8,0xb1,0x47,0x48,0x88,0x10,0xfa,0xa4,0x48,0x20,0xd4,0xbb,0xa5,0x7b,0x48,0xa5,0x7a,0x48,0xb1,0x4e,0x85,0x7a,0xc8,0xb1,0x4e,0x85,0x7b,0xa5,0x48,0x48,0xa5,0x47,0x48,0x20,0x8a,0xad,0x68,0x85,0x4e,0x68,0x85,0x4f,0x20,0x79,0x0,0xf0,0x3,0x4c,0x8,0xaf,0x68,0x85,0x7a,0x68,0x85,0x7b,0xa0,0x0,0x68,0x91,0x4e,0x68,0xc8,0x91,0x4e,0x68,0xc8,0x91,0x4e,0x68,0xc8,0x91,0x4e,0x68,0xc8,0x91,0x4e,0x60,0x20,0x8d,0xad,0xa0,0x0,0x20,0xdf,0xbd,0x68,0x68,0xa9,0xff,0xa0,0x0,0xf0,0x12,0xa6,0x64,0xa4,0x65,0x86,0x50,0x84,0x51,0x20,0xf4,0xb4,0x86,0x62,0x84,0x63,0x85,0x61,0x60,0xa2,0x22,0x86,0x7,0x86,0x8,0x85,0x6f,0x84,0x70,0x85,0x62,0x84,0x63,0xa0,0xff,0xc8,0xb1,0x6f,0xf0,0xc,0xc5,0x7,0xf0,0x4,0xc5,0x8,0xd0,0xf3,0xc9,0x22,0xf0,0x1,0x18,0x84,0x61,0x98,0x65,0x6f,0x85,0x71,0xa6,0x70,0x90,0x1,0xe8,0x86,0x72,0xa5,0x70,0xf0,0x4,0xc9,0x2,0xd0,0xb,0x98,0x20,0x75,0xb4,0xa6,0x6f,0xa4,0x70,0x20,0x88,0xb6,0xa6,0x16,0xe0,0x22,0xd0,0x5,0xa2,0x19,0x4c,0x37,0xa4,0xa5,0x61,0x95,0x0,0xa5,0x62,0x95,0x1,0xa5,0x63,0x95,0x2,0xa0,0x0,0x86,0x64,0x84,0x65,0x84,0x70,0x88,0x84,0xd,0x86,0x17,0xe8,0xe8,0xe8,0x86,0x16,0x60,0x46,0xf,0x48,0x49,0xff,0x38,0x65,0x33,0xa4,0x34,0xb0,0x1,0x88,0xc4,0x32,0x90,0x11,0xd0,0x4,0xc5,0x31,0x90,0xb,0x85,0x33,0x84,0x34,0x85,0x35,0x84,0x36,0xaa,0x68,0x60,0xa2,0x10,0xa5,0xf,0x30,0xb6,0x20,0x26,0xb5,0xa9,0x80,0x85,0xf,0x68,0xd0,0xd0,0xa6,0x37,0xa5,0x38,0x86,0x33,0x85,0x34,0xa0,0x0,0x84,0x4f,0x84,0x4e,0xa5,0x31,0xa6,0x32,0x85,0x5f,0x86,0x60,0xa9,0x19,0xa2,0x0,0x85,0x22,0x86,0x23,0xc5,0x16,0xf0,0x5,0x20,0xc7,0xb5,0xf0,0xf7,0xa9,0x7,0x85,0x53,0xa5,0x2d,0xa6,0x2e,0x85,0x22,0x86,0x23,0xe4,0x30,0xd0,0x4,0xc5,0x2f,0xf0,0x5,0x20,0xbd,0xb5,0xf0,0xf3,0x85,0x58,0x86,0x59,0xa9,0x3,0x85,0x53,0xa5,0x58,0xa6,0x59,0xe4,0x32,0xd0,0x7,0xc5,0x31,0xd0,0x3,0x4c,0x6,0xb6,0x85,0x22,0x86,0x23,0xa0,0x0,0xb1,0x22,0xaa,0xc8,0xb1,0x22,0x8,0xc8,0xb1,0x22,0x65,0x58,0x85,0x58,0xc8,0xb1,0x22,0x65,0x59,0x85,0x59,0x28,0x10,0xd3,0x8a,0x30,0xd0,0xc8,0xb1,0x22,0xa0,0x0,0xa,0x69,0x5,0x65,0x22,0x85,0x22,0x90,0x2,0xe6,0x23,0xa6,0x23,0xe4,0x59,0xd0,0x4,0xc5,0x58,0xf0,0xba,0x20,0xc7,0xb5,0xf0,0xf3,0xb1,0x22,0x30,0x35,0xc8,0xb1,0x22,0x10,0x30,0xc8,0xb1,0x22,0xf0,0x2b,0xc8,0xb1,0x22,0xaa,0xc8,0xb1,0x22,0xc5,0x34,0x90,0x6,0xd0,0x1e,0xe4,0x33,0xb0,0x1a,0xc5,0x60,0x90,0x16,0xd0,0x4,0xe4,0x5f,0x90,0x10,0x86,0x5f,0x85,0x60,0xa5,0x22,0xa6,0x23,0x85,0x4e,0x86,0x4f,0xa5,0x53,0x85,0x55,0xa5,0x53,0x18,0x65,0x22,0x85,0x22,0x90,0x2,0xe6,0x23,0xa6,0x23,0xa0,0x0,0x60,0xa5,0x4f,0x5,0x4e,0xf0,0xf5,0xa5,0x55,0x29,0x4,0x4a,0xa8,0x85,0x55,0xb1,0x4e,0x65,0x5f,0x85,0x5a,0xa5,0x60,0x69,0x0,0x85,0x5b,0xa5,0x33,0xa6,0x34,0x85,0x58,0x86,0x59,0x20,0xbf,0xa3,0xa4,0x55,0xc8,0xa5,0x58,0x91,0x4e,0xaa,0xe6,0x59,0xa5,0x59,0xc8,0x91,0x4e,0x4c,0x2a,0xb5,0xa5,0x65,0x48,0xa5,0x64,0x48,0x20,0x83,0xae,0x20,0x8f,0xad,0x68,0x85,0x6f,0x68,0x85,0x70,0xa0,0x0,0xb1,0x6f,0x18,0x71,0x64,0x90,0x5,0xa2,0x17,0x4c,0x37,0xa4,0x20,0x75,0xb4,0x20,0x7a,0xb6,0xa5,0x50,0xa4,0x51,0x20,0xaa,0xb6,0x20,0x8c,0xb6,0xa5,0x6f,0xa4,0x70,0x20,0xaa,0xb6,0x20,0xca,0xb4,0x4c,0xb8,0xad,0xa0,0x0,0xb1,0x6f,0x48,0xc8,0xb1,0x6f,0xaa,0xc8,0xb1,0x6f,0xa8,0x68,0x86,0x22,0x84,0x23,0xa8,0xf0,0xa,0x48,0x88,0xb1,0x22,0x91,0x35,0x98,0xd0,0xf8,0x68,0x18,0x65,0x35,0x85,0x35,0x90,0x2,0xe6,0x36,0x60,0x20,0x8f,0xad,0xa5,0x64,0xa4,0x65,0x85,0x22,0x84,0x23,0x20,0xdb,0xb6,0x8,0xa0,0x0,0xb1,0x22,0x48,0xc8,0xb1,0x22,0xaa,0xc8,0xb1,0x22,0xa8,0x68,0x28,0xd0,0x13,0xc4,0x34,0xd0,0xf,0xe4,0x33,0xd0,0xb,0x48,0x18,0x65,0x33,0x85,0x33,0x90,0x2,0xe6,0x34,0x68,0x86,0x22,0x84,0x23,0x60,0xc4,0x18,0xd0,0xc,0xc5,0x17,0xd0,0x8,0x85,0x16,0xe9,0x3,0x85,0x17,0xa0,0x0,0x60,0x20,0xa1,0xb7,0x8a,0x48,0xa9,0x1,0x20,0x7d,0xb4,0x68,0xa0,0x0,0x91,0x62,0x68,0x68,0x4c,0xca,0xb4,0x20,0x61,0xb7,0xd1,0x50,0x98,0x90,0x4,0xb1,0x50,0xaa,0x98,0x48,0x8a,0x48,0x20,0x7d,0xb4,0xa5,0x50,0xa4,0x51,0x20,0xaa,0xb6,0x68,0xa8,0x68,0x18,0x65,0x22,0x85,0x22,0x90,0x2,0xe6,0x23,0x98,0x20,0x8c,0xb6,0x4c,0xca,0xb4,0x20,0x61,0xb7,0x18,0xf1,0x50,0x49,0xff,0x4c,0x6,0xb7,0xa9,0xff,0x85,0x65,0x20,0x79,0x0,0xc9,0x29,0xf0,0x6,0x20,0xfd,0xae,0x20,0x9e,0xb7,0x20,0x61,0xb7,0xf0,0x4b,0xca,0x8a,0x48,0x18,0xa2,0x0,0xf1,0x50,0xb0,0xb6,0x49,0xff,0xc5,0x65,0x90,0xb1,0xa5,0x65,0xb0,0xad,0x20,0xf7,0xae,0x68,0xa8,0x68,0x85,0x55,0x68,0x68,0x68,0xaa,0x68,0x85,0x50,0x68,0x85,0x51,0xa5,0x55,0x48,0x98,0x48,0xa0,0x0,0x8a,0x60,0x20,0x82,0xb7,0x4c,0xa2,0xb3,0x20,0xa3,0xb6,0xa2,0x0,0x86,0xd,0xa8,0x60,0x20,0x82,0xb7,0xf0,0x8,0xa0,0x0,0xb1,0x22,0xa8,0x4c,0xa2,0xb3,0x4c,0x48,0xb2,0x20,0x73,0x0,0x20,0x8a,0xad,0x20,0xb8,0xb1,0xa6,0x64,0xd0,0xf0,0xa6,0x65,0x4c,0x79,0x0,0x20,0x82,0xb7,0xd0,0x3,0x4c,0xf7,0xb8,0xa6,0x7a,0xa4,0x7b,0x86,0x71,0x84,0x72,0xa6,0x22,0x86,0x7a,0x18,0x65,0x22,0x85,0x24,0xa6,0x23,0x86,0x7b,0x90,0x1,0xe8,0x86,0x25,0xa0,0x0,0xb1,0x24,0x48,0x98,0x91,0x24,0x20,0x79,0x0,0x20,0xf3,0xbc,0x68,0xa0,0x0,0x91,0x24,0xa6,0x71,0xa4,0x72,0x86,0x7a,0x84,0x7b,0x60,0x20,0x8a,0xad,0x20,0xf7,0xb7,0x20,0xfd,0xae,0x4c,0x9e,0xb7,0xa5,0x66,0x30,0x9d,0xa5,0x61,0xc9,0x91,0xb0,0x97,0x20,0x9b,0xbc,0xa5,0x64,0xa4,0x65,0x84,0x14,0x85,0x15,0x60,0xa5,0x15,0x48,0xa5,0x14,0x48,0x20,0xf7,0xb7,0xa0,0x0,0xb1,0x14,0xa8,0x68,0x85,0x14,0x68,0x85,0x15,0x4c,0xa2,0xb3,0x20,0xeb,0xb7,0x8a,0xa0,0x0,0x91,0x14,0x60,0x20,0xeb,0xb7,0x86,0x49,0xa2,0x0,0x20,0x79,0x0,0xf0,0x3,0x20,0xf1,0xb7,0x86,0x4a,0xa0,0x0,0xb1,0x14,0x45,0x4a,0x25,0x49,0xf0,0xf8,0x60,0xa9,0x11,0xa0,0xbf,0x4c,0x67,0xb8,0x20,0x8c,0xba,0xa5,0x66,0x49,0xff,0x85,0x66,0x45,0x6e,0x85,0x6f,0xa5,0x61,0x4c,0x6a,0xb8,0x20,0x99,0xb9,0x90,0x3c,0x20,0x8c,0xba,0xd0,0x3,0x4c,0xfc,0xbb,0xa6,0x70,0x86,0x56,0xa2,0x69,0xa5,0x69,0xa8,0xf0,0xce,0x38,0xe5,0x61,0xf0,0x24,0x90,0x12,0x84,0x61,0xa4,0x6e,0x84,0x66,0x49,0xff,0x69,0x0,0xa0,0x0,0x84,0x56,0xa2,0x61,0xd0,0x4,0xa0,0x0,0x84,0x70,0xc9,0xf9,0x30,0xc7,0xa8,0xa5,0x70,0x56,0x1,0x20,0xb0,0xb9,0x24,0x6f,0x10,0x57,0xa0,0x61,0xe0,0x69,0xf0,0x2,0xa0,0x69,0x38,0x49,0xff,0x65,0x56,0x85,0x70,0xb9,0x4,0x0,0xf5,0x4,0x85,0x65,0xb9,0x3,0x0,0xf5,0x3,0x85,0x64,0xb9,0x2,0x0,0xf5,0x2,0x85,0x63,0xb9,0x1,0x0,0xf5,0x1,0x85,0x62,0xb0,0x3,0x20,0x47,0xb9,0xa0,0x0,0x98,0x18,0xa6,0x62,0xd0,0x4a,0xa6,0x63,0x86,0x62,0xa6,0x64,0x86,0x63,0xa6,0x65,0x86,0x64,0xa6,0x70,0x86,0x65,0x84,0x70,0x69,0x8,0xc9,0x20,0xd0,0xe4,0xa9,0x0,0x85,0x61,0x85,0x66,0x60,0x65,0x56,0x85,0x70,0xa5,0x65,0x65,0x6d,0x85,0x65,0xa5,0x64,0x65,0x6c,0x85,0x64,0xa5,0x63,0x65,0x6b,0x85,0x63,0xa5,0x62,0x65,0x6a,0x85,0x62,0x4c,0x36,0xb9,0x69,0x1,0x6,0x70,0x26,0x65,0x26,0x64,0x26,0x63,0x26,0x62,0x10,0xf2,0x38,0xe5,0x61,0xb0,0xc7,0x49,0xff,0x69,0x1,0x85,0x61,0x90,0xe,0xe6,0x61,0xf0,0x42,0x66,0x62,0x66,0x63,0x66,0x64,0x66,0x65,0x66,0x70,0x60,0xa5,0x66,0x49,0xff,0x85,0x66,0xa5,0x62,0x49,0xff,0x85,0x62,0xa5,0x63,0x49,0xff,0x85,0x63,0xa5,0x64,0x49,0xff,0x85,0x64,0xa5,0x65,0x49,0xff,0x85,0x65,0xa5,0x70,0x49,0xff,0x85,0x70,0xe6,0x70,0xd0,0xe,0xe6,0x65,0xd0,0xa,0xe6,0x64,0xd0,0x6,0xe6,0x63,0xd0,0x2,0xe6,0x62,0x60,0xa2,0xf,0x4c,0x37,0xa4,0xa2,0x25,0xb4,0x4,0x84,0x70,0xb4,0x3,0x94,0x4,0xb4,0x2,0x94,0x3,0xb4,0x1,0x94,0x2,0xa4,0x68,0x94,0x1,0x69,0x8,0x30,0xe8,0xf0,0xe6,0xe9,0x8,0xa8,0xa5,0x70,0xb0,0x14,0x16,0x1,0x90,0x2,0xf6,0x1,0x76,0x1,0x76,0x1,0x76,0x2,0x76,0x3,0x76,0x4,0x6a,0xc8,0xd0,0xec,0x18,0x60,0x81,0x0,0x0,0x0,0x0,0x3,0x7f,0x5e,0x56,0xcb,0x79,0x80,0x13,0x9b,0xb,0x64,0x80,0x76,0x38,0x93,0x16,0x82,0x38,0xaa,0x3b,0x20,0x80,0x35,0x4,0xf3,0x34,0x81,0x35,0x4,0xf3,0x34,0x80,0x80,0x0,0x0,0x0,0x80,0x31,0x72,0x17,0xf8,0x20,0x2b,0xbc,0xf0,0x2,0x10,0x3,0x4c,0x48,0xb2,0xa5,0x61,0xe9,0x7f,0x48,0xa9,0x80,0x85,0x61,0xa9,0xd6,0xa0,0xb9,0x20,0x67,0xb8,0xa9,0xdb,0xa0,0xb9,0x20,0xf,0xbb,0xa9,0xbc,0xa0,0xb9,0x20,0x50,0xb8,0xa9,0xc1,0xa0,0xb9,0x20,0x43,0xe0,0xa9,0xe0,0xa0,0xb9,0x20,0x67,0xb8,0x68,0x20,0x7e,0xbd,0xa9,0xe5,0xa0,0xb9,0x20,0x8c,0xba,0xd0,0x3,0x4c,0x8b,0xba,0x20,0xb7,0xba,0xa9,0x0,0x85,0x26,0x85,0x27,0x85,0x28,0x85,0x29,0xa5,0x70,0x20,0x59,0xba,0xa5,0x65,0x20,0x59,0xba,0xa5,0x64,0x20,0x59,0xba,0xa5,0x63,0x20,0x59,0xba,0xa5,0x62,0x20,0x5e,0xba,0x4c,0x8f,0xbb,0xd0,0x3,0x4c,0x83,0xb9,0x4a,0x9,0x80,0xa8,0x90,0x19,0x18,0xa5,0x29,0x65,0x6d,0x85,0x29,0xa5,0x28,0x65,0x6c,0x85,0x28,0xa5,0x27,0x65,0x6b,0x85,0x27,0xa5,0x26,0x65,0x6a,0x85,0x26,0x66,0x26,0x66,0x27,0x66,0x28,0x66,0x29,0x66,0x70,0x98,0x4a,0xd0,0xd6,0x60,0x85,0x22,0x84,0x23,0xa0,0x4,0xb1,0x22,0x85,0x6d,0x88,0xb1,0x22,0x85,0x6c,0x88,0xb1,0x22,0x85,0x6b,0x88,0xb1,0x22,0x85,0x6e,0x45,0x66,0x85,0x6f,0xa5,0x6e,0x9,0x80,0x85,0x6a,0x88,0xb1,0x22,0x85,0x69,0xa5,0x61,0x60,0xa5,0x69,0xf0,0x1f,0x18,0x65,0x61,0x90,0x4,0x30,0x1d,0x18,0x2c,0x10,0x14,0x69,0x80,0x85,0x61,0xd0,0x3,0x4c,0xfb,0xb8,0xa5,0x6f,0x85,0x66,0x60,0xa5,0x66,0x49,0xff,0x30,0x5,0x68,0x68,0x4c,0xf7,0xb8,0x4c,0x7e,0xb9,0x20,0xc,0xbc,0xaa,0xf0,0x10,0x18,0x69,0x2,0xb0,0xf2,0xa2,0x0,0x86,0x6f,0x20,0x77,0xb8,0xe6,0x61,0xf0,0xe7,0x60,0x84,0x20,0x0,0x0,0x0,0x20,0xc,0xbc,0xa9,0xf9,0xa0,0xba,0xa2,0x0,0x86,0x6f,0x20,0xa2,0xbb,0x4c,0x12,0xbb,0x20,0x8c,0xba,0xf0,0x76,0x20,0x1b,0xbc,0xa9,0x0,0x38,0xe5,0x61,0x85,0x61,0x20,0xb7,0xba,0xe6,0x61,0xf0,0xba,0xa2,0xfc,0xa9,0x1,0xa4,0x6a,0xc4,0x62,0xd0,0x10,0xa4,0x6b,0xc4,0x63,0xd0,0xa,0xa4,0x6c,0xc4,0x64,0xd0,0x4,0xa4,0x6d,0xc4,0x65,0x8,0x2a,0x90,0x9,0xe8,0x95,0x29,0xf0,0x32,0x10,0x34,0xa9,0x1,0x28,0xb0,0xe,0x6,0x6d,0x26,0x6c,0x26,0x6b,0x26,0x6a,0xb0,0xe6,0x30,0xce,0x10,0xe2,0xa8,0xa5,0x6d,0xe5,0x65,0x85,0x6d,0xa5,0x6c,0xe5,0x64,0x85,0x6c,0xa5,0x6b,0xe5,0x63,0x85,0x6b,0xa5,0x6a,0xe5,0x62,0x85,0x6a,0x98,0x4c,0x4f,0xbb,0xa9,0x40,0xd0,0xce,0xa,0xa,0xa,0xa,0xa,0xa,0x85,0x70,0x28,0x4c,0x8f,0xbb,0xa2,0x14,0x4c,0x37,0xa4,0xa5,0x26,0x85,0x62,0xa5,0x27,0x85,0x63,0xa5,0x28,0x85,0x64,0xa5,0x29,0x85,0x65,0x4c,0xd7,0xb8,0x85,0x22,0x84,0x23,0xa0,0x4,0xb1,0x22,0x85,0x65,0x88,0xb1,0x22,0x85,0x64,0x88,0xb1,0x22,0x85,0x63,0x88,0xb1,0x22,0x85,0x66,0x9,0x80,0x85,0x62,0x88,0xb1,0x22,0x85,0x61,0x84,0x70,0x60,0xa2,0x5c,0x2c,0xa2,0x57,0xa0,0x0,0xf0,0x4,0xa6,0x49,0xa4,0x4a,0x20,0x1b,0xbc,0x86,0x22,0x84,0x23,0xa0,0x4,0xa5,0x65,0x91,0x22,0x88,0xa5,0x64,0x91,0x22,0x88,0xa5,0x63,0x91,0x22,0x88,0xa5,0x66,0x9,0x7f,0x25,0x62,0x91,0x22,0x88,0xa5,0x61,0x91,0x22,0x84,0x70,0x60,0xa5,0x6e,0x85,0x66,0xa2,0x5,0xb5,0x68,0x95,0x60,0xca,0xd0,0xf9,0x86,0x70,0x60,0x20,0x1b,0xbc,0xa2,0x6,0xb5,0x60,0x95,0x68,0xca,0xd0,0xf9,0x86,0x70,0x60,0xa5,0x61,0xf0,0xfb,0x6,0x70,0x90,0xf7,0x20,0x6f,0xb9,0xd0,0xf2,0x4c,0x38,0xb9,0xa5,0x61,0xf0,0x9,0xa5,0x66,0x2a,0xa9,0xff,0xb0,0x2,0xa9,0x1,0x60,0x20,0x2b,0xbc,0x85,0x62,0xa9,0x0,0x85,0x63,0xa2,0x88,0xa5,0x62,0x49,0xff,0x2a,0xa9,0x0,0x85,0x65,0x85,0x64,0x86,0x61,0x85,0x70,0x85,0x66,0x4c,0xd2,0xb8,0x46,0x66,0x60,0x85,0x24,0x84,0x25,0xa0,0x0,0xb1,0x24,0xc8,0xaa,0xf0,0xc4,0xb1,0x24,0x45,0x66,0x30,0xc2,0xe4,0x61,0xd0,0x21,0xb1,0x24,0x9,0x80,0xc5,0x62,0xd0,0x19,0xc8,0xb1,0x24,0xc5,0x63,0xd0,0x12,0xc8,0xb1,0x24,0xc5,0x64,0xd0,0xb,0xc8,0xa9,0x7f,0xc5,0x70,0xb1,0x24,0xe5,0x65,0xf0,0x28,0xa5,0x66,0x90,0x2,0x49,0xff,0x4c,0x31,0xbc,0xa5,0x61,0xf0,0x4a,0x38,0xe9,0xa0,0x24,0x66,0x10,0x9,0xaa,0xa9,0xff,0x85,0x68,0x20,0x4d,0xb9,0x8a,0xa2,0x61,0xc9,0xf9,0x10,0x6,0x20,0x99,0xb9,0x84,0x68,0x60,0xa8,0xa5,0x66,0x29,0x80,0x46,0x62,0x5,0x62,0x85,0x62,0x20,0xb0,0xb9,0x84,0x68,0x60,0xa5,0x61,0xc9,0xa0,0xb0,0x20,0x20,0x9b,0xbc,0x84,0x70,0xa5,0x66,0x84,0x66,0x49,0x80,0x2a,0xa9,0xa0,0x85,0x61,0xa5,0x65,0x85,0x7,0x4c,0xd2,0xb8,0x85,0x62,0x85,0x63,0x85,0x64,0x85,0x65,0xa8,0x60,0xa0,0x0,0xa2,0xa,0x94,0x5d,0xca,0x10,0xfb,0x90,0xf,0xc9,0x2d,0xd0,0x4,0x86,0x67,0xf0,0x4,0xc9,0x2b,0xd0,0x5,0x20,0x73,0x0,0x90,0x5b,0xc9,0x2e,0xf0,0x2e,0xc9,0x45,0xd0,0x30,0x20,0x73,0x0,0x90,0x17,0xc9,0xab,0xf0,0xe,0xc9,0x2d,0xf0,0xa,0xc9,0xaa,0xf0,0x8,0xc9,0x2b,0xf0,0x4,0xd0,0x7,0x66,0x60,0x20,0x73,0x0,0x90,0x5c,0x24,0x60,0x10,0xe,0xa9,0x0,0x38,0xe5,0x5e,0x4c,0x49,0xbd,0x66,0x5f,0x24,0x5f,0x50,0xc3,0xa5,0x5e,0x38,0xe5,0x5d,0x85,0x5e,0xf0,0x12,0x10,0x9,0x20,0xfe,0xba,0xe6,0x5e,0xd0,0xf9,0xf0,0x7,0x20,0xe2,0xba,0xc6,0x5e,0xd0,0xf9,0xa5,0x67,0x30,0x1,0x60,0x4c,0xb4,0xbf,0x48,0x24,0x5f,0x10,0x2,0xe6,0x5d,0x20,0xe2,0xba,0x68,0x38,0xe9,0x30,0x20,0x7e,0xbd,0x4c,0xa,0xbd,0x48,0x20,0xc,0xbc,0x68,0x20,0x3c,0xbc,0xa5,0x6e,0x45,0x66,0x85,0x6f,0xa6,0x61,0x4c,0x6a,0xb8,0xa5,0x5e,0xc9,0xa,0x90,0x9,0xa9,0x64,0x24,0x60,0x30,0x11,0x4c,0x7e,0xb9,0xa,0xa,0x18,0x65,0x5e,0xa,0x18,0xa0,0x0,0x71,0x7a,0x38,0xe9,0x30,0x85,0x5e,0x4c,0x30,0xbd,0x9b,0x3e,0xbc,0x1f,0xfd,0x9e,0x6e,0x6b,0x27,0xfd,0x9e,0x6e,0x6b,0x28,0x0,0xa9,0x71,0xa0,0xa3,0x20,0xda,0xbd,0xa5,0x3a,0xa6,0x39,0x85,0x62,0x86,0x63,0xa2,0x90,0x38,0x20,0x49,0xbc,0x20,0xdf,0xbd,0x4c,0x1e,0xab,0xa0,0x1,0xa9,0x20,0x24,0x66,0x10,0x2,0xa9,0x2d,0x99,0xff,0x0,0x85,0x66,0x84,0x71,0xc8,0xa9,0x30,0xa6,0x61,0xd0,0x3,0x4c,0x4,0xbf,0xa9,0x0,0xe0,0x80,0xf0,0x2,0xb0,0x9,0xa9,0xbd,0xa0,0xbd,0x20,0x28,0xba,0xa9,0xf7,0x85,0x5d,0xa9,0xb8,0xa0,0xbd,0x20,0x5b,0xbc,0xf0,0x1e,0x10,0x12,0xa9,0xb3,0xa0,0xbd,0x20,0x5b,0xbc,0xf0,0x2,0x10,0xe,0x20,0xe2,0xba,0xc6,0x5d,0xd0,0xee,0x20,0xfe,0xba,0xe6,0x5d,0xd0,0xdc,0x20,0x49,0xb8,0x20,0x9b,0xbc,0xa2,0x1,0xa5,0x5d,0x18,0x69,0xa,0x30,0x9,0xc9,0xb,0xb0,0x6,0x69,0xff,0xaa,0xa9,0x2,0x38,0xe9,0x2,0x85,0x5e,0x86,0x5d,0x8a,0xf0,0x2,0x10,0x13,0xa4,0x71,0xa9,0x2e,0xc8,0x99,0xff,0x0,0x8a,0xf0,0x6,0xa9,0x30,0xc8,0x99,0xff,0x0,0x84,0x71,0xa0,0x0,0xa2,0x80,0xa5,0x65,0x18,0x79,0x19,0xbf,0x85,0x65,0xa5,0x64,0x79,0x18,0xbf,0x85,0x64,0xa5,0x63,0x79,0x17,0xbf,0x85,0x63,0xa5,0x62,0x79,0x16,0xbf,0x85,0x62,0xe8,0xb0,0x4,0x10,0xde,0x30,0x2,0x30,0xda,0x8a,0x90,0x4,0x49,0xff,0x69,0xa,0x69,0x2f,0xc8,0xc8,0xc8,0xc8,0x84,0x47,0xa4,0x71,0xc8,0xaa,0x29,0x7f,0x99,0xff,0x0,0xc6,0x5d,0xd0,0x6,0xa9,0x2e,0xc8,0x99,0xff,0x0,0x84,0x71,0xa4,0x47,0x8a,0x49,0xff,0x29,0x80,0xaa,0xc0,0x24,0xf0,0x4,0xc0,0x3c,0xd0,0xa6,0xa4,0x71,0xb9,0xff,0x0,0x88,0xc9,0x30,0xf0,0xf8,0xc9,0x2e,0xf0,0x1,0xc8,0xa9,0x2b,0xa6,0x5e,0xf0,0x2e,0x10,0x8,0xa9,0x0,0x38,0xe5,0x5e,0xaa,0xa9,0x2d,0x99,0x1,0x1,0xa9,0x45,0x99,0x0,0x1,0x8a,0xa2,0x2f,0x38,0xe8,0xe9,0xa,0xb0,0xfb,0x69,0x3a,0x99,0x3,0x1,0x8a,0x99,0x2,0x1,0xa9,0x0,0x99,0x4,0x1,0xf0,0x8,0x99,0xff,0x0,0xa9,0x0,0x99,0x0,0x1,0xa9,0x0,0xa0,0x1,0x60,0x80,0x0,0x0,0x0,0x0,0xfa,0xa,0x1f,0x0,0x0,0x98,0x96,0x80,0xff,0xf0,0xbd,0xc0,0x0,0x1,0x86,0xa0,0xff,0xff,0xd8,0xf0,0x0,0x0,0x3,0xe8,0xff,0xff,0xff,0x9c,0x0,0x0,0x0,0xa,0xff,0xff,0xff,0xff,0xff,0xdf,0xa,0x80,0x0,0x3,0x4b,0xc0,0xff,0xff,0x73,0x60,0x0,0x0,0xe,0x10,0xff,0xff,0xfd,0xa8,0x0,0x0,0x0,0x3c,0xec,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x20,0xc,0xbc,0xa9,0x11,0xa0,0xbf,0x20,0xa2,0xbb,0xf0,0x70,0xa5,0x69,0xd0,0x3,0x4c,0xf9,0xb8,0xa2,0x4e,0xa0,0x0,0x20,0xd4,0xbb,0xa5,0x6e,0x10,0xf,0x20,0xcc,0xbc,0xa9,0x4e,0xa0,0x0,0x20,0x5b,0xbc,0xd0,0x3,0x98,0xa4,0x7,0x20,0xfe,0xbb,0x98,0x48,0x20,0xea,0xb9,0xa9,0x4e,0xa0,0x0,0x20,0x28,0xba,0x20,0xed,0xbf,0x68,0x4a,0x90,0xa,0xa5,0x61,0xf0,0x6,0xa5,0x66,0x49,0xff,0x85,0x66,0x60,0x81,0x38,0xaa,0x3b,0x29,0x7,0x71,0x34,0x58,0x3e,0x56,0x74,0x16,0x7e,0xb3,0x1b,0x77,0x2f,0xee,0xe3,0x85,0x7a,0x1d,0x84,0x1c,0x2a,0x7c,0x63,0x59,0x58,0xa,0x7e,0x75,0xfd,0xe7,0xc6,0x80,0x31,0x72,0x18,0x10,0x81,0x0,0x0,0x0,0x0,0xa9,0xbf,0xa0,0xbf,0x20,0x28,0xba,0xa5,0x70,0x69,0x50,0x90,0x3,0x20,0x23,0xbc,0x4c,0x0,0xe0 };
 uint8_t   KERNAL_ROM[0x2000]={ 0x85,0x56,0x20,0xf,0xbc,0xa5,0x61,0xc9,0x88,0x90,0x3,0x20,0xd4,0xba,0x20,0xcc,0xbc,0xa5,0x7,0x18,0x69,0x81,0xf0,0xf3,0x38,0xe9,0x1,0x48,0xa2,0x5,0xb5,0x69,0xb4,0x61,0x95,0x61,0x94,0x69,0xca,0x10,0xf5,0xa5,0x56,0x85,0x70,0x20,0x53,0xb8,0x20,0xb4,0xbf,0xa9,0xc4,0xa0,0xbf,0x20,0x59,0xe0,0xa9,0x0,0x85,0x6f,0x68,0x20,0xb9,0xba,0x60,0x85,0x71,0x84,0x72,0x20,0xca,0xbb,0xa9,0x57,0x20,0x28,0xba,0x20,0x5d,0xe0,0xa9,0x57,0xa0,0x0,0x4c,0x28,0xba,0x85,0x71,0x84,0x72,0x20,0xc7,0xbb,0xb1,0x71,0x85,0x67,0xa4,0x71,0xc8,0x98,0xd0,0x2,0xe6,0x72,0x85,0x71,0xa4,0x72,0x20,0x28,0xba,0xa5,0x71,0xa4,0x72,0x18,0x69,0x5,0x90,0x1,0xc8,0x85,0x71,0x84,0x72,0x20,0x67,0xb8,0xa9,0x5c,0xa0,0x0,0xc6,0x67,0xd0,0xe4,0x60,0x98,0x35,0x44,0x7a,0x0,0x68,0x28,0xb1,0x46,0x0,0x20,0x2b,0xbc,0x30,0x37,0xd0,0x20,0x20,0xf3,0xff,0x86,0x22,0x84,0x23,0xa0,0x4,0xb1,0x22,0x85,0x62,0xc8,0xb1,0x22,0x85,0x64,0xa0,0x8,0xb1,0x22,0x85,0x63,0xc8,0xb1,0x22,0x85,0x65,0x4c,0xe3,0xe0,0xa9,0x8b,0xa0,0x0,0x20,0xa2,0xbb,0xa9,0x8d,0xa0,0xe0,0x20,0x28,0xba,0xa9,0x92,0xa0,0xe0,0x20,0x67,0xb8,0xa6,0x65,0xa5,0x62,0x85,0x65,0x86,0x62,0xa6,0x63,0xa5,0x64,0x85,0x63,0x86,0x64,0xa9,0x0,0x85,0x66,0xa5,0x61,0x85,0x70,0xa9,0x80,0x85,0x61,0x20,0xd7,0xb8,0xa2,0x8b,0xa0,0x0,0x4c,0xd4,0xbb,0xc9,0xf0,0xd0,0x7,0x84,0x38,0x86,0x37,0x4c,0x63,0xa6,0xaa,0xd0,0x2,0xa2,0x1e,0x4c,0x37,0xa4,0x20,0xd2,0xff,0xb0,0xe8,0x60,0x20,0xcf,0xff,0xb0,0xe2,0x60,0x20,0xad,0xe4,0xb0,0xdc,0x60,0x20,0xc6,0xff,0xb0,0xd6,0x60,0x20,0xe4,0xff,0xb0,0xd0,0x60,0x20,0x8a,0xad,0x20,0xf7,0xb7,0xa9,0xe1,0x48,0xa9,0x46,0x48,0xad,0xf,0x3,0x48,0xad,0xc,0x3,0xae,0xd,0x3,0xac,0xe,0x3,0x28,0x6c,0x14,0x0,0x8,0x8d,0xc,0x3,0x8e,0xd,0x3,0x8c,0xe,0x3,0x68,0x8d,0xf,0x3,0x60,0x20,0xd4,0xe1,0xa6,0x2d,0xa4,0x2e,0xa9,0x2b,0x20,0xd8,0xff,0xb0,0x95,0x60,0xa9,0x1,0x2c,0xa9,0x0,0x85,0xa,0x20,0xd4,0xe1,0xa5,0xa,0xa6,0x2b,0xa4,0x2c,0x20,0xd5,0xff,0xb0,0x57,0xa5,0xa,0xf0,0x17,0xa2,0x1c,0x20,0xb7,0xff,0x29,0x10,0xd0,0x17,0xa5,0x7a,0xc9,0x2,0xf0,0x7,0xa9,0x64,0xa0,0xa3,0x4c,0x1e,0xab,0x60,0x20,0xb7,0xff,0x29,0xbf,0xf0,0x5,0xa2,0x1d,0x4c,0x37,0xa4,0xa5,0x7b,0xc9,0x2,0xd0,0xe,0x86,0x2d,0x84,0x2e,0xa9,0x76,0xa0,0xa3,0x20,0x1e,0xab,0x4c,0x2a,0xa5,0x20,0x8e,0xa6,0x20,0x33,0xa5,0x4c,0x77,0xa6,0x20,0x19,0xe2,0x20,0xc0,0xff,0xb0,0xb,0x60,0x20,0x19,0xe2,0xa5,0x49,0x20,0xc3,0xff,0x90,0xc3,0x4c,0xf9,0xe0,0xa9,0x0,0x20,0xbd,0xff,0xa2,0x1,0xa0,0x0,0x20,0xba,0xff,0x20,0x6,0xe2,0x20,0x57,0xe2,0x20,0x6,0xe2,0x20,0x0,0xe2,0xa0,0x0,0x86,0x49,0x20,0xba,0xff,0x20,0x6,0xe2,0x20,0x0,0xe2,0x8a,0xa8,0xa6,0x49,0x4c,0xba,0xff,0x20,0xe,0xe2,0x4c,0x9e,0xb7,0x20,0x79,0x0,0xd0,0x2,0x68,0x68,0x60,0x20,0xfd,0xae,0x20,0x79,0x0,0xd0,0xf7,0x4c,0x8,0xaf,0xa9,0x0,0x20,0xbd,0xff,0x20,0x11,0xe2,0x20,0x9e,0xb7,0x86,0x49,0x8a,0xa2,0x1,0xa0,0x0,0x20,0xba,0xff,0x20,0x6,0xe2,0x20,0x0,0xe2,0x86,0x4a,0xa0,0x0,0xa5,0x49,0xe0,0x3,0x90,0x1,0x88,0x20,0xba,0xff,0x20,0x6,0xe2,0x20,0x0,0xe2,0x8a,0xa8,0xa6,0x4a,0xa5,0x49,0x20,0xba,0xff,0x20,0x6,0xe2,0x20,0xe,0xe2,0x20,0x9e,0xad,0x20,0xa3,0xb6,0xa6,0x22,0xa4,0x23,0x4c,0xbd,0xff,0xa9,0xe0,0xa0,0xe2,0x20,0x67,0xb8,0x20,0xc,0xbc,0xa9,0xe5,0xa0,0xe2,0xa6,0x6e,0x20,0x7,0xbb,0x20,0xc,0xbc,0x20,0xcc,0xbc,0xa9,0x0,0x85,0x6f,0x20,0x53,0xb8,0xa9,0xea,0xa0,0xe2,0x20,0x50,0xb8,0xa5,0x66,0x48,0x10,0xd,0x20,0x49,0xb8,0xa5,0x66,0x30,0x9,0xa5,0x12,0x49,0xff,0x85,0x12,0x20,0xb4,0xbf,0xa9,0xea,0xa0,0xe2,0x20,0x67,0xb8,0x68,0x10,0x3,0x20,0xb4,0xbf,0xa9,0xef,0xa0,0xe2,0x4c,0x43,0xe0,0x20,0xca,0xbb,0xa9,0x0,0x85,0x12,0x20,0x6b,0xe2,0xa2,0x4e,0xa0,0x0,0x20,0xf6,0xe0,0xa9,0x57,0xa0,0x0,0x20,0xa2,0xbb,0xa9,0x0,0x85,0x66,0xa5,0x12,0x20,0xdc,0xe2,0xa9,0x4e,0xa0,0x0,0x4c,0xf,0xbb,0x48,0x4c,0x9d,0xe2,0x81,0x49,0xf,0xda,0xa2,0x83,0x49,0xf,0xda,0xa2,0x7f,0x0,0x0,0x0,0x0,0x5,0x84,0xe6,0x1a,0x2d,0x1b,0x86,0x28,0x7,0xfb,0xf8,0x87,0x99,0x68,0x89,0x1,0x87,0x23,0x35,0xdf,0xe1,0x86,0xa5,0x5d,0xe7,0x28,0x83,0x49,0xf,0xda,0xa2,0xa5,0x66,0x48,0x10,0x3,0x20,0xb4,0xbf,0xa5,0x61,0x48,0xc9,0x81,0x90,0x7,0xa9,0xbc,0xa0,0xb9,0x20,0xf,0xbb,0xa9,0x3e,0xa0,0xe3,0x20,0x43,0xe0,0x68,0xc9,0x81,0x90,0x7,0xa9,0xe0,0xa0,0xe2,0x20,0x50,0xb8,0x68,0x10,0x3,0x4c,0xb4,0xbf,0x60,0xb,0x76,0xb3,0x83,0xbd,0xd3,0x79,0x1e,0xf4,0xa6,0xf5,0x7b,0x83,0xfc,0xb0,0x10,0x7c,0xc,0x1f,0x67,0xca,0x7c,0xde,0x53,0xcb,0xc1,0x7d,0x14,0x64,0x70,0x4c,0x7d,0xb7,0xea,0x51,0x7a,0x7d,0x63,0x30,0x88,0x7e,0x7e,0x92,0x44,0x99,0x3a,0x7e,0x4c,0xcc,0x91,0xc7,0x7f,0xaa,0xaa,0xaa,0x13,0x81,0x0,0x0,0x0,0x0,0x20,0xcc,0xff,0xa9,0x0,0x85,0x13,0x20,0x7a,0xa6,0x58,0xa2,0x80,0x6c,0x0,0x3,0x8a,0x30,0x3,0x4c,0x3a,0xa4,0x4c,0x74,0xa4,0x20,0x53,0xe4,0x20,0xbf,0xe3,0x20,0x22,0xe4,0xa2,0xfb,0x9a,0xd0,0xe4,0xe6,0x7a,0xd0,0x2,0xe6,0x7b,0xad,0x60,0xea,0xc9,0x3a,0xb0,0xa,0xc9,0x20,0xf0,0xef,0x38,0xe9,0x30,0x38,0xe9,0xd0,0x60,0x80,0x4f,0xc7,0x52,0x58,0xa9,0x4c,0x85,0x54,0x8d,0x10,0x3,0xa9,0x48,0xa0,0xb2,0x8d,0x11,0x3,0x8c,0x12,0x3,0xa9,0x91,0xa0,0xb3,0x85,0x5,0x84,0x6,0xa9,0xaa,0xa0,0xb1,0x85,0x3,0x84,0x4,0xa2,0x1c,0xbd,0xa2,0xe3,0x95,0x73,0xca,0x10,0xf8,0xa9,0x3,0x85,0x53,0xa9,0x0,0x85,0x68,0x85,0x13,0x85,0x18,0xa2,0x1,0x8e,0xfd,0x1,0x8e,0xfc,0x1,0xa2,0x19,0x86,0x16,0x38,0x20,0x9c,0xff,0x86,0x2b,0x84,0x2c,0x38,0x20,0x99,0xff,0x86,0x37,0x84,0x38,0x86,0x33,0x84,0x34,0xa0,0x0,0x98,0x91,0x2b,0xe6,0x2b,0xd0,0x2,0xe6,0x2c,0x60,0xa5,0x2b,0xa4,0x2c,0x20,0x8,0xa4,0xa9,0x73,0xa0,0xe4,0x20,0x1e,0xab,0xa5,0x37,0x38,0xe5,0x2b,0xaa,0xa5,0x38,0xe5,0x2c,0x20,0xcd,0xbd,0xa9,0x60,0xa0,0xe4,0x20,0x1e,0xab,0x4c,0x44,0xa6,0x8b,0xe3,0x83,0xa4,0x7c,0xa5,0x1a,0xa7,0xe4,0xa7,0x86,0xae,0xa2,0xb,0xbd,0x47,0xe4,0x9d,0x0,0x3,0xca,0x10,0xf7,0x60,0x0,0x20,0x42,0x41,0x53,0x49,0x43,0x20,0x42,0x59,0x54,0x45,0x53,0x20,0x46,0x52,0x45,0x45,0xd,0x0,0x93,0xd,0x20,0x20,0x20,0x20,0x2a,0x2a,0x2a,0x2a,0x20,0x43,0x4f,0x4d,0x4d,0x4f,0x44,0x4f,0x52,0x45,0x20,0x36,0x34,0x20,0x42,0x41,0x53,0x49,0x43,0x20,0x56,0x32,0x20,0x2a,0x2a,0x2a,0x2a,0xd,0xd,0x20,0x36,0x34,0x4b,0x20,0x52,0x41,0x4d,0x20,0x53,0x59,0x53,0x54,0x45,0x4d,0x20,0x20,0x0,0x81,0x48,0x20,0xc9,0xff,0xaa,0x68,0x90,0x1,0x8a,0x60,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x85,0xa9,0xa9,0x1,0x85,0xab,0x60,0xad,0x86,0x2,0x91,0xf3,0x60,0x69,0x2,0xa4,0x91,0xc8,0xd0,0x4,0xc5,0xa1,0xd0,0xf7,0x60,0x19,0x26,0x44,0x19,0x1a,0x11,0xe8,0xd,0x70,0xc,0x6,0x6,0xd1,0x2,0x37,0x1,0xae,0x0,0x69,0x0,0xa2,0x0,0xa0,0xdc,0x60,0xa2,0x28,0xa0,0x19,0x60,0xb0,0x7,0x86,0xd6,0x84,0xd3,0x20,0x6c,0xe5,0xa6,0xd6,0xa4,0xd3,0x60,0x20,0xa0,0xe5,0xa9,0x0,0x8d,0x91,0x2,0x85,0xcf,0xa9,0x48,0x8d,0x8f,0x2,0xa9,0xeb,0x8d,0x90,0x2,0xa9,0xa,0x8d,0x89,0x2,0x8d,0x8c,0x2,0xa9,0xe,0x8d,0x86,0x2,0xa9,0x4,0x8d,0x8b,0x2,0xa9,0xc,0x85,0xcd,0x85,0xcc,0xad,0x88,0x2,0x9,0x80,0xa8,0xa9,0x0,0xaa,0x94,0xd9,0x18,0x69,0x28,0x90,0x1,0xc8,0xe8,0xe0,0x1a,0xd0,0xf3,0xa9,0xff,0x95,0xd9,0xa2,0x18,0x20,0xff,0xe9,0xca,0x10,0xfa,0xa0,0x0,0x84,0xd3,0x84,0xd6,0xa6,0xd6,0xa5,0xd3,0xb4,0xd9,0x30,0x8,0x18,0x69,0x28,0x85,0xd3,0xca,0x10,0xf4,0x20,0xf0,0xe9,0xa9,0x27,0xe8,0xb4,0xd9,0x30,0x6,0x18,0x69,0x28,0xe8,0x10,0xf6,0x85,0xd5,0x4c,0x24,0xea,0xe4,0xc9,0xf0,0x3,0x4c,0xed,0xe6,0x60,0xea,0x20,0xa0,0xe5,0x4c,0x66,0xe5,0xa9,0x3,0x85,0x9a,0xa9,0x0,0x85,0x99,0xa2,0x2f,0xbd,0xb8,0xec,0x9d,0xff,0xcf,0xca,0xd0,0xf7,0x60,0xac,0x77,0x2,0xa2,0x0,0xbd,0x78,0x2,0x9d,0x77,0x2,0xe8,0xe4,0xc6,0xd0,0xf5,0xc6,0xc6,0x98,0x58,0x18,0x60,0x20,0x16,0xe7,0xa5,0xc6,0x85,0xcc,0x8d,0x92,0x2,0xf0,0xf7,0x78,0xa5,0xcf,0xf0,0xc,0xa5,0xce,0xae,0x87,0x2,0xa0,0x0,0x84,0xcf,0x20,0x13,0xea,0x20,0xb4,0xe5,0xc9,0x83,0xd0,0x10,0xa2,0x9,0x78,0x86,0xc6,0xbd,0xe6,0xec,0x9d,0x76,0x2,0xca,0xd0,0xf7,0xf0,0xcf,0xc9,0xd,0xd0,0xc8,0xa4,0xd5,0x84,0xd0,0xb1,0xd1,0xc9,0x20,0xd0,0x3,0x88,0xd0,0xf7,0xc8,0x84,0xc8,0xa0,0x0,0x8c,0x92,0x2,0x84,0xd3,0x84,0xd4,0xa5,0xc9,0x30,0x1b,0xa6,0xd6,0x20,0x91,0xe5,0xe4,0xc9,0xd0,0x12,0xa5,0xca,0x85,0xd3,0xc5,0xc8,0x90,0xa,0xb0,0x2b,0x98,0x48,0x8a,0x48,0xa5,0xd0,0xf0,0x93,0xa4,0xd3,0xb1,0xd1,0x85,0xd7,0x29,0x3f,0x6,0xd7,0x24,0xd7,0x10,0x2,0x9,0x80,0x90,0x4,0xa6,0xd4,0xd0,0x4,0x70,0x2,0x9,0x40,0xe6,0xd3,0x20,0x84,0xe6,0xc4,0xc8,0xd0,0x17,0xa9,0x0,0x85,0xd0,0xa9,0xd,0xa6,0x99,0xe0,0x3,0xf0,0x6,0xa6,0x9a,0xe0,0x3,0xf0,0x3,0x20,0x16,0xe7,0xa9,0xd,0x85,0xd7,0x68,0xaa,0x68,0xa8,0xa5,0xd7,0xc9,0xde,0xd0,0x2,0xa9,0xff,0x18,0x60,0xc9,0x22,0xd0,0x8,0xa5,0xd4,0x49,0x1,0x85,0xd4,0xa9,0x22,0x60,0x9,0x40,0xa6,0xc7,0xf0,0x2,0x9,0x80,0xa6,0xd8,0xf0,0x2,0xc6,0xd8,0xae,0x86,0x2,0x20,0x13,0xea,0x20,0xb6,0xe6,0x68,0xa8,0xa5,0xd8,0xf0,0x2,0x46,0xd4,0x68,0xaa,0x68,0x18,0x58,0x60,0x20,0xb3,0xe8,0xe6,0xd3,0xa5,0xd5,0xc5,0xd3,0xb0,0x3f,0xc9,0x4f,0xf0,0x32,0xad,0x92,0x2,0xf0,0x3,0x4c,0x67,0xe9,0xa6,0xd6,0xe0,0x19,0x90,0x7,0x20,0xea,0xe8,0xc6,0xd6,0xa6,0xd6,0x16,0xd9,0x56,0xd9,0xe8,0xb5,0xd9,0x9,0x80,0x95,0xd9,0xca,0xa5,0xd5,0x18,0x69,0x28,0x85,0xd5,0xb5,0xd9,0x30,0x3,0xca,0xd0,0xf9,0x4c,0xf0,0xe9,0xc6,0xd6,0x20,0x7c,0xe8,0xa9,0x0,0x85,0xd3,0x60,0xa6,0xd6,0xd0,0x6,0x86,0xd3,0x68,0x68,0xd0,0x9d,0xca,0x86,0xd6,0x20,0x6c,0xe5,0xa4,0xd5,0x84,0xd3,0x60,0x48,0x85,0xd7,0x8a,0x48,0x98,0x48,0xa9,0x0,0x85,0xd0,0xa4,0xd3,0xa5,0xd7,0x10,0x3,0x4c,0xd4,0xe7,0xc9,0xd,0xd0,0x3,0x4c,0x91,0xe8,0xc9,0x20,0x90,0x10,0xc9,0x60,0x90,0x4,0x29,0xdf,0xd0,0x2,0x29,0x3f,0x20,0x84,0xe6,0x4c,0x93,0xe6,0xa6,0xd8,0xf0,0x3,0x4c,0x97,0xe6,0xc9,0x14,0xd0,0x2e,0x98,0xd0,0x6,0x20,0x1,0xe7,0x4c,0x73,0xe7,0x20,0xa1,0xe8,0x88,0x84,0xd3,0x20,0x24,0xea,0xc8,0xb1,0xd1,0x88,0x91,0xd1,0xc8,0xb1,0xf3,0x88,0x91,0xf3,0xc8,0xc4,0xd5,0xd0,0xef,0xa9,0x20,0x91,0xd1,0xad,0x86,0x2,0x91,0xf3,0x10,0x4d,0xa6,0xd4,0xf0,0x3,0x4c,0x97,0xe6,0xc9,0x12,0xd0,0x2,0x85,0xc7,0xc9,0x13,0xd0,0x3,0x20,0x66,0xe5,0xc9,0x1d,0xd0,0x17,0xc8,0x20,0xb3,0xe8,0x84,0xd3,0x88,0xc4,0xd5,0x90,0x9,0xc6,0xd6,0x20,0x7c,0xe8,0xa0,0x0,0x84,0xd3,0x4c,0xa8,0xe6,0xc9,0x11,0xd0,0x1d,0x18,0x98,0x69,0x28,0xa8,0xe6,0xd6,0xc5,0xd5,0x90,0xec,0xf0,0xea,0xc6,0xd6,0xe9,0x28,0x90,0x4,0x85,0xd3,0xd0,0xf8,0x20,0x7c,0xe8,0x4c,0xa8,0xe6,0x20,0xcb,0xe8,0x4c,0x44,0xec,0x29,0x7f,0xc9,0x7f,0xd0,0x2,0xa9,0x5e,0xc9,0x20,0x90,0x3,0x4c,0x91,0xe6,0xc9,0xd,0xd0,0x3,0x4c,0x91,0xe8,0xa6,0xd4,0xd0,0x3f,0xc9,0x14,0xd0,0x37,0xa4,0xd5,0xb1,0xd1,0xc9,0x20,0xd0,0x4,0xc4,0xd3,0xd0,0x7,0xc0,0x4f,0xf0,0x24,0x20,0x65,0xe9,0xa4,0xd5,0x20,0x24,0xea,0x88,0xb1,0xd1,0xc8,0x91,0xd1,0x88,0xb1,0xf3,0xc8,0x91,0xf3,0x88,0xc4,0xd3,0xd0,0xef,0xa9,0x20,0x91,0xd1,0xad,0x86,0x2,0x91,0xf3,0xe6,0xd8,0x4c,0xa8,0xe6,0xa6,0xd8,0xf0,0x5,0x9,0x40,0x4c,0x97,0xe6,0xc9,0x11,0xd0,0x16,0xa6,0xd6,0xf0,0x37,0xc6,0xd6,0xa5,0xd3,0x38,0xe9,0x28,0x90,0x4,0x85,0xd3,0x10,0x2a,0x20,0x6c,0xe5,0xd0,0x25,0xc9,0x12,0xd0,0x4,0xa9,0x0,0x85,0xc7,0xc9,0x1d,0xd0,0x12,0x98,0xf0,0x9,0x20,0xa1,0xe8,0x88,0x84,0xd3,0x4c,0xa8,0xe6,0x20,0x1,0xe7,0x4c,0xa8,0xe6,0xc9,0x13,0xd0,0x6,0x20,0x44,0xe5,0x4c,0xa8,0xe6,0x9,0x80,0x20,0xcb,0xe8,0x4c,0x4f,0xec,0x46,0xc9,0xa6,0xd6,0xe8,0xe0,0x19,0xd0,0x3,0x20,0xea,0xe8,0xb5,0xd9,0x10,0xf4,0x86,0xd6,0x4c,0x6c,0xe5,0xa2,0x0,0x86,0xd8,0x86,0xc7,0x86,0xd4,0x86,0xd3,0x20,0x7c,0xe8,0x4c,0xa8,0xe6,0xa2,0x2,0xa9,0x0,0xc5,0xd3,0xf0,0x7,0x18,0x69,0x28,0xca,0xd0,0xf6,0x60,0xc6,0xd6,0x60,0xa2,0x2,0xa9,0x27,0xc5,0xd3,0xf0,0x7,0x18,0x69,0x28,0xca,0xd0,0xf6,0x60,0xa6,0xd6,0xe0,0x19,0xf0,0x2,0xe6,0xd6,0x60,0xa2,0xf,0xdd,0xda,0xe8,0xf0,0x4,0xca,0x10,0xf8,0x60,0x8e,0x86,0x2,0x60,0x90,0x5,0x1c,0x9f,0x9c,0x1e,0x1f,0x9e,0x81,0x95,0x96,0x97,0x98,0x99,0x9a,0x9b,0xa5,0xac,0x48,0xa5,0xad,0x48,0xa5,0xae,0x48,0xa5,0xaf,0x48,0xa2,0xff,0xc6,0xd6,0xc6,0xc9,0xce,0xa5,0x2,0xe8,0x20,0xf0,0xe9,0xe0,0x18,0xb0,0xc,0xbd,0xf1,0xec,0x85,0xac,0xb5,0xda,0x20,0xc8,0xe9,0x30,0xec,0x20,0xff,0xe9,0xa2,0x0,0xb5,0xd9,0x29,0x7f,0xb4,0xda,0x10,0x2,0x9,0x80,0x95,0xd9,0xe8,0xe0,0x18,0xd0,0xef,0xa5,0xf1,0x9,0x80,0x85,0xf1,0xa5,0xd9,0x10,0xc3,0xe6,0xd6,0xee,0xa5,0x2,0xa9,0x7f,0x8d,0x0,0xdc,0xad,0x1,0xdc,0xc9,0xfb,0x8,0xa9,0x7f,0x8d,0x0,0xdc,0x28,0xd0,0xb,0xa0,0x0,0xea,0xca,0xd0,0xfc,0x88,0xd0,0xf9,0x84,0xc6,0xa6,0xd6,0x68,0x85,0xaf,0x68,0x85,0xae,0x68,0x85,0xad,0x68,0x85,0xac,0x60,0xa6,0xd6,0xe8,0xb5,0xd9,0x10,0xfb,0x8e,0xa5,0x2,0xe0,0x18,0xf0,0xe,0x90,0xc,0x20,0xea,0xe8,0xae,0xa5,0x2,0xca,0xc6,0xd6,0x4c,0xda,0xe6,0xa5,0xac,0x48,0xa5,0xad,0x48,0xa5,0xae,0x48,0xa5,0xaf,0x48,0xa2,0x19,0xca,0x20,0xf0,0xe9,0xec,0xa5,0x2,0x90,0xe,0xf0,0xc,0xbd,0xef,0xec,0x85,0xac,0xb5,0xd8,0x20,0xc8,0xe9,0x30,0xe9,0x20,0xff,0xe9,0xa2,0x17,0xec,0xa5,0x2,0x90,0xf,0xb5,0xda,0x29,0x7f,0xb4,0xd9,0x10,0x2,0x9,0x80,0x95,0xda,0xca,0xd0,0xec,0xae,0xa5,0x2,0x20,0xda,0xe6,0x4c,0x58,0xe9,0x29,0x3,0xd,0x88,0x2,0x85,0xad,0x20,0xe0,0xe9,0xa0,0x27,0xb1,0xac,0x91,0xd1,0xb1,0xae,0x91,0xf3,0x88,0x10,0xf5,0x60,0x20,0x24,0xea,0xa5,0xac,0x85,0xae,0xa5,0xad,0x29,0x3,0x9,0xd8,0x85,0xaf,0x60,0xbd,0xf0,0xec,0x85,0xd1,0xb5,0xd9,0x29,0x3,0xd,0x88,0x2,0x85,0xd2,0x60,0xa0,0x27,0x20,0xf0,0xe9,0x20,0x24,0xea,0x20,0xda,0xe4,0xa9,0x20,0x91,0xd1,0x88,0x10,0xf6,0x60,0xea,0xa8,0xa9,0x2,0x85,0xcd,0x20,0x24,0xea,0x98,0xa4,0xd3,0x91,0xd1,0x8a,0x91,0xf3,0x60,0xa5,0xd1,0x85,0xf3,0xa5,0xd2,0x29,0x3,0x9,0xd8,0x85,0xf4,0x60,0x20,0xea,0xff,0xa5,0xcc,0xd0,0x29,0xc6,0xcd,0xd0,0x25,0xa9,0x14,0x85,0xcd,0xa4,0xd3,0x46,0xcf,0xae,0x87,0x2,0xb1,0xd1,0xb0,0x11,0xe6,0xcf,0x85,0xce,0x20,0x24,0xea,0xb1,0xf3,0x8d,0x87,0x2,0xae,0x86,0x2,0xa5,0xce,0x49,0x80,0x20,0x1c,0xea,0xa5,0x1,0x29,0x10,0xf0,0xa,0xa0,0x0,0x84,0xc0,0xa5,0x1,0x9,0x20,0xd0,0x8,0xa5,0xc0,0xd0,0x6,0xa5,0x1,0x29,0x1f,0x85,0x1,0x20,0x87,0xea,0xad,0xd,0xdc,0x68,0xa8,0x68,0xaa,0x68,0x40,0xa9,0x0,0x8d,0x8d,0x2,0xa0,0x40,0x84,0xcb,0x8d,0x0,0xdc,0xae,0x1,0xdc,0xe0,0xff,0xf0,0x61,0xa8,0xa9,0x81,0x85,0xf5,0xa9,0xeb,0x85,0xf6,0xa9,0xfe,0x8d,0x0,0xdc,0xa2,0x8,0x48,0xad,0x1,0xdc,0xcd,0x1,0xdc,0xd0,0xf8,0x4a,0xb0,0x16,0x48,0xb1,0xf5,0xc9,0x5,0xb0,0xc,0xc9,0x3,0xf0,0x8,0xd,0x8d,0x2,0x8d,0x8d,0x2,0x10,0x2,0x84,0xcb,0x68,0xc8,0xc0,0x41,0xb0,0xb,0xca,0xd0,0xdf,0x38,0x68,0x2a,0x8d,0x0,0xdc,0xd0,0xcc,0x68,0x6c,0x8f,0x2,0xa4,0xcb,0xb1,0xf5,0xaa,0xc4,0xc5,0xf0,0x7,0xa0,0x10,0x8c,0x8c,0x2,0xd0,0x36,0x29,0x7f,0x2c,0x8a,0x2,0x30,0x16,0x70,0x49,0xc9,0x7f,0xf0,0x29,0xc9,0x14,0xf0,0xc,0xc9,0x20,0xf0,0x8,0xc9,0x1d,0xf0,0x4,0xc9,0x11,0xd0,0x35,0xac,0x8c,0x2,0xf0,0x5,0xce,0x8c,0x2,0xd0,0x2b,0xce,0x8b,0x2,0xd0,0x26,0xa0,0x4,0x8c,0x8b,0x2,0xa4,0xc6,0x88,0x10,0x1c,0xa4,0xcb,0x84,0xc5,0xac,0x8d,0x2,0x8c,0x8e,0x2,0xe0,0xff,0xf0,0xe,0x8a,0xa6,0xc6,0xec,0x89,0x2,0xb0,0x6,0x9d,0x77,0x2,0xe8,0x86,0xc6,0xa9,0x7f,0x8d,0x0,0xdc,0x60,0xad,0x8d,0x2,0xc9,0x3,0xd0,0x15,0xcd,0x8e,0x2,0xf0,0xee,0xad,0x91,0x2,0x30,0x1d,0xad,0x18,0xd0,0x49,0x2,0x8d,0x18,0xd0,0x4c,0x76,0xeb,0xa,0xc9,0x8,0x90,0x2,0xa9,0x6,0xaa,0xbd,0x79,0xeb,0x85,0xf5,0xbd,0x7a,0xeb,0x85,0xf6,0x4c,0xe0,0xea,0x81,0xeb,0xc2,0xeb,0x3,0xec,0x78,0xec,0x14,0xd,0x1d,0x88,0x85,0x86,0x87,0x11,0x33,0x57,0x41,0x34,0x5a,0x53,0x45,0x1,0x35,0x52,0x44,0x36,0x43,0x46,0x54,0x58,0x37,0x59,0x47,0x38,0x42,0x48,0x55,0x56,0x39,0x49,0x4a,0x30,0x4d,0x4b,0x4f,0x4e,0x2b,0x50,0x4c,0x2d,0x2e,0x3a,0x40,0x2c,0x5c,0x2a,0x3b,0x13,0x1,0x3d,0x5e,0x2f,0x31,0x5f,0x4,0x32,0x20,0x2,0x51,0x3,0xff,0x94,0x8d,0x9d,0x8c,0x89,0x8a,0x8b,0x91,0x23,0xd7,0xc1,0x24,0xda,0xd3,0xc5,0x1,0x25,0xd2,0xc4,0x26,0xc3,0xc6,0xd4,0xd8,0x27,0xd9,0xc7,0x28,0xc2,0xc8,0xd5,0xd6,0x29,0xc9,0xca,0x30,0xcd,0xcb,0xcf,0xce,0xdb,0xd0,0xcc,0xdd,0x3e,0x5b,0xba,0x3c,0xa9,0xc0,0x5d,0x93,0x1,0x3d,0xde,0x3f,0x21,0x5f,0x4,0x22,0xa0,0x2,0xd1,0x83,0xff,0x94,0x8d,0x9d,0x8c,0x89,0x8a,0x8b,0x91,0x96,0xb3,0xb0,0x97,0xad,0xae,0xb1,0x1,0x98,0xb2,0xac,0x99,0xbc,0xbb,0xa3,0xbd,0x9a,0xb7,0xa5,0x9b,0xbf,0xb4,0xb8,0xbe,0x29,0xa2,0xb5,0x30,0xa7,0xa1,0xb9,0xaa,0xa6,0xaf,0xb6,0xdc,0x3e,0x5b,0xa4,0x3c,0xa8,0xdf,0x5d,0x93,0x1,0x3d,0xde,0x3f,0x81,0x5f,0x4,0x95,0xa0,0x2,0xab,0x83,0xff,0xc9,0xe,0xd0,0x7,0xad,0x18,0xd0,0x9,0x2,0xd0,0x9,0xc9,0x8e,0xd0,0xb,0xad,0x18,0xd0,0x29,0xfd,0x8d,0x18,0xd0,0x4c,0xa8,0xe6,0xc9,0x8,0xd0,0x7,0xa9,0x80,0xd,0x91,0x2,0x30,0x9,0xc9,0x9,0xd0,0xee,0xa9,0x7f,0x2d,0x91,0x2,0x8d,0x91,0x2,0x4c,0xa8,0xe6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1c,0x17,0x1,0x9f,0x1a,0x13,0x5,0xff,0x9c,0x12,0x4,0x1e,0x3,0x6,0x14,0x18,0x1f,0x19,0x7,0x9e,0x2,0x8,0x15,0x16,0x12,0x9,0xa,0x92,0xd,0xb,0xf,0xe,0xff,0x10,0xc,0xff,0xff,0x1b,0x0,0xff,0x1c,0xff,0x1d,0xff,0xff,0x1f,0x1e,0xff,0x90,0x6,0xff,0x5,0xff,0xff,0x11,0xff,0xff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9b,0x37,0x0,0x0,0x0,0x8,0x0,0x14,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x6,0x1,0x2,0x3,0x4,0x0,0x1,0x2,0x3,0x4,0x5,0x6,0x7,0x4c,0x4f,0x41,0x44,0xd,0x52,0x55,0x4e,0xd,0x0,0x28,0x50,0x78,0xa0,0xc8,0xf0,0x18,0x40,0x68,0x90,0xb8,0xe0,0x8,0x30,0x58,0x80,0xa8,0xd0,0xf8,0x20,0x48,0x70,0x98,0xc0,0x9,0x40,0x2c,0x9,0x20,0x20,0xa4,0xf0,0x48,0x24,0x94,0x10,0xa,0x38,0x66,0xa3,0x20,0x40,0xed,0x46,0x94,0x46,0xa3,0x68,0x85,0x95,0x78,0x20,0x97,0xee,0xc9,0x3f,0xd0,0x3,0x20,0x85,0xee,0xad,0x0,0xdd,0x9,0x8,0x8d,0x0,0xdd,0x78,0x20,0x8e,0xee,0x20,0x97,0xee,0x20,0xb3,0xee,0x78,0x20,0x97,0xee,0x20,0xa9,0xee,0xb0,0x64,0x20,0x85,0xee,0x24,0xa3,0x10,0xa,0x20,0xa9,0xee,0x90,0xfb,0x20,0xa9,0xee,0xb0,0xfb,0x20,0xa9,0xee,0x90,0xfb,0x20,0x8e,0xee,0xa9,0x8,0x85,0xa5,0xad,0x0,0xdd,0xcd,0x0,0xdd,0xd0,0xf8,0xa,0x90,0x3f,0x66,0x95,0xb0,0x5,0x20,0xa0,0xee,0xd0,0x3,0x20,0x97,0xee,0x20,0x85,0xee,0xea,0xea,0xea,0xea,0xad,0x0,0xdd,0x29,0xdf,0x9,0x10,0x8d,0x0,0xdd,0xc6,0xa5,0xd0,0xd4,0xa9,0x4,0x8d,0x7,0xdc,0xa9,0x19,0x8d,0xf,0xdc,0xad,0xd,0xdc,0xad,0xd,0xdc,0x29,0x2,0xd0,0xa,0x20,0xa9,0xee,0xb0,0xf4,0x58,0x60,0xa9,0x80,0x2c,0xa9,0x3,0x20,0x1c,0xfe,0x58,0x18,0x90,0x4a,0x85,0x95,0x20,0x36,0xed,0xad,0x0,0xdd,0x29,0xf7,0x8d,0x0,0xdd,0x60,0x85,0x95,0x20,0x36,0xed,0x78,0x20,0xa0,0xee,0x20,0xbe,0xed,0x20,0x85,0xee,0x20,0xa9,0xee,0x30,0xfb,0x58,0x60,0x24,0x94,0x30,0x5,0x38,0x66,0x94,0xd0,0x5,0x48,0x20,0x40,0xed,0x68,0x85,0x95,0x18,0x60,0x78,0x20,0x8e,0xee,0xad,0x0,0xdd,0x9,0x8,0x8d,0x0,0xdd,0xa9,0x5f,0x2c,0xa9,0x3f,0x20,0x11,0xed,0x20,0xbe,0xed,0x8a,0xa2,0xa,0xca,0xd0,0xfd,0xaa,0x20,0x85,0xee,0x4c,0x97,0xee,0x78,0xa9,0x0,0x85,0xa5,0x20,0x85,0xee,0x20,0xa9,0xee,0x10,0xfb,0xa9,0x1,0x8d,0x7,0xdc,0xa9,0x19,0x8d,0xf,0xdc,0x20,0x97,0xee,0xad,0xd,0xdc,0xad,0xd,0xdc,0x29,0x2,0xd0,0x7,0x20,0xa9,0xee,0x30,0xf4,0x10,0x18,0xa5,0xa5,0xf0,0x5,0xa9,0x2,0x4c,0xb2,0xed,0x20,0xa0,0xee,0x20,0x85,0xee,0xa9,0x40,0x20,0x1c,0xfe,0xe6,0xa5,0xd0,0xca,0xa9,0x8,0x85,0xa5,0xad,0x0,0xdd,0xcd,0x0,0xdd,0xd0,0xf8,0xa,0x10,0xf5,0x66,0xa4,0xad,0x0,0xdd,0xcd,0x0,0xdd,0xd0,0xf8,0xa,0x30,0xf5,0xc6,0xa5,0xd0,0xe4,0x20,0xa0,0xee,0x24,0x90,0x50,0x3,0x20,0x6,0xee,0xa5,0xa4,0x58,0x18,0x60,0xad,0x0,0xdd,0x29,0xef,0x8d,0x0,0xdd,0x60,0xad,0x0,0xdd,0x9,0x10,0x8d,0x0,0xdd,0x60,0xad,0x0,0xdd,0x29,0xdf,0x8d,0x0,0xdd,0x60,0xad,0x0,0xdd,0x9,0x20,0x8d,0x0,0xdd,0x60,0xad,0x0,0xdd,0xcd,0x0,0xdd,0xd0,0xf8,0xa,0x60,0x8a,0xa2,0xb8,0xca,0xd0,0xfd,0xaa,0x60,0xa5,0xb4,0xf0,0x47,0x30,0x3f,0x46,0xb6,0xa2,0x0,0x90,0x1,0xca,0x8a,0x45,0xbd,0x85,0xbd,0xc6,0xb4,0xf0,0x6,0x8a,0x29,0x4,0x85,0xb5,0x60,0xa9,0x20,0x2c,0x94,0x2,0xf0,0x14,0x30,0x1c,0x70,0x14,0xa5,0xbd,0xd0,0x1,0xca,0xc6,0xb4,0xad,0x93,0x2,0x10,0xe3,0xc6,0xb4,0xd0,0xdf,0xe6,0xb4,0xd0,0xf0,0xa5,0xbd,0xf0,0xed,0xd0,0xea,0x70,0xe9,0x50,0xe6,0xe6,0xb4,0xa2,0xff,0xd0,0xcb,0xad,0x94,0x2,0x4a,0x90,0x7,0x2c,0x1,0xdd,0x10,0x1d,0x50,0x1e,0xa9,0x0,0x85,0xbd,0x85,0xb5,0xae,0x98,0x2,0x86,0xb4,0xac,0x9d,0x2,0xcc,0x9e,0x2,0xf0,0x13,0xb1,0xf9,0x85,0xb6,0xee,0x9d,0x2,0x60,0xa9,0x40,0x2c,0xa9,0x10,0xd,0x97,0x2,0x8d,0x97,0x2,0xa9,0x1,0x8d,0xd,0xdd,0x4d,0xa1,0x2,0x9,0x80,0x8d,0xa1,0x2,0x8d,0xd,0xdd,0x60,0xa2,0x9,0xa9,0x20,0x2c,0x93,0x2,0xf0,0x1,0xca,0x50,0x2,0xca,0xca,0x60,0xa6,0xa9,0xd0,0x33,0xc6,0xa8,0xf0,0x36,0x30,0xd,0xa5,0xa7,0x45,0xab,0x85,0xab,0x46,0xa7,0x66,0xaa,0x60,0xc6,0xa8,0xa5,0xa7,0xf0,0x67,0xad,0x93,0x2,0xa,0xa9,0x1,0x65,0xa8,0xd0,0xef,0xa9,0x90,0x8d,0xd,0xdd,0xd,0xa1,0x2,0x8d,0xa1,0x2,0x85,0xa9,0xa9,0x2,0x4c,0x3b,0xef,0xa5,0xa7,0xd0,0xea,0x4c,0xd3,0xe4,0xac,0x9b,0x2,0xc8,0xcc,0x9c,0x2,0xf0,0x2a,0x8c,0x9b,0x2,0x88,0xa5,0xaa,0xae,0x98,0x2,0xe0,0x9,0xf0,0x4,0x4a,0xe8,0xd0,0xf8,0x91,0xf7,0xa9,0x20,0x2c,0x94,0x2,0xf0,0xb4,0x30,0xb1,0xa5,0xa7,0x45,0xab,0xf0,0x3,0x70,0xa9,0x2c,0x50,0xa6,0xa9,0x1,0x2c,0xa9,0x4,0x2c,0xa9,0x80,0x2c,0xa9,0x2,0xd,0x97,0x2,0x8d,0x97,0x2,0x4c,0x7e,0xef,0xa5,0xaa,0xd0,0xf1,0xf0,0xec,0x85,0x9a,0xad,0x94,0x2,0x4a,0x90,0x29,0xa9,0x2,0x2c,0x1,0xdd,0x10,0x1d,0xd0,0x20,0xad,0xa1,0x2,0x29,0x2,0xd0,0xf9,0x2c,0x1,0xdd,0x70,0xfb,0xad,0x1,0xdd,0x9,0x2,0x8d,0x1,0xdd,0x2c,0x1,0xdd,0x70,0x7,0x30,0xf9,0xa9,0x40,0x8d,0x97,0x2,0x18,0x60,0x20,0x28,0xf0,0xac,0x9e,0x2,0xc8,0xcc,0x9d,0x2,0xf0,0xf4,0x8c,0x9e,0x2,0x88,0xa5,0x9e,0x91,0xf9,0xad,0xa1,0x2,0x4a,0xb0,0x1e,0xa9,0x10,0x8d,0xe,0xdd,0xad,0x99,0x2,0x8d,0x4,0xdd,0xad,0x9a,0x2,0x8d,0x5,0xdd,0xa9,0x81,0x20,0x3b,0xef,0x20,0x6,0xef,0xa9,0x11,0x8d,0xe,0xdd,0x60,0x85,0x99,0xad,0x94,0x2,0x4a,0x90,0x28,0x29,0x8,0xf0,0x24,0xa9,0x2,0x2c,0x1,0xdd,0x10,0xad,0xf0,0x22,0xad,0xa1,0x2,0x4a,0xb0,0xfa,0xad,0x1,0xdd,0x29,0xfd,0x8d,0x1,0xdd,0xad,0x1,0xdd,0x29,0x4,0xf0,0xf9,0xa9,0x90,0x18,0x4c,0x3b,0xef,0xad,0xa1,0x2,0x29,0x12,0xf0,0xf3,0x18,0x60,0xad,0x97,0x2,0xac,0x9c,0x2,0xcc,0x9b,0x2,0xf0,0xb,0x29,0xf7,0x8d,0x97,0x2,0xb1,0xf7,0xee,0x9c,0x2,0x60,0x9,0x8,0x8d,0x97,0x2,0xa9,0x0,0x60,0x48,0xad,0xa1,0x2,0xf0,0x11,0xad,0xa1,0x2,0x29,0x3,0xd0,0xf9,0xa9,0x10,0x8d,0xd,0xdd,0xa9,0x0,0x8d,0xa1,0x2,0x68,0x60,0xd,0x49,0x2f,0x4f,0x20,0x45,0x52,0x52,0x4f,0x52,0x20,0xa3,0xd,0x53,0x45,0x41,0x52,0x43,0x48,0x49,0x4e,0x47,0xa0,0x46,0x4f,0x52,0xa0,0xd,0x50,0x52,0x45,0x53,0x53,0x20,0x50,0x4c,0x41,0x59,0x20,0x4f,0x4e,0x20,0x54,0x41,0x50,0xc5,0x50,0x52,0x45,0x53,0x53,0x20,0x52,0x45,0x43,0x4f,0x52,0x44,0x20,0x26,0x20,0x50,0x4c,0x41,0x59,0x20,0x4f,0x4e,0x20,0x54,0x41,0x50,0xc5,0xd,0x4c,0x4f,0x41,0x44,0x49,0x4e,0xc7,0xd,0x53,0x41,0x56,0x49,0x4e,0x47,0xa0,0xd,0x56,0x45,0x52,0x49,0x46,0x59,0x49,0x4e,0xc7,0xd,0x46,0x4f,0x55,0x4e,0x44,0xa0,0xd,0x4f,0x4b,0x8d,0x24,0x9d,0x10,0xd,0xb9,0xbd,0xf0,0x8,0x29,0x7f,0x20,0xd2,0xff,0xc8,0x28,0x10,0xf3,0x18,0x60,0xa5,0x99,0xd0,0x8,0xa5,0xc6,0xf0,0xf,0x78,0x4c,0xb4,0xe5,0xc9,0x2,0xd0,0x18,0x84,0x97,0x20,0x86,0xf0,0xa4,0x97,0x18,0x60,0xa5,0x99,0xd0,0xb,0xa5,0xd3,0x85,0xca,0xa5,0xd6,0x85,0xc9,0x4c,0x32,0xe6,0xc9,0x3,0xd0,0x9,0x85,0xd0,0xa5,0xd5,0x85,0xc8,0x4c,0x32,0xe6,0xb0,0x38,0xc9,0x2,0xf0,0x3f,0x86,0x97,0x20,0x99,0xf1,0xb0,0x16,0x48,0x20,0x99,0xf1,0xb0,0xd,0xd0,0x5,0xa9,0x40,0x20,0x1c,0xfe,0xc6,0xa6,0xa6,0x97,0x68,0x60,0xaa,0x68,0x8a,0xa6,0x97,0x60,0x20,0xd,0xf8,0xd0,0xb,0x20,0x41,0xf8,0xb0,0x11,0xa9,0x0,0x85,0xa6,0xf0,0xf0,0xb1,0xb2,0x18,0x60,0xa5,0x90,0xf0,0x4,0xa9,0xd,0x18,0x60,0x4c,0x13,0xee,0x20,0x4e,0xf1,0xb0,0xf7,0xc9,0x0,0xd0,0xf2,0xad,0x97,0x2,0x29,0x60,0xd0,0xe9,0xf0,0xee,0x48,0xa5,0x9a,0xc9,0x3,0xd0,0x4,0x68,0x4c,0x16,0xe7,0x90,0x4,0x68,0x4c,0xdd,0xed,0x4a,0x68,0x85,0x9e,0x8a,0x48,0x98,0x48,0x90,0x23,0x20,0xd,0xf8,0xd0,0xe,0x20,0x64,0xf8,0xb0,0xe,0xa9,0x2,0xa0,0x0,0x91,0xb2,0xc8,0x84,0xa6,0xa5,0x9e,0x91,0xb2,0x18,0x68,0xa8,0x68,0xaa,0xa5,0x9e,0x90,0x2,0xa9,0x0,0x60,0x20,0x17,0xf0,0x4c,0xfc,0xf1,0x20,0xf,0xf3,0xf0,0x3,0x4c,0x1,0xf7,0x20,0x1f,0xf3,0xa5,0xba,0xf0,0x16,0xc9,0x3,0xf0,0x12,0xb0,0x14,0xc9,0x2,0xd0,0x3,0x4c,0x4d,0xf0,0xa6,0xb9,0xe0,0x60,0xf0,0x3,0x4c,0xa,0xf7,0x85,0x99,0x18,0x60,0xaa,0x20,0x9,0xed,0xa5,0xb9,0x10,0x6,0x20,0xcc,0xed,0x4c,0x48,0xf2,0x20,0xc7,0xed,0x8a,0x24,0x90,0x10,0xe6,0x4c,0x7,0xf7,0x20,0xf,0xf3,0xf0,0x3,0x4c,0x1,0xf7,0x20,0x1f,0xf3,0xa5,0xba,0xd0,0x3,0x4c,0xd,0xf7,0xc9,0x3,0xf0,0xf,0xb0,0x11,0xc9,0x2,0xd0,0x3,0x4c,0xe1,0xef,0xa6,0xb9,0xe0,0x60,0xf0,0xea,0x85,0x9a,0x18,0x60,0xaa,0x20,0xc,0xed,0xa5,0xb9,0x10,0x5,0x20,0xbe,0xed,0xd0,0x3,0x20,0xb9,0xed,0x8a,0x24,0x90,0x10,0xe7,0x4c,0x7,0xf7,0x20,0x14,0xf3,0xf0,0x2,0x18,0x60,0x20,0x1f,0xf3,0x8a,0x48,0xa5,0xba,0xf0,0x50,0xc9,0x3,0xf0,0x4c,0xb0,0x47,0xc9,0x2,0xd0,0x1d,0x68,0x20,0xf2,0xf2,0x20,0x83,0xf4,0x20,0x27,0xfe,0xa5,0xf8,0xf0,0x1,0xc8,0xa5,0xfa,0xf0,0x1,0xc8,0xa9,0x0,0x85,0xf8,0x85,0xfa,0x4c,0x7d,0xf4,0xa5,0xb9,0x29,0xf,0xf0,0x23,0x20,0xd0,0xf7,0xa9,0x0,0x38,0x20,0xdd,0xf1,0x20,0x64,0xf8,0x90,0x4,0x68,0xa9,0x0,0x60,0xa5,0xb9,0xc9,0x62,0xd0,0xb,0xa9,0x5,0x20,0x6a,0xf7,0x4c,0xf1,0xf2,0x20,0x42,0xf6,0x68,0xaa,0xc6,0x98,0xe4,0x98,0xf0,0x14,0xa4,0x98,0xb9,0x59,0x2,0x9d,0x59,0x2,0xb9,0x63,0x2,0x9d,0x63,0x2,0xb9,0x6d,0x2,0x9d,0x6d,0x2,0x18,0x60,0xa9,0x0,0x85,0x90,0x8a,0xa6,0x98,0xca,0x30,0x15,0xdd,0x59,0x2,0xd0,0xf8,0x60,0xbd,0x59,0x2,0x85,0xb8,0xbd,0x63,0x2,0x85,0xba,0xbd,0x6d,0x2,0x85,0xb9,0x60,0xa9,0x0,0x85,0x98,0xa2,0x3,0xe4,0x9a,0xb0,0x3,0x20,0xfe,0xed,0xe4,0x99,0xb0,0x3,0x20,0xef,0xed,0x86,0x9a,0xa9,0x0,0x85,0x99,0x60,0xa6,0xb8,0xd0,0x3,0x4c,0xa,0xf7,0x20,0xf,0xf3,0xd0,0x3,0x4c,0xfe,0xf6,0xa6,0x98,0xe0,0xa,0x90,0x3,0x4c,0xfb,0xf6,0xe6,0x98,0xa5,0xb8,0x9d,0x59,0x2,0xa5,0xb9,0x9,0x60,0x85,0xb9,0x9d,0x6d,0x2,0xa5,0xba,0x9d,0x63,0x2,0xf0,0x5a,0xc9,0x3,0xf0,0x56,0x90,0x5,0x20,0xd5,0xf3,0x90,0x4f,0xc9,0x2,0xd0,0x3,0x4c,0x9,0xf4,0x20,0xd0,0xf7,0xb0,0x3,0x4c,0x13,0xf7,0xa5,0xb9,0x29,0xf,0xd0,0x1f,0x20,0x17,0xf8,0xb0,0x36,0x20,0xaf,0xf5,0xa5,0xb7,0xf0,0xa,0x20,0xea,0xf7,0x90,0x18,0xf0,0x28,0x4c,0x4,0xf7,0x20,0x2c,0xf7,0xf0,0x20,0x90,0xc,0xb0,0xf4,0x20,0x38,0xf8,0xb0,0x17,0xa9,0x4,0x20,0x6a,0xf7,0xa9,0xbf,0xa4,0xb9,0xc0,0x60,0xf0,0x7,0xa0,0x0,0xa9,0x2,0x91,0xb2,0x98,0x85,0xa6,0x18,0x60,0xa5,0xb9,0x30,0xfa,0xa4,0xb7,0xf0,0xf6,0xa9,0x0,0x85,0x90,0xa5,0xba,0x20,0xc,0xed,0xa5,0xb9,0x9,0xf0,0x20,0xb9,0xed,0xa5,0x90,0x10,0x5,0x68,0x68,0x4c,0x7,0xf7,0xa5,0xb7,0xf0,0xc,0xa0,0x0,0xb1,0xbb,0x20,0xdd,0xed,0xc8,0xc4,0xb7,0xd0,0xf6,0x4c,0x54,0xf6,0x20,0x83,0xf4,0x8c,0x97,0x2,0xc4,0xb7,0xf0,0xa,0xb1,0xbb,0x99,0x93,0x2,0xc8,0xc0,0x4,0xd0,0xf2,0x20,0x4a,0xef,0x8e,0x98,0x2,0xad,0x93,0x2,0x29,0xf,0xf0,0x1c,0xa,0xaa,0xad,0xa6,0x2,0xd0,0x9,0xbc,0xc1,0xfe,0xbd,0xc0,0xfe,0x4c,0x40,0xf4,0xbc,0xeb,0xe4,0xbd,0xea,0xe4,0x8c,0x96,0x2,0x8d,0x95,0x2,0xad,0x95,0x2,0xa,0x20,0x2e,0xff,0xad,0x94,0x2,0x4a,0x90,0x9,0xad,0x1,0xdd,0xa,0xb0,0x3,0x20,0xd,0xf0,0xad,0x9b,0x2,0x8d,0x9c,0x2,0xad,0x9e,0x2,0x8d,0x9d,0x2,0x20,0x27,0xfe,0xa5,0xf8,0xd0,0x5,0x88,0x84,0xf8,0x86,0xf7,0xa5,0xfa,0xd0,0x5,0x88,0x84,0xfa,0x86,0xf9,0x38,0xa9,0xf0,0x4c,0x2d,0xfe,0xa9,0x7f,0x8d,0xd,0xdd,0xa9,0x6,0x8d,0x3,0xdd,0x8d,0x1,0xdd,0xa9,0x4,0xd,0x0,0xdd,0x8d,0x0,0xdd,0xa0,0x0,0x8c,0xa1,0x2,0x60,0x86,0xc3,0x84,0xc4,0x6c,0x30,0x3,0x85,0x93,0xa9,0x0,0x85,0x90,0xa5,0xba,0xd0,0x3,0x4c,0x13,0xf7,0xc9,0x3,0xf0,0xf9,0x90,0x7b,0xa4,0xb7,0xd0,0x3,0x4c,0x10,0xf7,0xa6,0xb9,0x20,0xaf,0xf5,0xa9,0x60,0x85,0xb9,0x20,0xd5,0xf3,0xa5,0xba,0x20,0x9,0xed,0xa5,0xb9,0x20,0xc7,0xed,0x20,0x13,0xee,0x85,0xae,0xa5,0x90,0x4a,0x4a,0xb0,0x50,0x20,0x13,0xee,0x85,0xaf,0x8a,0xd0,0x8,0xa5,0xc3,0x85,0xae,0xa5,0xc4,0x85,0xaf,0x20,0xd2,0xf5,0xa9,0xfd,0x25,0x90,0x85,0x90,0x20,0xe1,0xff,0xd0,0x3,0x4c,0x33,0xf6,0x20,0x13,0xee,0xaa,0xa5,0x90,0x4a,0x4a,0xb0,0xe8,0x8a,0xa4,0x93,0xf0,0xc,0xa0,0x0,0xd1,0xae,0xf0,0x8,0xa9,0x10,0x20,0x1c,0xfe,0x2c,0x91,0xae,0xe6,0xae,0xd0,0x2,0xe6,0xaf,0x24,0x90,0x50,0xcb,0x20,0xef,0xed,0x20,0x42,0xf6,0x90,0x79,0x4c,0x4,0xf7,0x4a,0xb0,0x3,0x4c,0x13,0xf7,0x20,0xd0,0xf7,0xb0,0x3,0x4c,0x13,0xf7,0x20,0x17,0xf8,0xb0,0x68,0x20,0xaf,0xf5,0xa5,0xb7,0xf0,0x9,0x20,0xea,0xf7,0x90,0xb,0xf0,0x5a,0xb0,0xda,0x20,0x2c,0xf7,0xf0,0x53,0xb0,0xd3,0xa5,0x90,0x29,0x10,0x38,0xd0,0x4a,0xe0,0x1,0xf0,0x11,0xe0,0x3,0xd0,0xdd,0xa0,0x1,0xb1,0xb2,0x85,0xc3,0xc8,0xb1,0xb2,0x85,0xc4,0xb0,0x4,0xa5,0xb9,0xd0,0xef,0xa0,0x3,0xb1,0xb2,0xa0,0x1,0xf1,0xb2,0xaa,0xa0,0x4,0xb1,0xb2,0xa0,0x2,0xf1,0xb2,0xa8,0x18,0x8a,0x65,0xc3,0x85,0xae,0x98,0x65,0xc4,0x85,0xaf,0xa5,0xc3,0x85,0xc1,0xa5,0xc4,0x85,0xc2,0x20,0xd2,0xf5,0x20,0x4a,0xf8,0x24,0x18,0xa6,0xae,0xa4,0xaf,0x60,0xa5,0x9d,0x10,0x1e,0xa0,0xc,0x20,0x2f,0xf1,0xa5,0xb7,0xf0,0x15,0xa0,0x17,0x20,0x2f,0xf1,0xa4,0xb7,0xf0,0xc,0xa0,0x0,0xb1,0xbb,0x20,0xd2,0xff,0xc8,0xc4,0xb7,0xd0,0xf6,0x60,0xa0,0x49,0xa5,0x93,0xf0,0x2,0xa0,0x59,0x4c,0x2b,0xf1,0x86,0xae,0x84,0xaf,0xaa,0xb5,0x0,0x85,0xc1,0xb5,0x1,0x85,0xc2,0x6c,0x32,0x3,0xa5,0xba,0xd0,0x3,0x4c,0x13,0xf7,0xc9,0x3,0xf0,0xf9,0x90,0x5f,0xa9,0x61,0x85,0xb9,0xa4,0xb7,0xd0,0x3,0x4c,0x10,0xf7,0x20,0xd5,0xf3,0x20,0x8f,0xf6,0xa5,0xba,0x20,0xc,0xed,0xa5,0xb9,0x20,0xb9,0xed,0xa0,0x0,0x20,0x8e,0xfb,0xa5,0xac,0x20,0xdd,0xed,0xa5,0xad,0x20,0xdd,0xed,0x20,0xd1,0xfc,0xb0,0x16,0xb1,0xac,0x20,0xdd,0xed,0x20,0xe1,0xff,0xd0,0x7,0x20,0x42,0xf6,0xa9,0x0,0x38,0x60,0x20,0xdb,0xfc,0xd0,0xe5,0x20,0xfe,0xed,0x24,0xb9,0x30,0x11,0xa5,0xba,0x20,0xc,0xed,0xa5,0xb9,0x29,0xef,0x9,0xe0,0x20,0xb9,0xed,0x20,0xfe,0xed,0x18,0x60,0x4a,0xb0,0x3,0x4c,0x13,0xf7,0x20,0xd0,0xf7,0x90,0x8d,0x20,0x38,0xf8,0xb0,0x25,0x20,0x8f,0xf6,0xa2,0x3,0xa5,0xb9,0x29,0x1,0xd0,0x2,0xa2,0x1,0x8a,0x20,0x6a,0xf7,0xb0,0x12,0x20,0x67,0xf8,0xb0,0xd,0xa5,0xb9,0x29,0x2,0xf0,0x6,0xa9,0x5,0x20,0x6a,0xf7,0x24,0x18,0x60,0xa5,0x9d,0x10,0xfb,0xa0,0x51,0x20,0x2f,0xf1,0x4c,0xc1,0xf5,0xa2,0x0,0xe6,0xa2,0xd0,0x6,0xe6,0xa1,0xd0,0x2,0xe6,0xa0,0x38,0xa5,0xa2,0xe9,0x1,0xa5,0xa1,0xe9,0x1a,0xa5,0xa0,0xe9,0x4f,0x90,0x6,0x86,0xa0,0x86,0xa1,0x86,0xa2,0xad,0x1,0xdc,0xcd,0x1,0xdc,0xd0,0xf8,0xaa,0x30,0x13,0xa2,0xbd,0x8e,0x0,0xdc,0xae,0x1,0xdc,0xec,0x1,0xdc,0xd0,0xf8,0x8d,0x0,0xdc,0xe8,0xd0,0x2,0x85,0x91,0x60,0x78,0xa5,0xa2,0xa6,0xa1,0xa4,0xa0,0x78,0x85,0xa2,0x86,0xa1,0x84,0xa0,0x58,0x60,0xa5,0x91,0xc9,0x7f,0xd0,0x7,0x8,0x20,0xcc,0xff,0x85,0xc6,0x28,0x60,0xa9,0x1,0x2c,0xa9,0x2,0x2c,0xa9,0x3,0x2c,0xa9,0x4,0x2c,0xa9,0x5,0x2c,0xa9,0x6,0x2c,0xa9,0x7,0x2c,0xa9,0x8,0x2c,0xa9,0x9,0x48,0x20,0xcc,0xff,0xa0,0x0,0x24,0x9d,0x50,0xa,0x20,0x2f,0xf1,0x68,0x48,0x9,0x30,0x20,0xd2,0xff,0x68,0x38,0x60,0xa5,0x93,0x48,0x20,0x41,0xf8,0x68,0x85,0x93,0xb0,0x32,0xa0,0x0,0xb1,0xb2,0xc9,0x5,0xf0,0x2a,0xc9,0x1,0xf0,0x8,0xc9,0x3,0xf0,0x4,0xc9,0x4,0xd0,0xe1,0xaa,0x24,0x9d,0x10,0x17,0xa0,0x63,0x20,0x2f,0xf1,0xa0,0x5,0xb1,0xb2,0x20,0xd2,0xff,0xc8,0xc0,0x15,0xd0,0xf6,0xa5,0xa1,0x20,0xe0,0xe4,0xea,0x18,0x88,0x60,0x85,0x9e,0x20,0xd0,0xf7,0x90,0x5e,0xa5,0xc2,0x48,0xa5,0xc1,0x48,0xa5,0xaf,0x48,0xa5,0xae,0x48,0xa0,0xbf,0xa9,0x20,0x91,0xb2,0x88,0xd0,0xfb,0xa5,0x9e,0x91,0xb2,0xc8,0xa5,0xc1,0x91,0xb2,0xc8,0xa5,0xc2,0x91,0xb2,0xc8,0xa5,0xae,0x91,0xb2,0xc8,0xa5,0xaf,0x91,0xb2,0xc8,0x84,0x9f,0xa0,0x0,0x84,0x9e,0xa4,0x9e,0xc4,0xb7,0xf0,0xc,0xb1,0xbb,0xa4,0x9f,0x91,0xb2,0xe6,0x9e,0xe6,0x9f,0xd0,0xee,0x20,0xd7,0xf7,0xa9,0x69,0x85,0xab,0x20,0x6b,0xf8,0xa8,0x68,0x85,0xae,0x68,0x85,0xaf,0x68,0x85,0xc1,0x68,0x85,0xc2,0x98,0x60,0xa6,0xb2,0xa4,0xb3,0xc0,0x2,0x60,0x20,0xd0,0xf7,0x8a,0x85,0xc1,0x18,0x69,0xc0,0x85,0xae,0x98,0x85,0xc2,0x69,0x0,0x85,0xaf,0x60,0x20,0x2c,0xf7,0xb0,0x1d,0xa0,0x5,0x84,0x9f,0xa0,0x0,0x84,0x9e,0xc4,0xb7,0xf0,0x10,0xb1,0xbb,0xa4,0x9f,0xd1,0xb2,0xd0,0xe7,0xe6,0x9e,0xe6,0x9f,0xa4,0x9e,0xd0,0xec,0x18,0x60,0x20,0xd0,0xf7,0xe6,0xa6,0xa4,0xa6,0xc0,0xc0,0x60,0x20,0x2e,0xf8,0xf0,0x1a,0xa0,0x1b,0x20,0x2f,0xf1,0x20,0xd0,0xf8,0x20,0x2e,0xf8,0xd0,0xf8,0xa0,0x6a,0x4c,0x2f,0xf1,0xa9,0x10,0x24,0x1,0xd0,0x2,0x24,0x1,0x18,0x60,0x20,0x2e,0xf8,0xf0,0xf9,0xa0,0x2e,0xd0,0xdd,0xa9,0x0,0x85,0x90,0x85,0x93,0x20,0xd7,0xf7,0x20,0x17,0xf8,0xb0,0x1f,0x78,0xa9,0x0,0x85,0xaa,0x85,0xb4,0x85,0xb0,0x85,0x9e,0x85,0x9f,0x85,0x9c,0xa9,0x90,0xa2,0xe,0xd0,0x11,0x20,0xd7,0xf7,0xa9,0x14,0x85,0xab,0x20,0x38,0xf8,0xb0,0x6c,0x78,0xa9,0x82,0xa2,0x8,0xa0,0x7f,0x8c,0xd,0xdc,0x8d,0xd,0xdc,0xad,0xe,0xdc,0x9,0x19,0x8d,0xf,0xdc,0x29,0x91,0x8d,0xa2,0x2,0x20,0xa4,0xf0,0xad,0x11,0xd0,0x29,0xef,0x8d,0x11,0xd0,0xad,0x14,0x3,0x8d,0x9f,0x2,0xad,0x15,0x3,0x8d,0xa0,0x2,0x20,0xbd,0xfc,0xa9,0x2,0x85,0xbe,0x20,0x97,0xfb,0xa5,0x1,0x29,0x1f,0x85,0x1,0x85,0xc0,0xa2,0xff,0xa0,0xff,0x88,0xd0,0xfd,0xca,0xd0,0xf8,0x58,0xad,0xa0,0x2,0xcd,0x15,0x3,0x18,0xf0,0x15,0x20,0xd0,0xf8,0x20,0xbc,0xf6,0x4c,0xbe,0xf8,0x20,0xe1,0xff,0x18,0xd0,0xb,0x20,0x93,0xfc,0x38,0x68,0x68,0xa9,0x0,0x8d,0xa0,0x2,0x60,0x86,0xb1,0xa5,0xb0,0xa,0xa,0x18,0x65,0xb0,0x18,0x65,0xb1,0x85,0xb1,0xa9,0x0,0x24,0xb0,0x30,0x1,0x2a,0x6,0xb1,0x2a,0x6,0xb1,0x2a,0xaa,0xad,0x6,0xdc,0xc9,0x16,0x90,0xf9,0x65,0xb1,0x8d,0x4,0xdc,0x8a,0x6d,0x7,0xdc,0x8d,0x5,0xdc,0xad,0xa2,0x2,0x8d,0xe,0xdc,0x8d,0xa4,0x2,0xad,0xd,0xdc,0x29,0x10,0xf0,0x9,0xa9,0xf9,0x48,0xa9,0x2a,0x48,0x4c,0x43,0xff,0x58,0x60,0xae,0x7,0xdc,0xa0,0xff,0x98,0xed,0x6,0xdc,0xec,0x7,0xdc,0xd0,0xf2,0x86,0xb1,0xaa,0x8c,0x6,0xdc,0x8c,0x7,0xdc,0xa9,0x19,0x8d,0xf,0xdc,0xad,0xd,0xdc,0x8d,0xa3,0x2,0x98,0xe5,0xb1,0x86,0xb1,0x4a,0x66,0xb1,0x4a,0x66,0xb1,0xa5,0xb0,0x18,0x69,0x3c,0xc5,0xb1,0xb0,0x4a,0xa6,0x9c,0xf0,0x3,0x4c,0x60,0xfa,0xa6,0xa3,0x30,0x1b,0xa2,0x0,0x69,0x30,0x65,0xb0,0xc5,0xb1,0xb0,0x1c,0xe8,0x69,0x26,0x65,0xb0,0xc5,0xb1,0xb0,0x17,0x69,0x2c,0x65,0xb0,0xc5,0xb1,0x90,0x3,0x4c,0x10,0xfa,0xa5,0xb4,0xf0,0x1d,0x85,0xa8,0xd0,0x19,0xe6,0xa9,0xb0,0x2,0xc6,0xa9,0x38,0xe9,0x13,0xe5,0xb1,0x65,0x92,0x85,0x92,0xa5,0xa4,0x49,0x1,0x85,0xa4,0xf0,0x2b,0x86,0xd7,0xa5,0xb4,0xf0,0x22,0xad,0xa3,0x2,0x29,0x1,0xd0,0x5,0xad,0xa4,0x2,0xd0,0x16,0xa9,0x0,0x85,0xa4,0x8d,0xa4,0x2,0xa5,0xa3,0x10,0x30,0x30,0xbf,0xa2,0xa6,0x20,0xe2,0xf8,0xa5,0x9b,0xd0,0xb9,0x4c,0xbc,0xfe,0xa5,0x92,0xf0,0x7,0x30,0x3,0xc6,0xb0,0x2c,0xe6,0xb0,0xa9,0x0,0x85,0x92,0xe4,0xd7,0xd0,0xf,0x8a,0xd0,0xa0,0xa5,0xa9,0x30,0xbd,0xc9,0x10,0x90,0xb9,0x85,0x96,0xb0,0xb5,0x8a,0x45,0x9b,0x85,0x9b,0xa5,0xb4,0xf0,0xd2,0xc6,0xa3,0x30,0xc5,0x46,0xd7,0x66,0xbf,0xa2,0xda,0x20,0xe2,0xf8,0x4c,0xbc,0xfe,0xa5,0x96,0xf0,0x4,0xa5,0xb4,0xf0,0x7,0xa5,0xa3,0x30,0x3,0x4c,0x97,0xf9,0x46,0xb1,0xa9,0x93,0x38,0xe5,0xb1,0x65,0xb0,0xa,0xaa,0x20,0xe2,0xf8,0xe6,0x9c,0xa5,0xb4,0xd0,0x11,0xa5,0x96,0xf0,0x26,0x85,0xa8,0xa9,0x0,0x85,0x96,0xa9,0x81,0x8d,0xd,0xdc,0x85,0xb4,0xa5,0x96,0x85,0xb5,0xf0,0x9,0xa9,0x0,0x85,0xb4,0xa9,0x1,0x8d,0xd,0xdc,0xa5,0xbf,0x85,0xbd,0xa5,0xa8,0x5,0xa9,0x85,0xb6,0x4c,0xbc,0xfe,0x20,0x97,0xfb,0x85,0x9c,0xa2,0xda,0x20,0xe2,0xf8,0xa5,0xbe,0xf0,0x2,0x85,0xa7,0xa9,0xf,0x24,0xaa,0x10,0x17,0xa5,0xb5,0xd0,0xc,0xa6,0xbe,0xca,0xd0,0xb,0xa9,0x8,0x20,0x1c,0xfe,0xd0,0x4,0xa9,0x0,0x85,0xaa,0x4c,0xbc,0xfe,0x70,0x31,0xd0,0x18,0xa5,0xb5,0xd0,0xf5,0xa5,0xb6,0xd0,0xf1,0xa5,0xa7,0x4a,0xa5,0xbd,0x30,0x3,0x90,0x18,0x18,0xb0,0x15,0x29,0xf,0x85,0xaa,0xc6,0xaa,0xd0,0xdd,0xa9,0x40,0x85,0xaa,0x20,0x8e,0xfb,0xa9,0x0,0x85,0xab,0xf0,0xd0,0xa9,0x80,0x85,0xaa,0xd0,0xca,0xa5,0xb5,0xf0,0xa,0xa9,0x4,0x20,0x1c,0xfe,0xa9,0x0,0x4c,0x4a,0xfb,0x20,0xd1,0xfc,0x90,0x3,0x4c,0x48,0xfb,0xa6,0xa7,0xca,0xf0,0x2d,0xa5,0x93,0xf0,0xc,0xa0,0x0,0xa5,0xbd,0xd1,0xac,0xf0,0x4,0xa9,0x1,0x85,0xb6,0xa5,0xb6,0xf0,0x4b,0xa2,0x3d,0xe4,0x9e,0x90,0x3e,0xa6,0x9e,0xa5,0xad,0x9d,0x1,0x1,0xa5,0xac,0x9d,0x0,0x1,0xe8,0xe8,0x86,0x9e,0x4c,0x3a,0xfb,0xa6,0x9f,0xe4,0x9e,0xf0,0x35,0xa5,0xac,0xdd,0x0,0x1,0xd0,0x2e,0xa5,0xad,0xdd,0x1,0x1,0xd0,0x27,0xe6,0x9f,0xe6,0x9f,0xa5,0x93,0xf0,0xb,0xa5,0xbd,0xa0,0x0,0xd1,0xac,0xf0,0x17,0xc8,0x84,0xb6,0xa5,0xb6,0xf0,0x7,0xa9,0x10,0x20,0x1c,0xfe,0xd0,0x9,0xa5,0x93,0xd0,0x5,0xa8,0xa5,0xbd,0x91,0xac,0x20,0xdb,0xfc,0xd0,0x43,0xa9,0x80,0x85,0xaa,0x78,0xa2,0x1,0x8e,0xd,0xdc,0xae,0xd,0xdc,0xa6,0xbe,0xca,0x30,0x2,0x86,0xbe,0xc6,0xa7,0xf0,0x8,0xa5,0x9e,0xd0,0x27,0x85,0xbe,0xf0,0x23,0x20,0x93,0xfc,0x20,0x8e,0xfb,0xa0,0x0,0x84,0xab,0xb1,0xac,0x45,0xab,0x85,0xab,0x20,0xdb,0xfc,0x20,0xd1,0xfc,0x90,0xf2,0xa5,0xab,0x45,0xbd,0xf0,0x5,0xa9,0x20,0x20,0x1c,0xfe,0x4c,0xbc,0xfe,0xa5,0xc2,0x85,0xad,0xa5,0xc1,0x85,0xac,0x60,0xa9,0x8,0x85,0xa3,0xa9,0x0,0x85,0xa4,0x85,0xa8,0x85,0x9b,0x85,0xa9,0x60,0xa5,0xbd,0x4a,0xa9,0x60,0x90,0x2,0xa9,0xb0,0xa2,0x0,0x8d,0x6,0xdc,0x8e,0x7,0xdc,0xad,0xd,0xdc,0xa9,0x19,0x8d,0xf,0xdc,0xa5,0x1,0x49,0x8,0x85,0x1,0x29,0x8,0x60,0x38,0x66,0xb6,0x30,0x3c,0xa5,0xa8,0xd0,0x12,0xa9,0x10,0xa2,0x1,0x20,0xb1,0xfb,0xd0,0x2f,0xe6,0xa8,0xa5,0xb6,0x10,0x29,0x4c,0x57,0xfc,0xa5,0xa9,0xd0,0x9,0x20,0xad,0xfb,0xd0,0x1d,0xe6,0xa9,0xd0,0x19,0x20,0xa6,0xfb,0xd0,0x14,0xa5,0xa4,0x49,0x1,0x85,0xa4,0xf0,0xf,0xa5,0xbd,0x49,0x1,0x85,0xbd,0x29,0x1,0x45,0x9b,0x85,0x9b,0x4c,0xbc,0xfe,0x46,0xbd,0xc6,0xa3,0xa5,0xa3,0xf0,0x3a,0x10,0xf3,0x20,0x97,0xfb,0x58,0xa5,0xa5,0xf0,0x12,0xa2,0x0,0x86,0xd7,0xc6,0xa5,0xa6,0xbe,0xe0,0x2,0xd0,0x2,0x9,0x80,0x85,0xbd,0xd0,0xd9,0x20,0xd1,0xfc,0x90,0xa,0xd0,0x91,0xe6,0xad,0xa5,0xd7,0x85,0xbd,0xb0,0xca,0xa0,0x0,0xb1,0xac,0x85,0xbd,0x45,0xd7,0x85,0xd7,0x20,0xdb,0xfc,0xd0,0xbb,0xa5,0x9b,0x49,0x1,0x85,0xbd,0x4c,0xbc,0xfe,0xc6,0xbe,0xd0,0x3,0x20,0xca,0xfc,0xa9,0x50,0x85,0xa7,0xa2,0x8,0x78,0x20,0xbd,0xfc,0xd0,0xea,0xa9,0x78,0x20,0xaf,0xfb,0xd0,0xe3,0xc6,0xa7,0xd0,0xdf,0x20,0x97,0xfb,0xc6,0xab,0x10,0xd8,0xa2,0xa,0x20,0xbd,0xfc,0x58,0xe6,0xab,0xa5,0xbe,0xf0,0x30,0x20,0x8e,0xfb,0xa2,0x9,0x86,0xa5,0x86,0xb6,0xd0,0x83,0x8,0x78,0xad,0x11,0xd0,0x9,0x10,0x8d,0x11,0xd0,0x20,0xca,0xfc,0xa9,0x7f,0x8d,0xd,0xdc,0x20,0xdd,0xfd,0xad,0xa0,0x2,0xf0,0x9,0x8d,0x15,0x3,0xad,0x9f,0x2,0x8d,0x14,0x3,0x28,0x60,0x20,0x93,0xfc,0xf0,0x97,0xbd,0x93,0xfd,0x8d,0x14,0x3,0xbd,0x94,0xfd,0x8d,0x15,0x3,0x60,0xa5,0x1,0x9,0x20,0x85,0x1,0x60,0x38,0xa5,0xac,0xe5,0xae,0xa5,0xad,0xe5,0xaf,0x60,0xe6,0xac,0xd0,0x2,0xe6,0xad,0x60,0xa2,0xff,0x78,0x9a,0xd8,0x20,0x2,0xfd,0xd0,0x3,0x6c,0x0,0x80,0x8e,0x16,0xd0,0x20,0xa3,0xfd,0x20,0x50,0xfd,0x20,0x15,0xfd,0x20,0x5b,0xff,0x58,0x6c,0x0,0xa0,0xa2,0x5,0xbd,0xf,0xfd,0xdd,0x3,0x80,0xd0,0x3,0xca,0xd0,0xf5,0x60,0xc3,0xc2,0xcd,0x38,0x30,0xa2,0x30,0xa0,0xfd,0x18,0x86,0xc3,0x84,0xc4,0xa0,0x1f,0xb9,0x14,0x3,0xb0,0x2,0xb1,0xc3,0x91,0xc3,0x99,0x14,0x3,0x88,0x10,0xf1,0x60,0x31,0xea,0x66,0xfe,0x47,0xfe,0x4a,0xf3,0x91,0xf2,0xe,0xf2,0x50,0xf2,0x33,0xf3,0x57,0xf1,0xca,0xf1,0xed,0xf6,0x3e,0xf1,0x2f,0xf3,0x66,0xfe,0xa5,0xf4,0xed,0xf5,0xa9,0x0,0xa8,0x99,0x2,0x0,0x99,0x0,0x2,0x99,0x0,0x3,0xc8,0xd0,0xf4,0xa2,0x3c,0xa0,0x3,0x86,0xb2,0x84,0xb3,0xa8,0xa9,0x3,0x85,0xc2,0xe6,0xc2,0xb1,0xc1,0xaa,0xa9,0x55,0x91,0xc1,0xd1,0xc1,0xd0,0xf,0x2a,0x91,0xc1,0xd1,0xc1,0xd0,0x8,0x8a,0x91,0xc1,0xc8,0xd0,0xe8,0xf0,0xe4,0x98,0xaa,0xa4,0xc2,0x18,0x20,0x2d,0xfe,0xa9,0x8,0x8d,0x82,0x2,0xa9,0x4,0x8d,0x88,0x2,0x60,0x6a,0xfc,0xcd,0xfb,0x31,0xea,0x2c,0xf9,0xa9,0x7f,0x8d,0xd,0xdc,0x8d,0xd,0xdd,0x8d,0x0,0xdc,0xa9,0x8,0x8d,0xe,0xdc,0x8d,0xe,0xdd,0x8d,0xf,0xdc,0x8d,0xf,0xdd,0xa2,0x0,0x8e,0x3,0xdc,0x8e,0x3,0xdd,0x8e,0x18,0xd4,0xca,0x8e,0x2,0xdc,0xa9,0x7,0x8d,0x0,0xdd,0xa9,0x3f,0x8d,0x2,0xdd,0xa9,0xe7,0x85,0x1,0xa9,0x2f,0x85,0x0,0xad,0xa6,0x2,0xf0,0xa,0xa9,0x25,0x8d,0x4,0xdc,0xa9,0x40,0x4c,0xf3,0xfd,0xa9,0x95,0x8d,0x4,0xdc,0xa9,0x42,0x8d,0x5,0xdc,0x4c,0x6e,0xff,0x85,0xb7,0x86,0xbb,0x84,0xbc,0x60,0x85,0xb8,0x86,0xba,0x84,0xb9,0x60,0xa5,0xba,0xc9,0x2,0xd0,0xd,0xad,0x97,0x2,0x48,0xa9,0x0,0x8d,0x97,0x2,0x68,0x60,0x85,0x9d,0xa5,0x90,0x5,0x90,0x85,0x90,0x60,0x8d,0x85,0x2,0x60,0x90,0x6,0xae,0x83,0x2,0xac,0x84,0x2,0x8e,0x83,0x2,0x8c,0x84,0x2,0x60,0x90,0x6,0xae,0x81,0x2,0xac,0x82,0x2,0x8e,0x81,0x2,0x8c,0x82,0x2,0x60,0x78,0x6c,0x18,0x3,0x48,0x8a,0x48,0x98,0x48,0xa9,0x7f,0x8d,0xd,0xdd,0xac,0xd,0xdd,0x30,0x1c,0x20,0x2,0xfd,0xd0,0x3,0x6c,0x2,0x80,0x20,0xbc,0xf6,0x20,0xe1,0xff,0xd0,0xc,0x20,0x15,0xfd,0x20,0xa3,0xfd,0x20,0x18,0xe5,0x6c,0x2,0xa0,0x98,0x2d,0xa1,0x2,0xaa,0x29,0x1,0xf0,0x28,0xad,0x0,0xdd,0x29,0xfb,0x5,0xb5,0x8d,0x0,0xdd,0xad,0xa1,0x2,0x8d,0xd,0xdd,0x8a,0x29,0x12,0xf0,0xd,0x29,0x2,0xf0,0x6,0x20,0xd6,0xfe,0x4c,0x9d,0xfe,0x20,0x7,0xff,0x20,0xbb,0xee,0x4c,0xb6,0xfe,0x8a,0x29,0x2,0xf0,0x6,0x20,0xd6,0xfe,0x4c,0xb6,0xfe,0x8a,0x29,0x10,0xf0,0x3,0x20,0x7,0xff,0xad,0xa1,0x2,0x8d,0xd,0xdd,0x68,0xa8,0x68,0xaa,0x68,0x40,0xc1,0x27,0x3e,0x1a,0xc5,0x11,0x74,0xe,0xed,0xc,0x45,0x6,0xf0,0x2,0x46,0x1,0xb8,0x0,0x71,0x0,0xad,0x1,0xdd,0x29,0x1,0x85,0xa7,0xad,0x6,0xdd,0xe9,0x1c,0x6d,0x99,0x2,0x8d,0x6,0xdd,0xad,0x7,0xdd,0x6d,0x9a,0x2,0x8d,0x7,0xdd,0xa9,0x11,0x8d,0xf,0xdd,0xad,0xa1,0x2,0x8d,0xd,0xdd,0xa9,0xff,0x8d,0x6,0xdd,0x8d,0x7,0xdd,0x4c,0x59,0xef,0xad,0x95,0x2,0x8d,0x6,0xdd,0xad,0x96,0x2,0x8d,0x7,0xdd,0xa9,0x11,0x8d,0xf,0xdd,0xa9,0x12,0x4d,0xa1,0x2,0x8d,0xa1,0x2,0xa9,0xff,0x8d,0x6,0xdd,0x8d,0x7,0xdd,0xae,0x98,0x2,0x86,0xa8,0x60,0xaa,0xad,0x96,0x2,0x2a,0xa8,0x8a,0x69,0xc8,0x8d,0x99,0x2,0x98,0x69,0x0,0x8d,0x9a,0x2,0x60,0xea,0xea,0x8,0x68,0x29,0xef,0x48,0x48,0x8a,0x48,0x98,0x48,0xba,0xbd,0x4,0x1,0x29,0x10,0xf0,0x3,0x6c,0x16,0x3,0x6c,0x14,0x3,0x20,0x18,0xe5,0xad,0x12,0xd0,0xd0,0xfb,0xad,0x19,0xd0,0x29,0x1,0x8d,0xa6,0x2,0x4c,0xdd,0xfd,0xa9,0x81,0x8d,0xd,0xdc,0xad,0xe,0xdc,0x29,0x80,0x9,0x11,0x8d,0xe,0xdc,0x4c,0x8e,0xee,0x3,0x4c,0x5b,0xff,0x4c,0xa3,0xfd,0x4c,0x50,0xfd,0x4c,0x15,0xfd,0x4c,0x1a,0xfd,0x4c,0x18,0xfe,0x4c,0xb9,0xed,0x4c,0xc7,0xed,0x4c,0x25,0xfe,0x4c,0x34,0xfe,0x4c,0x87,0xea,0x4c,0x21,0xfe,0x4c,0x13,0xee,0x4c,0xdd,0xed,0x4c,0xef,0xed,0x4c,0xfe,0xed,0x4c,0xc,0xed,0x4c,0x9,0xed,0x4c,0x7,0xfe,0x4c,0x0,0xfe,0x4c,0xf9,0xfd,0x6c,0x1a,0x3,0x6c,0x1c,0x3,0x6c,0x1e,0x3,0x6c,0x20,0x3,0x6c,0x22,0x3,0x6c,0x24,0x3,0x6c,0x26,0x3,0x4c,0x9e,0xf4,0x4c,0xdd,0xf5,0x4c,0xe4,0xf6,0x4c,0xdd,0xf6,0x6c,0x28,0x3,0x6c,0x2a,0x3,0x6c,0x2c,0x3,0x4c,0x9b,0xf6,0x4c,0x5,0xe5,0x4c,0xa,0xe5,0x4c,0x0,0xe5,0x52,0x52,0x42,0x59,0x43,0xfe,0xe2,0xfc,0x48,0xff }; 
 
@@ -176,58 +171,8 @@ int       incomingByte;
 //
 void setup() {
   
-  pinMode(PIN_CLK0,        INPUT);  
-  pinMode(PIN_RESET,       INPUT);  
-  pinMode(PIN_READY_n,     INPUT);  
-  pinMode(PIN_IRQ,         INPUT);  
-  pinMode(PIN_NMI,         INPUT);  
-  pinMode(PIN_RDWR_n,      OUTPUT); 
-  pinMode(PIN_P0,          OUTPUT); 
-  pinMode(PIN_P1,          OUTPUT); 
-  pinMode(PIN_P2,          OUTPUT); 
-  
-  pinMode(PIN_ADDR0,       OUTPUT); 
-  pinMode(PIN_ADDR1,       OUTPUT); 
-  pinMode(PIN_ADDR2,       OUTPUT); 
-  pinMode(PIN_ADDR3,       OUTPUT); 
-  pinMode(PIN_ADDR4,       OUTPUT); 
-  pinMode(PIN_ADDR5,       OUTPUT); 
-  pinMode(PIN_ADDR6,       OUTPUT); 
-  pinMode(PIN_ADDR7,       OUTPUT);
-  pinMode(PIN_ADDR8,       OUTPUT); 
-  pinMode(PIN_ADDR9,       OUTPUT); 
-  pinMode(PIN_ADDR10,      OUTPUT); 
-  pinMode(PIN_ADDR11,      OUTPUT); 
-  pinMode(PIN_ADDR12,      OUTPUT); 
-  pinMode(PIN_ADDR13,      OUTPUT); 
-  pinMode(PIN_ADDR14,      OUTPUT); 
-  pinMode(PIN_ADDR15,      OUTPUT);  
-  
-  pinMode(PIN_DATAIN0,     INPUT); 
-  pinMode(PIN_DATAIN1,     INPUT); 
-  pinMode(PIN_DATAIN2,     INPUT); 
-  pinMode(PIN_DATAIN3,     INPUT); 
-  pinMode(PIN_DATAIN4,     INPUT); 
-  pinMode(PIN_DATAIN5,     INPUT); 
-  pinMode(PIN_DATAIN6,     INPUT); 
-  pinMode(PIN_DATAIN7,     INPUT);
-    
-  pinMode(PIN_DATAOUT0,    OUTPUT); 
-  pinMode(PIN_DATAOUT1,    OUTPUT); 
-  pinMode(PIN_DATAOUT2,    OUTPUT); 
-  pinMode(PIN_DATAOUT3,    OUTPUT); 
-  pinMode(PIN_DATAOUT4,    OUTPUT); 
-  pinMode(PIN_DATAOUT5,    OUTPUT); 
-  pinMode(PIN_DATAOUT6,    OUTPUT); 
-  pinMode(PIN_DATAOUT7,    OUTPUT);
-  pinMode(PIN_DATAOUT_OE_n,  OUTPUT); 
-
-  digitalWriteFast(PIN_P0, 0x1 ); 
-  digitalWriteFast(PIN_P1, 0x1 ); 
-  digitalWriteFast(PIN_P2, 0x1 ); 
-
-  Serial.begin(9600);
-
+  TIMING::setup();
+  Rebuild_Page_Table();
 }
 
 
@@ -240,6 +185,42 @@ void setup() {
 // --------------------------------------------------------------------------------------------------
 
 
+// ----------------------------------------------------------
+// Rebuild the page table from the processor port, acceleration mode and cartridge lines
+//
+//  page_mode  - Value returned by internal_address_check() for the page
+//               Cartridge ROM, open and I/O pages are always 0x0 since only the motherboard can answer them
+//  page_read  - Internal BASIC, KERNAL or RAM contents of the page
+//  page_write - Internal RAM under the page, or discard_page when the write belongs to the cartridge
+// ----------------------------------------------------------
+void Rebuild_Page_Table() {
+  uint16_t page;
+  uint8_t  ultimax, roml, romh_a000, basic, kernal;
+
+  ultimax   = (cartridge_game==0 && cartridge_exrom==1);
+  roml      = ultimax || (cartridge_exrom==0 && port_loram && port_hiram);
+  romh_a000 = (cartridge_game==0 && cartridge_exrom==0 && port_hiram);
+  basic     = (cartridge_game==1 && port_loram && port_hiram);
+  kernal    = (ultimax==0 && port_hiram);
+
+  for (page=0; page<256; page++)  {
+    page_read[page]  = &internal_RAM[page<<8];
+    page_write[page] = &internal_RAM[page<<8];
+    page_mode[page]  = mode;
+
+         if (page>=0xD8 && page<=0xDB && mode>1)     {  }                                                      //   C64 Color RAM
+    else if (page>=0xD0 && page<=0xDF)               {  page_mode[page]=0x0;  }                                //   C64 I/O
+    else if (page>=0x80 && page<=0x9F && roml)       {  page_mode[page]=0x0;  if (ultimax) page_write[page]=discard_page;  }  //   Cartridge ROML
+    else if (page>=0xA0 && page<=0xBF && romh_a000)  {  page_mode[page]=0x0;  }                                //   Cartridge ROMH
+    else if (page>=0xA0 && page<=0xBF && basic)      {  page_read[page]=&BASIC_ROM[(page-0xA0)<<8];  }         //   BASIC ROM
+    else if (page>=0xE0 && ultimax)                  {  page_mode[page]=0x0;  page_write[page]=discard_page;  }  //   Cartridge ROMH
+    else if (page>=0xE0 && kernal)                   {  page_read[page]=&KERNAL_ROM[(page-0xE0)<<8];  }        //   KERNAL ROM
+    else if (page>=0x10 && ultimax)                  {  page_mode[page]=0x0;  page_write[page]=discard_page;  }  //   Ultimax open space
+  }
+  return;
+}
+
+
 // ----------------------------------------------------------
 // Address range check
 //  Return: 0x0 - All exernal memory accesses
@@ -249,89 +230,10 @@ void setup() {
 // ----------------------------------------------------------
 FASTRUN inline uint8_t internal_address_check(uint16_t local_address) {
 
-  if ( (local_address >= 0xD800) && (local_address <= 0xDBFF) && mode>1) return mode;  //   C64 Color RAM
-  if ( (local_address >= 0xD000) && (local_address <= 0xDFFF) )          return 0x0;   //   C64 I/O
-  return mode;
-
+  return TIMING::address_check(local_address);
 } 
 
 
-// -------------------------------------------------
-// Wait for the CLK1 rising edge and sample signals
-// -------------------------------------------------
-inline void wait_for_CLK_rising_edge() {
-  register uint32_t GPIO6_data=0;
-  register uint32_t GPIO6_data_d1=0;
-  uint32_t   d10, d2, d3, d4, d5, d76;
-
-    while (((GPIO6_DR >> 12) & 0x1)!=0) {}            // Teensy 4.1 Pin-24  GPIO6_DR[12]     CLK
-    
-    while (((GPIO6_DR >> 12) & 0x1)==0) {GPIO6_data=GPIO6_DR;}                  // This method is ok for VIC-20 and Apple-II+ non-DRAM ranges 
-    
-    //do {  GPIO6_data_d1=GPIO6_DR;   } while (((GPIO6_data_d1 >> 12) & 0x1)==0);   // This method needed to support Apple-II+ DRAM read data setup time
-    //GPIO6_data=GPIO6_data_d1;
-    
-    d10             = (GPIO6_data&0x000C0000) >> 18;  // Teensy 4.1 Pin-14  GPIO6_DR[19:18]  D1:D0
-    d2              = (GPIO6_data&0x00800000) >> 21;  // Teensy 4.1 Pin-16  GPIO6_DR[23]     D2
-    d3              = (GPIO6_data&0x00400000) >> 19;  // Teensy 4.1 Pin-17  GPIO6_DR[22]     D3
-    d4              = (GPIO6_data&0x00020000) >> 13;  // Teensy 4.1 Pin-18  GPIO6_DR[17]     D4
-    d5              = (GPIO6_data&0x00010000) >> 11;  // Teensy 4.1 Pin-19  GPIO6_DR[16]     D5
-    d76             = (GPIO6_data&0x0C000000) >> 20;  // Teensy 4.1 Pin-20  GPIO6_DR[27:26]  D7:D6
-    
-    direct_irq      = (GPIO6_data&0x00002000) >> 13;  // Teensy 4.1 Pin-25  GPIO6_DR[13]     IRQ
-    direct_ready_n  = (GPIO6_data&0x40000000) >> 30;  // Teensy 4.1 Pin-26  GPIO6_DR[30]     READY
-    direct_reset    = (GPIO6_data&0x00100000) >> 20;  // Teensy 4.1 Pin-40  GPIO6_DR[20]     RESET
-    direct_nmi      = (GPIO6_data&0x00200000) >> 21;  // Teensy 4.1 Pin-41  GPIO6_DR[21]     NMI
-    
-    direct_datain = d76 | d5 | d4 | d3 | d2 | d10;
-    
-    return; 
-}
-
-
-// -------------------------------------------------
-// Wait for the CLK1 falling edge 
-// -------------------------------------------------
-inline void wait_for_CLK_falling_edge() {
-
-  while (((GPIO6_DR >> 12) & 0x1)==0) {}   // Teensy 4.1 Pin-24  GPIO6_DR[12]  CLK
-  while (((GPIO6_DR >> 12) & 0x1)!=0) {}
-  return; 
-}
-
-
-// -------------------------------------------------
-// Drive the 6502 Address pins
-// -------------------------------------------------
-inline void send_address(uint32_t local_address) {
-  register uint32_t writeback_data=0;
-  
-    writeback_data = (0x6DFFFFF3 & GPIO6_DR);   // Read in current GPIOx register value and clear the bits we intend to update
-    writeback_data = writeback_data | (local_address & 0x8000)<<10 ;  // 6502_Address[15]   TEENSY_PIN23   GPIO6_DR[25]
-    writeback_data = writeback_data | (local_address & 0x2000)>>10 ;  // 6502_Address[13]   TEENSY_PIN0    GPIO6_DR[3]
-    writeback_data = writeback_data | (local_address & 0x1000)>>10 ;  // 6502_Address[12]   TEENSY_PIN1    GPIO6_DR[2]
-    writeback_data = writeback_data | (local_address & 0x0002)<<27 ;  // 6502_Address[1]    TEENSY_PIN38   GPIO6_DR[28]
-    GPIO6_DR       = writeback_data | (local_address & 0x0001)<<31 ;  // 6502_Address[0]    TEENSY_PIN27   GPIO6_DR[31]
-    
-    writeback_data = (0xCFF3EFFF & GPIO7_DR);   // Read in current GPIOx register value and clear the bits we intend to update
-    writeback_data = writeback_data | (local_address & 0x0400)<<2  ;  // 6502_Address[10]   TEENSY_PIN32   GPIO7_DR[12]
-    writeback_data = writeback_data | (local_address & 0x0200)<<20 ;  // 6502_Address[9]    TEENSY_PIN34   GPIO7_DR[29]
-    writeback_data = writeback_data | (local_address & 0x0080)<<21 ;  // 6502_Address[7]    TEENSY_PIN35   GPIO7_DR[28]
-    writeback_data = writeback_data | (local_address & 0x0020)<<13 ;  // 6502_Address[5]    TEENSY_PIN36   GPIO7_DR[18]
-    GPIO7_DR       = writeback_data | (local_address & 0x0008)<<16 ;  // 6502_Address[3]    TEENSY_PIN37   GPIO7_DR[19]
-                
-    writeback_data = (0xFF3BFFFF & GPIO8_DR);   // Read in current GPIOx register value and clear the bits we intend to update
-    writeback_data = writeback_data | (local_address & 0x0100)<<14 ;  // 6502_Address[8]    TEENSY_PIN31   GPIO8_DR[22]
-    writeback_data = writeback_data | (local_address & 0x0040)<<17 ;  // 6502_Address[6]    TEENSY_PIN30   GPIO8_DR[23]
-    GPIO8_DR       = writeback_data | (local_address & 0x0004)<<16 ;  // 6502_Address[2]    TEENSY_PIN28   GPIO8_DR[18]
-    
-    writeback_data = (0x7FFFFF6F & GPIO9_DR);   // Read in current GPIOx register value and clear the bits we intend to update
-    writeback_data = writeback_data | (local_address & 0x4000)>>10 ;  // 6502_Address[14]   TEENSY_PIN2    GPIO9_DR[4]
-    writeback_data = writeback_data | (local_address & 0x0800)>>4  ;  // 6502_Address[11]   TEENSY_PIN33   GPIO9_DR[7]
-    GPIO9_DR       = writeback_data | (local_address & 0x0010)<<27 ;  // 6502_Address[4]    TEENSY_PIN29   GPIO9_DR[31]
-    
-    return;
-}
 
         
 // -------------------------------------------------
@@ -347,11 +249,11 @@ inline void start_read(uint32_t local_address) {
 
     else 
     {
-       if (last_access_internal_RAM==1) wait_for_CLK_rising_edge();
+       if (last_access_internal_RAM==1) TIMING::wait_for_CLK_rising_edge();
        last_access_internal_RAM=0;
 
-        digitalWriteFast(PIN_RDWR_n,  0x1);
-        send_address(local_address);
+        TIMING::drive_RDWR_n(0x1);
+        TIMING::send_address(local_address);
      }
     return;
 }
@@ -363,13 +265,7 @@ inline void start_read(uint32_t local_address) {
 // -------------------------------------------------
 inline uint8_t fetch_byte_from_bank() {
                      
-    if (Page_160_191==0x1)  {  if   ((bank_mode&0x3)==0x3)                                  {  return BASIC_ROM[current_address & 0x1FFF];        }
-                               else                                                         {  return internal_RAM[current_address];              }  }
-    
-    if (Page_224_255==0x1)  {  if ( (bank_mode&0x2)==0x2)                                   {  return KERNAL_ROM[current_address & 0x1FFF];       }
-                               else                                                         {  return internal_RAM[current_address];              }  }
-    
-     return internal_RAM[current_address];
+     return page_read[current_address>>8][current_address&0xFF];
 }
   
 
@@ -384,10 +280,10 @@ inline uint8_t finish_read_byte() {
     }         
     else 
     {
-       if (last_access_internal_RAM==1) wait_for_CLK_rising_edge();
+       if (last_access_internal_RAM==1) TIMING::wait_for_CLK_rising_edge();
        last_access_internal_RAM=0;
        
-       do {  wait_for_CLK_rising_edge();  }  while (direct_ready_n == 0x1);  // Delay a clock cycle until ready is active 
+       do {  TIMING::wait_for_CLK_rising_edge();  }  while (direct_ready_n == 0x1);  // Delay a clock cycle until ready is active 
                       
        if (internal_address_check(current_address)>0x0)  {  return fetch_byte_from_bank();   }
        else                                              {  if (current_address==0x1) return (current_p|0x10); else return direct_datain;                  }
@@ -409,11 +305,11 @@ inline uint8_t read_byte(uint16_t local_address) {
     }
     else 
     {
-       if (last_access_internal_RAM==1) wait_for_CLK_rising_edge();
+       if (last_access_internal_RAM==1) TIMING::wait_for_CLK_rising_edge();
        last_access_internal_RAM=0;
        
        start_read(local_address);
-       do {  wait_for_CLK_rising_edge();  }  while (direct_ready_n == 0x1);  // Delay a clock cycle until ready is active 
+       do {  TIMING::wait_for_CLK_rising_edge();  }  while (direct_ready_n == 0x1);  // Delay a clock cycle until ready is active 
 
        if (internal_address_check(current_address)>0x0)  {  return fetch_byte_from_bank();  }
        else                                              {  if (current_address==0x1) return (current_p|0x10); else return direct_datain;                  }
@@ -430,46 +326,37 @@ inline void write_byte(uint16_t local_address , uint8_t local_write_data) {
   //
     if (internal_address_check(local_address)>0x2)  {
     last_access_internal_RAM=1;
-    internal_RAM[local_address] = local_write_data;
-      //if ( (Page_128_159==0x1)  && ( (EXROM==1 && GAME==0) || ( EXROM==0 && ((bank_mode&0x3)==0x3) ) )) {  } else internal_RAM[local_address] = local_write_data; 
+    page_write[local_address>>8][local_address&0xFF] = local_write_data;
+    if (local_address==0x1) {  current_p = local_write_data;  Rebuild_Page_Table();  }
   }
   else 
   {
-       if (last_access_internal_RAM==1) wait_for_CLK_rising_edge();
+       if (last_access_internal_RAM==1) TIMING::wait_for_CLK_rising_edge();
        last_access_internal_RAM=0;
-       internal_RAM[local_address] = local_write_data;
-      //if ( (Page_128_159==0x1)  && ( (EXROM==1 && GAME==0) || ( EXROM==0 && ((bank_mode&0x3)==0x3) ) )) {  } else internal_RAM[local_address] = local_write_data; 
+       page_write[local_address>>8][local_address&0xFF] = local_write_data;
      
-       digitalWriteFast(PIN_RDWR_n,  0x0);
-       send_address(local_address);
+       TIMING::drive_RDWR_n(0x0);
+       TIMING::send_address(local_address);
 
        
      // Drive the data bus pins from the Teensy to the bus driver which is inactive
      //
-       digitalWriteFast(PIN_DATAOUT0,  (local_write_data & 0x01)    );
-       digitalWriteFast(PIN_DATAOUT1,  (local_write_data & 0x02)>>1 ); 
-       digitalWriteFast(PIN_DATAOUT2,  (local_write_data & 0x04)>>2 ); 
-       digitalWriteFast(PIN_DATAOUT3,  (local_write_data & 0x08)>>3 ); 
-       digitalWriteFast(PIN_DATAOUT4,  (local_write_data & 0x10)>>4 ); 
-       digitalWriteFast(PIN_DATAOUT5,  (local_write_data & 0x20)>>5 ); 
-       digitalWriteFast(PIN_DATAOUT6,  (local_write_data & 0x40)>>6 ); 
-       digitalWriteFast(PIN_DATAOUT7,  (local_write_data & 0x80)>>7 ); 
+       TIMING::drive_data(local_write_data);
      
        if (local_address==0x1) {  
        current_p = local_write_data;
-       digitalWriteFast(PIN_P0,  (local_write_data & 0x01) ); 
-       digitalWriteFast(PIN_P1,  (local_write_data & 0x02) >> 1 ); 
-       digitalWriteFast(PIN_P2,  (local_write_data & 0x04) >> 2 ); 
+       Rebuild_Page_Table();
+       TIMING::drive_processor_port(local_write_data);
      }
      
        
        // During the second CLK phase, enable the data bus output drivers
        //
-       wait_for_CLK_falling_edge();
-       digitalWriteFast(PIN_DATAOUT_OE_n,  0x0 ); 
+       TIMING::wait_for_CLK_falling_edge();
+       TIMING::drive_data_OE_n(0x0); 
        
-       wait_for_CLK_rising_edge();
-       digitalWriteFast(PIN_DATAOUT_OE_n,  0x1 );   
+       TIMING::wait_for_CLK_rising_edge();
+       TIMING::drive_data_OE_n(0x1);   
   }            
    return;
 }
@@ -543,7 +430,7 @@ inline uint8_t Fetch_ZeroPage()  {
 inline uint8_t Fetch_ZeroPage_X()  {   
     uint16_t bal;
     bal = Fetch_Immediate();
-    // read_byte(register_pc+1); 
+    if (TIMING::cycle_accurate) read_byte(register_pc+1); 
     effective_address = (0x00FF & (bal + register_x));
     ea_data = read_byte(effective_address);
     return ea_data;
@@ -552,7 +439,7 @@ inline uint8_t Fetch_ZeroPage_X()  {
 inline uint8_t Fetch_ZeroPage_Y()  {   
     uint16_t bal;
     bal = Fetch_Immediate();
-    // read_byte(register_pc+1); 
+    if (TIMING::cycle_accurate) read_byte(register_pc+1); 
     effective_address = (0x00FF & (bal + register_y)); 
     ea_data = read_byte(effective_address);
     return ea_data;
@@ -585,7 +472,9 @@ inline uint8_t Fetch_Absolute_X(uint8_t page_cross_check)  {
     effective_address = bah + bal + register_x;
     ea_data = read_byte(effective_address );
     
-
+    if (TIMING::cycle_accurate && page_cross_check==1 && (  (0xFF00&effective_address) != (0xFF00&bah) ) ) {  
+        ea_data = read_byte(effective_address ); 
+    }
     return ea_data;
 }
 
@@ -596,7 +485,10 @@ inline uint8_t Fetch_Absolute_Y(uint8_t page_cross_check)  {
     bah = Fetch_Immediate()<<8;
     effective_address = bah + bal + register_y;
     ea_data = read_byte(effective_address );
-
+    
+    if (TIMING::cycle_accurate && page_cross_check==1 && (  (0xFF00&effective_address) != (0xFF00&bah) ) ) {  
+        ea_data = read_byte(effective_address ); 
+    } 
     return ea_data;
 }
 
@@ -605,7 +497,7 @@ inline uint8_t Fetch_Indexed_Indirect_X()  {
     uint16_t adl, adh;
     
     bal = Fetch_Immediate() + register_x;
-    // read_byte(bal);
+    if (TIMING::cycle_accurate) read_byte(bal);
     adl = read_byte(0xFF&bal);
     adh = read_byte(0xFF&(bal+1)) << 8;
     effective_address = adh + adl ;
@@ -623,6 +515,9 @@ inline uint8_t Fetch_Indexed_Indirect_Y(uint8_t page_cross_check)  {
     effective_address = bah + bal + register_y;
     ea_data = read_byte(effective_address);
     
+    if (TIMING::cycle_accurate && page_cross_check==1 && ((0xFF00&effective_address) != (0xFF00&bah)) ) {  
+        ea_data = read_byte(effective_address); 
+    }
     return ea_data;
 }
 
@@ -642,14 +537,14 @@ inline void Write_Absolute(uint8_t local_data)  {
 
 inline void Write_ZeroPage_X(uint8_t local_data)  {
     effective_address = Fetch_Immediate();
-    // read_byte(effective_address);
+    if (TIMING::cycle_accurate) read_byte(effective_address);
     write_byte( (0x00FF&(effective_address + register_x)) , local_data );
     return;
 }
 
 inline void Write_ZeroPage_Y(uint8_t local_data)  {
     effective_address = Fetch_Immediate();
-    // read_byte(effective_address);
+    if (TIMING::cycle_accurate) read_byte(effective_address);
     write_byte( (0x00FF&(effective_address + register_y)) , local_data );
     return;
 }
@@ -660,7 +555,7 @@ inline void Write_Absolute_X(uint8_t local_data)  {
     bal = Fetch_Immediate();
     bah = Fetch_Immediate()<<8;
     effective_address = bal + bah + register_x; 
-    // read_byte(effective_address);
+    if (TIMING::cycle_accurate) read_byte(effective_address);
     write_byte(effective_address , local_data );  
     return;
 }
@@ -671,9 +566,13 @@ inline void Write_Absolute_Y(uint8_t local_data)  {
     bal = Fetch_Immediate();
     bah = Fetch_Immediate()<<8;
     effective_address = bal + bah + register_y;
-    // read_byte(effective_address);
-
 
+    if (TIMING::cycle_accurate) {
+        read_byte(effective_address);
+        if ( (0xFF00&effective_address) != (0xFF00&bah) ) { 
+        read_byte(effective_address);
+        }
+    }
     write_byte(effective_address , local_data );  
     return;
 }
@@ -683,7 +582,7 @@ inline void Write_Indexed_Indirect_X(uint8_t local_data)  {
     uint16_t adl, adh;
 
     bal = Fetch_Immediate();
-    // read_byte(bal);
+    if (TIMING::cycle_accurate) read_byte(bal);
     adl = read_byte(0xFF&(bal+register_x));
     adh = read_byte(0xFF&(bal+register_x+1)) << 8;
     effective_address = adh + adl;
@@ -699,13 +598,13 @@ inline void Write_Indexed_Indirect_Y(uint8_t local_data)  {
     bal = read_byte(ial);
     bah = read_byte(ial+1)<<8;
     effective_address = bah + bal + register_y;
-    // read_byte(effective_address);
+    if (TIMING::cycle_accurate) read_byte(effective_address);
     write_byte(effective_address , local_data );
     return;
 }
 
 inline void Double_WriteBack(uint8_t local_data)  {  
-    //  write_byte(effective_address , ea_data);
+    if (TIMING::cycle_accurate) write_byte(effective_address , ea_data);
     write_byte(effective_address , local_data);
     return;
 }
@@ -717,16 +616,15 @@ inline void Double_WriteBack(uint8_t local_data)  {
 void reset_sequence() {
     uint16_t temp1, temp2;
        
-    while (digitalReadFast(PIN_RESET)!=0) {}                        // Stay here until RESET deasserts
+    while (TIMING::reset_asserted()!=0) {}                        // Stay here until RESET deasserts
             
                 
-    digitalWriteFast(PIN_RDWR_n,  0x1);         
-    digitalWriteFast(PIN_DATAOUT_OE_n,  0x1 );  
+    TIMING::drive_RDWR_n(0x1);         
+    TIMING::drive_data_OE_n(0x1);  
     
-    digitalWriteFast(PIN_P0, 0x1 ); 
-    digitalWriteFast(PIN_P1, 0x1 ); 
-    digitalWriteFast(PIN_P2, 0x1 );           
-            
+    TIMING::drive_processor_port(0x7);
+    current_p = 0x7;
+    Rebuild_Page_Table();
             
     temp1 = read_byte(register_pc);                                 // Address ??
     temp1 = read_byte(register_pc+1);                               // Address ?? + 1
@@ -754,12 +652,12 @@ void reset_sequence() {
 void nmi_handler() {
     uint16_t temp1, temp2;
     
-    wait_for_CLK_rising_edge();                                     // Begin processing on next CLK edge
+    TIMING::wait_for_CLK_rising_edge();                                     // Begin processing on next CLK edge
     
     register_flags = register_flags | 0x20;                         // Set the flag[5]          
     register_flags = register_flags & 0xEF;                         // Clear the B flag     
     
-    // read_byte(register_pc+1);                                       // Fetch PC+1 (Discard)
+    if (TIMING::cycle_accurate) read_byte(register_pc+1);           // Fetch PC+1 (Discard)
     push(register_pc>>8);                                           // Push PCH
     push(register_pc);                                              // Push PCL
     push(register_flags);                                           // Push P
@@ -782,13 +680,13 @@ void nmi_handler() {
 void irq_handler(uint8_t opcode_is_brk) {
     uint16_t temp1, temp2;
     
-    wait_for_CLK_rising_edge();                                     // Begin processing on next CLK edge
+    TIMING::wait_for_CLK_rising_edge();                                     // Begin processing on next CLK edge
                         
     register_flags = register_flags | 0x20;                         // Set the flag[5]          
     if (opcode_is_brk==1) register_flags = register_flags | 0x10;   // Set the B flag
     else                  register_flags = register_flags & 0xEF;   // Clear the B flag
     
-    // read_byte(register_pc+1);                                       // Fetch PC+1 (Discard)
+    if (TIMING::cycle_accurate) read_byte(register_pc+1);           // Fetch PC+1 (Discard)
     push(register_pc>>8);                                           // Push PCH
     push(register_pc);                                              // Push PCL
     push(register_flags);                                           // Push P
@@ -816,7 +714,7 @@ void irq_handler(uint8_t opcode_is_brk) {
 // -------------------------------------------------
 void opcode_0x0A() {
     
-    // read_byte(register_pc);        
+    if (TIMING::cycle_accurate) read_byte(register_pc);        
     Begin_Fetch_Next_Opcode();
      
     if (0x80&register_a)   register_flags = register_flags | 0x01;              // Set the C flag
@@ -835,7 +733,7 @@ void opcode_0x0A() {
 // -------------------------------------------------
 void opcode_0x4A() {
     
-    // read_byte(register_pc);        
+    if (TIMING::cycle_accurate) read_byte(register_pc);        
     Begin_Fetch_Next_Opcode();
     
     if (0x01&register_a)   register_flags = register_flags | 0x01;              // Set the C flag
@@ -854,7 +752,7 @@ void opcode_0x6A() {
 
   uint8_t old_carry_flag=0;
     
-    // read_byte(register_pc);        
+    if (TIMING::cycle_accurate) read_byte(register_pc);        
     Begin_Fetch_Next_Opcode();
     
     old_carry_flag = register_flags << 7;                                       // Shift the old carry flag to bit[8] to be rotated in
@@ -876,7 +774,7 @@ void opcode_0x2A() {
 
   uint8_t old_carry_flag=0;
 
-    // read_byte(register_pc);        
+    if (TIMING::cycle_accurate) read_byte(register_pc);        
     Begin_Fetch_Next_Opcode();
     
     old_carry_flag = 0x1 & register_flags;                                      // Store the old carry flag to be rotated in
@@ -1030,43 +928,43 @@ void opcode_0xF1() { Calculate_SBC(Fetch_Indexed_Indirect_Y(1));   return;  }  /
 // -------------------------------------------------
 // Flag set/resets and NOP
 // -------------------------------------------------
-void opcode_0xEA() {    Begin_Fetch_Next_Opcode();                                        return;  }  // 0xEA - NOP   
-void opcode_0x18() {    Begin_Fetch_Next_Opcode();  register_flags=register_flags&0xFE;   return;  }  // 0x18 - CLC - Clear Carry Flag  
-void opcode_0xD8() {    Begin_Fetch_Next_Opcode();  register_flags=register_flags&0xF7;   return;  }  // 0xD8 - CLD - Clear Decimal Mode  
-void opcode_0x58() {    Begin_Fetch_Next_Opcode();  register_flags=register_flags&0xFB;   return;  }  // 0x58 - CLI - Clear Interrupt Flag  
-void opcode_0xB8() {    Begin_Fetch_Next_Opcode();  register_flags=register_flags&0xBF;   return;  }  // 0xB8 - CLV - Clear Overflow Flag  
-void opcode_0x38() {    Begin_Fetch_Next_Opcode();  register_flags=register_flags|0x01;   return;  }  // 0x38 - SEC - Set Carry Flag  
-void opcode_0x78() {    Begin_Fetch_Next_Opcode();  register_flags=register_flags|0x04;   return;  }  // 0x78 - SEI - Set Interrupt Flag  
-void opcode_0xF8() {    Begin_Fetch_Next_Opcode();  register_flags=register_flags|0x08;   return;  }  // 0xF8 - SED - Set Decimal Mode  
+void opcode_0xEA() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();                                        return;  }  // 0xEA - NOP   
+void opcode_0x18() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_flags=register_flags&0xFE;   return;  }  // 0x18 - CLC - Clear Carry Flag  
+void opcode_0xD8() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_flags=register_flags&0xF7;   return;  }  // 0xD8 - CLD - Clear Decimal Mode  
+void opcode_0x58() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_flags=register_flags&0xFB;   return;  }  // 0x58 - CLI - Clear Interrupt Flag  
+void opcode_0xB8() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_flags=register_flags&0xBF;   return;  }  // 0xB8 - CLV - Clear Overflow Flag  
+void opcode_0x38() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_flags=register_flags|0x01;   return;  }  // 0x38 - SEC - Set Carry Flag  
+void opcode_0x78() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_flags=register_flags|0x04;   return;  }  // 0x78 - SEI - Set Interrupt Flag  
+void opcode_0xF8() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_flags=register_flags|0x08;   return;  }  // 0xF8 - SED - Set Decimal Mode  
 
 
 // -------------------------------------------------
 // Increment/Decrements
 // -------------------------------------------------
-void opcode_0xCA() {   Begin_Fetch_Next_Opcode();  register_x=register_x-1;   Calc_Flags_NEGATIVE_ZERO(register_x); return;  }  // 0xCA - DEX - Decrement X  
-void opcode_0x88() {   Begin_Fetch_Next_Opcode();  register_y=register_y-1;   Calc_Flags_NEGATIVE_ZERO(register_y); return;  }  // 0x88 - DEY - Decrement Y  
-void opcode_0xE8() {   Begin_Fetch_Next_Opcode();  register_x=register_x+1;   Calc_Flags_NEGATIVE_ZERO(register_x); return;  }  // 0xE8 - INX - Increment X  
-void opcode_0xC8() {   Begin_Fetch_Next_Opcode();  register_y=register_y+1;   Calc_Flags_NEGATIVE_ZERO(register_y); return;  }  // 0xC8 - INY - Increment Y  
+void opcode_0xCA() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_x=register_x-1;   Calc_Flags_NEGATIVE_ZERO(register_x); return;  }  // 0xCA - DEX - Decrement X  
+void opcode_0x88() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_y=register_y-1;   Calc_Flags_NEGATIVE_ZERO(register_y); return;  }  // 0x88 - DEY - Decrement Y  
+void opcode_0xE8() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_x=register_x+1;   Calc_Flags_NEGATIVE_ZERO(register_x); return;  }  // 0xE8 - INX - Increment X  
+void opcode_0xC8() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_y=register_y+1;   Calc_Flags_NEGATIVE_ZERO(register_y); return;  }  // 0xC8 - INY - Increment Y  
 
 
 // -------------------------------------------------
 // Transfers
 // -------------------------------------------------
-void opcode_0xAA() {   Begin_Fetch_Next_Opcode();  register_x=register_a;   Calc_Flags_NEGATIVE_ZERO(register_x); return;  }  // 0xAA - TAX - Transfer Accumulator to X 
-void opcode_0xA8() {   Begin_Fetch_Next_Opcode();  register_y=register_a;   Calc_Flags_NEGATIVE_ZERO(register_y); return;  }  // 0xA8 - TAY - Transfer Accumulator to Y
-void opcode_0xBA() {   Begin_Fetch_Next_Opcode();  register_x=register_sp;  Calc_Flags_NEGATIVE_ZERO(register_x); return;  }  // 0xBA - TSX - Transfer Stack Pointer to X
-void opcode_0x8A() {   Begin_Fetch_Next_Opcode();  register_a=register_x;   Calc_Flags_NEGATIVE_ZERO(register_a); return;  }  // 0x8A - TXA - Transfer X to Accumulator
-void opcode_0x9A() {   Begin_Fetch_Next_Opcode();  register_sp=register_x;                                        return;  }  // 0x9A - TXS - Transfer X to Stack Pointer
-void opcode_0x98() {   Begin_Fetch_Next_Opcode();  register_a=register_y;   Calc_Flags_NEGATIVE_ZERO(register_a); return;  }  // 0x98 - TYA - Transfer Y to Accumulator
+void opcode_0xAA() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_x=register_a;   Calc_Flags_NEGATIVE_ZERO(register_x); return;  }  // 0xAA - TAX - Transfer Accumulator to X 
+void opcode_0xA8() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_y=register_a;   Calc_Flags_NEGATIVE_ZERO(register_y); return;  }  // 0xA8 - TAY - Transfer Accumulator to Y
+void opcode_0xBA() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_x=register_sp;  Calc_Flags_NEGATIVE_ZERO(register_x); return;  }  // 0xBA - TSX - Transfer Stack Pointer to X
+void opcode_0x8A() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_a=register_x;   Calc_Flags_NEGATIVE_ZERO(register_a); return;  }  // 0x8A - TXA - Transfer X to Accumulator
+void opcode_0x9A() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_sp=register_x;                                        return;  }  // 0x9A - TXS - Transfer X to Stack Pointer
+void opcode_0x98() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  Begin_Fetch_Next_Opcode();  register_a=register_y;   Calc_Flags_NEGATIVE_ZERO(register_a); return;  }  // 0x98 - TYA - Transfer Y to Accumulator
 
 
 // -------------------------------------------------
 // PUSH/POP Flags and Accumulator 
 // -------------------------------------------------
-void opcode_0x08() {   push(register_flags|0x30);                                                              Begin_Fetch_Next_Opcode();  return;  }  // 0x08 - PHP - Push Flags to Stack
-void opcode_0x48() {   push(register_a);                                                                       Begin_Fetch_Next_Opcode();  return;  }  // 0x48 - PHA - Push Accumulator to the stack
-void opcode_0x28() {   /*read_byte(register_sp_fixed);*/  register_flags=(pop()|0x30);                             Begin_Fetch_Next_Opcode();  return;  }  // 0x28 - PLP - Pop Flags from Stack
-void opcode_0x68() {   /*read_byte(register_sp_fixed);*/  register_a=pop();  Calc_Flags_NEGATIVE_ZERO(register_a); Begin_Fetch_Next_Opcode();  return;  }  // 0x68 - PLA - Pop Accumulator from Stack
+void opcode_0x08() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  push(register_flags|0x30);                                                              Begin_Fetch_Next_Opcode();  return;  }  // 0x08 - PHP - Push Flags to Stack
+void opcode_0x48() {  if (TIMING::cycle_accurate) read_byte(register_pc+1);  push(register_a);                                                                       Begin_Fetch_Next_Opcode();  return;  }  // 0x48 - PHA - Push Accumulator to the stack
+void opcode_0x28() {  if (TIMING::cycle_accurate) { read_byte(register_pc+1);  read_byte(register_sp_fixed); }  register_flags=(pop()|0x30);                             Begin_Fetch_Next_Opcode();  return;  }  // 0x28 - PLP - Pop Flags from Stack
+void opcode_0x68() {  if (TIMING::cycle_accurate) { read_byte(register_pc+1);  read_byte(register_sp_fixed); }  register_a=pop();  Calc_Flags_NEGATIVE_ZERO(register_a); Begin_Fetch_Next_Opcode();  return;  }  // 0x68 - PLA - Pop Accumulator from Stack
 
 
 // -------------------------------------------------
@@ -1384,20 +1282,23 @@ void Branch_Taken()  {
     effective_address = Sign_Extend16(Fetch_Immediate()); 
     effective_address = (register_pc+1) + effective_address;
 
-
+    if (TIMING::cycle_accurate) {
+    if ( (0xFF00&register_pc) == (0xFF00&effective_address) )  {  Fetch_Immediate();                     }  // Page boundary not crossed
+    else                                                       {  Fetch_Immediate(); Fetch_Immediate();  }  // Page boundary crossed
+    }
     register_pc = effective_address;
     assert_sync=1;
     start_read(register_pc);
     return;
 }
-void opcode_0xB0() {  if ((flag_c)==1) Branch_Taken();  else { register_pc++; Begin_Fetch_Next_Opcode();}  return;  }  // 0xB0 - BCS - Branch on Carry Set
-void opcode_0x90() {  if ((flag_c)==0) Branch_Taken();  else { register_pc++; Begin_Fetch_Next_Opcode();}  return;  }  // 0x90 - BCC - Branch on Carry Clear
-void opcode_0xF0() {  if ((flag_z)==1) Branch_Taken();  else { register_pc++; Begin_Fetch_Next_Opcode();}  return;  }  // 0xF0 - BEQ - Branch on Zero Set
-void opcode_0xD0() {  if ((flag_z)==0) Branch_Taken();  else { register_pc++; Begin_Fetch_Next_Opcode();}  return;  }  // 0xD0 - BNE - Branch on Zero Clear
-void opcode_0x70() {  if ((flag_v)==1) Branch_Taken();  else { register_pc++; Begin_Fetch_Next_Opcode();}  return;  }  // 0x70 - BVS - Branch on Overflow Set
-void opcode_0x50() {  if ((flag_v)==0) Branch_Taken();  else { register_pc++; Begin_Fetch_Next_Opcode();}  return;  }  // 0x50 - BVC - Branch on Overflow Clear
-void opcode_0x30() {  if ((flag_n)==1) Branch_Taken();  else { register_pc++; Begin_Fetch_Next_Opcode();}  return;  }  // 0x30 - BMI - Branch on Minus (N Flag Set)
-void opcode_0x10() {  if ((flag_n)==0) Branch_Taken();  else { register_pc++; Begin_Fetch_Next_Opcode();}  return;  }  // 0x10 - BPL - Branch on Plus  (N Flag Clear)
+void opcode_0xB0() {  if ((flag_c)==1) Branch_Taken();  else { if (TIMING::cycle_accurate) Fetch_Immediate(); else register_pc++;  Begin_Fetch_Next_Opcode();}  return;  }  // 0xB0 - BCS - Branch on Carry Set
+void opcode_0x90() {  if ((flag_c)==0) Branch_Taken();  else { if (TIMING::cycle_accurate) Fetch_Immediate(); else register_pc++;  Begin_Fetch_Next_Opcode();}  return;  }  // 0x90 - BCC - Branch on Carry Clear
+void opcode_0xF0() {  if ((flag_z)==1) Branch_Taken();  else { if (TIMING::cycle_accurate) Fetch_Immediate(); else register_pc++;  Begin_Fetch_Next_Opcode();}  return;  }  // 0xF0 - BEQ - Branch on Zero Set
+void opcode_0xD0() {  if ((flag_z)==0) Branch_Taken();  else { if (TIMING::cycle_accurate) Fetch_Immediate(); else register_pc++;  Begin_Fetch_Next_Opcode();}  return;  }  // 0xD0 - BNE - Branch on Zero Clear
+void opcode_0x70() {  if ((flag_v)==1) Branch_Taken();  else { if (TIMING::cycle_accurate) Fetch_Immediate(); else register_pc++;  Begin_Fetch_Next_Opcode();}  return;  }  // 0x70 - BVS - Branch on Overflow Set
+void opcode_0x50() {  if ((flag_v)==0) Branch_Taken();  else { if (TIMING::cycle_accurate) Fetch_Immediate(); else register_pc++;  Begin_Fetch_Next_Opcode();}  return;  }  // 0x50 - BVC - Branch on Overflow Clear
+void opcode_0x30() {  if ((flag_n)==1) Branch_Taken();  else { if (TIMING::cycle_accurate) Fetch_Immediate(); else register_pc++;  Begin_Fetch_Next_Opcode();}  return;  }  // 0x30 - BMI - Branch on Minus (N Flag Set)
+void opcode_0x10() {  if ((flag_n)==0) Branch_Taken();  else { if (TIMING::cycle_accurate) Fetch_Immediate(); else register_pc++;  Begin_Fetch_Next_Opcode();}  return;  }  // 0x10 - BPL - Branch on Plus  (N Flag Clear)
 
 
 // -------------------------------------------------
@@ -1432,7 +1333,7 @@ void opcode_0x20()  {
     
     adl = Fetch_Immediate();
     adh = Fetch_Immediate()<<8;
-    //read_byte(register_sp_fixed);
+    if (TIMING::cycle_accurate) read_byte(register_sp_fixed);
     push((0xFF00&register_pc)>>8);  
 
     push(0x00FF&register_pc);
@@ -1449,7 +1350,7 @@ void opcode_0x40()  {
     uint16_t pcl, pch; 
     
     Fetch_Immediate();
-    // read_byte(register_sp_fixed);
+    if (TIMING::cycle_accurate) read_byte(register_sp_fixed);
     register_flags = pop();
     pcl = pop();
     pch = pop()<<8;
@@ -1466,11 +1367,11 @@ void opcode_0x60()  {
     uint16_t pcl, pch; 
     
     Fetch_Immediate();
-    // read_byte(register_sp_fixed);
+    if (TIMING::cycle_accurate) read_byte(register_sp_fixed);
     pcl = pop();
     pch = pop()<<8;
     register_pc = pch+pcl+1;  
-    // read_byte(register_pc);
+    if (TIMING::cycle_accurate) read_byte(register_pc);
     assert_sync=1;
     start_read(register_pc);
     return ;
@@ -1922,11 +1823,10 @@ void opcode_0xAB() {
   
   uint16_t local_counter=0;
   
-  // Give Teensy 4.1 a moment
-  delay (50);
-  wait_for_CLK_rising_edge();
-  wait_for_CLK_rising_edge();
-  wait_for_CLK_rising_edge();
+  TIMING::startup_delay();
+  TIMING::wait_for_CLK_rising_edge();
+  TIMING::wait_for_CLK_rising_edge();
+  TIMING::wait_for_CLK_rising_edge();
 
   reset_sequence();
 
@@ -1942,17 +1842,19 @@ void opcode_0xAB() {
       //
       local_counter++;
       if (local_counter==8000){
-        if (Serial.available() ) { 
-          incomingByte = Serial.read();   
+        incomingByte = TIMING::uart_read();
+        if (incomingByte >= 0) { 
           switch (incomingByte){
-            case 48: mode=0;  Serial.println("M0"); break;
-            case 49: mode=1;  Serial.println("M1"); break;
-            case 50: mode=2;  Serial.println("M2"); break;
-            case 51: mode=3;  Serial.println("M3"); break;
+            case 48: mode=0;  Rebuild_Page_Table();  TIMING::uart_println("M0"); break;
+            case 49: mode=1;  Rebuild_Page_Table();  TIMING::uart_println("M1"); break;
+            case 50: mode=2;  Rebuild_Page_Table();  TIMING::uart_println("M2"); break;
+            case 51: mode=3;  Rebuild_Page_Table();  TIMING::uart_println("M3"); break;
           }
         }
       }
     
+      TIMING::instruction_boundary();
+
       // Poll for NMI and IRQ
       //
       if (nmi_n_old==0 && direct_nmi==1)        nmi_handler();          
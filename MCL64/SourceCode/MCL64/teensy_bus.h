@@ -0,0 +1,293 @@
+//
+//
+//  File Name   :  teensy_bus.h
+//  Used on     :  MCL64
+//  Author      :  Ted Fried, MicroCore Labs
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//   
+//  Teensy 4.1 pin interface to the C64 6510 socket. Supplies the bus hooks
+//  used by the Cycle_Accurate_Timing and Accelerated_Timing policies in
+//  timing.h when MCL64.ino is built for the board.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision - moved out of the two MCL64.ino variants
+//
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Ted Fried
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#ifndef TEENSY_BUS_H
+#define TEENSY_BUS_H
+
+#include <stdint.h>
+
+// Teensy 4.1 pin assignments
+//
+#define PIN_CLK0            24
+#define PIN_READY_n         26
+#define PIN_IRQ             25
+#define PIN_NMI             41
+#define PIN_RESET           40
+#define PIN_RDWR_n          12
+#define PIN_P0              22
+#define PIN_P1              13
+#define PIN_P2              39
+                    
+#define PIN_ADDR0           27 
+#define PIN_ADDR1           38 
+#define PIN_ADDR2           28 
+#define PIN_ADDR3           37 
+#define PIN_ADDR4           29 
+#define PIN_ADDR5           36 
+#define PIN_ADDR6           30 
+#define PIN_ADDR7           35         
+#define PIN_ADDR8           31 
+#define PIN_ADDR9           34 
+#define PIN_ADDR10          32 
+#define PIN_ADDR11          33 
+#define PIN_ADDR12          1  
+#define PIN_ADDR13          0  
+#define PIN_ADDR14          2  
+#define PIN_ADDR15          23 
+        
+#define PIN_DATAIN0         14 
+#define PIN_DATAIN1         15 
+#define PIN_DATAIN2         16 
+#define PIN_DATAIN3         17 
+#define PIN_DATAIN4         18 
+#define PIN_DATAIN5         19 
+#define PIN_DATAIN6         20 
+#define PIN_DATAIN7         21 
+        
+#define PIN_DATAOUT0        11 
+#define PIN_DATAOUT1        10 
+#define PIN_DATAOUT2        9 
+#define PIN_DATAOUT3        8 
+#define PIN_DATAOUT4        7 
+#define PIN_DATAOUT5        6 
+#define PIN_DATAOUT6        5 
+#define PIN_DATAOUT7        4 
+#define PIN_DATAOUT_OE_n    3 
+
+
+// Sampled on each CLK rising edge, declared in MCL64.ino
+//
+extern uint8_t   direct_datain;
+extern uint8_t   direct_reset;
+extern uint8_t   direct_ready_n;
+extern uint8_t   direct_irq;
+extern uint8_t   direct_nmi;
+
+
+struct Teensy_Bus {
+
+  // -------------------------------------------------
+  // Setup Teensy 4.1 IO's
+  // -------------------------------------------------
+  static inline void setup() {
+
+    pinMode(PIN_CLK0,        INPUT);  
+    pinMode(PIN_RESET,       INPUT);  
+    pinMode(PIN_READY_n,     INPUT);  
+    pinMode(PIN_IRQ,         INPUT);  
+    pinMode(PIN_NMI,         INPUT);  
+    pinMode(PIN_RDWR_n,      OUTPUT); 
+    pinMode(PIN_P0,          OUTPUT); 
+    pinMode(PIN_P1,          OUTPUT); 
+    pinMode(PIN_P2,          OUTPUT); 
+  
+    pinMode(PIN_ADDR0,       OUTPUT); 
+    pinMode(PIN_ADDR1,       OUTPUT); 
+    pinMode(PIN_ADDR2,       OUTPUT); 
+    pinMode(PIN_ADDR3,       OUTPUT); 
+    pinMode(PIN_ADDR4,       OUTPUT); 
+    pinMode(PIN_ADDR5,       OUTPUT); 
+    pinMode(PIN_ADDR6,       OUTPUT); 
+    pinMode(PIN_ADDR7,       OUTPUT);
+    pinMode(PIN_ADDR8,       OUTPUT); 
+    pinMode(PIN_ADDR9,       OUTPUT); 
+    pinMode(PIN_ADDR10,      OUTPUT); 
+    pinMode(PIN_ADDR11,      OUTPUT); 
+    pinMode(PIN_ADDR12,      OUTPUT); 
+    pinMode(PIN_ADDR13,      OUTPUT); 
+    pinMode(PIN_ADDR14,      OUTPUT); 
+    pinMode(PIN_ADDR15,      OUTPUT);  
+  
+    pinMode(PIN_DATAIN0,     INPUT); 
+    pinMode(PIN_DATAIN1,     INPUT); 
+    pinMode(PIN_DATAIN2,     INPUT); 
+    pinMode(PIN_DATAIN3,     INPUT); 
+    pinMode(PIN_DATAIN4,     INPUT); 
+    pinMode(PIN_DATAIN5,     INPUT); 
+    pinMode(PIN_DATAIN6,     INPUT); 
+    pinMode(PIN_DATAIN7,     INPUT);
+    
+    pinMode(PIN_DATAOUT0,    OUTPUT); 
+    pinMode(PIN_DATAOUT1,    OUTPUT); 
+    pinMode(PIN_DATAOUT2,    OUTPUT); 
+    pinMode(PIN_DATAOUT3,    OUTPUT); 
+    pinMode(PIN_DATAOUT4,    OUTPUT); 
+    pinMode(PIN_DATAOUT5,    OUTPUT); 
+    pinMode(PIN_DATAOUT6,    OUTPUT); 
+    pinMode(PIN_DATAOUT7,    OUTPUT);
+    pinMode(PIN_DATAOUT_OE_n,  OUTPUT); 
+
+    digitalWriteFast(PIN_P0, 0x1 ); 
+    digitalWriteFast(PIN_P1, 0x1 ); 
+    digitalWriteFast(PIN_P2, 0x1 ); 
+
+    Serial.begin(9600);
+    return;
+  }
+
+
+  // -------------------------------------------------
+  // Wait for the CLK1 rising edge and sample signals
+  // -------------------------------------------------
+  static inline void wait_for_CLK_rising_edge() {
+    uint32_t GPIO6_data=0;
+    uint32_t   d10, d2, d3, d4, d5, d76;
+
+      while (((GPIO6_DR >> 12) & 0x1)!=0) {}            // Teensy 4.1 Pin-24  GPIO6_DR[12]     CLK
+    
+      while (((GPIO6_DR >> 12) & 0x1)==0) {GPIO6_data=GPIO6_DR;}                  // This method is ok for VIC-20 and Apple-II+ non-DRAM ranges 
+    
+      //uint32_t GPIO6_data_d1;
+      //do {  GPIO6_data_d1=GPIO6_DR;   } while (((GPIO6_data_d1 >> 12) & 0x1)==0);   // This method needed to support Apple-II+ DRAM read data setup time
+      //GPIO6_data=GPIO6_data_d1;
+    
+      d10             = (GPIO6_data&0x000C0000) >> 18;  // Teensy 4.1 Pin-14  GPIO6_DR[19:18]  D1:D0
+      d2              = (GPIO6_data&0x00800000) >> 21;  // Teensy 4.1 Pin-16  GPIO6_DR[23]     D2
+      d3              = (GPIO6_data&0x00400000) >> 19;  // Teensy 4.1 Pin-17  GPIO6_DR[22]     D3
+      d4              = (GPIO6_data&0x00020000) >> 13;  // Teensy 4.1 Pin-18  GPIO6_DR[17]     D4
+      d5              = (GPIO6_data&0x00010000) >> 11;  // Teensy 4.1 Pin-19  GPIO6_DR[16]     D5
+      d76             = (GPIO6_data&0x0C000000) >> 20;  // Teensy 4.1 Pin-20  GPIO6_DR[27:26]  D7:D6
+    
+      direct_irq      = (GPIO6_data&0x00002000) >> 13;  // Teensy 4.1 Pin-25  GPIO6_DR[13]     IRQ
+      direct_ready_n  = (GPIO6_data&0x40000000) >> 30;  // Teensy 4.1 Pin-26  GPIO6_DR[30]     READY
+      direct_reset    = (GPIO6_data&0x00100000) >> 20;  // Teensy 4.1 Pin-40  GPIO6_DR[20]     RESET
+      direct_nmi      = (GPIO6_data&0x00200000) >> 21;  // Teensy 4.1 Pin-41  GPIO6_DR[21]     NMI
+    
+      direct_datain = d76 | d5 | d4 | d3 | d2 | d10;
+    
+      return; 
+  }
+
+
+  // -------------------------------------------------
+  // Wait for the CLK1 falling edge 
+  // -------------------------------------------------
+  static inline void wait_for_CLK_falling_edge() {
+
+    while (((GPIO6_DR >> 12) & 0x1)==0) {}   // Teensy 4.1 Pin-24  GPIO6_DR[12]  CLK
+    while (((GPIO6_DR >> 12) & 0x1)!=0) {}
+    return; 
+  }
+
+
+  // -------------------------------------------------
+  // Drive the 6502 Address pins
+  // -------------------------------------------------
+  static inline void send_address(uint32_t local_address) {
+    uint32_t writeback_data=0;
+  
+      writeback_data = (0x6DFFFFF3 & GPIO6_DR);   // Read in current GPIOx register value and clear the bits we intend to update
+      writeback_data = writeback_data | (local_address & 0x8000)<<10 ;  // 6502_Address[15]   TEENSY_PIN23   GPIO6_DR[25]
+      writeback_data = writeback_data | (local_address & 0x2000)>>10 ;  // 6502_Address[13]   TEENSY_PIN0    GPIO6_DR[3]
+      writeback_data = writeback_data | (local_address & 0x1000)>>10 ;  // 6502_Address[12]   TEENSY_PIN1    GPIO6_DR[2]
+      writeback_data = writeback_data | (local_address & 0x0002)<<27 ;  // 6502_Address[1]    TEENSY_PIN38   GPIO6_DR[28]
+      GPIO6_DR       = writeback_data | (local_address & 0x0001)<<31 ;  // 6502_Address[0]    TEENSY_PIN27   GPIO6_DR[31]
+    
+      writeback_data = (0xCFF3EFFF & GPIO7_DR);   // Read in current GPIOx register value and clear the bits we intend to update
+      writeback_data = writeback_data | (local_address & 0x0400)<<2  ;  // 6502_Address[10]   TEENSY_PIN32   GPIO7_DR[12]
+      writeback_data = writeback_data | (local_address & 0x0200)<<20 ;  // 6502_Address[9]    TEENSY_PIN34   GPIO7_DR[29]
+      writeback_data = writeback_data | (local_address & 0x0080)<<21 ;  // 6502_Address[7]    TEENSY_PIN35   GPIO7_DR[28]
+      writeback_data = writeback_data | (local_address & 0x0020)<<13 ;  // 6502_Address[5]    TEENSY_PIN36   GPIO7_DR[18]
+      GPIO7_DR       = writeback_data | (local_address & 0x0008)<<16 ;  // 6502_Address[3]    TEENSY_PIN37   GPIO7_DR[19]
+                
+      writeback_data = (0xFF3BFFFF & GPIO8_DR);   // Read in current GPIOx register value and clear the bits we intend to update
+      writeback_data = writeback_data | (local_address & 0x0100)<<14 ;  // 6502_Address[8]    TEENSY_PIN31   GPIO8_DR[22]
+      writeback_data = writeback_data | (local_address & 0x0040)<<17 ;  // 6502_Address[6]    TEENSY_PIN30   GPIO8_DR[23]
+      GPIO8_DR       = writeback_data | (local_address & 0x0004)<<16 ;  // 6502_Address[2]    TEENSY_PIN28   GPIO8_DR[18]
+    
+      writeback_data = (0x7FFFFF6F & GPIO9_DR);   // Read in current GPIOx register value and clear the bits we intend to update
+      writeback_data = writeback_data | (local_address & 0x4000)>>10 ;  // 6502_Address[14]   TEENSY_PIN2    GPIO9_DR[4]
+      writeback_data = writeback_data | (local_address & 0x0800)>>4  ;  // 6502_Address[11]   TEENSY_PIN33   GPIO9_DR[7]
+      GPIO9_DR       = writeback_data | (local_address & 0x0010)<<27 ;  // 6502_Address[4]    TEENSY_PIN29   GPIO9_DR[31]
+    
+      return;
+  }
+
+
+
+  // -------------------------------------------------
+  // Bus control and data pins
+  // -------------------------------------------------
+  static inline void drive_RDWR_n(uint8_t local_data)     {  digitalWriteFast(PIN_RDWR_n,  local_data);          return;  }
+  static inline void drive_data_OE_n(uint8_t local_data)  {  digitalWriteFast(PIN_DATAOUT_OE_n,  local_data);    return;  }
+  static inline uint8_t reset_asserted()                  {  return digitalReadFast(PIN_RESET);  }
+
+  // Drive the data bus pins from the Teensy to the bus driver which is inactive
+  //
+  static inline void drive_data(uint8_t local_write_data)  {
+    digitalWriteFast(PIN_DATAOUT0,  (local_write_data & 0x01)    );
+    digitalWriteFast(PIN_DATAOUT1,  (local_write_data & 0x02)>>1 ); 
+    digitalWriteFast(PIN_DATAOUT2,  (local_write_data & 0x04)>>2 ); 
+    digitalWriteFast(PIN_DATAOUT3,  (local_write_data & 0x08)>>3 ); 
+    digitalWriteFast(PIN_DATAOUT4,  (local_write_data & 0x10)>>4 ); 
+    digitalWriteFast(PIN_DATAOUT5,  (local_write_data & 0x20)>>5 ); 
+    digitalWriteFast(PIN_DATAOUT6,  (local_write_data & 0x40)>>6 ); 
+    digitalWriteFast(PIN_DATAOUT7,  (local_write_data & 0x80)>>7 ); 
+    return;
+  }
+
+  // 6510 processor port P2:P0
+  //
+  static inline void drive_processor_port(uint8_t local_data)  {
+    digitalWriteFast(PIN_P0,  (local_data & 0x01) ); 
+    digitalWriteFast(PIN_P1,  (local_data & 0x02) >> 1 ); 
+    digitalWriteFast(PIN_P2,  (local_data & 0x04) >> 2 ); 
+    return;
+  }
+
+
+  // -------------------------------------------------
+  // Startup, UART and instruction boundary
+  // -------------------------------------------------
+  static inline void startup_delay()                 {  delay (50);  return;  }     // Give Teensy 4.1 a moment
+  static inline void instruction_boundary()          {  return;  }
+  static inline int  uart_read()                     {  if (Serial.available()) return Serial.read();  else return -1;  }
+  static inline void uart_println(const char * text) {  Serial.println(text);  return;  }
+
+};
+
+#endif
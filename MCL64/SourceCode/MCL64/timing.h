@@ -0,0 +1,113 @@
+//
+//
+//  File Name   :  timing.h
+//  Used on     :  MCL64
+//  Author      :  Ted Fried, MicroCore Labs
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//   
+//  Compile-time timing policies for the 6510 core in MCL64.ino. Each policy 
+//  inherits its pin-level hooks from a bus class, Teensy_Bus for the board or
+//  Host_Bus for the Linux build in ../Host, so the same core runs on both.
+//
+//  Cycle_Accurate_Timing - Every 6510 bus cycle is performed, including the
+//                          discarded reads, double write-backs and page-cross
+//                          penalties. Video memory and most of the KERNAL stay
+//                          cycle accurate in acceleration modes 2 and 3.
+//
+//  Accelerated_Timing    - The discarded cycles are removed for an additional
+//                          acceleration boost and the page table in MCL64.ino
+//                          alone decides which accesses use internal memory.
+//
+//  The flags are constants so the unused cycles compile away completely.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Ted Fried
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdint.h>
+
+// Declared in MCL64.ino
+//
+extern uint8_t   mode;
+extern uint8_t   page_mode[256];
+
+
+// ----------------------------------------------------------
+// Cycle accurate 6510
+// ----------------------------------------------------------
+template <class BUS> struct Cycle_Accurate_Timing : BUS {
+
+  static const uint8_t cycle_accurate = 1;
+  static const uint8_t initial_mode   = 0;
+
+  // Address range check, see internal_address_check() in MCL64.ino
+  //
+  static inline uint8_t address_check(uint16_t local_address) {
+
+    if (page_mode[local_address>>8]==0x0) return 0x0;                                   //   C64 I/O and cartridge pages
+    
+    if ( (local_address > 0x0001 ) && (local_address <= 0x03FF) ) return mode;            //   Zero-Page up to video 
+    if ( (local_address >= 0x0400) && (local_address <= 0x07FF) && mode>1) return 0x1;    //   C64 Video Memory 
+    if ( (local_address >= 0x0800) && (local_address <= 0x7FFF) ) return mode;            //   C64 RAM 
+    if ( (local_address >= 0x8000) && (local_address <= 0x9FFF) ) return mode;            //   C64 CART_LOW & RAM 
+    if ( (local_address >= 0xA000) && (local_address <= 0xBFFF) ) return mode;            //   C64 BASIC ROM & RAM
+    if ( (local_address >= 0xC000) && (local_address <= 0xCFFF) ) return mode;            //   C64 RAM
+    if ( (local_address >= 0xE000) && (local_address <= 0xE4FF) ) return mode;            //   C64 KERNAL ROM  
+    if ( (local_address >= 0xE500) && (local_address <= 0xFF7F) && mode>1) return 0x1;    //   C64 KERNAL ROM  
+    if ( (local_address >= 0xFF80) && (local_address <= 0xFFFF) ) return mode;            //   C64 KERNAL ROM 
+ 
+    return 0x0;
+  }
+};
+
+
+// ----------------------------------------------------------
+// Accelerated 6510
+// ----------------------------------------------------------
+template <class BUS> struct Accelerated_Timing : BUS {
+
+  static const uint8_t cycle_accurate = 0;
+  static const uint8_t initial_mode   = 1;
+
+  static inline uint8_t address_check(uint16_t local_address) {
+
+    return page_mode[local_address>>8];
+  }
+};
+
+#endif
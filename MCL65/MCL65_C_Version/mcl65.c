@@ -14,7 +14,17 @@
 //  exact same microcode. NMI and Interrupts are suppored.
 //  Each loop of the code below is equivalent to one microsequencer clock
 //  and will execute a new micro-instruction each time.
-//  The user code and data RAM are held in a 64KB array.
+//  The user code and data RAM are held in 64KB of copy-on-write pages.
+//
+//  The emulator can also be built into a test harness as a library. Build
+//  with -DMCL65_LIBRARY to leave out main(), and include mcl65.h for
+//  mcl65_create(), mcl65_run() and mcl65_snapshot().
+//
+//  Run with -f to use the fused trace cache instead of stepping one
+//  micro-instruction at a time. The results are the same.
+//
+//  Run with -b <count> to step that many independent instances together
+//  in the batch engine. Build with -mavx2 to run them in AVX2 lanes.
 //
 //------------------------------------------------------------------------
 //
@@ -24,6 +34,21 @@
 // Revision 1 3/22/2020
 // Initial revision
 //
+// Revision 2 10/18/2026
+// Moved the body of the main loop into microsequencer_step()
+// Added the fused micro-op trace cache, selected with -f
+//
+// Revision 3 10/18/2026
+// Added the batch engine, which runs many instances in SIMD lanes, selected with -b
+//
+// Revision 4 10/18/2026
+// Added the library interface with memory and IRQ/NMI callbacks
+// The IRQ_n and NMI_n pins are now real inputs
+// Added snapshot and restore, with the memory held in copy-on-write pages
+// The library interface is declared in mcl65.h and main() is left out with -DMCL65_LIBRARY
+// The microcode ROM moved to mcl65_microcode.h
+// The batch engine samples each instance's IRQ_n and NMI_n pins on every clock
+//
 //
 //------------------------------------------------------------------------
 //
@@ -50,7 +75,14 @@
 //------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "mcl65.h"
+#include "mcl65_microcode.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 #define rdwr_n           ( system_output & 0x1   ) >> 0      // system_output[0]
 #define flag_i           ( register_flags & 0x04 ) >> 2      // register_flags[2]
@@ -62,16 +94,31 @@
 #define opcode_jump_call ( rom_data & 0x01000000 ) >> 24     // rom_data[24];
 #define opcode_jump_src  ( rom_data & 0x00700000 ) >> 20     // rom_data[22:20];
 #define opcode_jump_cond ( rom_data & 0x000F0000 ) >> 16     // rom_data[16:19];
+#define nmi_debounce     ( system_output & 0x8   ) >> 3      // system_output[3]
+
+#define MEMORY_PAGE_BITS MCL65_MEMORY_PAGE_BITS
+#define MEMORY_PAGE_SIZE (1<<MEMORY_PAGE_BITS)
+#define MEMORY_PAGES     MCL65_MEMORY_PAGES
 
+#define memory_read(table,address)   ( (table)[(address)>>MEMORY_PAGE_BITS]->data[(address)&(MEMORY_PAGE_SIZE-1)] )
 
-unsigned char attached_memory[65536]={ };
+
+// The Attached Memory RAM is split into pages which instances and snapshots share until one of them writes
+struct memory_page
+  {
+    unsigned long  references;
+    unsigned char  data[MEMORY_PAGE_SIZE];
+  };
+
+
+memory_page_t **memory_page;                // Page table of the running instance
+mcl65_callbacks_t callbacks;
 unsigned char register_flags=0;
 unsigned char add_carry7=0;
 unsigned char add_carry8=0;
 unsigned char nmi_asserted=0;
 unsigned char irq_gated=0;
 unsigned char add_overflow8=0;
-unsigned char nmi_debounce=0;
 unsigned char system_status=0;
 unsigned char register_a=0;
 unsigned char register_x=0;
@@ -93,19 +140,44 @@ unsigned short int operand0=0;
 unsigned short int operand1=0;
 unsigned long rom_data;
 unsigned long calling_address;
+unsigned char P6502_IRQ_n=1;
+unsigned char P6502_NMI_n=1;
+unsigned char P6502_NMI_n_old=1;
+unsigned long long clock_count=0;
 
 
-// Main loop
+// Copies a page that is shared before it is written
 //
-int main() 
+void memory_write(memory_page_t **table, unsigned short address, unsigned char data)
   {
-    while (1)
+    memory_page_t *page = table[address>>MEMORY_PAGE_BITS];
+
+    if (page->references > 1)
       {
-        // Optional INT and NMI Signals
-        //  irq_gated = P6502_IRQ_n & ~flag_i;    
-        //  if (nmi_debounce==1) nmi_asserted=0;  else if (P6502_NMI_n_old==1 && P6502_NMI_n==0)  nmi_asserted=1;   P6502_NMI_n_old = P6502_NMI_n;
+        page = malloc(sizeof(memory_page_t));
+        if (page==NULL) { printf("Out of memory\n"); exit(1); }
+        memcpy(page->data, table[address>>MEMORY_PAGE_BITS]->data, MEMORY_PAGE_SIZE);
+        page->references = 1;
+        table[address>>MEMORY_PAGE_BITS]->references--;
+        table[address>>MEMORY_PAGE_BITS] = page;
+      }
+    page->data[address&(MEMORY_PAGE_SIZE-1)] = data;
+  }
+
 
-        data_in = attached_memory[address_out];  // Read data from the Attached Memory RAM
+// One microsequencer clock
+//
+void microsequencer_step()
+  {
+        // INT and NMI Signals
+        if (callbacks.irq_n!=NULL) P6502_IRQ_n = callbacks.irq_n(callbacks.context);
+        if (callbacks.nmi_n!=NULL) P6502_NMI_n = callbacks.nmi_n(callbacks.context);
+        irq_gated = (P6502_IRQ_n==0 && (flag_i)==0);
+        if ((nmi_debounce)==1) nmi_asserted=0;  else if (P6502_NMI_n_old==1 && P6502_NMI_n==0)  nmi_asserted=1;   P6502_NMI_n_old = P6502_NMI_n;
+
+        // Read data from the Attached Memory RAM
+        if (callbacks.read!=NULL) data_in = callbacks.read(callbacks.context, address_out);
+        else                      data_in = memory_read(memory_page, address_out);
 
         rom_data = microcode_rom[rom_address];   // Fetch the next microcode instruction 
   
@@ -220,7 +292,778 @@ int main()
          
          
            // Writes to the 6502 Data RAM occur on the simulated rising edge of the clock 
-           if (opcode_type==0x1 && opcode_jump_cond==0x3 && rdwr_n==0) attached_memory[address_out] = data_out;
+           if (opcode_type==0x1 && opcode_jump_cond==0x3 && rdwr_n==0)
+             {
+               if (callbacks.write!=NULL) callbacks.write(callbacks.context, address_out, data_out);
+               else                       memory_write(memory_page, address_out, data_out);
+             }
+  }
+
+
+//------------------------------------------------------------------------
+// Fused micro-op trace cache
+//
+// The path the microsequencer takes from a microcode address up to the next
+// opcode jump table dispatch is recorded once, while single-stepping, and
+// compiled into a list of fused micro-ops. Operand, destination and ALU
+// selects are resolved into pointers and a kind when the trace is recorded.
+// Unconditional jumps, NOPs and micro-instructions with no effect are
+// folded into the fused micro-op before them. Conditional jumps and
+// subroutine returns become guards which check that execution still follows
+// the recorded path, otherwise the trace is left at the point they diverge
+// and another trace is looked up or recorded from there.
+//
+// While traces run the registers are held in fused_state[], arranged so
+// each operand and destination select is a plain 16-bit slot. The
+// per-clock temporaries operand0, operand1, alu_out, data_in,
+// system_status and rom_data are not updated in fused mode, and irq_gated
+// is only worked out when system_status is sampled. The pin levels must
+// hold still and no callbacks may be set while traces run, which
+// mcl65_run() checks before it calls fused_run().
+//------------------------------------------------------------------------
+
+#define FUSED_MAX_OPS    128             // Micro-instructions recorded per trace, not counting the folded ones
+
+enum { FUSED_ADD, FUSED_AND, FUSED_OR, FUSED_XOR, FUSED_SHR, FUSED_EEEE, FUSED_CALL, FUSED_WRITE,
+       FUSED_GUARD_NZ, FUSED_GUARD_Z, FUSED_RETURN, FUSED_DISPATCH, FUSED_END };
+
+// fused_state[] slots. Operand selects 0x0 to 0xD read the slot of the same number
+enum { SLOT_R0, SLOT_R1, SLOT_R2, SLOT_R3, SLOT_A, SLOT_X, SLOT_Y, SLOT_PC, SLOT_SP_PAGE, SLOT_FLAGS, SLOT_ADDRESS_OUT,
+       SLOT_DATA_IN, SLOT_STATUS, SLOT_SYSTEM_OUTPUT, SLOT_ZERO, SLOT_PC_SWAPPED, SLOT_SP, SLOT_DATA_OUT, SLOT_DISCARD, SLOT_COUNT };
+
+#define FUSED_DATA_IN    0x1             // Operand needs data_in sampled first
+#define FUSED_STATUS     0x2             // Operand needs system_status sampled first
+
+typedef struct
+  {
+    unsigned char  kind;
+    unsigned char  cycles;               // This micro-instruction plus the ones folded into it
+    unsigned char  sample;               // FUSED_DATA_IN, FUSED_STATUS
+    unsigned char  taken;                // Recorded direction of a conditional jump
+    unsigned short *operand0;
+    unsigned short *operand1;
+    unsigned short *destination;
+    unsigned short dst_and;
+    unsigned short dst_or;
+    unsigned short immediate;            // Also the address pushed by CALL
+    unsigned short rom_next;             // Recorded target of a guard, or where an END record resumes
+    unsigned short rom_other;            // Where a conditional jump goes off the recorded path
+  } fused_op_t;
+
+typedef struct
+  {
+    unsigned long  cycles;               // Clocks along the whole recorded path
+    unsigned short lead;                 // Folded micro-instructions before the first record
+    fused_op_t     op[1];
+  } fused_trace_t;
+
+fused_trace_t *fused_trace[2048];
+unsigned short fused_state[SLOT_COUNT];
+
+
+void fused_load()
+  {
+    fused_state[SLOT_R0]            = register_r0;
+    fused_state[SLOT_R1]            = register_r1;
+    fused_state[SLOT_R2]            = register_r2;
+    fused_state[SLOT_R3]            = register_r3;
+    fused_state[SLOT_A]             = register_a;
+    fused_state[SLOT_X]             = register_x;
+    fused_state[SLOT_Y]             = register_y;
+    fused_state[SLOT_PC]            = register_pc;
+    fused_state[SLOT_PC_SWAPPED]    = (register_pc<<8) | (register_pc>>8);
+    fused_state[SLOT_SP]            = register_sp;
+    fused_state[SLOT_SP_PAGE]       = (register_sp & 0x00FF) | 0x0100;
+    fused_state[SLOT_FLAGS]         = register_flags;
+    fused_state[SLOT_ADDRESS_OUT]   = address_out;
+    fused_state[SLOT_SYSTEM_OUTPUT] = system_output;
+    fused_state[SLOT_DATA_OUT]      = data_out;
+    fused_state[SLOT_ZERO]          = 0;
+  }
+
+
+void fused_store()
+  {
+    register_r0    = fused_state[SLOT_R0];
+    register_r1    = fused_state[SLOT_R1];
+    register_r2    = fused_state[SLOT_R2];
+    register_r3    = fused_state[SLOT_R3];
+    register_a     = fused_state[SLOT_A];
+    register_x     = fused_state[SLOT_X];
+    register_y     = fused_state[SLOT_Y];
+    register_pc    = fused_state[SLOT_PC];
+    register_sp    = fused_state[SLOT_SP];
+    register_flags = fused_state[SLOT_FLAGS];
+    address_out    = fused_state[SLOT_ADDRESS_OUT];
+    system_output  = fused_state[SLOT_SYSTEM_OUTPUT];
+    data_out       = fused_state[SLOT_DATA_OUT];
+  }
+
+
+// Resolves the operand, destination and ALU selects of one ALU micro-instruction
+//
+void fused_compile_alu(fused_op_t *op)
+  {
+    static const unsigned char dst_slot[16] = { SLOT_R0, SLOT_R1, SLOT_R2, SLOT_R3, SLOT_A, SLOT_X, SLOT_Y, SLOT_PC, SLOT_SP,
+                                                SLOT_FLAGS, SLOT_ADDRESS_OUT, SLOT_DATA_OUT, SLOT_DISCARD, SLOT_SYSTEM_OUTPUT,
+                                                SLOT_DISCARD, SLOT_DISCARD };
+    static const unsigned short dst_and[16] = { 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00FF, 0x00FF, 0x00FF, 0xFFFF, 0x00FF,
+                                                0x00FF, 0xFFFF, 0x00FF, 0xFFFF, 0x001F, 0xFFFF, 0xFFFF };
+    unsigned char op0 = opcode_op0_sel;
+    unsigned char op1 = opcode_op1_sel;
+
+    switch (opcode_type)
+      {
+        case 0x2: op->kind = FUSED_ADD;   break;
+        case 0x3: op->kind = FUSED_AND;   break;
+        case 0x4: op->kind = FUSED_OR;    break;
+        case 0x5: op->kind = FUSED_XOR;   break;
+        case 0x6: op->kind = FUSED_SHR;   break;
+        default:  op->kind = FUSED_EEEE;  break;
+      }
+
+    op->operand0 = &fused_state[op0==0xF ? SLOT_ZERO : op0];
+    if      (op1==0xF) op->operand1 = &op->immediate;
+    else if (op1==0x7) op->operand1 = &fused_state[SLOT_PC_SWAPPED];
+    else               op->operand1 = &fused_state[op1];
+    op->immediate = opcode_immediate;
+
+    if (op0==0xB || op1==0xB) op->sample |= FUSED_DATA_IN;
+    if (op0==0xC || op1==0xC) op->sample |= FUSED_STATUS;
+
+    op->destination = &fused_state[dst_slot[opcode_dst_sel]];
+    op->dst_and = dst_and[opcode_dst_sel];
+    op->dst_or  = (opcode_dst_sel==0x9) ? 0x30 : 0;
+  }
+
+
+// Single-steps from the current rom_address up to the next opcode dispatch, recording the path taken.
+// Returns NULL if the cycles run out first or the path cannot be fused.
+//
+fused_trace_t *fused_record(unsigned long *cycles)
+  {
+    fused_trace_t *trace;
+    fused_op_t *op;
+    unsigned short start = rom_address;
+    unsigned short address;
+    unsigned long count = 0;
+    unsigned char folded, finished = 0;
+
+    trace = calloc(1, sizeof(fused_trace_t) + FUSED_MAX_OPS * sizeof(fused_op_t));
+    if (trace==NULL) return NULL;
+
+    while (!finished && *cycles>0)
+      {
+        address  = rom_address;
+        rom_data = microcode_rom[address];
+        op       = &trace->op[count];
+        folded   = 0;
+
+        if (count==FUSED_MAX_OPS-1 ||
+           (opcode_type==0x1 && opcode_jump_cond<=0x2 && (opcode_jump_src>0x2 ||
+                                                          (opcode_jump_cond!=0x0 && (opcode_jump_src!=0x0 || opcode_jump_call==1)) ||
+                                                          (opcode_jump_src!=0x0 && opcode_jump_call==1))))
+          {
+            op->kind = FUSED_END;                   // Out of room, or a jump which only single-stepping handles
+            op->rom_next = address;
+            count++;
+            break;
+          }
+
+        if (opcode_type > 1) fused_compile_alu(op);
+        else if (opcode_type==0x1 && opcode_jump_cond==0x3) op->kind = FUSED_WRITE;
+        else if (opcode_type==0x1 && opcode_jump_cond==0x0 && opcode_jump_src==0x1) { op->kind = FUSED_DISPATCH; finished = 1; }
+        else if (opcode_type==0x1 && opcode_jump_cond==0x0 && opcode_jump_src==0x2) op->kind = FUSED_RETURN;
+        else if (opcode_type==0x1 && opcode_jump_cond==0x0 && opcode_jump_call==1) { op->kind = FUSED_CALL; op->immediate = address & 0x07FF; }
+        else if (opcode_type==0x1 && opcode_jump_cond==0x1) { op->kind = FUSED_GUARD_NZ; op->taken = (alu_last_result!=0); }
+        else if (opcode_type==0x1 && opcode_jump_cond==0x2) { op->kind = FUSED_GUARD_Z;  op->taken = (alu_last_result==0); }
+        else folded = 1;                            // NOP, unconditional jump, or no effect
+
+        if (op->kind==FUSED_GUARD_NZ || op->kind==FUSED_GUARD_Z)
+            op->rom_other = op->taken ? (unsigned short)(address + 1) : (unsigned short)(opcode_immediate & 0x07FF);
+
+        microsequencer_step();
+        (*cycles)--;
+        trace->cycles++;
+
+        if (op->kind==FUSED_RETURN || op->kind==FUSED_GUARD_NZ || op->kind==FUSED_GUARD_Z) op->rom_next = rom_address;
+
+        if (folded==0) { op->cycles = 1; count++; }
+        else if (count==0) trace->lead++;
+        else trace->op[count-1].cycles++;
+      }
+
+    // Nothing to run, or the cycles ran out before the path was complete
+    if (trace->cycles==0 || (!finished && (count==0 || trace->op[count-1].kind!=FUSED_END))) { free(trace); return NULL; }
+    fused_trace[start] = trace;
+    return trace;
+  }
+
+
+// Runs for exactly the given number of microsequencer clocks
+//
+void fused_run(unsigned long cycles)
+  {
+    fused_trace_t *trace;
+    fused_op_t *op;
+    unsigned short alu, a, b, target;
+    unsigned long done;
+
+    fused_load();
+    while (cycles > 0)
+      {
+        trace = fused_trace[rom_address];
+
+        if (trace==NULL || trace->cycles > cycles)
+          {
+            done = cycles;
+            fused_store();
+            if (trace==NULL) trace = fused_record(&cycles);
+            if (cycles==done) { microsequencer_step(); cycles--; }   // Not recorded, or too long for the cycles left
+            clock_count = clock_count + (done - cycles);
+            fused_load();
+            continue;
+          }
+
+        done = trace->lead;
+        for (op = trace->op; ; op++)
+          {
+            if (op->sample & FUSED_DATA_IN) fused_state[SLOT_DATA_IN] = memory_read(memory_page, fused_state[SLOT_ADDRESS_OUT]) * 0x0101;
+            if (op->sample & FUSED_STATUS)
+              {
+                irq_gated = (P6502_IRQ_n==0 && (fused_state[SLOT_FLAGS] & 0x04)==0);
+                fused_state[SLOT_STATUS] = add_carry8 | nmi_asserted<<3 | irq_gated<<5 | add_overflow8<<6;
+              }
+            done = done + op->cycles;
+
+            switch (op->kind)
+              {
+                case FUSED_ADD:
+                  a = *op->operand0;
+                  b = *op->operand1;
+                  alu = a + b;
+                  add_carry7 = (( ((a&0x007F) + (b&0x007F)) & 0x0080) >> 7);
+                  add_carry8 = (( ((a&0x00FF) + (b&0x00FF)) & 0x0100) >> 8);
+                  add_overflow8 = (add_carry7 ^ add_carry8) & 0x1;
+                  break;
+                case FUSED_AND:  alu = *op->operand0 & *op->operand1;   break;
+                case FUSED_OR:   alu = *op->operand0 | *op->operand1;   break;
+                case FUSED_XOR:  alu = *op->operand0 ^ *op->operand1;   break;
+                case FUSED_SHR:  alu = *op->operand0 >> 1;              break;
+
+                case FUSED_CALL:
+                  calling_address = (calling_address<<11) | op->immediate;
+                  continue;
+
+                case FUSED_WRITE:
+                  if ((fused_state[SLOT_SYSTEM_OUTPUT] & 0x1)==0) memory_write(memory_page, fused_state[SLOT_ADDRESS_OUT], fused_state[SLOT_DATA_OUT]);
+                  continue;
+
+                case FUSED_GUARD_NZ:
+                case FUSED_GUARD_Z:
+                  if (((op->kind==FUSED_GUARD_NZ) ? (alu_last_result!=0) : (alu_last_result==0)) == op->taken) continue;
+                  rom_address = op->rom_other;
+                  done = done - op->cycles + 1;
+                  goto trace_exit;
+
+                case FUSED_RETURN:
+                  target = (calling_address & 0x07FF) + 1;
+                  calling_address = calling_address>>11;
+                  if (target==op->rom_next) continue;
+                  rom_address = target;
+                  done = done - op->cycles + 1;
+                  goto trace_exit;
+
+                case FUSED_DISPATCH:
+                  rom_address = memory_read(memory_page, fused_state[SLOT_ADDRESS_OUT]);
+                  goto trace_exit;
+
+                case FUSED_END:
+                  rom_address = op->rom_next;
+                  goto trace_exit;
+
+                default: alu = 0xEEEE;  break;
+              }
+
+            // Register write-back
+            alu_last_result = alu;
+            *op->destination = (alu & op->dst_and) | op->dst_or;
+            if (op->destination==&fused_state[SLOT_PC]) fused_state[SLOT_PC_SWAPPED] = (alu<<8) | (alu>>8);
+            if (op->destination==&fused_state[SLOT_SP]) fused_state[SLOT_SP_PAGE] = (alu & 0x00FF) | 0x0100;
+          }
+
+        trace_exit:
+        cycles = cycles - done;
+        clock_count = clock_count + done;
+      }
+    fused_store();
+  }
+
+
+//------------------------------------------------------------------------
+// Library interface
+//
+// Each instance holds a copy of the globals above, which mcl65_run()
+// swaps in, runs and swaps back out, so only one instance runs at a time.
+// Memory is a table of pages with reference counts. A snapshot copies the
+// registers and the page table and takes a reference on every page, and
+// the first write to a shared page copies it, so taking and restoring a
+// snapshot costs the same however much memory the instance uses. The
+// types and prototypes are in mcl65.h.
+//------------------------------------------------------------------------
+
+
+void mcl65_pages_release(memory_page_t **table)
+  {
+    int page;
+
+    for (page=0; page<MEMORY_PAGES; page++)
+        if (table[page]!=NULL && --table[page]->references==0) free(table[page]);
+  }
+
+
+// Creates an instance in the reset state with all of its memory cleared
+//
+mcl65_t *mcl65_create()
+  {
+    mcl65_t *instance;
+    memory_page_t *zero;
+    int page;
+
+    instance = calloc(1, sizeof(mcl65_t));
+    zero = calloc(1, sizeof(memory_page_t));
+    if (instance==NULL || zero==NULL) { free(instance); free(zero); return NULL; }
+
+    for (page=0; page<MEMORY_PAGES; page++) instance->state.memory_page[page] = zero;
+    zero->references = MEMORY_PAGES;
+
+    instance->state.register_pc     = 0x400;
+    instance->state.rom_address     = 0x07D0;   // Address for Microcode Reset procedure
+    instance->state.P6502_IRQ_n     = 1;
+    instance->state.P6502_NMI_n     = 1;
+    instance->state.P6502_NMI_n_old = 1;
+    return instance;
+  }
+
+
+void mcl65_destroy(mcl65_t *instance)
+  {
+    if (instance==NULL) return;
+    mcl65_pages_release(instance->state.memory_page);
+    free(instance);
+  }
+
+
+unsigned char mcl65_read(mcl65_t *instance, unsigned short address)
+  {
+    return memory_read(instance->state.memory_page, address);
+  }
+
+
+void mcl65_write(mcl65_t *instance, unsigned short address, unsigned char data)
+  {
+    memory_write(instance->state.memory_page, address, data);
+  }
+
+
+// Pin levels, active low as on the 6502. Ignored while the matching callback is set
+//
+void mcl65_set_irq(mcl65_t *instance, unsigned char irq_n)  { instance->state.P6502_IRQ_n = irq_n; }
+void mcl65_set_nmi(mcl65_t *instance, unsigned char nmi_n)  { instance->state.P6502_NMI_n = nmi_n; }
+
+
+// Runs the instance for exactly the given number of microsequencer clocks
+//
+void mcl65_run(mcl65_t *instance, unsigned long cycles)
+  {
+    mcl65_state_t *state = &instance->state;
+
+    register_flags  = state->register_flags;     add_carry7      = state->add_carry7;
+    add_carry8      = state->add_carry8;         nmi_asserted    = state->nmi_asserted;
+    irq_gated       = state->irq_gated;          add_overflow8   = state->add_overflow8;
+    system_status   = state->system_status;      register_a      = state->register_a;
+    register_x      = state->register_x;         register_y      = state->register_y;
+    register_r0     = state->register_r0;        register_r1     = state->register_r1;
+    register_r2     = state->register_r2;        register_r3     = state->register_r3;
+    register_pc     = state->register_pc;        register_sp     = state->register_sp;
+    address_out     = state->address_out;        data_in         = state->data_in;
+    data_out        = state->data_out;           system_output   = state->system_output;
+    alu_last_result = state->alu_last_result;    alu_out         = state->alu_out;
+    rom_address     = state->rom_address;        operand0        = state->operand0;
+    operand1        = state->operand1;           rom_data        = state->rom_data;
+    calling_address = state->calling_address;    P6502_IRQ_n     = state->P6502_IRQ_n;
+    P6502_NMI_n     = state->P6502_NMI_n;        P6502_NMI_n_old = state->P6502_NMI_n_old;
+    clock_count     = state->clock_count;
+    memory_page     = state->memory_page;
+    callbacks       = instance->callbacks;
+
+    // The trace cache needs the bus to be this instance's memory and no NMI edge to turn up while it runs
+    if (instance->single_step==0 && callbacks.read==NULL && callbacks.write==NULL && callbacks.irq_n==NULL &&
+        callbacks.nmi_n==NULL && P6502_NMI_n==P6502_NMI_n_old && nmi_asserted==0)
+      {
+        fused_run(cycles);
+      }
+    else
+      {
+        clock_count = clock_count + cycles;
+        while (cycles-- > 0) microsequencer_step();
       }
+
+    state->register_flags  = register_flags;     state->add_carry7      = add_carry7;
+    state->add_carry8      = add_carry8;         state->nmi_asserted    = nmi_asserted;
+    state->irq_gated       = irq_gated;          state->add_overflow8   = add_overflow8;
+    state->system_status   = system_status;      state->register_a      = register_a;
+    state->register_x      = register_x;         state->register_y      = register_y;
+    state->register_r0     = register_r0;        state->register_r1     = register_r1;
+    state->register_r2     = register_r2;        state->register_r3     = register_r3;
+    state->register_pc     = register_pc;        state->register_sp     = register_sp;
+    state->address_out     = address_out;        state->data_in         = data_in;
+    state->data_out        = data_out;           state->system_output   = system_output;
+    state->alu_last_result = alu_last_result;    state->alu_out         = alu_out;
+    state->rom_address     = rom_address;        state->operand0        = operand0;
+    state->operand1        = operand1;           state->rom_data        = rom_data;
+    state->calling_address = calling_address;    state->P6502_IRQ_n     = P6502_IRQ_n;
+    state->P6502_NMI_n     = P6502_NMI_n;        state->P6502_NMI_n_old = P6502_NMI_n_old;
+    state->clock_count     = clock_count;
+  }
+
+
+// Takes a snapshot of the registers, microsequencer and memory of an instance
+//
+mcl65_state_t *mcl65_snapshot(mcl65_t *instance)
+  {
+    mcl65_state_t *snapshot;
+    int page;
+
+    snapshot = malloc(sizeof(mcl65_state_t));
+    if (snapshot==NULL) return NULL;
+    *snapshot = instance->state;
+    for (page=0; page<MEMORY_PAGES; page++) snapshot->memory_page[page]->references++;
+    return snapshot;
+  }
+
+
+// Puts an instance back into the state of a snapshot. The snapshot can be restored again
+//
+void mcl65_restore(mcl65_t *instance, const mcl65_state_t *snapshot)
+  {
+    int page;
+
+    for (page=0; page<MEMORY_PAGES; page++) snapshot->memory_page[page]->references++;
+    mcl65_pages_release(instance->state.memory_page);
+    instance->state = *snapshot;
+  }
+
+
+void mcl65_snapshot_free(mcl65_state_t *snapshot)
+  {
+    if (snapshot==NULL) return;
+    mcl65_pages_release(snapshot->memory_page);
+    free(snapshot);
+  }
+
+
+//------------------------------------------------------------------------
+// Batch engine
+//
+// Runs a batch of independent MCL65 instances together. The registers of
+// the instances are held in a structure-of-arrays, one row per register,
+// and the microsequencer steps BATCH_LANES instances at a time with every
+// field of the micro-instruction decoded, selected and written back as one
+// vector operation across the lanes. Each lane fetches its own micro-ROM
+// word and reads its own 64KB memory through a gather, so the instances
+// are free to take different paths through the microcode.
+//
+// Each instance has its own IRQ_n and NMI_n pin rows, set with batch_set_irq()
+// and batch_set_nmi() between calls to batch_run(). The pins are sampled on
+// every clock the way microsequencer_step() does, so the I flag, the NMI edge
+// and its debounce are seen at the same clock as in the scalar model.
+//
+// Built with -mavx2 the lanes are AVX2 registers. Otherwise the same
+// operations are written as loops over the lanes.
+//------------------------------------------------------------------------
+
+#define BATCH_LANES      8
+#define BATCH_MEMORY     65536                // Bytes of memory per instance
+
+// Batch rows past the fused_state[] slots, which are laid out the same way
+enum { BATCH_ROM_ADDRESS=SLOT_COUNT, BATCH_ALU_LAST_RESULT, BATCH_CARRY8, BATCH_OVERFLOW8, BATCH_NMI_ASSERTED,
+       BATCH_IRQ_GATED, BATCH_CALLING_LOW, BATCH_CALLING_HIGH, BATCH_IRQ_N, BATCH_NMI_N, BATCH_NMI_N_OLD, BATCH_ROWS };
+
+typedef struct
+  {
+    unsigned long  count;                     // Instances, rounded up to a multiple of BATCH_LANES
+    unsigned int   *state;                    // BATCH_ROWS rows of count registers
+    unsigned char  *memory;                   // count memories of BATCH_MEMORY bytes, one after the other
+  } batch_t;
+
+// Write-back slot, mask and fixed bits of each destination select. The SP is held as SLOT_SP_PAGE while running
+static const unsigned int batch_dst_slot[16] = { SLOT_R0, SLOT_R1, SLOT_R2, SLOT_R3, SLOT_A, SLOT_X, SLOT_Y, SLOT_PC, SLOT_SP_PAGE,
+                                                 SLOT_FLAGS, SLOT_ADDRESS_OUT, SLOT_DATA_OUT, SLOT_DISCARD, SLOT_SYSTEM_OUTPUT,
+                                                 SLOT_DISCARD, SLOT_DISCARD };
+static const unsigned int batch_dst_and[16]  = { 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00FF, 0x00FF, 0x00FF, 0xFFFF, 0x00FF,
+                                                 0x00FF, 0xFFFF, 0x00FF, 0xFFFF, 0x001F, 0xFFFF, 0xFFFF };
+static const unsigned int batch_dst_or[16]   = { 0, 0, 0, 0, 0, 0, 0, 0, 0x0100, 0x30, 0, 0, 0, 0, 0, 0 };
+
+// One register of one instance. The calling address is split over two 32-bit rows
+#define batch_register(batch,row,instance)   (batch)->state[(unsigned long)(row)*(batch)->count + (instance)]
+#define batch_memory(batch,instance)         ((batch)->memory + (unsigned long)(instance)*BATCH_MEMORY)
+
+
+#ifdef __AVX2__
+
+typedef __m256i lanes_t;
+
+#define lanes_set(x)             _mm256_set1_epi32(x)
+#define lanes_load(p)            _mm256_loadu_si256((const __m256i *)(p))
+#define lanes_store(p,a)         _mm256_storeu_si256((__m256i *)(p), a)
+#define lanes_add(a,b)           _mm256_add_epi32(a, b)
+#define lanes_and(a,b)           _mm256_and_si256(a, b)
+#define lanes_or(a,b)            _mm256_or_si256(a, b)
+#define lanes_xor(a,b)           _mm256_xor_si256(a, b)
+#define lanes_shr(a,n)           _mm256_srli_epi32(a, n)
+#define lanes_shl(a,n)           _mm256_slli_epi32(a, n)
+#define lanes_eq(a,b)            _mm256_cmpeq_epi32(a, b)
+#define lanes_gt(a,b)            _mm256_cmpgt_epi32(a, b)
+#define lanes_select(m,a,b)      _mm256_blendv_epi8(b, a, m)                  // m ? a : b
+#define lanes_mask(m)            _mm256_movemask_ps(_mm256_castsi256_ps(m))
+#define lanes_gather(p,i)        _mm256_i32gather_epi32((const int *)(p), i, 4)
+#define lanes_gather_byte(p,i)   _mm256_and_si256(_mm256_i32gather_epi32((const int *)(p), i, 1), _mm256_set1_epi32(0xFF))
+#define lanes_gather_rom(i)      _mm256_i32gather_epi32((const int *)microcode_rom, i, sizeof(microcode_rom[0]))
+#define lanes_index()            _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)
+
+#else
+
+typedef struct { unsigned int v[BATCH_LANES]; } lanes_t;
+
+#define LANES_LOOP(expression)   lanes_t r; int l; for (l=0; l<BATCH_LANES; l++) r.v[l] = (expression); return r;
+
+static inline lanes_t lanes_set(unsigned int x)                     { LANES_LOOP(x) }
+static inline lanes_t lanes_load(const unsigned int *p)             { LANES_LOOP(p[l]) }
+static inline void    lanes_store(unsigned int *p, lanes_t a)       { int l; for (l=0; l<BATCH_LANES; l++) p[l] = a.v[l]; }
+static inline lanes_t lanes_add(lanes_t a, lanes_t b)               { LANES_LOOP(a.v[l] + b.v[l]) }
+static inline lanes_t lanes_and(lanes_t a, lanes_t b)               { LANES_LOOP(a.v[l] & b.v[l]) }
+static inline lanes_t lanes_or(lanes_t a, lanes_t b)                { LANES_LOOP(a.v[l] | b.v[l]) }
+static inline lanes_t lanes_xor(lanes_t a, lanes_t b)               { LANES_LOOP(a.v[l] ^ b.v[l]) }
+static inline lanes_t lanes_shr(lanes_t a, int n)                   { LANES_LOOP(a.v[l] >> n) }
+static inline lanes_t lanes_shl(lanes_t a, int n)                   { LANES_LOOP(a.v[l] << n) }
+static inline lanes_t lanes_eq(lanes_t a, lanes_t b)                { LANES_LOOP(a.v[l]==b.v[l] ? 0xFFFFFFFF : 0) }
+static inline lanes_t lanes_gt(lanes_t a, lanes_t b)                { LANES_LOOP((int)a.v[l]>(int)b.v[l] ? 0xFFFFFFFF : 0) }
+static inline lanes_t lanes_select(lanes_t m, lanes_t a, lanes_t b) { LANES_LOOP(m.v[l] ? a.v[l] : b.v[l]) }
+static inline lanes_t lanes_gather(const unsigned int *p, lanes_t i)        { LANES_LOOP(p[i.v[l]]) }
+static inline lanes_t lanes_gather_byte(const unsigned char *p, lanes_t i)  { LANES_LOOP(p[i.v[l]]) }
+static inline lanes_t lanes_gather_rom(lanes_t i)                   { LANES_LOOP((unsigned int)microcode_rom[i.v[l]]) }
+static inline lanes_t lanes_index()                                 { LANES_LOOP(l) }
+static inline int     lanes_mask(lanes_t m)                         { int l, r=0; for (l=0; l<BATCH_LANES; l++) if (m.v[l]) r |= 1<<l; return r; }
+
+#endif
+
+
+// Allocates a batch of instances, each reset the way the globals above are
+//
+batch_t *batch_create(unsigned long count)
+  {
+    batch_t *batch;
+    unsigned long i;
+
+    batch = calloc(1, sizeof(batch_t));
+    if (batch==NULL) return NULL;
+    batch->count  = (count + BATCH_LANES - 1) / BATCH_LANES * BATCH_LANES;
+    batch->state  = calloc(BATCH_ROWS * batch->count, sizeof(unsigned int));
+    batch->memory = calloc(batch->count * BATCH_MEMORY + 4, 1);     // The memory gather reads 4 bytes at a time
+    if (batch->state==NULL || batch->memory==NULL)
+      {
+        free(batch->state);
+        free(batch->memory);
+        free(batch);
+        return NULL;
+      }
+
+    for (i=0; i<batch->count; i++)
+      {
+        batch_register(batch, SLOT_PC, i)           = 0x400;
+        batch_register(batch, BATCH_ROM_ADDRESS, i) = 0x07D0;   // Address for Microcode Reset procedure
+        batch_register(batch, BATCH_IRQ_N, i)       = 1;
+        batch_register(batch, BATCH_NMI_N, i)       = 1;
+        batch_register(batch, BATCH_NMI_N_OLD, i)   = 1;
+      }
+    return batch;
+  }
+
+
+void batch_free(batch_t *batch)
+  {
+    if (batch==NULL) return;
+    free(batch->state);
+    free(batch->memory);
+    free(batch);
+  }
+
+
+// Pin levels of one instance, active low as on the 6502
+//
+void batch_set_irq(batch_t *batch, unsigned long instance, unsigned char irq_n)  { batch_register(batch, BATCH_IRQ_N, instance) = irq_n; }
+void batch_set_nmi(batch_t *batch, unsigned long instance, unsigned char nmi_n)  { batch_register(batch, BATCH_NMI_N, instance) = nmi_n; }
+
+
+// Runs every instance in the batch for exactly the given number of microsequencer clocks
+//
+void batch_run(batch_t *batch, unsigned long cycles)
+  {
+    unsigned int  table[SLOT_COUNT * BATCH_LANES];        // Operand rows of the current lanes, gathered by select
+    unsigned int  write_address[BATCH_LANES], write_data[BATCH_LANES];
+    unsigned char *memory;
+    unsigned long group, cycle, row;
+    int           lane, writes;
+
+    lanes_t index = lanes_index();
+    lanes_t memory_index = lanes_shl(index, 16);
+    lanes_t zero = lanes_set(0);
+    lanes_t rom_address, alu_last_result, carry8, overflow8, nmi_asserted, irq_gated, calling_low, calling_high;
+    lanes_t irq_n, nmi_n, nmi_n_old, nmi_edge;
+    lanes_t rom_data, type, dst, select0, select1, immediate, data_in, operand0, operand1;
+    lanes_t alu, sum, carry7, is_alu, is_jump, taken, push, pop, target, next, value, mask;
+
+    for (group=0; group<batch->count; group=group+BATCH_LANES)
+      {
+        memory = batch_memory(batch, group);
+        for (row=0; row<SLOT_COUNT; row++) lanes_store(&table[row*BATCH_LANES], lanes_load(&batch_register(batch, row, group)));
+        rom_address     = lanes_load(&batch_register(batch, BATCH_ROM_ADDRESS, group));
+        alu_last_result = lanes_load(&batch_register(batch, BATCH_ALU_LAST_RESULT, group));
+        carry8          = lanes_load(&batch_register(batch, BATCH_CARRY8, group));
+        overflow8       = lanes_load(&batch_register(batch, BATCH_OVERFLOW8, group));
+        nmi_asserted    = lanes_load(&batch_register(batch, BATCH_NMI_ASSERTED, group));
+        irq_gated       = lanes_load(&batch_register(batch, BATCH_IRQ_GATED, group));
+        calling_low     = lanes_load(&batch_register(batch, BATCH_CALLING_LOW, group));
+        calling_high    = lanes_load(&batch_register(batch, BATCH_CALLING_HIGH, group));
+        irq_n           = lanes_load(&batch_register(batch, BATCH_IRQ_N, group));
+        nmi_n           = lanes_load(&batch_register(batch, BATCH_NMI_N, group));
+        nmi_n_old       = lanes_load(&batch_register(batch, BATCH_NMI_N_OLD, group));
+        lanes_store(&table[SLOT_ZERO*BATCH_LANES], zero);
+        lanes_store(&table[SLOT_SP_PAGE*BATCH_LANES], lanes_or(lanes_and(lanes_load(&table[SLOT_SP*BATCH_LANES]), lanes_set(0x00FF)), lanes_set(0x0100)));
+
+        for (cycle=0; cycle<cycles; cycle++)
+          {
+            // INT and NMI Signals
+            irq_gated    = lanes_and(lanes_and(lanes_eq(irq_n, zero), lanes_eq(lanes_and(lanes_load(&table[SLOT_FLAGS*BATCH_LANES]), lanes_set(0x04)), zero)), lanes_set(1));
+            nmi_edge     = lanes_and(lanes_eq(nmi_n_old, lanes_set(1)), lanes_eq(nmi_n, zero));
+            nmi_asserted = lanes_select(nmi_edge, lanes_set(1), nmi_asserted);
+            nmi_asserted = lanes_select(lanes_eq(lanes_and(lanes_load(&table[SLOT_SYSTEM_OUTPUT*BATCH_LANES]), lanes_set(0x8)), zero), nmi_asserted, zero);
+            nmi_n_old    = nmi_n;
+
+            data_in  = lanes_gather_byte(memory, lanes_add(memory_index, lanes_load(&table[SLOT_ADDRESS_OUT*BATCH_LANES])));
+            rom_data = lanes_gather_rom(rom_address);
+            lanes_store(&table[SLOT_DATA_IN*BATCH_LANES], lanes_or(lanes_shl(data_in, 8), data_in));
+            lanes_store(&table[SLOT_STATUS*BATCH_LANES], lanes_or(lanes_or(carry8, lanes_shl(nmi_asserted, 3)),
+                                                                  lanes_or(lanes_shl(irq_gated, 5), lanes_shl(overflow8, 6))));
+
+            type      = lanes_shr(rom_data, 28);
+            dst       = lanes_and(lanes_shr(rom_data, 24), lanes_set(0xF));
+            select0   = lanes_and(lanes_shr(rom_data, 20), lanes_set(0xF));
+            select1   = lanes_and(lanes_shr(rom_data, 16), lanes_set(0xF));
+            immediate = lanes_and(rom_data, lanes_set(0xFFFF));
+
+            // Operand select. Operand 0 select 0xF reads zero, operand 1 select 0x7 byte-swaps the PC
+            operand0 = lanes_select(lanes_eq(select0, lanes_set(0xF)), lanes_set(SLOT_ZERO), select0);
+            operand0 = lanes_gather(table, lanes_add(lanes_shl(operand0, 3), index));
+            operand1 = lanes_gather(table, lanes_add(lanes_shl(select1, 3), index));
+            operand1 = lanes_select(lanes_eq(select1, lanes_set(0x7)), lanes_and(lanes_or(lanes_shl(operand1, 8), lanes_shr(operand1, 8)), lanes_set(0xFFFF)), operand1);
+            operand1 = lanes_select(lanes_eq(select1, lanes_set(0xF)), immediate, operand1);
+
+            // ALU
+            sum    = lanes_add(operand0, operand1);
+            carry7 = lanes_and(lanes_shr(lanes_add(lanes_and(operand0, lanes_set(0x7F)), lanes_and(operand1, lanes_set(0x7F))), 7), lanes_set(1));
+            mask   = lanes_eq(type, lanes_set(0x2));
+            carry8    = lanes_select(mask, lanes_shr(lanes_add(lanes_and(operand0, lanes_set(0xFF)), lanes_and(operand1, lanes_set(0xFF))), 8), carry8);
+            overflow8 = lanes_select(mask, lanes_xor(carry7, carry8), overflow8);
+            alu = lanes_set(0xEEEE);
+            alu = lanes_select(mask, lanes_and(sum, lanes_set(0xFFFF)), alu);
+            alu = lanes_select(lanes_eq(type, lanes_set(0x3)), lanes_and(operand0, operand1), alu);
+            alu = lanes_select(lanes_eq(type, lanes_set(0x4)), lanes_or(operand0, operand1), alu);
+            alu = lanes_select(lanes_eq(type, lanes_set(0x5)), lanes_xor(operand0, operand1), alu);
+            alu = lanes_select(lanes_eq(type, lanes_set(0x6)), lanes_shr(operand0, 1), alu);
+
+            // Register write-back. Each lane writes one slot, or SLOT_DISCARD
+            is_alu = lanes_gt(type, lanes_set(0x1));
+            alu_last_result = lanes_select(is_alu, alu, alu_last_result);
+            value = lanes_or(lanes_and(alu, lanes_gather(batch_dst_and, dst)), lanes_gather(batch_dst_or, dst));
+            mask  = lanes_select(is_alu, lanes_gather(batch_dst_slot, dst), lanes_set(SLOT_DISCARD));
+            lanes_store(write_address, lanes_add(lanes_shl(mask, 3), index));
+            lanes_store(write_data, value);
+            for (lane=0; lane<BATCH_LANES; lane++) table[write_address[lane]] = write_data[lane];
+
+            // JUMP Opcode. select1 holds the jump condition and bits 22:20 of select0 the jump source
+            is_jump = lanes_eq(type, lanes_set(0x1));
+            taken   = lanes_or(lanes_eq(select1, zero),
+                      lanes_or(lanes_and(lanes_eq(select1, lanes_set(0x1)), lanes_xor(lanes_eq(alu_last_result, zero), lanes_set(-1))),
+                               lanes_and(lanes_eq(select1, lanes_set(0x2)), lanes_eq(alu_last_result, zero))));
+            taken   = lanes_and(is_jump, taken);
+
+            // For subroutine CALLs, store next opcode address
+            push = lanes_and(taken, lanes_eq(lanes_and(dst, lanes_set(0x1)), lanes_set(0x1)));
+            calling_high = lanes_select(push, lanes_or(lanes_shl(calling_high, 11), lanes_shr(calling_low, 21)), calling_high);
+            calling_low  = lanes_select(push, lanes_or(lanes_shl(calling_low, 11), lanes_and(rom_address, lanes_set(0x07FF))), calling_low);
+
+            select0 = lanes_and(select0, lanes_set(0x7));
+            pop     = lanes_and(taken, lanes_eq(select0, lanes_set(0x2)));
+            target  = lanes_add(lanes_and(calling_low, lanes_set(0x07FF)), lanes_set(1));
+            calling_low  = lanes_select(pop, lanes_or(lanes_shr(calling_low, 11), lanes_shl(calling_high, 21)), calling_low);
+            calling_high = lanes_select(pop, lanes_shr(calling_high, 11), calling_high);
+
+            next = lanes_select(taken, rom_address, lanes_and(lanes_add(rom_address, lanes_set(1)), lanes_set(0xFFFF)));
+            next = lanes_select(lanes_and(taken, lanes_eq(select0, zero)), lanes_and(immediate, lanes_set(0x07FF)), next);
+            next = lanes_select(lanes_and(taken, lanes_eq(select0, lanes_set(0x1))), data_in, next);
+            rom_address = lanes_select(pop, target, next);
+
+            // Writes to the 6502 Data RAM occur on the simulated rising edge of the clock
+            mask = lanes_and(lanes_and(is_jump, lanes_eq(select1, lanes_set(0x3))),
+                             lanes_eq(lanes_and(lanes_load(&table[SLOT_SYSTEM_OUTPUT*BATCH_LANES]), lanes_set(0x1)), zero));
+            writes = lanes_mask(mask);
+            if (writes)
+              {
+                lanes_store(write_address, lanes_add(memory_index, lanes_load(&table[SLOT_ADDRESS_OUT*BATCH_LANES])));
+                lanes_store(write_data, lanes_load(&table[SLOT_DATA_OUT*BATCH_LANES]));
+                for (lane=0; lane<BATCH_LANES; lane++)
+                    if (writes & (1<<lane)) memory[write_address[lane]] = write_data[lane];
+              }
+          }
+
+        lanes_store(&table[SLOT_SP*BATCH_LANES], lanes_and(lanes_load(&table[SLOT_SP_PAGE*BATCH_LANES]), lanes_set(0x00FF)));
+        for (row=0; row<SLOT_COUNT; row++) lanes_store(&batch_register(batch, row, group), lanes_load(&table[row*BATCH_LANES]));
+        lanes_store(&batch_register(batch, BATCH_ROM_ADDRESS, group),     rom_address);
+        lanes_store(&batch_register(batch, BATCH_ALU_LAST_RESULT, group), alu_last_result);
+        lanes_store(&batch_register(batch, BATCH_CARRY8, group),          carry8);
+        lanes_store(&batch_register(batch, BATCH_OVERFLOW8, group),       overflow8);
+        lanes_store(&batch_register(batch, BATCH_NMI_ASSERTED, group),    nmi_asserted);
+        lanes_store(&batch_register(batch, BATCH_IRQ_GATED, group),       irq_gated);
+        lanes_store(&batch_register(batch, BATCH_NMI_N_OLD, group),       nmi_n_old);
+        lanes_store(&batch_register(batch, BATCH_CALLING_LOW, group),     calling_low);
+        lanes_store(&batch_register(batch, BATCH_CALLING_HIGH, group),    calling_high);
+      }
+  }
+
+
+#ifndef MCL65_LIBRARY
+
+// Main loop
+//
+int main(int argc, char *argv[])
+  {
+    mcl65_t *instance;
+    batch_t *batch;
+
+    if (argc>2 && strcmp(argv[1],"-b")==0)
+      {
+        batch = batch_create(strtoul(argv[2], NULL, 0));
+        if (batch==NULL) { printf("Cannot allocate the batch\n"); return 1; }
+        while (1) batch_run(batch, 1000000);
+      }
+
+    instance = mcl65_create();
+    if (instance==NULL) { printf("Cannot allocate the instance\n"); return 1; }
+    instance->single_step = !(argc>1 && strcmp(argv[1],"-f")==0);
+
+    while (1) mcl65_run(instance, 1000000);
   }
 
+#endif
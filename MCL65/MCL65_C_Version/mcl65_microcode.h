@@ -0,0 +1 @@
+unsigned long microcode_rom[2048] ={ 0x10000570, 0x100002d0, 0x1000020c, 0x1000020c, 0x1000020c, 0x100002c6, 0x100003a0, 0x1000020c, 0x10000412, 0x100002c0, 0x1000025a, 0x1000020c, 0x1000020c, 0x100002ca, 0x100003a8, 0x1000020c, 0x1000052c, 0x100002d2, 0x1000020c, 0x1000020c, 0x1000020c, 0x100002c8, 0x100003a6, 0x1000020c, 0x10000200, 0x100002ce, 0x1000020c, 0x1000020c, 0x1000020c, 0x100002cc, 0x100003aa, 0x1000020c, 0x10000470, 0x100002b8, 0x1000020c, 0x1000020c, 0x10000327, 0x100002ae, 0x100003e0, 0x1000020c, 0x10000430, 0x100002a7, 0x10000262, 0x1000020c, 0x1000032e, 0x100002b2, 0x100003e9, 0x1000020c, 0x10000526, 0x100002ba, 0x1000020c, 0x1000020c, 0x1000020c, 0x100002b0, 0x100003e7, 0x1000020c, 0x10000206, 0x100002b6, 0x1000020c, 0x1000020c, 0x1000020c, 0x100002b4, 0x100003eb, 0x1000020c, 0x100004a0, 0x100002e7, 0x1000020c, 0x1000020c, 0x1000020c, 0x100002dd, 0x100003d0, 0x1000020c, 0x10000410, 0x100002d8, 0x1000026c, 0x1000020c, 0x100004c0, 0x100002e1, 0x100003db, 0x1000020c, 0x1000052f, 0x100002e9, 0x1000020c, 0x1000020c, 0x1000020c, 0x100002df, 0x100003d9, 0x1000020c, 0x10000221, 0x100002e5, 0x1000020c, 0x1000020c, 0x1000020c, 0x100002e3, 0x100003dd, 0x1000020c, 0x10000500, 0x1000071a, 0x1000020c, 0x1000020c, 0x1000020c, 0x10000710, 0x100003f0, 0x1000020c, 0x10000448, 0x10000700, 0x10000276, 0x1000020c, 0x100004e0, 0x10000714, 0x10000400, 0x1000020c, 0x10000532, 0x1000071c, 0x1000020c, 0x1000020c, 0x1000020c, 0x10000712, 0x100003fe, 0x1000020c, 0x10000239, 0x10000718, 0x1000020c, 0x1000020c, 0x1000020c, 0x10000716, 0x10000402, 0x1000020c, 0x1000020c, 0x10000379, 0x1000020c, 0x1000020c, 0x10000390, 0x1000036a, 0x10000383, 0x1000020c, 0x1000029e, 0x1000020c, 0x10000246, 0x1000020c, 0x10000396, 0x10000370, 0x10000389, 0x1000020c, 0x10000535, 0x1000037c, 0x1000020c, 0x1000020c, 0x10000393, 0x1000036d, 0x10000386, 0x1000020c, 0x10000253, 0x10000376, 0x1000024d, 0x1000020c, 0x1000020c, 0x10000373, 0x1000020c, 0x1000020c, 0x10000318, 0x100002ff, 0x10000307, 0x1000020c, 0x1000031d, 0x100002f5, 0x1000030c, 0x1000020c, 0x1000021a, 0x100002f0, 0x10000212, 0x1000020c, 0x10000321, 0x100002f9, 0x10000310, 0x1000020c, 0x10000520, 0x10000301, 0x1000020c, 0x1000020c, 0x1000031f, 0x100002f7, 0x1000030e, 0x1000020c, 0x1000022d, 0x100002fd, 0x1000023f, 0x1000020c, 0x10000323, 0x100002fb, 0x10000312, 0x1000020c, 0x1000035c, 0x10000346, 0x1000020c, 0x1000020c, 0x10000362, 0x1000033c, 0x100003c0, 0x1000020c, 0x1000028e, 0x10000336, 0x10000296, 0x1000020c, 0x10000364, 0x10000340, 0x100003c8, 0x1000020c, 0x10000529, 0x10000348, 0x1000020c, 0x1000020c, 0x1000020c, 0x1000033e, 0x100003c6, 0x1000020c, 0x10000227, 0x10000344, 0x1000020c, 0x1000020c, 0x1000020c, 0x10000342, 0x100003ca, 0x1000020c, 0x1000034e, 0x1000075a, 0x1000020c, 0x1000020c, 0x10000354, 0x10000750, 0x100003b0, 0x1000020c, 0x10000286, 0x10000730, 0x1000020c, 0x1000020c, 0x10000356, 0x10000754, 0x100003b8, 0x1000020c, 0x10000523, 0x1000075c, 0x1000020c, 0x1000020c, 0x1000020c, 0x10000752, 0x100003b6, 0x1000020c, 0x10000233, 0x10000758, 0x1000020c, 0x1000020c, 0x1000020c, 0x10000756, 0x100003ba, 0x1000020c, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10330000, 0x3fcf0038, 0x10020113, 0x3fcf0010, 0x1002010c, 0x499f0040, 0x4ddf0010, 0x3ddfffef, 0x10020113, 0x3fcf0008, 0x10020111, 0x4ddf0008, 0x3ddffff7, 0x100005a2, 0x3fcf0020, 0x10010573, 0x10340000, 0x4dff0001, 0x10100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x30cf0040, 0x399fffbf, 0x49900000, 0x30cf0001, 0x399ffffe, 0x49900000, 0x399fff7f, 0x3f2f0080, 0x1002012c, 0x499f0080, 0x399ffffd, 0x3f2f00ff, 0x10010130, 0x499f0002, 0x10200000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10200000, 0x00000000, 0x00000000, 0x00000000, 0x436f0000, 0x10000156, 0x435f0000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x10330000, 0x10340000, 0x223a0000, 0x3a2f00ff, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10200000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x10330000, 0x10340000, 0x33bfff00, 0x4a230000, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10200000, 0x00000000, 0x00000000, 0x00000000, 0x415f0000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x10330000, 0x10340000, 0x33bfff00, 0x43230000, 0x20310000, 0x3fcf0001, 0x1002019a, 0x310f00ff, 0x323fff00, 0x4a120000, 0x10330000, 0x10340000, 0x2aaf0100, 0x10330000, 0x10340000, 0x32bf00ff, 0x1000019e, 0x4af00000, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10200000, 0x00000000, 0x00000000, 0x416f0000, 0x10000181, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x10330000, 0x10340000, 0x225a0000, 0x3a2f00ff, 0x10330000, 0x10340000, 0x30bf00ff, 0x22af0001, 0x3a2f00ff, 0x10330000, 0x10340000, 0x31bfff00, 0x4a010000, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10200000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x10330000, 0x10340000, 0x32bf00ff, 0x23af0001, 0x3a3f00ff, 0x416f0000, 0x10000189, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x4dff0003, 0x10200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x399ffffe, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x499f0001, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x45f40000, 0x325f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x46f40000, 0x326f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x110001e0, 0x399ffffb, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x399ffff7, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x399fffbf, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x499f0008, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x499f0004, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x45f80000, 0x325f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x110001e0, 0x44f50000, 0x324f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x110001e0, 0x48f50000, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x44f60000, 0x324f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x110001e0, 0x24440000, 0x324f00ff, 0x11000125, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x309f0001, 0x24440000, 0x44400000, 0x324f00ff, 0x11000125, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x304f0001, 0x64440000, 0x399ffffe, 0x49900000, 0x324f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x110001e0, 0x319f0001, 0x304f0001, 0x64440000, 0x399ffffe, 0x49900000, 0x324f00ff, 0x4f1f0000, 0x10020280, 0x444f0080, 0x324f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x255f0001, 0x325f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x266f0001, 0x326f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x255fffff, 0x325f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x110001e0, 0x266fffff, 0x326f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x34420000, 0x324f00ff, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x11000142, 0x100002a8, 0x11000155, 0x100002a8, 0x1100016a, 0x100002a8, 0x11000180, 0x100002a8, 0x110001a4, 0x100002a8, 0x110001a7, 0x100002a8, 0x110001c4, 0x100002a8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x44420000, 0x00000000, 0x324f00ff, 0x11000128, 0x10000101, 0x11000142, 0x100002c1, 0x11000155, 0x100002c1, 0x1100016a, 0x100002c1, 0x11000180, 0x100002c1, 0x110001a4, 0x100002c1, 0x110001a7, 0x100002c1, 0x110001c4, 0x100002c1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x54420000, 0x324f00ff, 0x11000128, 0x10000101, 0x11000142, 0x100002d9, 0x11000155, 0x100002d9, 0x1100016a, 0x100002d9, 0x11000180, 0x100002d9, 0x110001a4, 0x100002d9, 0x110001a7, 0x100002d9, 0x110001c4, 0x100002d9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x44f20000, 0x324f00ff, 0x11000128, 0x10000101, 0x11000142, 0x100002f1, 0x11000155, 0x100002f1, 0x1100016a, 0x100002f1, 0x11000180, 0x100002f1, 0x110001a4, 0x100002f1, 0x110001a7, 0x100002f1, 0x110001c4, 0x100002f1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x45f20000, 0x325f00ff, 0x11000128, 0x10000101, 0x11000142, 0x10000308, 0x11000153, 0x10000308, 0x1100016a, 0x10000308, 0x110001a4, 0x10000308, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x46f20000, 0x326f00ff, 0x11000128, 0x10000101, 0x11000142, 0x10000319, 0x11000155, 0x10000319, 0x1100016a, 0x10000319, 0x11000180, 0x10000319, 0x00000000, 0x00000000, 0x11000142, 0x399fff3f, 0x312f00c0, 0x49910000, 0x32420000, 0x1100012c, 0x10000101, 0x1100016a, 0x10000328, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x522fffff, 0x222f0001, 0x22420000, 0x11000760, 0x10000101, 0x11000142, 0x10000337, 0x11000155, 0x10000337, 0x1100016a, 0x10000337, 0x11000180, 0x10000337, 0x110001a4, 0x10000337, 0x110001a7, 0x10000337, 0x110001c4, 0x10000337, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x522fffff, 0x222f0001, 0x22520000, 0x11000760, 0x10000101, 0x11000142, 0x1000034f, 0x1100016a, 0x1000034f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x522fffff, 0x222f0001, 0x22620000, 0x11000760, 0x10000101, 0x11000142, 0x1000035d, 0x1100016a, 0x1000035d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4b4f0000, 0x11000600, 0x10000101, 0x4b4f0000, 0x11000615, 0x10000101, 0x4b4f0000, 0x11000625, 0x10000101, 0x4b4f0000, 0x11000636, 0x10000101, 0x4b4f0000, 0x11000647, 0x10000101, 0x4b4f0000, 0x1100064d, 0x10000101, 0x4b4f0000, 0x11000665, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4b5f0000, 0x11000600, 0x10000101, 0x4b5f0000, 0x11000613, 0x10000101, 0x4b5f0000, 0x11000625, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4b6f0000, 0x11000600, 0x10000101, 0x4b6f0000, 0x11000615, 0x10000101, 0x4b6f0000, 0x11000625, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000680, 0x20220000, 0x4b0f0000, 0x320f00ff, 0x11000125, 0x100006d0, 0x11000690, 0x100003a1, 0x110006a0, 0x100003a1, 0x110006b0, 0x100003a1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000680, 0x202f0001, 0x4b0f0000, 0x320f00ff, 0x11000128, 0x100006d0, 0x11000690, 0x100003b1, 0x110006a0, 0x100003b1, 0x110006b0, 0x100003b1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000680, 0x202fffff, 0x4b0f0000, 0x320f00ff, 0x11000128, 0x100006d0, 0x11000690, 0x100003c1, 0x110006a0, 0x100003c1, 0x110006b0, 0x100003c1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000680, 0x302f0001, 0x62220000, 0x4b2f0000, 0x399ffffe, 0x49900000, 0x322f00ff, 0x11000128, 0x100006d0, 0x11000690, 0x100003d1, 0x110006a0, 0x100003d1, 0x110006b0, 0x100003d1, 0x00000000, 0x11000680, 0x309f0001, 0x22220000, 0x4b200000, 0x422000ff, 0x11000125, 0x100006d0, 0x11000690, 0x100003e1, 0x110006a0, 0x100003e1, 0x110006b0, 0x100003e1, 0x00000000, 0x00000000, 0x00000000, 0x11000680, 0x319f0001, 0x302f0001, 0x63220000, 0x399ffffe, 0x49900000, 0x324f00ff, 0x4f1f0000, 0x100203fa, 0x433f0080, 0x4b3f0000, 0x323f00ff, 0x11000128, 0x100006d0, 0x11000690, 0x100003f1, 0x110006a0, 0x100003f1, 0x110006b0, 0x100003f1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4b4f0000, 0x10000413, 0x4b9f0000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x4a8f0000, 0x4dff0000, 0x288fffff, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0007, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x4a8f0000, 0x288f0001, 0x10330000, 0x10340000, 0x4a8f0000, 0x10330000, 0x10340000, 0x39bf00ff, 0x4a7f0000, 0x4dff0003, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x4a8f0000, 0x288f0001, 0x10330000, 0x10340000, 0x4a8f0000, 0x10330000, 0x10340000, 0x34bf00ff, 0x324f00ff, 0x11000128, 0x4a7f0000, 0x4dff0003, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x4a8f0000, 0x4dff0001, 0x10330000, 0x277f0001, 0x10340000, 0x3fbf00ff, 0x4dff0000, 0x4bf70000, 0x288fffff, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0000, 0x4a8f0000, 0x4b7f0000, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0000, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x288fffff, 0x10340000, 0x31bfff00, 0x47120000, 0x4a7f0000, 0x4dff0003, 0x10000102, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x4a8f0000, 0x10330000, 0x10340000, 0x288f0001, 0x4a8f0000, 0x10330000, 0x288f0001, 0x10340000, 0x39bf00ff, 0x4a8f0000, 0x10330000, 0x288f0001, 0x10340000, 0x32bf00ff, 0x4a8f0000, 0x10330000, 0x10340000, 0x31bfff00, 0x47120000, 0x4a7f0000, 0x4dff0003, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x10330000, 0x10340000, 0x33bfff00, 0x47230000, 0x4a7f0000, 0x4dff0003, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x277f0001, 0x10340000, 0x32bf00ff, 0x4a7f0000, 0x10330000, 0x10340000, 0x33bfff00, 0x4a230000, 0x10330000, 0x30af00ff, 0x200f0001, 0x300f00ff, 0x32afff00, 0x10340000, 0x31bf00ff, 0x4a020000, 0x10330000, 0x10340000, 0x30bfff00, 0x47010000, 0x4a7f0000, 0x4dff0003, 0x10000102, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x4a8f0000, 0x00000000, 0x10330000, 0x10340000, 0x288f0001, 0x4a8f0000, 0x10330000, 0x288f0001, 0x10340000, 0x32bf00ff, 0x4a8f0000, 0x10330000, 0x10340000, 0x31bfff00, 0x47120000, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3f9f0001, 0x10010550, 0x10000540, 0x3f9f0002, 0x10010550, 0x10000540, 0x3f9f0080, 0x10010550, 0x10000540, 0x3f9f0002, 0x10020548, 0x10000540, 0x3f9f0080, 0x10020548, 0x10000540, 0x3f9f0040, 0x10020548, 0x10000540, 0x3f9f0040, 0x10010550, 0x10000540, 0x3f9f0001, 0x10020548, 0x10000540, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x10330000, 0x10340000, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10000103, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x30bf00ff, 0x277f0001, 0x4a7f0000, 0x3f0f0080, 0x1002055b, 0x400fff00, 0x10330000, 0x10340000, 0x20700000, 0x320fff00, 0x33afff00, 0x5f230000, 0x10010565, 0x4a0f0000, 0x00000000, 0x1000056b, 0x310f00ff, 0x327fff00, 0x4a120000, 0x10330000, 0x10340000, 0x4a0f0000, 0x47af0000, 0x4dff0003, 0x10000103, 0x00000000, 0x00000000, 0x409f0010, 0x277f0002, 0x10000575, 0x309fffef, 0x00000000, 0x10330000, 0x10340000, 0x4a8f0000, 0x4dff0000, 0x4bf70000, 0x288fffff, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0000, 0x4a8f0000, 0x4b7f0000, 0x288fffff, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0000, 0x4a8f0000, 0x4bf00000, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0001, 0x4afffffe, 0x10330000, 0x10340000, 0x33bf00ff, 0x4affffff, 0x499f0004, 0x10330000, 0x288fffff, 0x10340000, 0x32bfff00, 0x47230000, 0x4a7f0000, 0x4dff0003, 0x10000103, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x309fffef, 0x10330000, 0x10340000, 0x4a8f0000, 0x4dff0000, 0x4bf70000, 0x288fffff, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0000, 0x4a8f0000, 0x4b7f0000, 0x288fffff, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0000, 0x4a8f0000, 0x4bf00000, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0001, 0x4afffffa, 0x10330000, 0x499f0004, 0x00000000, 0x10340000, 0x33bf00ff, 0x4afffffb, 0x10330000, 0x288fffff, 0x10340000, 0x32bfff00, 0x47230000, 0x4a7f0000, 0x4dff0003, 0x10000103, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x4dff0000, 0x10330000, 0x4dff0004, 0x10340000, 0x4dff0000, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x436f0000, 0x10000616, 0x435f0000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x10330000, 0x10340000, 0x223a0000, 0x3a2f00ff, 0x10000606, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x10330000, 0x10340000, 0x33bfff00, 0x4a230000, 0x10000606, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x415f0000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x10330000, 0x10340000, 0x33bfff00, 0x43230000, 0x2a310000, 0x10330000, 0x10340000, 0x10000606, 0x416f0000, 0x10000637, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x10330000, 0x10340000, 0x225a0000, 0x3a2f00ff, 0x10330000, 0x10340000, 0x30bf00ff, 0x22af0001, 0x3a2f00ff, 0x10330000, 0x10340000, 0x31bfff00, 0x4a010000, 0x10000606, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x10330000, 0x10340000, 0x32bf00ff, 0x23af0001, 0x3a3f00ff, 0x416f0000, 0x1000063f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x10330000, 0x10340000, 0x32bf00ff, 0x4dff0000, 0x10200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x435f0000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x3abf00ff, 0x10330000, 0x10340000, 0x223a0000, 0x3a2f00ff, 0x10000686, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x10330000, 0x10340000, 0x33bfff00, 0x4a230000, 0x10000686, 0x00000000, 0x00000000, 0x00000000, 0x415f0000, 0x277f0001, 0x4a7f0000, 0x4dff0001, 0x10330000, 0x10340000, 0x32bf00ff, 0x277f0001, 0x4a7f0000, 0x10330000, 0x10340000, 0x33bfff00, 0x43230000, 0x2a310000, 0x10330000, 0x10340000, 0x10000686, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10330000, 0x10340000, 0x4dff0000, 0x10330000, 0x4dff0004, 0x10340000, 0x277f0001, 0x4a7f0000, 0x4dff0003, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x3f9f0008, 0x10010770, 0x20240000, 0x31cf0041, 0x329f0001, 0x22020000, 0x33c00041, 0x43130000, 0x399f00be, 0x49930000, 0x442f0000, 0x11000128, 0x10000101, 0x00000000, 0x00000000, 0x11000142, 0x10000701, 0x11000155, 0x10000701, 0x1100016a, 0x10000701, 0x11000180, 0x10000701, 0x110001a4, 0x10000701, 0x110001a7, 0x10000701, 0x110001c4, 0x10000701, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000134, 0x3f9f0008, 0x10010790, 0x399f00bf, 0x522fffff, 0x22240000, 0x30cf0040, 0x3f9f0001, 0x1002073a, 0x222f0001, 0x31cf0040, 0x40010000, 0x49900000, 0x442f0000, 0x11000760, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000142, 0x10000731, 0x11000155, 0x10000731, 0x1100016a, 0x10000731, 0x11000180, 0x10000731, 0x110001a4, 0x10000731, 0x110001a7, 0x10000731, 0x110001c4, 0x10000731, 0x00000000, 0x00000000, 0x399ffffe, 0x302f0100, 0x10010764, 0x499f0001, 0x10000128, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x309f0001, 0x399ffffe, 0x24400000, 0x304f000f, 0x312f000f, 0x20010000, 0x310f001f, 0x231f0006, 0x3f3f00f0, 0x1002077c, 0x403f0000, 0x1000077d, 0x401f0000, 0x344f00f0, 0x322f00f0, 0x21420000, 0x21100000, 0x321f01ff, 0x232f0060, 0x3f3f0f00, 0x10020787, 0x403f0000, 0x10000788, 0x401f0000, 0x440f0000, 0x3f0f0f00, 0x10020101, 0x499f0001, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x309f0001, 0x500f0001, 0x22200000, 0x399ffffe, 0x502fffff, 0x200f0001, 0x20040000, 0x3f0f0f00, 0x1001079a, 0x499f0001, 0x502fffff, 0x200f000b, 0x300f000f, 0x314f000f, 0x20010000, 0x230f0006, 0x3f3f00f0, 0x100207a5, 0x303f000f, 0x43ff00b0, 0x100007a6, 0x43ff00a0, 0x512ffff0, 0x311f00f0, 0x23130000, 0x313f00f0, 0x324f00f0, 0x21120000, 0x221f0060, 0x3f2f0f00, 0x100207b0, 0x211f0060, 0x44010000, 0x3f3f0f00, 0x100207b4, 0x10000101, 0x42010000, 0x502fffff, 0x200f000b, 0x300f000f, 0x230f0006, 0x3f3f00f0, 0x100207be, 0x303f000f, 0x43ff00b0, 0x100007bf, 0x43ff00a0, 0x512fffff, 0x311f00f0, 0x21130000, 0x311f00f0, 0x221f0060, 0x3f2f0f00, 0x100207c7, 0x211f0060, 0x44010000, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4dff0019, 0x10330000, 0x10340000, 0x4dff0003, 0x10330000, 0x10340000, 0x4dff0001, 0x2aaf0001, 0x10330000, 0x10340000, 0x4a8f0000, 0x10330000, 0x10340000, 0x288fffff, 0x4a8f0000, 0x10330000, 0x10340000, 0x288fffff, 0x4a8f0000, 0x10330000, 0x10340000, 0x4afffffc, 0x10330000, 0x10340000, 0x33bf00ff, 0x4afffffd, 0x499f0004, 0x10330000, 0x10340000, 0x32bfff00, 0x47230000, 0x4a7f0000, 0x4dff0003, 0x10000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1000020c, 0x00000000 };
@@ -0,0 +1,74 @@
+//
+//
+//  File Name   :  host_biu.h
+//  Used on     :  MCL68 host opcode test build
+//  Author      :  Ted Fried, MicroCore Labs
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//   
+//  Included by mcl68.ino when it is compiled on Linux with -DHOST_BUILD.
+//  The Teensy program memory array and its IORD_32DIRECT/IOWR_32DIRECT BIU
+//  model are left out of that build and host_main.cpp supplies a 16MB memory
+//  model in their place, so the 68000 core runs unchanged against it.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Ted Fried
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#ifndef HOST_BIU_H
+#define HOST_BIU_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#define DMAMEM
+
+static inline void delay(unsigned long milliseconds)  {  (void)milliseconds;  return;  }
+
+
+// --------------------------------------------------------------------------------------------------
+// Simulated BIU and instruction hooks - implemented in host_main.cpp
+// --------------------------------------------------------------------------------------------------
+
+unsigned long IORD_32DIRECT(unsigned long base_address , unsigned long reg_address);
+void          IOWR_32DIRECT(unsigned long base_address , unsigned long reg_address , unsigned long write_data);
+
+void host_instruction_start();                      // Before each opcode fetch - tracks the test groups
+void host_instruction_done();                       // After each opcode - counts instructions and ends the run
+
+#define HOST_INSTRUCTION_START()    host_instruction_start()
+#define HOST_INSTRUCTION_DONE()     host_instruction_done()
+
+#endif
@@ -0,0 +1,422 @@
+//
+//
+//  File Name   :  host_main.cpp
+//  Used on     :  MCL68 host opcode test build
+//  Author      :  Ted Fried, MicroCore Labs
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//   
+//  Runs the MCL68 68000 core from mcl68.ino on Linux against the opcode test
+//  program in MC68000_Test_Code and reports pass/fail for each opcode group, 
+//  emulated instructions per second, BIU bus cycle totals and a histogram of 
+//  execution count and host time for each opcode handler.
+//
+//  Build:   g++ -O2 -DHOST_BUILD host_main.cpp -o mcl68_host
+//
+//  Usage:   ./mcl68_host [-b image] [-l listing] [-r repeats] [-n instructions] [-p]
+//
+//      -b   Test program image loaded at address 0   (default ../MC68000_Test_Code/Test_Suite.bin)
+//      -l   Assembler listing used to name the groups (default ../MC68000_Test_Code/MC68000_test_all_opcodes.L68)
+//      -r   Number of times to run the whole test program            (default 1)
+//      -n   Stop after this many instructions                         (default 0 = no limit)
+//      -p   Time each opcode handler on the host for the histogram
+//
+//  Exit status is 0 when every opcode group passes and 1 otherwise.
+//
+//  The test program calls each opcode group with a JSR from a list that
+//  starts at the reset PC. A group passes when it returns to the list. A 
+//  group fails when it reaches one of its "bra *" failure loops, runs outside
+//  the test image or exceeds HOST_GROUP_LIMIT instructions. The stack and SR 
+//  are then restored and the run continues with the next group.
+//
+//  Bus cycles are counted at the BIU interface. The clock estimate uses the
+//  68000 minimum of 4 clocks per bus cycle, because mcl68.ino does not count 
+//  internal cycles.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Ted Fried
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "host_biu.h"
+#include "../MCL68_with_BASIC/mcl68.ino"
+
+
+#define HOST_MEMORY_SIZE    0x1000000               // 24-bit 68000 address bus
+#define HOST_MAX_GROUPS     128
+#define HOST_GROUP_LIMIT    2000000                 // Instructions before a group is treated as hung
+#define HOST_UART_TX        0x21                    // Emulated UART transmit address used by Tiny BASIC
+
+struct host_group_t {
+  uint32_t  jsr_address;                            // JSR in the list that calls this group
+  char      name[32];
+  uint8_t   completed;                              // Returned to the JSR list at least once
+  uint8_t   failed;
+  uint32_t  fail_address;
+  const char * fail_reason;
+  uint64_t  instructions;
+};
+
+uint8_t  host_memory[HOST_MEMORY_SIZE];
+uint8_t  host_image[HOST_MEMORY_SIZE];
+uint32_t host_image_size=0;
+
+host_group_t host_group[HOST_MAX_GROUPS];
+uint32_t host_group_count=0;
+uint32_t host_current_group=0;
+uint64_t host_group_instructions=0;
+uint32_t host_last_pc=0xFFFFFFFF;
+
+uint32_t host_repeats=1;
+uint32_t host_pass=0;
+uint8_t  host_profile=0;
+uint64_t host_instruction_budget=0;
+uint64_t host_instructions=0;
+
+uint64_t host_prefetch_cycles=0;
+uint64_t host_read_cycles=0;
+uint64_t host_write_cycles=0;
+uint64_t host_jumps=0;
+
+uint64_t host_handler_count[256];
+uint64_t host_handler_ns[256];
+const char * host_handler_name[256];
+
+struct timespec host_start_time;
+struct timespec host_opcode_time;
+
+
+// -------------------------------------------------
+// Simulated BIU registers and memory
+// -------------------------------------------------
+uint32_t host_read_word(uint32_t local_address) {
+  local_address = local_address & (HOST_MEMORY_SIZE-1);
+  return (host_memory[local_address]<<8) | host_memory[(local_address+1) & (HOST_MEMORY_SIZE-1)];
+}
+
+unsigned long IORD_32DIRECT(unsigned long base_address , unsigned long reg_address) {
+  (void)base_address;                                                            // Only one BIU
+
+  switch (reg_address)  {
+    case BIU_REG_PFQ_EMPTY:   return 0x0;                                        // PFQ always has data
+    case BIU_REG_STATUS:      return 0x0;                                        // Never in RESET
+    case BIU_REG_INTERRUPTS:  return 0x0;                                        // No interrupts
+    case BIU_REG_DONE:        return 0x1;                                        // Cycles complete immediately
+    case BIU_REG_FAIL_TYPE:   return 0x0;
+    case BIU_REG_PFQ_TOP:     return host_read_word(mc68k_pc);
+    case BIU_REG_DATAIN:      return biu_read_data;
+    case BIU_REG_BUS_ERROR:   return 0x0;
+    default:                  return 0x0;
+  }
+}
+
+void IOWR_32DIRECT(unsigned long base_address , unsigned long reg_address , unsigned long write_data) {
+  uint32_t local_address = biu_address & (HOST_MEMORY_SIZE-1);
+  (void)base_address;
+
+  switch (reg_address)  {
+    case BIU_REG_PFQ_STROBE:    if (write_data==0x1)  host_prefetch_cycles++;  break;
+    case BIU_REG_JUMP_ADDRESS:  mc68k_pc = write_data;                          break;
+    case BIU_REG_ADDRESS:       biu_address = write_data;                       break;
+    case BIU_REG_DATAOUT:       biu_dataout = write_data;                       break;
+    case BIU_REG_SIZE:          biu_size = write_data;                          break;
+    
+    case BIU_REG_COMMAND:
+      if (write_data==0x8)  host_jumps++;
+      if (write_data==0x3)  biu_read_data = 0x3;                                 // IACK
+      if (write_data==0x2)  {
+        host_read_cycles++;
+        if (biu_size==8)  biu_read_data = host_memory[local_address];
+        else              biu_read_data = host_read_word(local_address);
+      }
+      if (write_data==0x1)  {
+        host_write_cycles++;
+        if (biu_size==8)  host_memory[local_address] = biu_dataout;
+        else            { host_memory[local_address] = (biu_dataout>>8)&0xFF;  host_memory[(local_address+1) & (HOST_MEMORY_SIZE-1)] = biu_dataout&0xFF; }
+        if (biu_size==8 && local_address==HOST_UART_TX)  putchar(biu_dataout&0xFF);
+      }
+      break;
+      
+    default:  break;
+  }
+  return;
+}
+
+
+// -------------------------------------------------
+// Test program image and opcode groups
+// -------------------------------------------------
+void host_load_image(const char * file_name) {
+  FILE * image_file = fopen(file_name, "rb");
+
+  if (image_file==NULL)  {  printf("Cannot open test image %s\n", file_name);  exit(1);  }
+  host_image_size = fread(host_image, 1, HOST_MEMORY_SIZE, image_file);
+  fclose(image_file);
+  return;
+}
+
+void host_reload_memory() {
+  memset(host_memory, 0, HOST_MEMORY_SIZE);
+  memcpy(host_memory, host_image, host_image_size);
+  return;
+}
+
+// The JSR list starts at the reset PC after the stack pointer setup
+//
+void host_find_groups() {
+  uint32_t local_address;
+  uint32_t reset_pc = (host_read_word(4)<<16) | host_read_word(6);
+
+  for (local_address=reset_pc ; local_address<reset_pc+0x100 ; local_address+=2)  {
+    if (host_read_word(local_address)==0x4EB9)  break;                            // JSR (xxx).L
+  }
+  while (host_read_word(local_address)==0x4EB9 && host_group_count<HOST_MAX_GROUPS)  {
+    host_group[host_group_count].jsr_address = local_address;
+    sprintf(host_group[host_group_count].name, "group@%06X", local_address);
+    host_group_count++;
+    local_address = local_address + 6;
+  }
+  return;
+}
+
+// Name the groups from the JSR lines of the assembler listing when it is available
+//
+void host_name_groups(const char * file_name) {
+  FILE * listing_file = fopen(file_name, "r");
+  char line[512], mnemonic[64], label[64];
+  unsigned int local_address, opcode, target;
+
+  if (listing_file==NULL)  return;
+  while (fgets(line, sizeof(line), listing_file)!=NULL)  {
+    if (sscanf(line, "%x %x %x %*d %63s %63s", &local_address, &opcode, &target, mnemonic, label)!=5)  continue;
+    if (opcode!=0x4EB9 || strcasecmp(mnemonic, "jsr")!=0)                                                continue;
+    for (uint32_t i=0 ; i<host_group_count ; i++)  {
+      if (host_group[i].jsr_address==local_address)  snprintf(host_group[i].name, sizeof(host_group[i].name), "%.31s", strncmp(label,"op_",3)==0 ? label+3 : label);
+    }
+  }
+  fclose(listing_file);
+  return;
+}
+
+// Restore the stack and flags that the JSR list runs with and continue with the next group
+//
+void host_fail_group(uint32_t local_pc, const char * reason) {
+  host_group_t * group = &host_group[host_current_group];
+
+  if (group->failed==0)  {  group->failed = 1;  group->fail_address = local_pc;  group->fail_reason = reason;  }
+  
+  m68k_a7_S = (host_read_word(0)<<16) | host_read_word(2);
+  Update_System_Flags(0x2700);
+  BIU_Jump(group->jsr_address + 6);
+  return;
+}
+
+
+// -------------------------------------------------
+// Report at the end of the run
+// -------------------------------------------------
+void host_name_handlers() {
+  #define HOST_NAME(opc)  host_handler_name[opc] = #opc + 4
+  HOST_NAME(OPC_ILLEGAL);         HOST_NAME(OPC_BOOL_I_TO_CCR_1); HOST_NAME(OPC_BOOL_I_TO_SR_1);  HOST_NAME(OPC_BOOL_I_TO_CCR_3);
+  HOST_NAME(OPC_BOOL_I_TO_SR_3);  HOST_NAME(OPC_BOOL_I_TO_CCR_2); HOST_NAME(OPC_BOOL_I_TO_SR_2);  HOST_NAME(OPC_BMOD_31);
+  HOST_NAME(OPC_BMOD_21);         HOST_NAME(OPC_BMOD_11);         HOST_NAME(OPC_BMOD_01);         HOST_NAME(OPC_MOVEP);
+  HOST_NAME(OPC_BOOL_I_3);        HOST_NAME(OPC_BOOL_I_1);        HOST_NAME(OPC_BOOL_I_2);        HOST_NAME(OPC_ADDSUBI_0);
+  HOST_NAME(OPC_ADDSUBI_1);       HOST_NAME(OPC_BOOL_I_4);        HOST_NAME(OPC_BMOD_30);         HOST_NAME(OPC_BMOD_20);
+  HOST_NAME(OPC_BMOD_10);         HOST_NAME(OPC_BMOD_00);         HOST_NAME(OPC_MOVE);            HOST_NAME(OPC_MOVE_FROM_SR);
+  HOST_NAME(OPC_MOVE_TO_CCR);     HOST_NAME(OPC_MOVE_TO_SR);      HOST_NAME(OPC_NEGS_3);          HOST_NAME(OPC_NEGS_4);
+  HOST_NAME(OPC_NEGS_2);          HOST_NAME(OPC_NEGS_1);          HOST_NAME(OPC_EXT);             HOST_NAME(OPC_NBCD);
+  HOST_NAME(OPC_SWAP);            HOST_NAME(OPC_PEA);             HOST_NAME(OPC_TAS);             HOST_NAME(OPC_TST);
+  HOST_NAME(OPC_TRAP);            HOST_NAME(OPC_LINK);            HOST_NAME(OPC_UNLK);            HOST_NAME(OPC_MOVE_USP);
+  HOST_NAME(OPC_NOP);             HOST_NAME(OPC_RESET);           HOST_NAME(OPC_STOP);            HOST_NAME(OPC_RTE);
+  HOST_NAME(OPC_RTS);             HOST_NAME(OPC_TRAPV);           HOST_NAME(OPC_RTR);             HOST_NAME(OPC_JSR);
+  HOST_NAME(OPC_JMP);             HOST_NAME(OPC_MOVEM);           HOST_NAME(OPC_LEA);             HOST_NAME(OPC_CHK);
+  HOST_NAME(OPC_DBCC);            HOST_NAME(OPC_SCC);             HOST_NAME(OPC_ADDSUBQ_1);       HOST_NAME(OPC_ADDSUBQ_0);
+  HOST_NAME(OPC_BSR);             HOST_NAME(OPC_BCC);             HOST_NAME(OPC_MOVEQ);           HOST_NAME(OPC_DIVU);
+  HOST_NAME(OPC_DIVS);            HOST_NAME(OPC_XBCD_1);          HOST_NAME(OPC_BOOL_1);          HOST_NAME(OPC_ADDSUBA_0);
+  HOST_NAME(OPC_ADDSUBX_0);       HOST_NAME(OPC_ADDSUB_0);        HOST_NAME(OPC_LINE_A);          HOST_NAME(OPC_CMPA);
+  HOST_NAME(OPC_CMPM);            HOST_NAME(OPC_BOOL_3);          HOST_NAME(OPC_BOOL_4);          HOST_NAME(OPC_MULU);
+  HOST_NAME(OPC_MULS);            HOST_NAME(OPC_XBCD_0);          HOST_NAME(OPC_EXG);             HOST_NAME(OPC_BOOL_2);
+  HOST_NAME(OPC_ADDSUBA_1);       HOST_NAME(OPC_ADDSUBX_1);       HOST_NAME(OPC_ADDSUB_1);        HOST_NAME(OPC_XSL_0_1);
+  HOST_NAME(OPC_XSL_0_2);         HOST_NAME(OPC_ROXL_0);          HOST_NAME(OPC_ROL_0);           HOST_NAME(OPC_XSR_1_2);
+  HOST_NAME(OPC_XSR_2_2);         HOST_NAME(OPC_ROXR_0);          HOST_NAME(OPC_ROR_0);           HOST_NAME(OPC_XSL_1_1);
+  HOST_NAME(OPC_XSL_1_2);         HOST_NAME(OPC_ROXL_1);          HOST_NAME(OPC_ROL_1);           HOST_NAME(OPC_XSR_1_1);
+  HOST_NAME(OPC_XSR_2_1);         HOST_NAME(OPC_ROXR_1);          HOST_NAME(OPC_ROR_1);           HOST_NAME(OPC_LINE_F);
+  return;
+}
+
+int host_compare_handlers(const void * a, const void * b) {
+  uint8_t handler_a = *(const uint8_t *)a;
+  uint8_t handler_b = *(const uint8_t *)b;
+
+  if (host_handler_count[handler_a] > host_handler_count[handler_b])  return -1;
+  if (host_handler_count[handler_a] < host_handler_count[handler_b])  return 1;
+  return handler_a - handler_b;
+}
+
+void host_finish() {
+  struct timespec end_time;
+  double seconds;
+  uint32_t passed=0;
+  uint64_t bus_cycles = host_prefetch_cycles + host_read_cycles + host_write_cycles;
+  uint8_t  order[256];
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+  seconds = (end_time.tv_sec-host_start_time.tv_sec) + (end_time.tv_nsec-host_start_time.tv_nsec)/1e9;
+
+  printf("\nOpcode groups:\n");
+  for (uint32_t i=0 ; i<host_group_count ; i++)  {
+    host_group_t * group = &host_group[i];
+         if (group->failed==1)     printf("  FAIL  %-20s %10llu instructions  %s at %06X\n", group->name, (unsigned long long)group->instructions, group->fail_reason, group->fail_address);
+    else if (group->completed==1)  {  passed++;  printf("  PASS  %-20s %10llu instructions\n", group->name, (unsigned long long)group->instructions);  }
+    else                           printf("  ----  %-20s %10llu instructions  not completed\n", group->name, (unsigned long long)group->instructions);
+  }
+
+  for (int i=0 ; i<256 ; i++)  order[i] = i;
+  qsort(order, 256, 1, host_compare_handlers);
+  
+  printf("\nOpcode handlers:\n");
+  printf("  %-20s %12s %8s", "handler", "count", "percent");
+  if (host_profile==1)  printf(" %12s %8s", "host ns", "ns/op");
+  printf("\n");
+  for (int i=0 ; i<256 ; i++)  {
+    uint8_t handler = order[i];
+    if (host_handler_count[handler]==0)  break;
+    printf("  %-20s %12llu %7.2f%%", host_handler_name[handler] ? host_handler_name[handler] : "?", (unsigned long long)host_handler_count[handler], 100.0*host_handler_count[handler]/host_instructions);
+    if (host_profile==1)  printf(" %12llu %8.1f", (unsigned long long)host_handler_ns[handler], (double)host_handler_ns[handler]/host_handler_count[handler]);
+    printf("\n");
+  }
+
+  printf("\nMCL68 host opcode test\n");
+  printf("  passes                  : %u\n",   host_pass);
+  printf("  opcode groups           : %u passed, %u failed\n", passed, host_group_count-passed);
+  printf("  instructions            : %llu\n", (unsigned long long)host_instructions);
+  printf("  host seconds            : %.3f%s\n", seconds, host_profile ? " (includes -p timing overhead)" : "");
+  printf("  instructions per second : %.0f\n", host_instructions/seconds);
+  printf("  bus cycles              : %llu  (prefetch %llu, read %llu, write %llu)\n", (unsigned long long)bus_cycles,
+         (unsigned long long)host_prefetch_cycles, (unsigned long long)host_read_cycles, (unsigned long long)host_write_cycles);
+  printf("  bus cycles/instruction  : %.2f\n", (double)bus_cycles/host_instructions);
+  printf("  minimum clocks          : %llu  (4 per bus cycle)\n", (unsigned long long)bus_cycles*4);
+  printf("  jumps                   : %llu\n", (unsigned long long)host_jumps);
+
+  exit((passed==host_group_count && host_group_count>0) ? 0 : 1);
+}
+
+
+// -------------------------------------------------
+// Instruction hooks called from the MCL68 main loop
+// -------------------------------------------------
+void host_instruction_start() {
+  uint32_t local_pc = mc68k_pc;
+  host_group_t * group = &host_group[host_current_group];
+
+  // Failure traps are BRA/Bcc to themselves
+  //
+       if (local_pc==host_last_pc && (host_read_word(local_pc)&0xF0FF)==0x60FE)  {  host_fail_group(local_pc, "failure loop");  local_pc = mc68k_pc;  }
+  else if (local_pc>=host_image_size)                                             {  host_fail_group(local_pc, "ran outside the image");  local_pc = mc68k_pc;  }
+  else if (host_group_instructions>HOST_GROUP_LIMIT)                              {  host_fail_group(local_pc, "instruction limit");  local_pc = mc68k_pc;  }
+
+  // Returning to the JSR list ends the current group
+  //
+  if (local_pc==group->jsr_address+6)  {
+    group->completed = 1;
+    host_current_group++;
+    if (host_current_group==host_group_count)  {
+      host_pass++;
+      if (host_pass==host_repeats)  host_finish();
+      host_current_group = 0;
+      host_reload_memory();
+      Reset_routine();
+    }
+    host_group_instructions = 0;
+    local_pc = mc68k_pc;
+  }
+  
+  host_last_pc = local_pc;
+  if (host_profile==1)  clock_gettime(CLOCK_MONOTONIC, &host_opcode_time);
+  return;
+}
+
+void host_instruction_done() {
+  struct timespec end_time;
+  uint8_t handler = opcode_table[first_opcode];
+
+  host_handler_count[handler]++;
+  if (host_profile==1)  {
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+    host_handler_ns[handler] += (end_time.tv_sec-host_opcode_time.tv_sec)*1000000000LL + (end_time.tv_nsec-host_opcode_time.tv_nsec);
+  }
+
+  host_instructions++;
+  host_group_instructions++;
+  host_group[host_current_group].instructions++;
+  
+  if (host_instruction_budget!=0 && host_instructions>=host_instruction_budget)  host_finish();
+  return;
+}
+
+
+// -------------------------------------------------
+// Test driver
+// -------------------------------------------------
+int main(int argc, char *argv[]) {
+  const char * image_name   = "../MC68000_Test_Code/Test_Suite.bin";
+  const char * listing_name = "../MC68000_Test_Code/MC68000_test_all_opcodes.L68";
+
+  for (int i=1 ; i<argc ; i++)  {
+         if (strcmp(argv[i],"-b")==0 && i+1<argc)  image_name = argv[++i];
+    else if (strcmp(argv[i],"-l")==0 && i+1<argc)  listing_name = argv[++i];
+    else if (strcmp(argv[i],"-r")==0 && i+1<argc)  host_repeats = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-n")==0 && i+1<argc)  host_instruction_budget = strtoull(argv[++i], NULL, 0);
+    else if (strcmp(argv[i],"-p")==0)              host_profile = 1;
+    else  {  printf("Usage: %s [-b image] [-l listing] [-r repeats] [-n instructions] [-p]\n", argv[0]);  return 1;  }
+  }
+  if (host_repeats==0)  host_repeats = 1;
+
+  host_load_image(image_name);
+  host_reload_memory();
+  host_find_groups();
+  host_name_groups(listing_name);
+  host_name_handlers();
+  
+  if (host_group_count==0)  {  printf("No JSR list found at the reset PC of %s\n", image_name);  return 1;  }
+  printf("Running %u opcode groups from %s\n", host_group_count, image_name);
+
+  clock_gettime(CLOCK_MONOTONIC, &host_start_time);
+  MCL68_Main();                                                  // Returns through host_finish()
+  return 1;
+}
@@ -26,6 +26,12 @@
 // Revision 3 7/12/2023
 // Updated RTE opcode and A-Line,F-Line traps per David Rumball
 //
+// Revision 4 10/18/2026
+// Opcode decode now uses a 64K entry table built at startup from the original decode rules
+//
+// Revision 5 10/18/2026
+// Builds on Linux with -DHOST_BUILD for the opcode test harness in MCL68/Host
+//
 //
 //------------------------------------------------------------------------
 //
@@ -79,6 +85,12 @@
 
 #include <stdio.h>
 
+#ifdef HOST_BUILD
+#include "../Host/host_biu.h"          // Linux build - memory and the UART are provided by the host harness
+#else
+#define HOST_INSTRUCTION_START()
+#define HOST_INSTRUCTION_DONE()
+#endif
 
 
 // Defines
@@ -170,9 +182,114 @@ unsigned long  num=0;
 unsigned long  original_mc68k_pc;
 
 
+// Opcode decode table - holds one handler number for each of the 64K opcode words.
+// Filled in at startup by Build_Opcode_Table() so the main loop dispatches with a single lookup.
+//
+DMAMEM uint8_t opcode_table[0x10000];   // 64KB in RAM2
+
+#define OPC_ILLEGAL            0
+#define OPC_BOOL_I_TO_CCR_1    1
+#define OPC_BOOL_I_TO_SR_1     2
+#define OPC_BOOL_I_TO_CCR_3    3
+#define OPC_BOOL_I_TO_SR_3     4
+#define OPC_BOOL_I_TO_CCR_2    5
+#define OPC_BOOL_I_TO_SR_2     6
+#define OPC_BMOD_31            7
+#define OPC_BMOD_21            8
+#define OPC_BMOD_11            9
+#define OPC_BMOD_01            10
+#define OPC_MOVEP              11
+#define OPC_BOOL_I_3           12
+#define OPC_BOOL_I_1           13
+#define OPC_BOOL_I_2           14
+#define OPC_ADDSUBI_0          15
+#define OPC_ADDSUBI_1          16
+#define OPC_BOOL_I_4           17
+#define OPC_BMOD_30            18
+#define OPC_BMOD_20            19
+#define OPC_BMOD_10            20
+#define OPC_BMOD_00            21
+#define OPC_MOVE               22
+#define OPC_MOVE_FROM_SR       23
+#define OPC_MOVE_TO_CCR        24
+#define OPC_MOVE_TO_SR         25
+#define OPC_NEGS_3             26
+#define OPC_NEGS_4             27
+#define OPC_NEGS_2             28
+#define OPC_NEGS_1             29
+#define OPC_EXT                30
+#define OPC_NBCD               31
+#define OPC_SWAP               32
+#define OPC_PEA                33
+#define OPC_TAS                34
+#define OPC_TST                35
+#define OPC_TRAP               36
+#define OPC_LINK               37
+#define OPC_UNLK               38
+#define OPC_MOVE_USP           39
+#define OPC_NOP                40
+#define OPC_RESET              41
+#define OPC_STOP               42
+#define OPC_RTE                43
+#define OPC_RTS                44
+#define OPC_TRAPV              45
+#define OPC_RTR                46
+#define OPC_JSR                47
+#define OPC_JMP                48
+#define OPC_MOVEM              49
+#define OPC_LEA                50
+#define OPC_CHK                51
+#define OPC_DBCC               52
+#define OPC_SCC                53
+#define OPC_ADDSUBQ_1          54
+#define OPC_ADDSUBQ_0          55
+#define OPC_BSR                56
+#define OPC_BCC                57
+#define OPC_MOVEQ              58
+#define OPC_DIVU               59
+#define OPC_DIVS               60
+#define OPC_XBCD_1             61
+#define OPC_BOOL_1             62
+#define OPC_ADDSUBA_0          63
+#define OPC_ADDSUBX_0          64
+#define OPC_ADDSUB_0           65
+#define OPC_LINE_A             66
+#define OPC_CMPA               67
+#define OPC_CMPM               68
+#define OPC_BOOL_3             69
+#define OPC_BOOL_4             70
+#define OPC_MULU               71
+#define OPC_MULS               72
+#define OPC_XBCD_0             73
+#define OPC_EXG                74
+#define OPC_BOOL_2             75
+#define OPC_ADDSUBA_1          76
+#define OPC_ADDSUBX_1          77
+#define OPC_ADDSUB_1           78
+#define OPC_XSL_0_1            79
+#define OPC_XSL_0_2            80
+#define OPC_ROXL_0             81
+#define OPC_ROL_0              82
+#define OPC_XSR_1_2            83
+#define OPC_XSR_2_2            84
+#define OPC_ROXR_0             85
+#define OPC_ROR_0              86
+#define OPC_XSL_1_1            87
+#define OPC_XSL_1_2            88
+#define OPC_ROXL_1             89
+#define OPC_ROL_1              90
+#define OPC_XSR_1_1            91
+#define OPC_XSR_2_1            92
+#define OPC_ROXR_1             93
+#define OPC_ROR_1              94
+#define OPC_LINE_F             95
+
+
 void Exception_Handler(unsigned int exception_type);
 
 
+#ifndef HOST_BUILD
+
 // Uncomment this line for "Tiny BASIC for the Motorola MC68000"
 unsigned char PROGRAM_MEMORY_ARRAY[65535] = { 0xde,0xad,0xbe,0xef,0x0,0x0,0x0,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x60,0x0,0x0,0x22,0x60,0x0,0x0,0x50,0x60,0x0,0xd,0x26,0x60,0x0,0xd,0x30,0x60,0x0,0xd,0x40,0x60,0x0,0xd,0x4a,0x60,0x0,0xd,0x5a,0x0,0x0,0xf,0x62,0x0,0x0,0x80,0x0,0x2e,0x78,0x0,0xb0,0x4d,0xf9,0x0,0x0,0xe,0xa,0x61,0x0,0xc,0xf2,0x23,0xf8,0x0,0xac,0x0,0x0,0xf,0x6,0x20,0x38,0x0,0xb0,0x4,0x80,0x0,0x0,0x8,0x0,0x23,0xc0,0x0,0x0,0xf,0xe,0x4,0x80,0x0,0x0,0x0,0x6c,0x23,0xc0,0x0,0x0,0xf,0xa,0x42,0x80,0x23,0xc0,0x0,0x0,0xe,0xf2,0x23,0xc0,0x0,0x0,0xe,0xea,0x23,0xc0,0x0,0x0,0xe,0xe6,0x2e,0x78,0x0,0xb0,0x4d,0xf9,0x0,0x0,0xe,0x30,0x61,0x0,0xc,0xac,0x10,0x3c,0x0,0x3e,0x61,0x0,0x9,0x7e,0x61,0x0,0xc,0x2a,0x28,0x48,0x41,0xf9,0x0,0x0,0xf,0x12,0x61,0x0,0xb,0xd4,0x61,0x0,0xc,0xc,0x4a,0x41,0x67,0x0,0x1,0x26,0xb2,0xbc,0x0,0x0,0xff,0xff,0x64,0x0,0x8,0xa0,0x11,0x1,0xe0,0x59,0x11,0x1,0xe1,0x59,0x61,0x0,0x9,0xfc,0x2a,0x49,0x66,0x0,0x0,0x18,0x61,0x0,0xa,0x1e,0x24,0x4d,0x26,0x79,0x0,0x0,0xf,0x6,0x61,0x0,0xa,0x1c,0x23,0xca,0x0,0x0,0xf,0x6,0x20,0xc,0x90,0x88,0xb0,0xbc,0x0,0x0,0x0,0x3,0x67,0xa0,0x26,0x79,0x0,0x0,0xf,0x6,0x2c,0x4b,0xd7,0xc0,0x20,0x39,0x0,0x0,0xf,0xa,0xb0,0x8b,0x63,0x0,0x8,0x38,0x23,0xcb,0x0,0x0,0xf,0x6,0x22,0x4e,0x24,0x4d,0x61,0x0,0x9,0xf2,0x22,0x48,0x24,0x4d,0x26,0x4c,0x61,0x0,0x9,0xdc,0x60,0x0,0xff,0x70,0x4c,0x49,0x53,0xd4,0x4c,0x4f,0x41,0xc4,0x4e,0x45,0xd7,0x52,0x55,0xce,0x53,0x41,0x56,0xc5,0x4e,0x45,0x58,0xd4,0x4c,0x45,0xd4,0x49,0xc6,0x47,0x4f,0x54,0xcf,0x47,0x4f,0x53,0x55,0xc2,0x52,0x45,0x54,0x55,0x52,0xce,0x52,0x45,0xcd,0x46,0x4f,0xd2,0x49,0x4e,0x50,0x55,0xd4,0x50,0x52,0x49,0x4e,0xd4,0x50,0x4f,0x4b,0xc5,0x53,0x54,0x4f,0xd0,0x42,0x59,0xc5,0x43,0x41,0x4c,0xcc,0x0,0x50,0x45,0x45,0xcb,0x52,0x4e,0xc4,0x41,0x42,0xd3,0x53,0x49,0x5a,0xc5,0x0,0x54,0xcf,0x0,0x53,0x54,0x45,0xd0,0x0,0x3e,0xbd,0x3c,0xbe,0xbe,0xbd,0x3c,0xbd,0xbc,0x0,0x0,0x3,0x2,0x5,0x94,0x2,0x9c,0x2,0xb0,0x5,0xfc,0x4,0x76,0x5,0x84,0x4,0xdc,0x2,0xee,0x3,0xa4,0x3,0xd4,0x4,0xd8,0x3,0xf8,0x5,0x6,0x3,0x32,0x6,0x84,0x2,0xa8,0x0,0xa8,0x6,0xa0,0x5,0x7c,0x8,0xc2,0x8,0xce,0x9,0x8,0x9,0x1a,0x7,0xaa,0x4,0x12,0x9,0x6e,0x4,0x28,0x4,0x30,0x6,0xc8,0x6,0xd4,0x6,0xe0,0x6,0xf8,0x6,0xec,0x7,0x6,0x7,0x1c,0x43,0xf8,0x1,0x9a,0x45,0xf8,0x2,0x6,0x61,0x0,0xa,0xd6,0x26,0x48,0x42,0x2,0x10,0x18,0x12,0x11,0x66,0x0,0x0,0x8,0x20,0x4b,0x60,0x0,0x0,0x2a,0x16,0x0,0xc6,0x2,0xb6,0x3c,0x0,0x2e,0x67,0x0,0x0,0x1e,0xc2,0x3c,0x0,0x7f,0xb2,0x0,0x67,0x0,0x0,0xe,0x54,0x8a,0x20,0x4b,0x42,0x2,0x4a,0x19,0x6a,0xfc,0x60,0xd0,0x74,0xff,0x4a,0x19,0x6a,0xca,0x47,0xf8,0x0,0x0,0x36,0x52,0x4e,0xd3,0x61,0x0,0x6,0xc2,0x23,0xf8,0x0,0xac,0x0,0x0,0xf,0x6,0x61,0x0,0x6,0xb6,0x60,0x0,0xfe,0x38,0x61,0x0,0x6,0xae,0x20,0x78,0x0,0xac,0x23,0xc8,0x0,0x0,0xe,0xe6,0x4a,0xb9,0x0,0x0,0xe,0xe6,0x67,0x0,0xfe,0x20,0x42,0x81,0x22,0x48,0x61,0x0,0x8,0x7a,0x65,0x0,0xfe,0x14,0x23,0xc9,0x0,0x0,0xe,0xe6,0x20,0x49,0x54,0x88,0x61,0x0,0xa,0xb6,0x43,0xf8,0x1,0xac,0x45,0xf8,0x2,0x10,0x60,0x0,0xff,0x6a,0x61,0x0,0x3,0xc6,0x61,0x0,0x6,0x6c,0x22,0x0,0x61,0x0,0x8,0x40,0x66,0x0,0x6,0xde,0x60,0xd2,0x61,0x0,0x9,0xee,0x61,0x0,0x6,0x58,0x61,0x0,0x8,0x2e,0x65,0x0,0xfd,0xd6,0x61,0x0,0x9,0xa6,0x61,0x0,0xa,0x7e,0x67,0x0,0x0,0x10,0xb0,0x3c,0x0,0x13,0x66,0x0,0x0,0x8,0x61,0x0,0xa,0x6e,0x67,0xfa,0x61,0x0,0x8,0x1a,0x60,0xdc,0x38,0x3c,0x0,0xb,0x61,0x0,0x9,0x9e,0x3a,0x7,0x61,0x0,0xa,0x6e,0x60,0x9c,0x61,0x0,0x9,0x92,0xd,0x9,0x61,0x0,0xa,0x62,0x60,0x0,0xff,0x70,0x61,0x0,0x9,0x84,0x23,0xb,0x61,0x0,0x3,0x5e,0x38,0x0,0x60,0x0,0x0,0x1a,0x61,0x0,0x9,0x74,0x24,0xd,0x61,0x0,0x3,0x4e,0x61,0x0,0xfd,0x2c,0x60,0x0,0x0,0x8,0x61,0x0,0x8,0x88,0x60,0x14,0x61,0x0,0x9,0x5c,0x2c,0x7,0x61,0x0,0x5,0xc6,0x60,0xcc,0x61,0x0,0xa,0x26,0x60,0x0,0x0,0x12,0x3f,0x4,0x61,0x0,0x3,0x26,0x38,0x1f,0x22,0x0,0x61,0x0,0x8,0xa2,0x60,0xdc,0x61,0x0,0x5,0xa8,0x60,0x0,0x5,0xcc,0x61,0x0,0x8,0x4,0x61,0x0,0x3,0xc,0x2f,0x8,0x22,0x0,0x61,0x0,0x7,0x88,0x66,0x0,0x6,0xcc,0x2f,0x39,0x0,0x0,0xe,0xe6,0x2f,0x39,0x0,0x0,0xe,0xea,0x42,0xb9,0x0,0x0,0xe,0xf2,0x23,0xcf,0x0,0x0,0xe,0xea,0x60,0x0,0xff,0x2,0x61,0x0,0x5,0x8a,0x22,0x39,0x0,0x0,0xe,0xea,0x67,0x0,0x5,0x8e,0x2e,0x41,0x23,0xdf,0x0,0x0,0xe,0xea,0x23,0xdf,0x0,0x0,0xe,0xe6,0x20,0x5f,0x61,0x0,0x7,0x90,0x60,0xa4,0x61,0x0,0x7,0xb0,0x61,0x0,0x5,0x2a,0x23,0xce,0x0,0x0,0xe,0xf2,0x43,0xf8,0x1,0xf3,0x45,0xf8,0x2,0x38,0x60,0x0,0xfe,0x46,0x61,0x0,0x2,0xa2,0x23,0xc0,0x0,0x0,0xe,0xfa,0x43,0xf8,0x1,0xf6,0x45,0xf8,0x2,0x3c,0x60,0x0,0xfe,0x30,0x61,0x0,0x2,0x8c,0x60,0x0,0x0,0x4,0x70,0x1,0x23,0xc0,0x0,0x0,0xe,0xf6,0x23,0xf9,0x0,0x0,0xe,0xe6,0x0,0x0,0xe,0xfe,0x23,0xc8,0x0,0x0,0xf,0x2,0x2c,0x4f,0x60,0x0,0x0,0x8,0xdd,0xfc,0x0,0x0,0x0,0x14,0x20,0x16,0x67,0x0,0x0,0x1a,0xb0,0xb9,0x0,0x0,0xe,0xf2,0x66,0xec,0x24,0x4f,0x22,0x4e,0x47,0xf8,0x0,0x14,0xd7,0xc9,0x61,0x0,0x7,0xe,0x2e,0x4b,0x60,0x0,0xff,0x28,0x61,0x0,0x3,0x62,0x65,0x0,0x4,0xf2,0x22,0x40,0x20,0x39,0x0,0x0,0xe,0xf2,0x67,0x0,0x4,0xe6,0xb3,0xc0,0x67,0x0,0x0,0x8,0x61,0x0,0x6,0xf2,0x60,0xea,0x20,0x11,0xd0,0xb9,0x0,0x0,0xe,0xf6,0x69,0x0,0x5,0x46,0x22,0x80,0x22,0x39,0x0,0x0,0xe,0xfa,0x4a,0xb9,0x0,0x0,0xe,0xf6,0x6a,0x0,0x0,0x4,0xc1,0x41,0xb2,0x80,0x6d,0x0,0x0,0x16,0x23,0xf9,0x0,0x0,0xe,0xfe,0x0,0x0,0xe,0xe6,0x20,0x79,0x0,0x0,0xf,0x2,0x60,0x0,0xfe,0xce,0x61,0x0,0x6,0xb2,0x60,0x0,0xfe,0xc6,0x60,0x0,0x0,0xc,0x61,0x0,0x1,0xd8,0x4a,0x80,0x66,0x0,0xfd,0xfa,0x22,0x48,0x42,0x81,0x61,0x0,0x6,0x7c,0x64,0x0,0xfd,0xe4,0x60,0x0,0xfb,0xf2,0x2e,0x79,0x0,0x0,0xe,0xee,0x23,0xdf,0x0,0x0,0xe,0xe6,0x58,0x8f,0x20,0x5f,0x2f,0x8,0x61,0x0,0x6,0xf2,0x60,0xe,0x61,0x0,0x2,0xca,0x65,0x0,0x0,0x5a,0x24,0x40,0x60,0x0,0x0,0x1c,0x2f,0x8,0x61,0x0,0x2,0xba,0x65,0x0,0x4,0x4a,0x24,0x40,0x14,0x10,0x42,0x0,0x10,0x80,0x22,0x5f,0x61,0x0,0x6,0xac,0x10,0x82,0x2f,0x8,0x2f,0x39,0x0,0x0,0xe,0xe6,0x23,0xfc,0xff,0xff,0xff,0xff,0x0,0x0,0xe,0xe6,0x23,0xcf,0x0,0x0,0xe,0xee,0x2f,0xa,0x10,0x3c,0x0,0x3a,0x61,0x0,0x5,0x36,0x41,0xf9,0x0,0x0,0xf,0x12,0x61,0x0,0x1,0x56,0x24,0x5f,0x24,0x80,0x23,0xdf,0x0,0x0,0xe,0xe6,0x20,0x5f,0x58,0x8f,0x61,0x0,0x7,0x64,0x2c,0x3,0x60,0x8e,0x60,0x0,0xfe,0x22,0xc,0x10,0x0,0xd,0x67,0x0,0x0,0xe,0x61,0x0,0x3,0xa2,0x61,0x0,0x7,0x4c,0x2c,0x3,0x60,0xf4,0x60,0x0,0xfe,0xa,0x20,0x78,0x0,0xac,0x10,0x3c,0x0,0xd,0x61,0x0,0xfb,0x2,0x61,0x0,0xfb,0x2,0x67,0xfa,0xb0,0x3c,0x0,0x40,0x67,0x0,0x0,0x24,0xb0,0x3c,0x0,0x3a,0x66,0xec,0x61,0x0,0x0,0x24,0x10,0xc1,0x61,0x0,0x0,0x1e,0x10,0xc1,0x61,0x0,0xfa,0xe2,0x67,0xfa,0x10,0xc0,0xb0,0x3c,0x0,0xd,0x66,0xf2,0x60,0xd0,0x23,0xc8,0x0,0x0,0xf,0x6,0x60,0x0,0xfb,0xe,0x74,0x1,0x42,0x41,0x61,0x0,0xfa,0xc4,0x67,0xfa,0xb0,0x3c,0x0,0x41,0x65,0x0,0x0,0x4,0x5f,0x0,0xc0,0x3c,0x0,0xf,0xe9,0x9,0x82,0x0,0x51,0xca,0xff,0xe6,0x4e,0x75,0x20,0x78,0x0,0xac,0x22,0x79,0x0,0x0,0xf,0x6,0x10,0x3c,0x0,0xd,0x61,0x0,0xfa,0x94,0x10,0x3c,0x0,0xa,0x61,0x0,0xfa,0x8c,0xb3,0xc8,0x63,0x0,0x0,0x24,0x10,0x3c,0x0,0x3a,0x61,0x0,0xfa,0x7e,0x12,0x18,0x61,0x0,0x0,0x3a,0x12,0x18,0x61,0x0,0x0,0x34,0x10,0x18,0xb0,0x3c,0x0,0xd,0x67,0xce,0x61,0x0,0xfa,0x66,0x60,0xf2,0x10,0x3c,0x0,0x40,0x61,0x0,0xfa,0x5c,0x10,0x3c,0x0,0xd,0x61,0x0,0xfa,0x54,0x10,0x3c,0x0,0xa,0x61,0x0,0xfa,0x4c,0x10,0x3c,0x0,0x1a,0x61,0x0,0xfa,0x44,0x60,0x0,0xfa,0x86,0x74,0x1,0xe9,0x19,0x10,0x1,0xc0,0x3c,0x0,0xf,0x6,0x0,0x0,0x30,0xb0,0x3c,0x0,0x39,0x63,0x0,0x0,0x4,0x5e,0x0,0x61,0x0,0xfa,0x24,0x51,0xca,0xff,0xe4,0x4e,0x75,0x61,0x0,0x0,0x30,0x61,0x0,0x6,0x4c,0x2c,0xf,0x2f,0x0,0x61,0x0,0x0,0x24,0x22,0x5f,0x12,0x80,0x60,0x0,0xfd,0x2,0x60,0x0,0x2,0xd0,0x61,0x0,0x0,0x14,0x4a,0x80,0x67,0x0,0x3,0x48,0x2f,0x8,0x22,0x40,0x4e,0x91,0x20,0x5f,0x60,0x0,0xfc,0xe8,0x61,0x0,0x0,0x7a,0x2f,0x0,0x43,0xf8,0x1,0xfb,0x45,0xf8,0x2,0x40,0x60,0x0,0xfb,0x90,0x61,0x0,0x0,0x56,0x6d,0x0,0x0,0x46,0x60,0x0,0x0,0x46,0x61,0x0,0x0,0x4a,0x67,0x0,0x0,0x3a,0x60,0x0,0x0,0x3a,0x61,0x0,0x0,0x3e,0x6f,0x0,0x0,0x2e,0x60,0x0,0x0,0x2e,0x61,0x0,0x0,0x32,0x6e,0x0,0x0,0x22,0x60,0x0,0x0,0x22,0x61,0x0,0x0,0x26,0x66,0x0,0x0,0x16,0x60,0x0,0x0,0x16,0x4e,0x75,0x61,0x0,0x0,0x18,0x6c,0x0,0x0,0x8,0x60,0x0,0x0,0x8,0x4e,0x75,0x42,0x80,0x4e,0x75,0x70,0x1,0x4e,0x75,0x20,0x1f,0x4e,0x75,0x20,0x1f,0x22,0x1f,0x2f,0x0,0x2f,0x1,0x61,0x0,0x0,0x8,0x22,0x1f,0xb2,0x80,0x4e,0x75,0x61,0x0,0x5,0xa2,0x2d,0x7,0x42,0x80,0x60,0x0,0x0,0x28,0x61,0x0,0x5,0x96,0x2b,0x1,0x61,0x0,0x0,0x2a,0x61,0x0,0x5,0x8c,0x2b,0x11,0x2f,0x0,0x61,0x0,0x0,0x1e,0x22,0x1f,0xd0,0x81,0x69,0x0,0x2,0xa2,0x60,0xea,0x61,0x0,0x5,0x76,0x2d,0x71,0x2f,0x0,0x61,0x0,0x0,0x8,0x44,0x80,0x4e,0xf8,0x7,0x54,0x61,0x0,0x0,0x2c,0x61,0x0,0x5,0x60,0x2a,0xf,0x2f,0x0,0x61,0x0,0x0,0x20,0x22,0x1f,0x61,0x0,0x0,0xae,0x60,0xec,0x61,0x0,0x5,0x4c,0x2f,0x47,0x2f,0x0,0x61,0x0,0x0,0xc,0x22,0x1f,0xc1,0x41,0x61,0x0,0x0,0xe2,0x60,0xd6,0x43,0xf8,0x1,0xe4,0x45,0xf8,0x2,0x2e,0x60,0x0,0xfa,0xae,0x61,0x0,0x0,0x2e,0x65,0x0,0x0,0xa,0x22,0x40,0x42,0x80,0x20,0x11,0x4e,0x75,0x61,0x0,0x5,0x36,0x20,0x1,0x4a,0x42,0x66,0xf4,0x61,0x0,0x5,0x10,0x28,0xd,0x61,0x0,0xfe,0xea,0x61,0x0,0x5,0x6,0x29,0x3,0x4e,0x75,0x60,0x0,0x1,0x96,0x61,0x0,0x5,0x52,0x42,0x80,0x10,0x10,0x4,0x0,0x0,0x40,0x65,0x0,0x0,0x48,0x66,0x0,0x0,0x2a,0x52,0x48,0x61,0xd2,0xd0,0x80,0x65,0x0,0x2,0x12,0xd0,0x80,0x65,0x0,0x2,0x18,0x2f,0x0,0x61,0x0,0x1,0x18,0x22,0x1f,0xb0,0x81,0x63,0x0,0x1,0xaa,0x20,0x39,0x0,0x0,0xf,0xa,0x90,0x81,0x4e,0x75,0xb0,0x3c,0x0,0x1b,0xa,0x3c,0x0,0x1,0x65,0x0,0x0,0x10,0x52,0x48,0xd0,0x40,0xd0,0x40,0x22,0x39,0x0,0x0,0xf,0xa,0xd0,0x41,0x4e,0x75,0x28,0x1,0xb1,0x84,0x4a,0x80,0x6a,0x0,0x0,0x4,0x44,0x80,0x4a,0x81,0x6a,0x0,0x0,0x4,0x44,0x81,0xb2,0xbc,0x0,0x0,0xff,0xff,0x63,0x0,0x0,0xe,0xc1,0x41,0xb2,0xbc,0x0,0x0,0xff,0xff,0x62,0x0,0x1,0xc6,0x34,0x0,0xc4,0xc1,0x48,0x40,0xc0,0xc1,0x48,0x40,0x4a,0x40,0x66,0x0,0x1,0xc2,0xd0,0x82,0x6b,0x0,0x1,0xc8,0x4a,0x84,0x6a,0x0,0x0,0x4,0x44,0x80,0x4e,0x75,0x4a,0x81,0x67,0x0,0x1,0xc4,0x24,0x1,0x28,0x1,0xb1,0x84,0x4a,0x80,0x6a,0x0,0x0,0x4,0x44,0x80,0x4a,0x81,0x6a,0x0,0x0,0x4,0x44,0x81,0x76,0x1f,0x22,0x0,0x42,0x80,0xd2,0x81,0xd1,0x80,0x67,0x0,0x0,0xc,0xb0,0x82,0x6b,0x0,0x0,0x6,0x52,0x81,0x90,0x82,0x51,0xcb,0xff,0xec,0xc1,0x41,0x4a,0x84,0x6a,0x0,0x0,0x6,0x44,0x80,0x44,0x81,0x4e,0x75,0x61,0x0,0xff,0x0,0x22,0x40,0x42,0x80,0x10,0x11,0x4e,0x75,0x61,0x0,0xfe,0xf4,0x4a,0x80,0x67,0x0,0x1,0x7a,0x6b,0x0,0x1,0x82,0x22,0x0,0x22,0x79,0x0,0x0,0xe,0xe2,0xb3,0xfc,0x0,0x0,0xe,0xe1,0x65,0x0,0x0,0x6,0x43,0xf8,0x0,0x90,0x20,0x19,0x8,0x80,0x0,0x1f,0x23,0xc9,0x0,0x0,0xe,0xe2,0x61,0x0,0xff,0x7c,0x20,0x1,0x52,0x80,0x4e,0x75,0x61,0x0,0xfe,0xba,0x4a,0x80,0x6a,0x0,0x0,0x8,0x44,0x80,0x6b,0x0,0x1,0x52,0x4e,0x75,0x20,0x39,0x0,0x0,0xf,0xa,0x90,0xb9,0x0,0x0,0xf,0x6,0x4e,0x75,0x61,0x0,0xfe,0xb0,0x65,0x0,0x0,0x40,0x2f,0x0,0x61,0x0,0x3,0xa2,0x3d,0xb,0x61,0x0,0xfd,0x7c,0x2c,0x5f,0x2c,0x80,0x4e,0x75,0x60,0x0,0x0,0x2a,0x61,0x0,0x3,0x8e,0x3a,0x7,0x58,0x8f,0x60,0x0,0xf9,0x8e,0x61,0x0,0x3,0x82,0xd,0x7,0x58,0x8f,0x60,0x0,0xf9,0x62,0x4e,0x75,0x61,0x0,0x3,0xcc,0xc,0x10,0x0,0xd,0x66,0x0,0x0,0x4,0x4e,0x75,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0xcf,0x61,0x0,0x4,0x3a,0x20,0x5f,0x20,0x39,0x0,0x0,0xe,0xe6,0x67,0x0,0xf7,0x62,0xb0,0xbc,0xff,0xff,0xff,0xff,0x67,0x0,0xfb,0x68,0x1f,0x10,0x42,0x10,0x22,0x79,0x0,0x0,0xe,0xe6,0x61,0x0,0x3,0x1e,0x10,0x9f,0x10,0x3c,0x0,0x3f,0x61,0x0,0xf6,0xf2,0x42,0x40,0x53,0x89,0x61,0x0,0x2,0x30,0x60,0x0,0xf7,0x34,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0xd7,0x60,0xb8,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x37,0x60,0xae,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x3f,0x60,0xa4,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x47,0x60,0x9a,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x4f,0x60,0x90,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x57,0x60,0x86,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x5f,0x60,0x0,0xff,0x7c,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x67,0x60,0x0,0xff,0x70,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x6f,0x60,0x0,0xff,0x64,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x77,0x60,0x0,0xff,0x58,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x7f,0x60,0x0,0xff,0x4c,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x88,0x60,0x0,0xff,0x40,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x90,0x60,0x0,0xff,0x34,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0x99,0x60,0x0,0xff,0x28,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0xa2,0x60,0x0,0xff,0x1c,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0xab,0x60,0x0,0xff,0x10,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0xb4,0x60,0x0,0xff,0x4,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0xbd,0x60,0x0,0xfe,0xf8,0x2f,0x8,0x4d,0xf9,0x0,0x0,0xe,0xc6,0x60,0x0,0xfe,0xec,0x61,0x0,0xf6,0xa,0x10,0x3c,0x0,0x20,0x61,0x0,0xf6,0x2,0x41,0xf9,0x0,0x0,0xf,0x12,0x61,0x0,0x2,0xf6,0x67,0xfa,0xb0,0x3c,0x0,0x8,0x67,0x0,0x0,0x2e,0xb0,0x3c,0x0,0x18,0x67,0x0,0x0,0x4a,0xb0,0x3c,0x0,0xd,0x67,0x0,0x0,0x8,0xb0,0x3c,0x0,0x20,0x65,0xdc,0x10,0xc0,0x61,0x0,0xf5,0xd2,0xb0,0x3c,0x0,0xd,0x67,0x0,0x0,0x62,0xb1,0xfc,0x0,0x0,0xf,0x61,0x65,0xc6,0x10,0x3c,0x0,0x8,0x61,0x0,0xf5,0xba,0x10,0x3c,0x0,0x20,0x61,0x0,0xf5,0xb2,0xb1,0xfc,0x0,0x0,0xf,0x12,0x63,0xae,0x10,0x3c,0x0,0x8,0x61,0x0,0xf5,0xa2,0x53,0x88,0x60,0xa2,0x22,0x8,0x4,0x81,0x0,0x0,0xf,0x12,0x67,0x0,0x0,0x20,0x53,0x41,0x10,0x3c,0x0,0x8,0x61,0x0,0xf5,0x88,0x10,0x3c,0x0,0x20,0x61,0x0,0xf5,0x80,0x10,0x3c,0x0,0x8,0x61,0x0,0xf5,0x78,0x51,0xc9,0xff,0xe6,0x41,0xf9,0x0,0x0,0xf,0x12,0x60,0x0,0xff,0x70,0x10,0x3c,0x0,0xa,0x61,0x0,0xf5,0x62,0x4e,0x75,0xb2,0xbc,0x0,0x0,0xff,0xff,0x64,0x0,0xfe,0x7c,0x22,0x78,0x0,0xac,0x24,0x79,0x0,0x0,0xf,0x6,0x53,0x8a,0xb4,0xc9,0x65,0x0,0x0,0x10,0x14,0x19,0xe1,0x4a,0x14,0x11,0x53,0x89,0xb4,0x41,0x65,0x0,0x0,0x4,0x4e,0x75,0x54,0x89,0xc,0x19,0x0,0xd,0x66,0xfa,0x60,0xd8,0xb7,0xc9,0x67,0x0,0x0,0x6,0x14,0xd9,0x60,0xf6,0x4e,0x75,0xb5,0xc9,0x67,0xfa,0x17,0x21,0x60,0xf8,0x2c,0x5f,0x23,0xdf,0x0,0x0,0xe,0xf2,0x67,0x0,0x0,0x1a,0x23,0xdf,0x0,0x0,0xe,0xf6,0x23,0xdf,0x0,0x0,0xe,0xfa,0x23,0xdf,0x0,0x0,0xe,0xfe,0x23,0xdf,0x0,0x0,0xf,0x2,0x4e,0xd6,0x22,0x39,0x0,0x0,0xf,0xe,0x92,0x8f,0x64,0x0,0xfe,0x0,0x2c,0x5f,0x22,0x39,0x0,0x0,0xe,0xf2,0x67,0x0,0x0,0x1a,0x2f,0x39,0x0,0x0,0xf,0x2,0x2f,0x39,0x0,0x0,0xe,0xfe,0x2f,0x39,0x0,0x0,0xe,0xfa,0x2f,0x39,0x0,0x0,0xe,0xf6,0x2f,0x1,0x4e,0xd6,0x12,0x0,0x10,0x19,0xb2,0x0,0x67,0x0,0x0,0x14,0x61,0x0,0xf4,0xae,0xb0,0x3c,0x0,0xd,0x66,0xee,0x10,0x3c,0x0,0xa,0x61,0x0,0xf4,0xa0,0x4e,0x75,0x61,0x0,0x0,0xd8,0x22,0x19,0x10,0x3c,0x0,0x22,0x22,0x48,0x61,0xd4,0x20,0x49,0x22,0x5f,0xb0,0x3c,0x0,0xa,0x67,0x0,0xf6,0xaa,0x54,0x89,0x4e,0xd1,0x61,0x0,0x0,0xba,0x27,0x7,0x10,0x3c,0x0,0x27,0x60,0xe0,0x61,0x0,0x0,0xae,0x5f,0xd,0x10,0x3c,0x0,0xd,0x61,0x0,0xf4,0x66,0x22,0x5f,0x60,0xde,0x4e,0x75,0x26,0x1,0x3f,0x4,0x1f,0x3c,0x0,0xff,0x4a,0x81,0x6a,0x0,0x0,0x6,0x44,0x81,0x53,0x44,0x82,0xfc,0x0,0xa,0x69,0x0,0x0,0xe,0x20,0x1,0xc2,0xbc,0x0,0x0,0xff,0xff,0x60,0x0,0x0,0x1c,0x30,0x1,0x42,0x41,0x48,0x41,0x82,0xfc,0x0,0xa,0x34,0x1,0x32,0x0,0x82,0xfc,0x0,0xa,0x20,0x1,0x48,0x41,0x32,0x2,0x48,0x41,0x48,0x40,0x1f,0x0,0x48,0x40,0x53,0x44,0x4a,0x81,0x66,0xc6,0x53,0x44,0x6b,0x0,0x0,0xe,0x10,0x3c,0x0,0x20,0x61,0x0,0xf4,0x6,0x51,0xcc,0xff,0xf6,0x4a,0x83,0x6a,0x0,0x0,0xa,0x10,0x3c,0x0,0x2d,0x61,0x0,0xf3,0xf4,0x10,0x1f,0x6b,0x0,0x0,0xc,0x6,0x0,0x0,0x30,0x61,0x0,0xf3,0xe6,0x60,0xf0,0x38,0x1f,0x4e,0x75,0x42,0x81,0x12,0x19,0xe1,0x49,0x12,0x19,0x78,0x5,0x61,0x0,0xff,0x74,0x10,0x3c,0x0,0x20,0x61,0x0,0xf3,0xca,0x42,0x40,0x60,0x0,0xff,0xa,0x61,0x0,0x0,0x56,0x22,0x5f,0x12,0x19,0xb2,0x10,0x67,0x0,0x0,0xa,0x42,0x81,0x12,0x11,0xd3,0xc1,0x4e,0xd1,0x52,0x88,0x52,0x89,0x4e,0xd1,0x42,0x81,0x42,0x42,0x61,0x0,0x0,0x36,0xc,0x10,0x0,0x30,0x65,0x0,0x0,0x2c,0xc,0x10,0x0,0x39,0x62,0x0,0x0,0x24,0xb2,0xbc,0xc,0xcc,0xcc,0xcc,0x64,0x0,0xfc,0xb6,0x20,0x1,0xd2,0x81,0xd2,0x81,0xd2,0x80,0xd2,0x81,0x10,0x18,0xc0,0xbc,0x0,0x0,0x0,0xf,0xd2,0x80,0x52,0x42,0x60,0xce,0x4e,0x75,0xc,0x10,0x0,0x20,0x66,0x0,0x0,0x6,0x52,0x88,0x60,0xf4,0x4e,0x75,0x41,0xf9,0x0,0x0,0xf,0x12,0x42,0x1,0x10,0x18,0xb0,0x3c,0x0,0xd,0x67,0x0,0x0,0x20,0xb0,0x3c,0x0,0x22,0x67,0x0,0x0,0x1a,0xb0,0x3c,0x0,0x27,0x67,0x0,0x0,0x12,0x4a,0x1,0x66,0xe2,0x61,0x0,0x0,0x1c,0x11,0x0,0x52,0x88,0x60,0xd8,0x4e,0x75,0x4a,0x1,0x66,0x0,0x0,0x6,0x12,0x0,0x60,0xcc,0xb2,0x0,0x66,0xc8,0x42,0x1,0x60,0xc4,0xb0,0x3c,0x0,0x61,0x65,0x0,0x0,0xe,0xb0,0x3c,0x0,0x7a,0x62,0x0,0x0,0x6,0x4,0x0,0x0,0x20,0x4e,0x75,0x61,0x0,0xf3,0x4,0x67,0x0,0x0,0xe,0xb0,0x3c,0x0,0x3,0x66,0x0,0x0,0x6,0x60,0x0,0xf3,0x3e,0x4e,0x75,0x4d,0xf9,0x0,0x0,0xe,0xdd,0x10,0x1e,0x67,0x0,0x0,0x8,0x61,0x0,0xf2,0xde,0x60,0xf4,0x4e,0x75,0x8,0x38,0x0,0x1,0x0,0x20,0x67,0xf8,0x11,0xc0,0x0,0x21,0x4e,0x75,0x8,0x38,0x0,0x0,0x0,0x22,0x67,0x0,0x0,0xa,0x10,0x38,0x0,0x23,0xc0,0x3c,0x0,0x7f,0x4e,0x75,0x8,0x38,0x0,0x1,0x0,0x24,0x67,0xf8,0x11,0xc0,0x0,0x25,0x4e,0x75,0x8,0x38,0x0,0x0,0x0,0x21,0x67,0x0,0x0,0xa,0x10,0x38,0x0,0x23,0xc0,0x3c,0x0,0x7f,0x4e,0x75,0x1e,0x3c,0x0,0xe4,0x4e,0x4e,0xd,0xa,0x47,0x6f,0x72,0x64,0x6f,0x27,0x73,0x20,0x4d,0x43,0x36,0x38,0x30,0x30,0x30,0x20,0x54,0x69,0x6e,0x79,0x20,0x42,0x41,0x53,0x49,0x43,0x2c,0x20,0x76,0x31,0x2e,0x32,0xd,0xa,0xa,0x0,0xd,0xa,0x4f,0x4b,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x32,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x33,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x34,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x35,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x36,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x37,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x38,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x39,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x30,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x31,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x32,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x33,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x34,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x35,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x36,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x37,0x3f,0xd,0xa,0x0,0x48,0x6f,0x77,0x31,0x38,0x3f,0xd,0xa,0x0,0x57,0x68,0x61,0x74,0x3f,0xd,0xa,0x0,0x53,0x6f,0x72,0x72,0x79,0x2e,0xd,0xa,0x0,0x0,0xff,0x0,0x0,0x0,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0 };
 
@@ -237,6 +354,8 @@ void IOWR_32DIRECT(unsigned long base_address , unsigned long reg_address , unsi
    
 }
 
+#endif
+
 
 // Retrieves the interrupt status from the BIU
 // ----------------------------------------------------------------------
@@ -634,7 +753,7 @@ void Exception_Handler(unsigned int vector_number)
       vector_number = BIU_IACK();                                                       // Fetch the vector from the BIU IACK Cycle
     }
 	
-  if ( (vector_number == 10) || (vector_number == 11) { 								// for the Line-A and Line-F trap the PC is 2 less
+  if ( (vector_number == 10) || (vector_number == 11) ) { 								// for the Line-A and Line-F trap the PC is 2 less
       mc68k_pc -=2 ;
   }
 
@@ -2563,13 +2682,171 @@ void op_MOVEP()
 }
 
 
+// Opcode Decoder
+// ----------------------------------------------------------------------
+// Returns the handler number for an opcode word using the 68000 decode rules.
+// Called once per opcode word by Build_Opcode_Table() rather than on every instruction.
+//
+uint8_t Decode_Opcode(uint16_t opcode)  {
+
+  switch (opcode&0xF000)
+    {
+      case (0x0000):
+        if ((opcode&0x0FFF)==0x003C)  return OPC_BOOL_I_TO_CCR_1;
+        if ((opcode&0x0FFF)==0x007C)  return OPC_BOOL_I_TO_SR_1;
+        if ((opcode&0x0FFF)==0x0A3C)  return OPC_BOOL_I_TO_CCR_3;
+        if ((opcode&0x0FFF)==0x0A7C)  return OPC_BOOL_I_TO_SR_3;
+        if ((opcode&0x0FFF)==0x023C)  return OPC_BOOL_I_TO_CCR_2;
+        if ((opcode&0x0FFF)==0x027C)  return OPC_BOOL_I_TO_SR_2;
+        if ((opcode&0x0FC0)==0x0800)  return OPC_BMOD_31;
+        if ((opcode&0x0FC0)==0x0840)  return OPC_BMOD_21;
+        if ((opcode&0x0FC0)==0x0880)  return OPC_BMOD_11;
+        if ((opcode&0x0FC0)==0x08C0)  return OPC_BMOD_01;
+        if ((opcode&0x0138)==0x0108)  return OPC_MOVEP;
+        if ((opcode&0x0F00)==0x0A00)  return OPC_BOOL_I_3;
+        if ((opcode&0x0F00)==0x0000)  return OPC_BOOL_I_1;
+        if ((opcode&0x0F00)==0x0200)  return OPC_BOOL_I_2;
+        if ((opcode&0x0F00)==0x0400)  return OPC_ADDSUBI_0;
+        if ((opcode&0x0F00)==0x0600)  return OPC_ADDSUBI_1;
+        if ((opcode&0x0F00)==0x0C00)  return OPC_BOOL_I_4;
+        if ((opcode&0x01C0)==0x0100)  return OPC_BMOD_30;
+        if ((opcode&0x01C0)==0x0140)  return OPC_BMOD_20;
+        if ((opcode&0x01C0)==0x0180)  return OPC_BMOD_10;
+        if ((opcode&0x01C0)==0x01C0)  return OPC_BMOD_00;
+        return OPC_ILLEGAL;
+
+      case (0x1000):  case (0x2000):  case (0x3000):  return OPC_MOVE;
+
+      case (0x4000):
+        if ((opcode&0x0FC0)==0x00C0)  return OPC_MOVE_FROM_SR;
+        if ((opcode&0x0FC0)==0x04C0)  return OPC_MOVE_TO_CCR;
+        if ((opcode&0x0FC0)==0x06C0)  return OPC_MOVE_TO_SR;
+        if ((opcode&0x0F00)==0x0000)  return OPC_NEGS_3;
+        if ((opcode&0x0F00)==0x0200)  return OPC_NEGS_4;
+        if ((opcode&0x0F00)==0x0400)  return OPC_NEGS_2;
+        if ((opcode&0x0F00)==0x0600)  return OPC_NEGS_1;
+        if ((opcode&0x0FB8)==0x0880)  return OPC_EXT;
+        if ((opcode&0x0FC0)==0x0800)  return OPC_NBCD;
+        if ((opcode&0x0FF8)==0x0840)  return OPC_SWAP;
+        if ((opcode&0x0FC0)==0x0840)  return OPC_PEA;
+        if ((opcode&0x0FFF)==0x0AFC)  return OPC_ILLEGAL;
+        if ((opcode&0x0FC0)==0x0AC0)  return OPC_TAS;
+        if ((opcode&0x0F00)==0x0A00)  return OPC_TST;
+        if ((opcode&0x0FF0)==0x0E40)  return OPC_TRAP;
+        if ((opcode&0x0FF8)==0x0E50)  return OPC_LINK;
+        if ((opcode&0x0FF8)==0x0E58)  return OPC_UNLK;
+        if ((opcode&0x0FF0)==0x0E60)  return OPC_MOVE_USP;
+        if ((opcode&0x0FFF)==0x0E71)  return OPC_NOP;
+        if ((opcode&0x0FFF)==0x0E70)  return OPC_RESET;
+        if ((opcode&0x0FFF)==0x0E72)  return OPC_STOP;
+        if ((opcode&0x0FFF)==0x0E73)  return OPC_RTE;
+        if ((opcode&0x0FFF)==0x0E75)  return OPC_RTS;
+        if ((opcode&0x0FFF)==0x0E76)  return OPC_TRAPV;
+        if ((opcode&0x0FFF)==0x0E77)  return OPC_RTR;
+        if ((opcode&0x0FC0)==0x0E80)  return OPC_JSR;
+        if ((opcode&0x0FC0)==0x0EC0)  return OPC_JMP;
+        if ((opcode&0x0B80)==0x0880)  return OPC_MOVEM;
+        if ((opcode&0x01C0)==0x01C0)  return OPC_LEA;
+        if ((opcode&0x01C0)==0x0180)  return OPC_CHK;
+        return OPC_ILLEGAL;
+
+      case (0x5000):
+        if ((opcode&0x00F8)==0x00C8)  return OPC_DBCC;
+        if ((opcode&0x00C0)==0x00C0)  return OPC_SCC;
+        if ((opcode&0x0100)==0x0000)  return OPC_ADDSUBQ_1;
+        if ((opcode&0x0100)==0x0100)  return OPC_ADDSUBQ_0;
+        return OPC_ILLEGAL;
+
+      case (0x6000):
+        if ((opcode&0x0F00)==0x0100)  return OPC_BSR;
+        if ((opcode&0x0000)==0x0000)  return OPC_BCC;
+        return OPC_ILLEGAL;
+
+      case (0x7000):
+        if ((opcode&0x0100)==0x0000)  return OPC_MOVEQ;
+        return OPC_ILLEGAL;
+
+      case (0x8000):
+        if ((opcode&0x01C0)==0x00C0)  return OPC_DIVU;
+        if ((opcode&0x01C0)==0x01C0)  return OPC_DIVS;
+        if ((opcode&0x01F0)==0x0100)  return OPC_XBCD_1;
+        if ((opcode&0x0000)==0x0000)  return OPC_BOOL_1;
+        return OPC_ILLEGAL;
+
+      case (0x9000):
+        if ((opcode&0x00C0)==0x00C0)  return OPC_ADDSUBA_0;
+        if ((opcode&0x0130)==0x0100)  return OPC_ADDSUBX_0;
+        if ((opcode&0x0000)==0x0000)  return OPC_ADDSUB_0;
+        return OPC_ILLEGAL;
+
+      case (0xA000):  return OPC_LINE_A;
+
+      case (0xB000):
+        if ((opcode&0x00C0)==0x00C0)  return OPC_CMPA;
+        if ((opcode&0x0138)==0x0108)  return OPC_CMPM;
+        if ((opcode&0x0100)==0x0100)  return OPC_BOOL_3;
+        if ((opcode&0x0100)==0x0000)  return OPC_BOOL_4;
+        return OPC_ILLEGAL;
+
+      case (0xC000):
+        if ((opcode&0x01C0)==0x00C0)  return OPC_MULU;
+        if ((opcode&0x01C0)==0x01C0)  return OPC_MULS;
+        if ((opcode&0x01F0)==0x0100)  return OPC_XBCD_0;
+        if ((opcode&0x0130)==0x0100)  return OPC_EXG;
+        if ((opcode&0x0000)==0x0000)  return OPC_BOOL_2;
+        return OPC_ILLEGAL;
+
+      case (0xD000):
+        if ((opcode&0x00C0)==0x00C0)  return OPC_ADDSUBA_1;
+        if ((opcode&0x0130)==0x0100)  return OPC_ADDSUBX_1;
+        if ((opcode&0x0000)==0x0000)  return OPC_ADDSUB_1;
+        return OPC_ILLEGAL;
+
+      case (0xE000):
+        if ((opcode&0x0FC0)==0x01C0)  return OPC_XSL_0_1;               // MEMORY Left
+        if ((opcode&0x0FC0)==0x03C0)  return OPC_XSL_0_2;
+        if ((opcode&0x0FC0)==0x05C0)  return OPC_ROXL_0;
+        if ((opcode&0x0FC0)==0x07C0)  return OPC_ROL_0;
+        if ((opcode&0x0FC0)==0x00C0)  return OPC_XSR_1_2;               // MEMORY Right
+        if ((opcode&0x0FC0)==0x02C0)  return OPC_XSR_2_2;
+        if ((opcode&0x0FC0)==0x04C0)  return OPC_ROXR_0;
+        if ((opcode&0x0FC0)==0x06C0)  return OPC_ROR_0;
+        if ((opcode&0x0118)==0x0100)  return OPC_XSL_1_1;               // REGISTER Left
+        if ((opcode&0x0118)==0x0108)  return OPC_XSL_1_2;
+        if ((opcode&0x0118)==0x0110)  return OPC_ROXL_1;
+        if ((opcode&0x0118)==0x0118)  return OPC_ROL_1;
+        if ((opcode&0x0118)==0x0000)  return OPC_XSR_1_1;               // REGISTER Right
+        if ((opcode&0x0118)==0x0008)  return OPC_XSR_2_1;
+        if ((opcode&0x0118)==0x0010)  return OPC_ROXR_1;
+        if ((opcode&0x0118)==0x0018)  return OPC_ROR_1;
+        return OPC_ILLEGAL;
+
+      case (0xF000):  return OPC_LINE_F;
+    }
+  return OPC_ILLEGAL;
+}
+
+
+void Build_Opcode_Table()  {
+
+  for (uint32_t i=0 ; i<=0xFFFF ; i++)  {  opcode_table[i] = Decode_Opcode(i);  }
+  return;
+}
+
+
 // Main MCL68 loop
 // ----------------------------------------------------------------------
+#ifdef HOST_BUILD
+int MCL68_Main()                // Called by the host harness in MCL68/Host/host_main.cpp
+#else
 int main()
+#endif
 {
 
   delay(3000);                // Delay a few seconds to give the UART link to establish with the host PC
 
+  Build_Opcode_Table();        // Predecode every 16-bit opcode word into opcode_table[]
+
   Reset_routine();
 
   while (1)
@@ -2585,160 +2862,109 @@ int main()
       if (BIU_IRQ_LEVEL() != 0)  {  Exception_Handler(99);  }
 
  
+      HOST_INSTRUCTION_START();
       first_opcode = BIU_PFQ_Fetch();
          
-      switch (first_opcode&0xF000)
+      switch (opcode_table[first_opcode])
       {
-        case (0x0000):
-          if ((first_opcode&0x0FFF)==0x003C) { op_BOOL_I_TO_CCR(1);       break; }// Checked   
-          if ((first_opcode&0x0FFF)==0x007C) { op_BOOL_I_TO_SR(1);        break; }// Checked     
-          if ((first_opcode&0x0FFF)==0x0A3C) { op_BOOL_I_TO_CCR(3);       break; }// Checked
-          if ((first_opcode&0x0FFF)==0x0A7C) { op_BOOL_I_TO_SR(3);        break; }// Checked
-          if ((first_opcode&0x0FFF)==0x023C) { op_BOOL_I_TO_CCR(2);       break; }// Checked
-          if ((first_opcode&0x0FFF)==0x027C) { op_BOOL_I_TO_SR(2);        break; }// Checked
-          if ((first_opcode&0x0FC0)==0x0800) { op_BMOD(0x31);             break; }// Checked
-          if ((first_opcode&0x0FC0)==0x0840) { op_BMOD(0x21);             break; }// Checked
-          if ((first_opcode&0x0FC0)==0x0880) { op_BMOD(0x11);             break; }// Checked
-          if ((first_opcode&0x0FC0)==0x08C0) { op_BMOD(0x01);             break; }// Checked
-          if ((first_opcode&0x0138)==0x0108) { op_MOVEP();                break; }// Checked
-          if ((first_opcode&0x0F00)==0x0A00) { op_BOOL_I(3);              break; }// Checked
-          if ((first_opcode&0x0F00)==0x0000) { op_BOOL_I(1);              break; }// Checked
-          if ((first_opcode&0x0F00)==0x0200) { op_BOOL_I(2);              break; }// Checked
-          if ((first_opcode&0x0F00)==0x0400) { op_ADDSUBI(0);             break; }// Checked
-          if ((first_opcode&0x0F00)==0x0600) { op_ADDSUBI(1);             break; }// Checked
-          if ((first_opcode&0x0F00)==0x0C00) { op_BOOL_I(4);              break; }// Checked         
-          if ((first_opcode&0x01C0)==0x0100) { op_BMOD(0x30);             break; }// Checked
-          if ((first_opcode&0x01C0)==0x0140) { op_BMOD(0x20);             break; }// Checked
-          if ((first_opcode&0x01C0)==0x0180) { op_BMOD(0x10);             break; }// Checked
-          if ((first_opcode&0x01C0)==0x01C0) { op_BMOD(0x00);             break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x1000):  case (0x2000):  case (0x3000):                                                                             
-                                             {   op_MOVE();               break; }// Checked
-                                                                                                                                   
-                                                                                                                                   
-         case (0x4000):                                                                                                             
-           if ((first_opcode&0x0FC0)==0x00C0) { op_MOVE_FROM_SR();          break; }// Checked
-           if ((first_opcode&0x0FC0)==0x04C0) { op_MOVE_TO_CCR();           break; }// Checked
-           if ((first_opcode&0x0FC0)==0x06C0) { op_MOVE_TO_SR();            break; }// Checked
-           if ((first_opcode&0x0F00)==0x0000) { op_NEGS(3);                 break; }// Checked
-           if ((first_opcode&0x0F00)==0x0200) { op_NEGS(4);                 break; }// Checked
-           if ((first_opcode&0x0F00)==0x0400) { op_NEGS(2);                 break; }// Checked
-           if ((first_opcode&0x0F00)==0x0600) { op_NEGS(1);                 break; }// Checked
-           if ((first_opcode&0x0FB8)==0x0880) { op_EXT();                   break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0800) { op_NBCD();                  break; }// Checked
-           if ((first_opcode&0x0FF8)==0x0840) { op_SWAP();                  break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0840) { op_PEA();                   break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0AFC) { Exception_Handler(4);       break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0AC0) { op_TAS();                   break; }// Checked
-           if ((first_opcode&0x0F00)==0x0A00) { op_TST();                   break; }// Checked
-           if ((first_opcode&0x0FF0)==0x0E40) { op_TRAP();                  break; }// Checked
-           if ((first_opcode&0x0FF8)==0x0E50) { op_LINK();                  break; }// Checked
-           if ((first_opcode&0x0FF8)==0x0E58) { op_UNLK();                  break; }// Checked
-           if ((first_opcode&0x0FF0)==0x0E60) { op_MOVE_USP();              break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E71) { /* Do Nothing */            break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E70) { op_RESET();                 break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E72) { op_STOP();                  break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E73) { op_RTE();                   break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E75) { op_RTS();                   break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E76) { op_TRAPV();                 break; }// Checked
-           if ((first_opcode&0x0FFF)==0x0E77) { op_RTR();                   break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0E80) { op_JSR();                   break; }// Checked
-           if ((first_opcode&0x0FC0)==0x0EC0) { op_JMP();                   break; }// Checked
-           if ((first_opcode&0x0B80)==0x0880) { op_MOVEM();                 break; }// Checked
-           if ((first_opcode&0x01C0)==0x01C0) { op_LEA();                   break; }// Checked
-           if ((first_opcode&0x01C0)==0x0180) { op_CHK();                   break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x5000):                                                                                                             
-           if ((first_opcode&0x00F8)==0x00C8) { op_dBCC();                  break; }// Checked
-           if ((first_opcode&0x00C0)==0x00C0) { op_SCC();                   break; }// Checked
-           if ((first_opcode&0x0100)==0x0000) { op_ADDSUBQ(1);              break; }// Checked
-           if ((first_opcode&0x0100)==0x0100) { op_ADDSUBQ(0);              break; }// Checked
-           Exception_Handler(4);                                                     
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x6000):                                                                                                             
-           if ((first_opcode&0x0F00)==0x0100) { op_BSR();                   break; }// Checked         
-           if ((first_opcode&0x0000)==0x0000) { op_BCC();                   break; }// Checked 
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x7000):                                                                                                             
-           if ((first_opcode&0x0100)==0x0000) { op_MOVEQ();                 break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x8000):                                                                                                             
-           if ((first_opcode&0x01C0)==0x00C0) { op_DIVU();                  break; }// Checked
-           if ((first_opcode&0x01C0)==0x01C0) { op_DIVS();                  break; }// Checked
-           if ((first_opcode&0x01F0)==0x0100) { op_xBCD(1);                 break; }// Checked
-           if ((first_opcode&0x0000)==0x0000) { op_BOOL(1);                 break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0x9000):                                                                                                             
-           if ((first_opcode&0x00C0)==0x00C0) { op_ADDSUBA(0);              break; }// Checked
-           if ((first_opcode&0x0130)==0x0100) { op_ADDSUBX(0);              break; }// Checked         
-           if ((first_opcode&0x0000)==0x0000) { op_ADDSUB(0);               break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                     
-         case (0xA000):   {  Exception_Handler(10);                         break; }// Checked
-                                                                                                                                   
-         case (0xB000):                                                                                                             
-           if ((first_opcode&0x00C0)==0x00C0) { op_CMPA();                  break; }// Checked
-           if ((first_opcode&0x0138)==0x0108) { op_CMPM();                  break; }// Checked
-           if ((first_opcode&0x0100)==0x0100) { op_BOOL(3);                 break; }// Checked
-           if ((first_opcode&0x0100)==0x0000) { op_BOOL(4);                 break; }// Checked
-           Exception_Handler(4);                                                   
-           break;                                                                   
-                                                                                   
-         case (0xC000):                                                             
-           if ((first_opcode&0x01C0)==0x00C0) { op_MULU();                  break; }// Checked
-           if ((first_opcode&0x01C0)==0x01C0) { op_MULS();                  break; }// Checked
-           if ((first_opcode&0x01F0)==0x0100) { op_xBCD(0);                 break; }// Checked
-           if ((first_opcode&0x0130)==0x0100) { op_EXG();                   break; }// Checked
-           if ((first_opcode&0x0000)==0x0000) { op_BOOL(2);                 break; }// Checked
-           Exception_Handler(4);                                                                                                   
-           break;                                                                                                                   
-                                                                                                                                   
-         case (0xD000):                                                                                                             
-           if ((first_opcode&0x00C0)==0x00C0) { op_ADDSUBA(1);              break; }// Checked
-           if ((first_opcode&0x0130)==0x0100) { op_ADDSUBX(1);              break; }// Checked
-           if ((first_opcode&0x0000)==0x0000) { op_ADDSUB(1);               break; }// Checked
-           Exception_Handler(4);                                                   
-           break;                                                                   
-                                                                                   
-         case (0xE000):                                                             
-           if ((first_opcode&0x0FC0)==0x01C0) { op_xSL(0,1);                break; }// Checked  // MEMORY Left
-           if ((first_opcode&0x0FC0)==0x03C0) { op_xSL(0,2);                break; }// Checked
-           if ((first_opcode&0x0FC0)==0x05C0) { op_ROXL(0);                 break; }// Checked
-           if ((first_opcode&0x0FC0)==0x07C0) { op_ROL(0);                  break; }// Checked
-       
-           if ((first_opcode&0x0FC0)==0x00C0) { op_xSR(1,2);                break; }// Checked  // MEMORY Right
-           if ((first_opcode&0x0FC0)==0x02C0) { op_xSR(2,2);                break; }// Checked
-           if ((first_opcode&0x0FC0)==0x04C0) { op_ROXR(0);                 break; }// Checked
-           if ((first_opcode&0x0FC0)==0x06C0) { op_ROR(0);                  break; }// Checked
-                                                                                   
-           if ((first_opcode&0x0118)==0x0100) { op_xSL(1,1);                break; }// Checked  // REGISTER Left
-           if ((first_opcode&0x0118)==0x0108) { op_xSL(1,2);                break; }// Checked
-           if ((first_opcode&0x0118)==0x0110) { op_ROXL(1);                 break; }// Checked
-           if ((first_opcode&0x0118)==0x0118) { op_ROL(1);                  break; }// Checked 
-       
-           if ((first_opcode&0x0118)==0x0000) { op_xSR(1,1);                break; }// Checked  // REGISTER Right 
-           if ((first_opcode&0x0118)==0x0008) { op_xSR(2,1);                break; }// Checked
-           if ((first_opcode&0x0118)==0x0010) { op_ROXR(1);                 break; }// Checked
-           if ((first_opcode&0x0118)==0x0018) { op_ROR(1);                  break; }// Checked 
-           Exception_Handler(4);       
-           break;
-           
-         case (0xF000):                       { Exception_Handler(11);      break; }// Checked
-   
-      default: ;
+        case OPC_BOOL_I_TO_CCR_1:     op_BOOL_I_TO_CCR(1);       break;
+        case OPC_BOOL_I_TO_SR_1:      op_BOOL_I_TO_SR(1);        break;
+        case OPC_BOOL_I_TO_CCR_3:     op_BOOL_I_TO_CCR(3);       break;
+        case OPC_BOOL_I_TO_SR_3:      op_BOOL_I_TO_SR(3);        break;
+        case OPC_BOOL_I_TO_CCR_2:     op_BOOL_I_TO_CCR(2);       break;
+        case OPC_BOOL_I_TO_SR_2:      op_BOOL_I_TO_SR(2);        break;
+        case OPC_BMOD_31:             op_BMOD(0x31);             break;
+        case OPC_BMOD_21:             op_BMOD(0x21);             break;
+        case OPC_BMOD_11:             op_BMOD(0x11);             break;
+        case OPC_BMOD_01:             op_BMOD(0x01);             break;
+        case OPC_MOVEP:               op_MOVEP();                break;
+        case OPC_BOOL_I_3:            op_BOOL_I(3);              break;
+        case OPC_BOOL_I_1:            op_BOOL_I(1);              break;
+        case OPC_BOOL_I_2:            op_BOOL_I(2);              break;
+        case OPC_ADDSUBI_0:           op_ADDSUBI(0);             break;
+        case OPC_ADDSUBI_1:           op_ADDSUBI(1);             break;
+        case OPC_BOOL_I_4:            op_BOOL_I(4);              break;
+        case OPC_BMOD_30:             op_BMOD(0x30);             break;
+        case OPC_BMOD_20:             op_BMOD(0x20);             break;
+        case OPC_BMOD_10:             op_BMOD(0x10);             break;
+        case OPC_BMOD_00:             op_BMOD(0x00);             break;
+        case OPC_MOVE:                op_MOVE();                 break;
+        case OPC_MOVE_FROM_SR:        op_MOVE_FROM_SR();         break;
+        case OPC_MOVE_TO_CCR:         op_MOVE_TO_CCR();          break;
+        case OPC_MOVE_TO_SR:          op_MOVE_TO_SR();           break;
+        case OPC_NEGS_3:              op_NEGS(3);                break;
+        case OPC_NEGS_4:              op_NEGS(4);                break;
+        case OPC_NEGS_2:              op_NEGS(2);                break;
+        case OPC_NEGS_1:              op_NEGS(1);                break;
+        case OPC_EXT:                 op_EXT();                  break;
+        case OPC_NBCD:                op_NBCD();                 break;
+        case OPC_SWAP:                op_SWAP();                 break;
+        case OPC_PEA:                 op_PEA();                  break;
+        case OPC_TAS:                 op_TAS();                  break;
+        case OPC_TST:                 op_TST();                  break;
+        case OPC_TRAP:                op_TRAP();                 break;
+        case OPC_LINK:                op_LINK();                 break;
+        case OPC_UNLK:                op_UNLK();                 break;
+        case OPC_MOVE_USP:            op_MOVE_USP();             break;
+        case OPC_NOP:                 /* Do Nothing */           break;
+        case OPC_RESET:               op_RESET();                break;
+        case OPC_STOP:                op_STOP();                 break;
+        case OPC_RTE:                 op_RTE();                  break;
+        case OPC_RTS:                 op_RTS();                  break;
+        case OPC_TRAPV:               op_TRAPV();                break;
+        case OPC_RTR:                 op_RTR();                  break;
+        case OPC_JSR:                 op_JSR();                  break;
+        case OPC_JMP:                 op_JMP();                  break;
+        case OPC_MOVEM:               op_MOVEM();                break;
+        case OPC_LEA:                 op_LEA();                  break;
+        case OPC_CHK:                 op_CHK();                  break;
+        case OPC_DBCC:                op_dBCC();                 break;
+        case OPC_SCC:                 op_SCC();                  break;
+        case OPC_ADDSUBQ_1:           op_ADDSUBQ(1);             break;
+        case OPC_ADDSUBQ_0:           op_ADDSUBQ(0);             break;
+        case OPC_BSR:                 op_BSR();                  break;
+        case OPC_BCC:                 op_BCC();                  break;
+        case OPC_MOVEQ:               op_MOVEQ();                break;
+        case OPC_DIVU:                op_DIVU();                 break;
+        case OPC_DIVS:                op_DIVS();                 break;
+        case OPC_XBCD_1:              op_xBCD(1);                break;
+        case OPC_BOOL_1:              op_BOOL(1);                break;
+        case OPC_ADDSUBA_0:           op_ADDSUBA(0);             break;
+        case OPC_ADDSUBX_0:           op_ADDSUBX(0);             break;
+        case OPC_ADDSUB_0:            op_ADDSUB(0);              break;
+        case OPC_LINE_A:              Exception_Handler(10);     break;
+        case OPC_CMPA:                op_CMPA();                 break;
+        case OPC_CMPM:                op_CMPM();                 break;
+        case OPC_BOOL_3:              op_BOOL(3);                break;
+        case OPC_BOOL_4:              op_BOOL(4);                break;
+        case OPC_MULU:                op_MULU();                 break;
+        case OPC_MULS:                op_MULS();                 break;
+        case OPC_XBCD_0:              op_xBCD(0);                break;
+        case OPC_EXG:                 op_EXG();                  break;
+        case OPC_BOOL_2:              op_BOOL(2);                break;
+        case OPC_ADDSUBA_1:           op_ADDSUBA(1);             break;
+        case OPC_ADDSUBX_1:           op_ADDSUBX(1);             break;
+        case OPC_ADDSUB_1:            op_ADDSUB(1);              break;
+        case OPC_XSL_0_1:             op_xSL(0,1);               break;
+        case OPC_XSL_0_2:             op_xSL(0,2);               break;
+        case OPC_ROXL_0:              op_ROXL(0);                break;
+        case OPC_ROL_0:               op_ROL(0);                 break;
+        case OPC_XSR_1_2:             op_xSR(1,2);               break;
+        case OPC_XSR_2_2:             op_xSR(2,2);               break;
+        case OPC_ROXR_0:              op_ROXR(0);                break;
+        case OPC_ROR_0:               op_ROR(0);                 break;
+        case OPC_XSL_1_1:             op_xSL(1,1);               break;
+        case OPC_XSL_1_2:             op_xSL(1,2);               break;
+        case OPC_ROXL_1:              op_ROXL(1);                break;
+        case OPC_ROL_1:               op_ROL(1);                 break;
+        case OPC_XSR_1_1:             op_xSR(1,1);               break;
+        case OPC_XSR_2_1:             op_xSR(2,1);               break;
+        case OPC_ROXR_1:              op_ROXR(1);                break;
+        case OPC_ROR_1:               op_ROR(1);                 break;
+        case OPC_LINE_F:              Exception_Handler(11);     break;
+        default:                      Exception_Handler(4);      break;
      }
+     HOST_INSTRUCTION_DONE();
 
 
      // Process Trace if flag is set, but don't allow if last opcode caused ILLEGAL or PIVILEGE exception
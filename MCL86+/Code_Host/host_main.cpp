@@ -0,0 +1,174 @@
+//
+//
+//  File Name   :  host_main.cpp
+//  Used on     :  MCL86+ host benchmark build
+//  Author      :  Ted Fried, MicroCore Labs
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//   
+//  Runs the unmodified MCL86+ execution unit on Linux against a simulated
+//  PC/XT memory and IO map, then reports emulated instructions per second and
+//  clocks per instruction. The BIOS is the Test_Image selected in the sketch.
+//
+//  Build:   g++ -O2 -DHOST_BUILD -I. host_main.cpp -o mcl86_host
+//
+//  Usage:   ./mcl86_host [-c clocks] [-t]
+//
+//      -c   Number of 8088 clocks to run                   (default 100000000)
+//      -t   Raise INTR type 8 every 262144 clocks like the 8253 timer tick
+//
+//  Simulated map:
+//      00000-BFFFF  RAM  (640KB plus video RAM)
+//      C0000-FFFFF  ROM  - reads 0xFF except for Test_Image at the top of memory
+//      IO ports     Read back the last value written, 0xFF if never written
+//      Port 0x3DA   CGA/MDA status toggles the retrace bits on every read
+//      Port 0x80    POST code, reported at the end of the run
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Ted Fried
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_bus.h"
+#include "../Code_Maximum_Mode/MCL86_Plus.ino"
+
+
+#define HOST_RAM_TOP        0xC0000
+#define HOST_TIMER_PERIOD   262144                  // 65536 8253 counts at CLK/4
+
+uint8_t  host_memory[0x100000];
+uint8_t  host_io[0x10000];
+
+uint8_t  host_stop=0;
+uint8_t  host_timer_enable=0;
+uint8_t  host_intr=0;
+uint8_t  host_post_code=0xFF;
+uint8_t  host_retrace=0;
+uint64_t host_instructions=0;
+uint64_t host_clocks=0;
+uint64_t host_clock_budget=100000000;
+uint64_t host_next_tick=HOST_TIMER_PERIOD;
+
+
+// -------------------------------------------------
+// Simulated CLK and input pins
+// -------------------------------------------------
+void host_clock_rising_edge() {
+    return;
+}
+
+uint32_t host_clock_falling_edge() {
+    uint32_t gpio6_data = 0x01000000;                               // READY is always high
+
+    host_clocks++;
+    if (host_clocks >= host_clock_budget)  host_stop=1;
+
+    if (host_timer_enable==1 && host_clocks >= host_next_tick)  {
+        host_intr=1;
+        host_next_tick = host_next_tick + HOST_TIMER_PERIOD;
+    }
+
+    if (host_intr==1)  gpio6_data = gpio6_data | 0x04000000;        // INTR
+    if (host_stop==1)  gpio6_data = gpio6_data | 0x02000000;        // RESET releases a HLT so loop() can return
+    return gpio6_data;
+}
+
+
+// -------------------------------------------------
+// Simulated memory and IO map
+// -------------------------------------------------
+uint8_t host_bus_read(uint8_t biu_operation, uint32_t local_address) {
+
+    switch (biu_operation&0xF)  {
+        case INTERRUPT_ACK:  host_intr=0;  return 0x08;
+        case IO_READ_BYTE:   if ((local_address&0xFFFF)==0x3DA || (local_address&0xFFFF)==0x3BA)  {
+                                 host_retrace = host_retrace ^ 0x09;                    // Toggle video retrace status
+                                 return host_retrace;
+                             }
+                             return host_io[local_address&0xFFFF];
+        default:             return host_memory[local_address&0xFFFFF];
+    }
+}
+
+void host_bus_write(uint8_t biu_operation, uint32_t local_address, uint8_t local_data) {
+
+    if ((biu_operation&0xF)==IO_WRITE_BYTE)  {
+        host_io[local_address&0xFFFF] = local_data;
+        if ((local_address&0xFFFF)==0x80)  host_post_code = local_data;
+    }
+    else if (local_address < HOST_RAM_TOP)  {
+        host_memory[local_address] = local_data;
+    }
+    return;
+}
+
+
+// -------------------------------------------------
+// Benchmark driver
+// -------------------------------------------------
+int main(int argc, char *argv[]) {
+    struct timespec start_time, end_time;
+    double seconds;
+
+    for (int i=1 ; i<argc ; i++)  {
+             if (strcmp(argv[i],"-c")==0 && i+1<argc)  host_clock_budget = strtoull(argv[++i], NULL, 0);
+        else if (strcmp(argv[i],"-t")==0)              host_timer_enable = 1;
+        else  { printf("Usage: %s [-c clocks] [-t]\n", argv[0]);  return 1; }
+    }
+
+    memset(host_memory+HOST_RAM_TOP, 0xFF, 0x100000-HOST_RAM_TOP);
+    memcpy(host_memory+0x100000-sizeof(Test_Image), Test_Image, sizeof(Test_Image));
+    memset(host_io, 0xFF, sizeof(host_io));
+
+    setup();
+
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    loop();
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+    seconds = (end_time.tv_sec-start_time.tv_sec) + (end_time.tv_nsec-start_time.tv_nsec)/1e9;
+
+    printf("MCL86+ host benchmark\n");
+    printf("  clocks                  : %llu\n",  (unsigned long long)host_clocks);
+    printf("  instructions            : %llu\n",  (unsigned long long)host_instructions);
+    printf("  host seconds            : %.3f\n",  seconds);
+    printf("  instructions per second : %.0f\n",  host_instructions/seconds);
+    printf("  clocks per instruction  : %.2f\n",  host_instructions ? (double)host_clocks/host_instructions : 0.0);
+    printf("  emulated clock rate     : %.2f MHz\n", host_clocks/seconds/1e6);
+    printf("  final CS:IP             : %04X:%04X\n", register_cs, register_ip);
+    printf("  last POST code          : %02X\n",  host_post_code);
+    return 0;
+}
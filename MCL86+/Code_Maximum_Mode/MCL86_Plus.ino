@@ -25,6 +25,12 @@
 // Revision 3 7/2/2025
 // Fixed a number of bugs found when running core against the MartyPC 8086 test suite.
 //
+// Revision 4 10/18/2026
+// Added HOST_BUILD bus abstraction so the core can be compiled and benchmarked on Linux - see ../Code_Host
+//
+// Revision 5 10/18/2026
+// Opcode dispatch through a handler table, ModRM decode table, prefixes handled within execute_new_instruction
+//
 //------------------------------------------------------------------------
 //
 // Copyright (c) 2022 Ted Fried
@@ -52,6 +58,10 @@
 
 #include <stdint.h>
 
+#ifdef HOST_BUILD
+#include "host_bus.h"       // Teensy stand-ins and the simulated 8088 bus used by the Linux benchmark build
+#endif
+
 
 // Teensy 4.1 pin assignments
 //
@@ -330,10 +340,14 @@ void setup() {
 // Wait for the CLK rising edge  
 // -------------------------------------------------         
 inline void wait_for_CLK_rising_edge() {
-      uint32_t  gpio6_data=0;
+#ifdef HOST_BUILD
+    host_clock_rising_edge();
+#else
+    uint32_t  gpio6_data=0;
 
     while ( (GPIO6_DR&0x08000000) != 0) {}                                      // First ensure clock is at a low level
     do { gpio6_data = GPIO6_DR;   } while ( (gpio6_data&0x08000000) == 0);      // Then poll for the first instance where clock is not low
+#endif
     return;
 }
     
@@ -348,10 +362,14 @@ inline void wait_for_CLK_falling_edge() {
     if (nmi_d==0 && direct_nmi!=0) nmi_latched=1;                               // Latch rising edge of NMI
     nmi_d = direct_nmi;
 
+#ifdef HOST_BUILD
+    GPIO6_raw_data = host_clock_falling_edge();                                 // Simulated CLK, READY, INTR, NMI and RESET
+#else
     while ( (GPIO6_DR&0x08000000) == 0) {}                                      // First ensure clock is at a high level
     do {    } while ( (GPIO6_DR&0x08000000) != 0);                              // Then poll for the first instance where clock is not high
     
     GPIO6_raw_data = GPIO6_DR;                                                  // Store slightly-delayed version of GPIO6 in a global register
+#endif
     direct_nmi     = (GPIO6_raw_data&0x00010000);         
     return;
 }
@@ -447,11 +465,18 @@ inline uint8_t BIU_Bus_Cycle(uint8_t biu_operation, uint32_t local_address , uin
     interrupts();                       // Re-enable Teensy's interrupts so the UART and downloading works
 
     if (read_cycle==0) {
+#ifdef HOST_BUILD
+        host_bus_write(biu_operation, local_address, local_data);
+#endif
         return 0xEE; 
     }
     else
     {
+#ifdef HOST_BUILD
+        joe = host_bus_read(biu_operation, local_address);
+#else
         joe = read_data_array[ (GPIO6_raw_data>>16) ];  // Read the 8088 bus data, re-arranging bits through read_data_array
+#endif
 
 
 
@@ -687,13 +712,13 @@ void opcode_0x9E()  { clock_counter=4;  register_flags=0x02| ((register_flags&0x
 // ------------------------------------------------------
 // Set Prefixes
 // ------------------------------------------------------
-void opcode_0xF0()  { clock_counter=2;  prefix_flags=(prefix_flags|0x01); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF0 - LOCK  Prefix  
-void opcode_0xF2()  { clock_counter=2;  prefix_flags=(prefix_flags|0x02); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF2 - REPNZ Prefix
-void opcode_0xF3()  { clock_counter=2;  prefix_flags=(prefix_flags|0x04); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF3 - REPZ  Prefix
-void opcode_0x26()  { clock_counter=2;  prefix_flags=(prefix_flags|0x10); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x26 - Segment Override Prefix - ES
-void opcode_0x2E()  { clock_counter=2;  prefix_flags=(prefix_flags|0x20); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x2E - Segment Override Prefix - CS
-void opcode_0x36()  { clock_counter=2;  prefix_flags=(prefix_flags|0x40); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x36 - Segment Override Prefix - SS
-void opcode_0x3E()  { clock_counter=2;  prefix_flags=(prefix_flags|0x80); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x3E - Segment Override Prefix - DS
+void opcode_0xF0()  { clock_counter=clock_counter+2;  prefix_flags=(prefix_flags|0x01); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF0 - LOCK  Prefix  
+void opcode_0xF2()  { clock_counter=clock_counter+2;  prefix_flags=(prefix_flags|0x02); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF2 - REPNZ Prefix
+void opcode_0xF3()  { clock_counter=clock_counter+2;  prefix_flags=(prefix_flags|0x04); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF3 - REPZ  Prefix
+void opcode_0x26()  { clock_counter=clock_counter+2;  prefix_flags=(prefix_flags|0x10); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x26 - Segment Override Prefix - ES
+void opcode_0x2E()  { clock_counter=clock_counter+2;  prefix_flags=(prefix_flags|0x20); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x2E - Segment Override Prefix - CS
+void opcode_0x36()  { clock_counter=clock_counter+2;  prefix_flags=(prefix_flags|0x40); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x36 - Segment Override Prefix - SS
+void opcode_0x3E()  { clock_counter=clock_counter+2;  prefix_flags=(prefix_flags|0x80); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x3E - Segment Override Prefix - DS
 
 
 void opcode_0x98()  { clock_counter=2;  register_ax = Sign_Extended_Byte(register_ax);  return;                       }  // 0x98 - CBW - Sign extend AL Register into AH Register 
@@ -884,10 +909,67 @@ void Write_Register(uint16_t local_regsel , uint16_t local_data )  {
     return;
 }
 
+// ------------------------------------------------------
+// ModRM decode table
+//   Indexed by the ModRM byte. Gives the default segment, the number of displacement
+//   bytes, the EA calculation clocks and the two registers summed to form the EA.
+// ------------------------------------------------------
+struct modrm_decode_entry  {
+    uint8_t    ea_is_a_register;        // MOD=11
+    uint8_t    ea_segment;              // Default segment, may be replaced by a segment override prefix
+    uint8_t    ea_displacement;         // 0, 1 or 2 displacement bytes follow the ModRM byte
+    uint8_t    ea_clocks;               // Effective address calculation clocks
+    uint16_t * ea_base;                 // EA = *ea_base + *ea_index + displacement
+    uint16_t * ea_index;
+};
+
+uint16_t register_zero=0;
+
+constexpr modrm_decode_entry modrm_decode_table[256] = {
+    // MOD=00  -  [BX+SI]  [BX+DI]  [BP+SI]  [BP+DI]  [SI]  [DI]  [disp16]  [BX]
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x00 - 0x07
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x08 - 0x0F
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x10 - 0x17
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x18 - 0x1F
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x20 - 0x27
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x28 - 0x2F
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x30 - 0x37
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x38 - 0x3F
+    // MOD=01  -  Same registers plus a sign-extended 8-bit displacement, R/M=110 is [BP+disp8]
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x40 - 0x47
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x48 - 0x4F
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x50 - 0x57
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x58 - 0x5F
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x60 - 0x67
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x68 - 0x6F
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x70 - 0x77
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x78 - 0x7F
+    // MOD=10  -  Same registers plus a 16-bit displacement, R/M=110 is [BP+disp16]
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0x80 - 0x87
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0x88 - 0x8F
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0x90 - 0x97
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0x98 - 0x9F
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0xA0 - 0xA7
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0xA8 - 0xAF
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0xB0 - 0xB7
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0xB8 - 0xBF
+    // MOD=11  -  R/M selects a register
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xC0 - 0xC7
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xC8 - 0xCF
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xD0 - 0xD7
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xD8 - 0xDF
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xE0 - 0xE7
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xE8 - 0xEF
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xF0 - 0xF7
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero}     // 0xF8 - 0xFF
+};
+
+
 // ------------------------------------------------------
 // Calculate the Effective Address 
 // ------------------------------------------------------
 void Calculate_EA()  {
+    const modrm_decode_entry * modrm_decode;
     
     word_operation = (0x01&opcode_first_byte);                      // Isolate the R/W bit from the opcode
     opcode_second_byte = pfq_fetch_byte();                          // Fetch the MOD/REG/RM byte from the prefetch queue
@@ -900,47 +982,16 @@ void Calculate_EA()  {
     REG_field_table = word_operation<<3 |  REG_field;               // Concatinate W and MOD=11 register field bits
     RM_field_table  = word_operation<<3 |  R_M_field;               // Concatinate W and R/M register field bits
 
-    ea_is_a_register=0; // Default
-
-
-    if (MOD_field==3)  ea_is_a_register=1;    
+    modrm_decode = &modrm_decode_table[opcode_second_byte];
+    ea_is_a_register = modrm_decode->ea_is_a_register;
     
-    else if (MOD_field==0)  {
-        switch (R_M_field) {
-            case 0x00:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_si;                                         clock_counter=clock_counter+7;   break;
-            case 0x01:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_di;                                         clock_counter=clock_counter+8;   break;
-            case 0x02:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_si;                                         clock_counter=clock_counter+8;   break;
-            case 0x03:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_di;                                         clock_counter=clock_counter+7;   break;
-            case 0x04:  ea_segment=SEGMENT_DS;  ea_address = register_si;                                                       clock_counter=clock_counter+5;   break;
-            case 0x05:  ea_segment=SEGMENT_DS;  ea_address = register_di;                                                       clock_counter=clock_counter+5;   break;
-            case 0x06:  ea_segment=SEGMENT_DS;  ea_address = pfq_fetch_word();                                                  clock_counter=clock_counter+6;   break;
-            case 0x07:  ea_segment=SEGMENT_DS;  ea_address = register_bx;                                                       clock_counter=clock_counter+5;   break;
-        }
+    if (ea_is_a_register==0)  {
+        ea_segment = modrm_decode->ea_segment;
+        ea_address = *modrm_decode->ea_base + *modrm_decode->ea_index;
+        if      (modrm_decode->ea_displacement==1)  ea_address = ea_address + Sign_Extended_Byte(pfq_fetch_byte());
+        else if (modrm_decode->ea_displacement==2)  ea_address = ea_address + pfq_fetch_word();
+        clock_counter = clock_counter + modrm_decode->ea_clocks;
     }
-    else if (MOD_field==1)  {
-        switch (R_M_field) {
-            case 0x00:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_si + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+11;  break;
-            case 0x01:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_di + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+12;  break;
-            case 0x02:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_si + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+12;  break;
-            case 0x03:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_di + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+11;  break;
-            case 0x04:  ea_segment=SEGMENT_DS;  ea_address = register_si               + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+9;   break;
-            case 0x05:  ea_segment=SEGMENT_DS;  ea_address = register_di               + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+9;   break;
-            case 0x06:  ea_segment=SEGMENT_SS;  ea_address = register_bp               + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+9;   break;
-            case 0x07:  ea_segment=SEGMENT_DS;  ea_address = register_bx               + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+9;   break;
-        }
-    }   
-    else if (MOD_field==2)  {
-        switch (R_M_field) {
-            case 0x00:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_si + pfq_fetch_word();                      clock_counter=clock_counter+11;  break;
-            case 0x01:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_di + pfq_fetch_word();                      clock_counter=clock_counter+12;  break;
-            case 0x02:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_si + pfq_fetch_word();                      clock_counter=clock_counter+12;  break;
-            case 0x03:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_di + pfq_fetch_word();                      clock_counter=clock_counter+11;  break;
-            case 0x04:  ea_segment=SEGMENT_DS;  ea_address = register_si               + pfq_fetch_word();                      clock_counter=clock_counter+9;   break;
-            case 0x05:  ea_segment=SEGMENT_DS;  ea_address = register_di               + pfq_fetch_word();                      clock_counter=clock_counter+9;   break;
-            case 0x06:  ea_segment=SEGMENT_SS;  ea_address = register_bp               + pfq_fetch_word();                      clock_counter=clock_counter+9;   break;
-            case 0x07:  ea_segment=SEGMENT_DS;  ea_address = register_bx               + pfq_fetch_word();                      clock_counter=clock_counter+9;   break;
-        }
-    }   
     return ;
 }
 
@@ -2328,6 +2379,7 @@ void opcode_0xF7()  {
     int32_t  signed_local_numr;
     int16_t  signed_local_divr;
     uint64_t local_overflow_test;
+    int32_t  local_overflow_test2;
 
 
     Calculate_EA();
@@ -2628,273 +2680,72 @@ void opcode_0xC5()  {
 } 
     
 
+// ------------------------------------------------------------------------------------------------------------
+// Opcode handler table - indexed by the first byte of the opcode
+// ------------------------------------------------------------------------------------------------------------
+constexpr void (*opcode_table[256])() = {
+    opcode_0x00 , opcode_0x01 , opcode_0x02 , opcode_0x03 , opcode_0x04 , opcode_0x05 , opcode_0x06 , opcode_0x07 ,   // 0x00
+    opcode_0x08 , opcode_0x09 , opcode_0x0A , opcode_0x0B , opcode_0x0C , opcode_0x0D , opcode_0x0E , opcode_0x0F ,   // 0x08
+    opcode_0x10 , opcode_0x11 , opcode_0x12 , opcode_0x13 , opcode_0x14 , opcode_0x15 , opcode_0x16 , opcode_0x17 ,   // 0x10
+    opcode_0x18 , opcode_0x19 , opcode_0x1A , opcode_0x1B , opcode_0x1C , opcode_0x1D , opcode_0x1E , opcode_0x1F ,   // 0x18
+    opcode_0x20 , opcode_0x21 , opcode_0x22 , opcode_0x23 , opcode_0x24 , opcode_0x25 , opcode_0x26 , opcode_0x27 ,   // 0x20
+    opcode_0x28 , opcode_0x29 , opcode_0x2A , opcode_0x2B , opcode_0x2C , opcode_0x2D , opcode_0x2E , opcode_0x2F ,   // 0x28
+    opcode_0x30 , opcode_0x31 , opcode_0x32 , opcode_0x33 , opcode_0x34 , opcode_0x35 , opcode_0x36 , opcode_0x37 ,   // 0x30
+    opcode_0x38 , opcode_0x39 , opcode_0x3A , opcode_0x3B , opcode_0x3C , opcode_0x3D , opcode_0x3E , opcode_0x3F ,   // 0x38
+    opcode_0x40 , opcode_0x41 , opcode_0x42 , opcode_0x43 , opcode_0x44 , opcode_0x45 , opcode_0x46 , opcode_0x47 ,   // 0x40
+    opcode_0x48 , opcode_0x49 , opcode_0x4A , opcode_0x4B , opcode_0x4C , opcode_0x4D , opcode_0x4E , opcode_0x4F ,   // 0x48
+    opcode_0x50 , opcode_0x51 , opcode_0x52 , opcode_0x53 , opcode_0x54 , opcode_0x55 , opcode_0x56 , opcode_0x57 ,   // 0x50
+    opcode_0x58 , opcode_0x59 , opcode_0x5A , opcode_0x5B , opcode_0x5C , opcode_0x5D , opcode_0x5E , opcode_0x5F ,   // 0x58
+    opcode_0x70 , opcode_0x71 , opcode_0x72 , opcode_0x73 , opcode_0x74 , opcode_0x75 , opcode_0x76 , opcode_0x77 ,   // 0x60
+    opcode_0x78 , opcode_0x79 , opcode_0x7A , opcode_0x7B , opcode_0x7C , opcode_0x7D , opcode_0x7E , opcode_0x7F ,   // 0x68
+    opcode_0x70 , opcode_0x71 , opcode_0x72 , opcode_0x73 , opcode_0x74 , opcode_0x75 , opcode_0x76 , opcode_0x77 ,   // 0x70
+    opcode_0x78 , opcode_0x79 , opcode_0x7A , opcode_0x7B , opcode_0x7C , opcode_0x7D , opcode_0x7E , opcode_0x7F ,   // 0x78
+    opcode_0x80 , opcode_0x81 , opcode_0x80 , opcode_0x83 , opcode_0x84 , opcode_0x85 , opcode_0x86 , opcode_0x87 ,   // 0x80
+    opcode_0x88 , opcode_0x89 , opcode_0x8A , opcode_0x8B , opcode_0x8C , opcode_0x8D , opcode_0x8E , opcode_0x8F ,   // 0x88
+    opcode_0x90 , opcode_0x91 , opcode_0x92 , opcode_0x93 , opcode_0x94 , opcode_0x95 , opcode_0x96 , opcode_0x97 ,   // 0x90
+    opcode_0x98 , opcode_0x99 , opcode_0x9A , opcode_0x9B , opcode_0x9C , opcode_0x9D , opcode_0x9E , opcode_0x9F ,   // 0x98
+    opcode_0xA0 , opcode_0xA1 , opcode_0xA2 , opcode_0xA3 , opcode_0xA4 , opcode_0xA5 , opcode_0xA6 , opcode_0xA7 ,   // 0xA0
+    opcode_0xA8 , opcode_0xA9 , opcode_0xAA , opcode_0xAB , opcode_0xAC , opcode_0xAD , opcode_0xAE , opcode_0xAF ,   // 0xA8
+    opcode_0xB0 , opcode_0xB1 , opcode_0xB2 , opcode_0xB3 , opcode_0xB4 , opcode_0xB5 , opcode_0xB6 , opcode_0xB7 ,   // 0xB0
+    opcode_0xB8 , opcode_0xB9 , opcode_0xBA , opcode_0xBB , opcode_0xBC , opcode_0xBD , opcode_0xBE , opcode_0xBF ,   // 0xB8
+    opcode_0xC2 , opcode_0xC3 , opcode_0xC2 , opcode_0xC3 , opcode_0xC4 , opcode_0xC5 , opcode_0xC6 , opcode_0xC7 ,   // 0xC0
+    opcode_0xCA , opcode_0xCB , opcode_0xCA , opcode_0xCB , opcode_0xCC , opcode_0xCD , opcode_0xCE , opcode_0xCF ,   // 0xC8
+    opcode_0xD0 , opcode_0xD1 , opcode_0xD2 , opcode_0xD3 , opcode_0xD4 , opcode_0xD5 , opcode_0xD6 , opcode_0xD7 ,   // 0xD0
+    opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 ,   // 0xD8
+    opcode_0xE0 , opcode_0xE1 , opcode_0xE2 , opcode_0xE3 , opcode_0xE4 , opcode_0xE5 , opcode_0xE6 , opcode_0xE7 ,   // 0xE0
+    opcode_0xE8 , opcode_0xE9 , opcode_0xEA , opcode_0xEB , opcode_0xEC , opcode_0xED , opcode_0xEE , opcode_0xEF ,   // 0xE8
+    opcode_0xF0 , opcode_0xF0 , opcode_0xF2 , opcode_0xF3 , opcode_0xF4 , opcode_0xF5 , opcode_0xF6 , opcode_0xF7 ,   // 0xF0
+    opcode_0xF8 , opcode_0xF9 , opcode_0xFA , opcode_0xFB , opcode_0xFC , opcode_0xFD , opcode_0xFE , opcode_0xFF     // 0xF8
+};
+
+#define opcode_is_prefix(op)  ( ((op)&0xE7)==0x26 || ((op)&0xFC)==0xF0 )      // ES: CS: SS: DS: LOCK REPNZ REPZ
+
+
 // ------------------------------------------------------------------------------------------------------------
 // Decode the first byte of the opcode
+//   Prefixes are executed here and the following opcode is dispatched straight away, so interrupts
+//   and the main loop are never entered between a prefix and its instruction.
+//   Each prefix's clocks are spent filling the prefetch queue the same way the main loop spends them
+//   between instructions, so the clock count is unchanged from running the prefix on its own.
 // ------------------------------------------------------------------------------------------------------------
 void execute_new_instruction()  {
     
     opcode_first_byte = pfq_fetch_byte();
-
-    switch (opcode_first_byte)  {
-        
-        case 0x00:  opcode_0x00();   break; 
-        case 0x01:  opcode_0x01();   break; 
-        case 0x02:  opcode_0x02();   break; 
-        case 0x03:  opcode_0x03();   break; 
-        case 0x04:  opcode_0x04();   break; 
-        case 0x05:  opcode_0x05();   break; 
-        case 0x06:  opcode_0x06();   break; 
-        case 0x07:  opcode_0x07();   break; 
-        case 0x08:  opcode_0x08();   break; 
-        case 0x09:  opcode_0x09();   break; 
-        case 0x0A:  opcode_0x0A();   break; 
-        case 0x0B:  opcode_0x0B();   break; 
-        case 0x0C:  opcode_0x0C();   break; 
-        case 0x0D:  opcode_0x0D();   break; 
-        case 0x0E:  opcode_0x0E();   break; 
-        case 0x0F:  opcode_0x0F();   break; 
-        case 0x10:  opcode_0x10();   break; 
-        case 0x11:  opcode_0x11();   break; 
-        case 0x12:  opcode_0x12();   break; 
-        case 0x13:  opcode_0x13();   break; 
-        case 0x14:  opcode_0x14();   break; 
-        case 0x15:  opcode_0x15();   break; 
-        case 0x16:  opcode_0x16();   break; 
-        case 0x17:  opcode_0x17();   break; 
-        case 0x18:  opcode_0x18();   break; 
-        case 0x19:  opcode_0x19();   break; 
-        case 0x1A:  opcode_0x1A();   break; 
-        case 0x1B:  opcode_0x1B();   break; 
-        case 0x1C:  opcode_0x1C();   break; 
-        case 0x1D:  opcode_0x1D();   break; 
-        case 0x1E:  opcode_0x1E();   break; 
-        case 0x1F:  opcode_0x1F();   break; 
-        case 0x20:  opcode_0x20();   break; 
-        case 0x21:  opcode_0x21();   break; 
-        case 0x22:  opcode_0x22();   break; 
-        case 0x23:  opcode_0x23();   break; 
-        case 0x24:  opcode_0x24();   break; 
-        case 0x25:  opcode_0x25();   break; 
-        case 0x26:  opcode_0x26();   break; 
-        case 0x27:  opcode_0x27();   break; 
-        case 0x28:  opcode_0x28();   break; 
-        case 0x29:  opcode_0x29();   break; 
-        case 0x2A:  opcode_0x2A();   break; 
-        case 0x2B:  opcode_0x2B();   break; 
-        case 0x2C:  opcode_0x2C();   break; 
-        case 0x2D:  opcode_0x2D();   break; 
-        case 0x2E:  opcode_0x2E();   break; 
-        case 0x2F:  opcode_0x2F();   break; 
-        case 0x30:  opcode_0x30();   break; 
-        case 0x31:  opcode_0x31();   break; 
-        case 0x32:  opcode_0x32();   break; 
-        case 0x33:  opcode_0x33();   break; 
-        case 0x34:  opcode_0x34();   break; 
-        case 0x35:  opcode_0x35();   break; 
-        case 0x36:  opcode_0x36();   break; 
-        case 0x37:  opcode_0x37();   break; 
-        case 0x38:  opcode_0x38();   break; 
-        case 0x39:  opcode_0x39();   break; 
-        case 0x3A:  opcode_0x3A();   break; 
-        case 0x3B:  opcode_0x3B();   break; 
-        case 0x3C:  opcode_0x3C();   break; 
-        case 0x3D:  opcode_0x3D();   break; 
-        case 0x3E:  opcode_0x3E();   break; 
-        case 0x3F:  opcode_0x3F();   break; 
-        case 0x40:  opcode_0x40();   break; 
-        case 0x41:  opcode_0x41();   break; 
-        case 0x42:  opcode_0x42();   break; 
-        case 0x43:  opcode_0x43();   break; 
-        case 0x44:  opcode_0x44();   break; 
-        case 0x45:  opcode_0x45();   break; 
-        case 0x46:  opcode_0x46();   break; 
-        case 0x47:  opcode_0x47();   break; 
-        case 0x48:  opcode_0x48();   break; 
-        case 0x49:  opcode_0x49();   break; 
-        case 0x4A:  opcode_0x4A();   break; 
-        case 0x4B:  opcode_0x4B();   break; 
-        case 0x4C:  opcode_0x4C();   break; 
-        case 0x4D:  opcode_0x4D();   break; 
-        case 0x4E:  opcode_0x4E();   break; 
-        case 0x4F:  opcode_0x4F();   break; 
-        case 0x50:  opcode_0x50();   break; 
-        case 0x51:  opcode_0x51();   break; 
-        case 0x52:  opcode_0x52();   break; 
-        case 0x53:  opcode_0x53();   break; 
-        case 0x54:  opcode_0x54();   break; 
-        case 0x55:  opcode_0x55();   break; 
-        case 0x56:  opcode_0x56();   break; 
-        case 0x57:  opcode_0x57();   break; 
-        case 0x58:  opcode_0x58();   break; 
-        case 0x59:  opcode_0x59();   break; 
-        case 0x5A:  opcode_0x5A();   break; 
-        case 0x5B:  opcode_0x5B();   break; 
-        case 0x5C:  opcode_0x5C();   break; 
-        case 0x5D:  opcode_0x5D();   break; 
-        case 0x5E:  opcode_0x5E();   break; 
-        case 0x5F:  opcode_0x5F();   break; 
-        case 0x60:  opcode_0x70();   break; 
-        case 0x61:  opcode_0x71();   break; 
-        case 0x62:  opcode_0x72();   break; 
-        case 0x63:  opcode_0x73();   break; 
-        case 0x64:  opcode_0x74();   break; 
-        case 0x65:  opcode_0x75();   break; 
-        case 0x66:  opcode_0x76();   break; 
-        case 0x67:  opcode_0x77();   break; 
-        case 0x68:  opcode_0x78();   break; 
-        case 0x69:  opcode_0x79();   break; 
-        case 0x6A:  opcode_0x7A();   break; 
-        case 0x6B:  opcode_0x7B();   break; 
-        case 0x6C:  opcode_0x7C();   break; 
-        case 0x6D:  opcode_0x7D();   break; 
-        case 0x6E:  opcode_0x7E();   break; 
-        case 0x6F:  opcode_0x7F();   break; 
-        case 0x70:  opcode_0x70();   break; 
-        case 0x71:  opcode_0x71();   break; 
-        case 0x72:  opcode_0x72();   break; 
-        case 0x73:  opcode_0x73();   break; 
-        case 0x74:  opcode_0x74();   break; 
-        case 0x75:  opcode_0x75();   break; 
-        case 0x76:  opcode_0x76();   break; 
-        case 0x77:  opcode_0x77();   break; 
-        case 0x78:  opcode_0x78();   break; 
-        case 0x79:  opcode_0x79();   break; 
-        case 0x7A:  opcode_0x7A();   break; 
-        case 0x7B:  opcode_0x7B();   break; 
-        case 0x7C:  opcode_0x7C();   break; 
-        case 0x7D:  opcode_0x7D();   break; 
-        case 0x7E:  opcode_0x7E();   break; 
-        case 0x7F:  opcode_0x7F();   break; 
-        case 0x80:  opcode_0x80();   break; 
-        case 0x81:  opcode_0x81();   break; 
-        case 0x82:  opcode_0x80();   break; 
-        case 0x83:  opcode_0x83();   break; 
-        case 0x84:  opcode_0x84();   break; 
-        case 0x85:  opcode_0x85();   break; 
-        case 0x86:  opcode_0x86();   break; 
-        case 0x87:  opcode_0x87();   break; 
-        case 0x88:  opcode_0x88();   break; 
-        case 0x89:  opcode_0x89();   break; 
-        case 0x8A:  opcode_0x8A();   break; 
-        case 0x8B:  opcode_0x8B();   break; 
-        case 0x8C:  opcode_0x8C();   break; 
-        case 0x8D:  opcode_0x8D();   break; 
-        case 0x8E:  opcode_0x8E();   break; 
-        case 0x8F:  opcode_0x8F();   break; 
-        case 0x90:  opcode_0x90();   break;   
-        case 0x91:  opcode_0x91();   break;  
-        case 0x92:  opcode_0x92();   break;  
-        case 0x93:  opcode_0x93();   break;  
-        case 0x94:  opcode_0x94();   break;  
-        case 0x95:  opcode_0x95();   break;  
-        case 0x96:  opcode_0x96();   break;  
-        case 0x97:  opcode_0x97();   break;  
-        case 0x98:  opcode_0x98();   break; 
-        case 0x99:  opcode_0x99();   break; 
-        case 0x9A:  opcode_0x9A();   break; 
-        case 0x9B:  opcode_0x9B();   break; 
-        case 0x9C:  opcode_0x9C();   break; 
-        case 0x9D:  opcode_0x9D();   break; 
-        case 0x9E:  opcode_0x9E();   break; 
-        case 0x9F:  opcode_0x9F();   break; 
-        case 0xA0:  opcode_0xA0();   break; 
-        case 0xA1:  opcode_0xA1();   break; 
-        case 0xA2:  opcode_0xA2();   break; 
-        case 0xA3:  opcode_0xA3();   break; 
-        case 0xA4:  opcode_0xA4();   break; 
-        case 0xA5:  opcode_0xA5();   break; 
-        case 0xA6:  opcode_0xA6();   break; 
-        case 0xA7:  opcode_0xA7();   break; 
-        case 0xA8:  opcode_0xA8();   break; 
-        case 0xA9:  opcode_0xA9();   break; 
-        case 0xAA:  opcode_0xAA();   break; 
-        case 0xAB:  opcode_0xAB();   break; 
-        case 0xAC:  opcode_0xAC();   break; 
-        case 0xAD:  opcode_0xAD();   break; 
-        case 0xAE:  opcode_0xAE();   break; 
-        case 0xAF:  opcode_0xAF();   break; 
-        case 0xB0:  opcode_0xB0();   break; 
-        case 0xB1:  opcode_0xB1();   break; 
-        case 0xB2:  opcode_0xB2();   break; 
-        case 0xB3:  opcode_0xB3();   break; 
-        case 0xB4:  opcode_0xB4();   break; 
-        case 0xB5:  opcode_0xB5();   break; 
-        case 0xB6:  opcode_0xB6();   break; 
-        case 0xB7:  opcode_0xB7();   break; 
-        case 0xB8:  opcode_0xB8();   break; 
-        case 0xB9:  opcode_0xB9();   break; 
-        case 0xBA:  opcode_0xBA();   break; 
-        case 0xBB:  opcode_0xBB();   break; 
-        case 0xBC:  opcode_0xBC();   break; 
-        case 0xBD:  opcode_0xBD();   break; 
-        case 0xBE:  opcode_0xBE();   break; 
-        case 0xBF:  opcode_0xBF();   break; 
-        case 0xC0:  opcode_0xC2();   break; 
-        case 0xC1:  opcode_0xC3();   break; 
-        case 0xC2:  opcode_0xC2();   break; 
-        case 0xC3:  opcode_0xC3();   break; 
-        case 0xC4:  opcode_0xC4();   break; 
-        case 0xC5:  opcode_0xC5();   break; 
-        case 0xC6:  opcode_0xC6();   break; 
-        case 0xC7:  opcode_0xC7();   break; 
-        case 0xC8:  opcode_0xCA();   break; 
-        case 0xC9:  opcode_0xCB();   break; 
-        case 0xCA:  opcode_0xCA();   break; 
-        case 0xCB:  opcode_0xCB();   break; 
-        case 0xCC:  opcode_0xCC();   break; 
-        case 0xCD:  opcode_0xCD();   break; 
-        case 0xCE:  opcode_0xCE();   break; 
-        case 0xCF:  opcode_0xCF();   break; 
-        case 0xD0:  opcode_0xD0();   break; 
-        case 0xD1:  opcode_0xD1();   break; 
-        case 0xD2:  opcode_0xD2();   break; 
-        case 0xD3:  opcode_0xD3();   break; 
-        case 0xD4:  opcode_0xD4();   break; 
-        case 0xD5:  opcode_0xD5();   break; 
-        case 0xD6:  opcode_0xD6();   break; 
-        case 0xD7:  opcode_0xD7();   break; 
-        case 0xD8:  opcode_0xD8();   break; 
-        case 0xD9:  opcode_0xD8();   break; 
-        case 0xDA:  opcode_0xD8();   break; 
-        case 0xDB:  opcode_0xD8();   break; 
-        case 0xDC:  opcode_0xD8();   break; 
-        case 0xDD:  opcode_0xD8();   break; 
-        case 0xDE:  opcode_0xD8();   break; 
-        case 0xDF:  opcode_0xD8();   break; 
-        case 0xE0:  opcode_0xE0();   break; 
-        case 0xE1:  opcode_0xE1();   break; 
-        case 0xE2:  opcode_0xE2();   break; 
-        case 0xE3:  opcode_0xE3();   break; 
-        case 0xE4:  opcode_0xE4();   break; 
-        case 0xE5:  opcode_0xE5();   break; 
-        case 0xE6:  opcode_0xE6();   break; 
-        case 0xE7:  opcode_0xE7();   break; 
-        case 0xE8:  opcode_0xE8();   break; 
-        case 0xE9:  opcode_0xE9();   break; 
-        case 0xEA:  opcode_0xEA();   break; 
-        case 0xEB:  opcode_0xEB();   break; 
-        case 0xEC:  opcode_0xEC();   break; 
-        case 0xED:  opcode_0xED();   break; 
-        case 0xEE:  opcode_0xEE();   break; 
-        case 0xEF:  opcode_0xEF();   break; 
-        case 0xF0:  opcode_0xF0();   break; 
-        case 0xF1:  opcode_0xF0();   break; 
-        case 0xF2:  opcode_0xF2();   break; 
-        case 0xF3:  opcode_0xF3();   break; 
-        case 0xF4:  opcode_0xF4();   break; 
-        case 0xF5:  opcode_0xF5();   break;   
-        case 0xF6:  opcode_0xF6();   break;  
-        case 0xF7:  opcode_0xF7();   break;  
-        case 0xF8:  opcode_0xF8();   break;   
-        case 0xF9:  opcode_0xF9();   break;   
-        case 0xFA:  opcode_0xFA();   break;  
-        case 0xFB:  opcode_0xFB();   break;  
-        case 0xFC:  opcode_0xFC();   break;   
-        case 0xFD:  opcode_0xFD();   break;   
-        case 0xFE:  opcode_0xFE();   break;   
-        case 0xFF:  opcode_0xFF();   break;   
-      }
-return;
+    
+    while (opcode_is_prefix(opcode_first_byte))  {
+        opcode_table[opcode_first_byte]();
+        if (prefetch_queue_count<4) pfq_add_byte();
+        while (clock_counter>0)  {
+            wait_for_CLK_falling_edge();
+            if ( (clock_counter>0) && (prefetch_queue_count<4) ) pfq_add_byte();
+        }
+        opcode_first_byte = pfq_fetch_byte();
+    }
+    
+    last_instruction_set_a_prefix=0;
+    pause_interrupts=0;
+    opcode_table[opcode_first_byte]();
+    return;
 }
 
 
@@ -2922,6 +2773,9 @@ return;
 
   while(1) {
     
+#ifdef HOST_BUILD
+      if (host_stop!=0) return;                 // Benchmark clock budget has expired
+#endif
       //clock_counter=0;
       if (direct_reset_raw!=0) reset_sequence();
       
@@ -2952,6 +2806,9 @@ return;
           execute_new_instruction();   
           //clock_counter=0;       
           if (last_instruction_set_a_prefix==0) prefix_flags=0x00;
+#ifdef HOST_BUILD
+          if (last_instruction_set_a_prefix==0) host_instructions++;
+#endif
       }
           
           
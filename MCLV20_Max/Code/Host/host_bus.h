@@ -0,0 +1,128 @@
+//
+//
+//  File Name   :  host_bus.h
+//  Used on     :  MCLV20_Max host benchmark build
+//  Author      :  Ted Fried, MicroCore Labs
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//   
+//  Stand-ins for the Teensy 4.1 runtime and the interface to the simulated 
+//  8088 bus so that MCLV20_Max.ino compiles on Linux with -DHOST_BUILD.
+//
+//  The GPIO registers become plain variables, so the BIU still performs all of
+//  its address and S-bit table lookups. Clock edges, READY, INTR, NMI, RESET and 
+//  the data returned by a bus cycle come from host_main.cpp instead of the pins.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+// Revision 2 10/18/2026
+// Added host_sample_pins() for the acceleration_mode 3 fast path
+//
+// Revision 3 10/18/2026
+// The MicroSD pins go to the simulated card in host_main.cpp
+//
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Ted Fried
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#ifndef HOST_BUS_H
+#define HOST_BUS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+
+// --------------------------------------------------------------------------------------------------
+// Teensy 4.1 stand-ins
+// --------------------------------------------------------------------------------------------------
+
+#define DMAMEM
+#define INPUT              0
+#define OUTPUT             1
+#define INPUT_PULLUP       2
+
+uint32_t GPIO6_DR   = 0;
+uint32_t GPIO7_DR   = 0;
+uint32_t GPIO8_DR   = 0;
+uint32_t GPIO9_DR   = 0;
+uint32_t GPIO9_GDIR = 0;
+
+inline void     pinMode(uint8_t pin, uint8_t mode)             { (void)pin; (void)mode;  }
+void     host_sd_pin_write(uint8_t pin, uint32_t value);
+uint8_t  host_sd_miso();
+
+inline void     digitalWriteFast(uint8_t pin, uint32_t value)  { host_sd_pin_write(pin, value); }
+inline uint8_t  digitalReadFast(uint8_t pin)                   { (void)pin; return host_sd_miso(); }   // MISO is the only input read this way
+inline void     delay(uint32_t ms)                             { (void)ms; }
+inline void     delayMicroseconds(uint32_t us)                 { (void)us; }
+inline void     delayNanoseconds(uint32_t ns)                  { (void)ns; }
+inline void     noInterrupts()                                 { }
+inline void     interrupts()                                   { }
+
+inline uint32_t millis()  {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec*1000 + ts.tv_nsec/1000000);
+}
+
+class elapsedMillis {
+    uint32_t ms;
+public:
+    elapsedMillis()                         { ms = millis(); }
+    operator uint32_t () const              { return millis() - ms; }
+    elapsedMillis & operator = (uint32_t v) { ms = millis() - v; return *this; }
+};
+
+struct HostSerial {
+    void begin(uint32_t baud)  { (void)baud; }
+};
+HostSerial Serial;
+
+
+// --------------------------------------------------------------------------------------------------
+// Simulated 8088 bus - implemented in host_main.cpp
+// --------------------------------------------------------------------------------------------------
+
+#define HOST_PSRAM_SIZE    0x800000                 // 8MB EMS PSRAM
+
+extern uint8_t  host_psram[HOST_PSRAM_SIZE];
+extern uint8_t  host_stop;                          // Set when the clock budget expires; loop() returns
+extern uint64_t host_instructions;                  // Instructions retired, prefixes not counted separately
+
+void     host_clock_rising_edge();
+uint32_t host_clock_falling_edge();                 // Returns the GPIO6 sample: READY, INTR, NMI, RESET
+uint32_t host_sample_pins();                        // Same sample without a clock, for accelerated internal RAM accesses
+uint8_t  host_bus_read(uint8_t biu_operation, uint32_t local_address);
+void     host_bus_write(uint8_t biu_operation, uint32_t local_address, uint8_t local_data);
+
+#endif
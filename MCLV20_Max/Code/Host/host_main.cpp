@@ -0,0 +1,441 @@
+//
+//
+//  File Name   :  host_main.cpp
+//  Used on     :  MCLV20_Max host benchmark build
+//  Author      :  Ted Fried, MicroCore Labs
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//   
+//  Runs the unmodified MCLV20_Max execution unit on Linux against a simulated
+//  PC/XT memory and IO map, then reports emulated instructions per second and
+//  clocks per instruction. The BIOS is the Test_Image selected in the sketch.
+//
+//  Build:   g++ -O2 -DHOST_BUILD -I. host_main.cpp -o mclv20_host
+//
+//  Usage:   ./mclv20_host [-c clocks] [-n instructions] [-a acceleration_mode] [-t] [-l program.bin] [-d disk.img]
+//
+//      -c   Number of 8088 clocks to run                   (default 100000000)
+//      -n   Also stop after this many instructions, whichever comes first
+//      -a   Starting acceleration_mode, 0 or 3              (default 0)
+//      -t   Raise INTR type 8 every 262144 clocks like the 8253 timer tick
+//      -l   Load a flat binary at 0000:7C00 and point the reset vector at it
+//           instead of running the BIOS
+//      -d   Insert a MicroSD card holding disk.img. The Boot ROM finds it and
+//           the BIOS boots from it. Without -d MISO floats high and the card
+//           is missing.
+//
+//  With -a 3 most accesses to internal RAM take no bus clocks. Each pin sample
+//  taken instead counts as one clock of time for the timer tick and for -c, so
+//  a run that never touches the bus still ends. -n does not lift the -c limit,
+//  which also ends a HLT that no interrupt wakes up.
+//
+//  Simulated map:
+//      00000-BFFFF  RAM  (640KB plus video RAM)
+//      C0000-FFFFF  ROM  - reads 0xFF except for Test_Image at the top of memory
+//      IO ports     Read back the last value written, 0xFF if never written
+//      Port 0x3DA   CGA/MDA status toggles the retrace bits on every read
+//      Port 0x80    POST code, reported at the end of the run
+//      MicroSD      SPI mode card on the PIN_SD_* pins: CMD0/8/12/16/17/18/24/25/55/58
+//                   and ACMD41, block addressed. CMD12 answers with a stuff byte
+//                   from the data stream, then R1 and a short busy.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+// Revision 2 10/18/2026
+// Added -n instruction budget and pin samples for the acceleration_mode 3 fast path
+// Added -l to benchmark a program from RAM
+//
+// Revision 3 10/18/2026
+// Build the sketch's region table before loading a program into internal RAM
+//
+// Revision 4 10/18/2026
+// Added -d and a simulated MicroSD card for the Boot ROM
+//
+// Revision 5 10/18/2026
+// Pin samples count toward -c, and -n no longer removes the -c limit
+//
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Ted Fried
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_bus.h"
+#include "../MCLV20_Max/MCLV20_Max.ino"
+
+
+#define HOST_RAM_TOP        0xC0000
+#define HOST_TIMER_PERIOD   262144                  // 65536 8253 counts at CLK/4
+
+uint8_t  host_memory[0x100000];
+uint8_t  host_io[0x10000];
+uint8_t  host_psram[HOST_PSRAM_SIZE];
+
+uint8_t  host_stop=0;
+uint8_t  host_timer_enable=0;
+uint8_t  host_intr=0;
+uint8_t  host_post_code=0xFF;
+uint8_t  host_retrace=0;
+uint64_t host_instructions=0;
+uint64_t host_clocks=0;
+uint64_t host_samples=0;
+uint64_t host_clock_budget=100000000;
+uint64_t host_instruction_budget=0;
+uint64_t host_next_tick=HOST_TIMER_PERIOD;
+
+
+// -------------------------------------------------
+// Simulated CLK and input pins
+// -------------------------------------------------
+void host_clock_rising_edge() {
+    return;
+}
+
+uint32_t host_pins(uint64_t host_time) {
+    uint32_t gpio6_data = 0x01000000;                               // READY is always high
+
+    if (host_time >= host_clock_budget)  host_stop=1;
+    if (host_instruction_budget!=0 && host_instructions >= host_instruction_budget)  host_stop=1;
+
+    if (host_timer_enable==1 && host_time >= host_next_tick)  {
+        host_intr=1;
+        host_next_tick = host_next_tick + HOST_TIMER_PERIOD;
+    }
+
+    if (host_intr==1)  gpio6_data = gpio6_data | 0x04000000;        // INTR
+    if (host_stop==1)  gpio6_data = gpio6_data | 0x02000000;        // RESET releases a HLT so loop() can return
+    return gpio6_data;
+}
+
+uint32_t host_clock_falling_edge() {
+    host_clocks++;
+    return host_pins(host_clocks+host_samples);
+}
+
+uint32_t host_sample_pins() {
+    host_samples++;
+    return host_pins(host_clocks+host_samples);
+}
+
+
+// -------------------------------------------------
+// Simulated MicroSD card
+// -------------------------------------------------
+enum HostSdState { SdCommand, SdReadToken, SdReadData, SdWriteToken, SdWriteData, SdBusy };
+
+FILE *      host_sd_file=NULL;
+uint32_t    host_sd_sectors=0;
+HostSdState host_sd_state=SdCommand;
+uint8_t     host_sd_cs_n=1;
+uint8_t     host_sd_clk=0;
+uint8_t     host_sd_mosi=0;
+uint8_t     host_sd_miso_bit=1;
+uint8_t     host_sd_bit=0;
+uint8_t     host_sd_in=0;
+uint8_t     host_sd_out=0xFF;
+uint8_t     host_sd_frame[6];
+uint32_t    host_sd_frame_index=0;
+uint8_t     host_sd_response[5];
+uint32_t    host_sd_response_count=0;
+uint32_t    host_sd_response_index=0;
+uint8_t     host_sd_app=0;
+uint8_t     host_sd_ready=0;
+uint8_t     host_sd_multi=0;
+uint32_t    host_sd_lba=0;
+uint32_t    host_sd_index=0;
+uint32_t    host_sd_delay=0;
+uint8_t     host_sd_sector[512];
+uint64_t    host_sd_commands=0;
+uint64_t    host_sd_sectors_read=0;
+uint64_t    host_sd_sectors_written=0;
+
+void host_sd_respond(uint32_t byte_count, uint8_t r0, uint8_t r1=0xFF, uint8_t r2=0xFF, uint8_t r3=0xFF, uint8_t r4=0xFF) {
+    host_sd_response[0] = r0;
+    host_sd_response[1] = r1;
+    host_sd_response[2] = r2;
+    host_sd_response[3] = r3;
+    host_sd_response[4] = r4;
+    host_sd_response_count = byte_count;
+    host_sd_response_index = 0;
+}
+
+void host_sd_command() {
+    uint8_t  command = host_sd_frame[0] & 0x3F;
+    uint32_t arg = ((uint32_t)host_sd_frame[1]<<24) | ((uint32_t)host_sd_frame[2]<<16) | (host_sd_frame[3]<<8) | host_sd_frame[4];
+    uint8_t  app = host_sd_app;
+    uint8_t  r1  = host_sd_ready ? 0x00 : 0x01;
+    uint8_t  stuff;
+
+    host_sd_commands++;
+    host_sd_app = 0;
+
+    switch (command)  {
+        case 0:   host_sd_ready=0;  host_sd_state=SdCommand;  host_sd_respond(1, 0x01);  return;
+        case 8:   host_sd_respond(5, 0x01, 0x00, 0x00, (arg>>8)&0x0F, arg);  return;                         // Echo the check pattern
+        case 55:  host_sd_app=1;  host_sd_respond(1, r1);  return;
+        case 58:  host_sd_respond(5, r1, 0xC0, 0xFF, 0x80, 0x00);  return;                                  // Powered up, block addressed
+        case 16:  host_sd_respond(1, r1);  return;
+        case 12:                                                                                              // Stuff byte from the stream, R1, busy
+            stuff = (host_sd_state==SdReadData && host_sd_index<512) ? host_sd_sector[host_sd_index] : 0xFF;
+            host_sd_respond(3, stuff, 0xFF, r1);
+            host_sd_state = SdBusy;
+            host_sd_multi = 0;
+            host_sd_delay = 3;
+            return;
+    }
+    if (app && command==41)  { host_sd_ready=1;  host_sd_respond(1, 0x00);  return; }
+
+    if (command==17 || command==18 || command==24 || command==25)  {
+        if (!host_sd_ready)              { host_sd_respond(1, 0x05);  return; }          // Illegal command, idle
+        if (arg >= host_sd_sectors)      { host_sd_respond(1, 0x40);  return; }          // Parameter error
+        host_sd_lba   = arg;
+        host_sd_multi = (command==18 || command==25);
+        host_sd_delay = 8;
+        host_sd_state = (command==17 || command==18) ? SdReadToken : SdWriteToken;
+        host_sd_respond(1, 0x00);
+        return;
+    }
+    host_sd_respond(1, r1|0x04);                                                         // Illegal command
+}
+
+// Card output for the next byte. Only depends on the bytes already received.
+uint8_t host_sd_next_byte() {
+    uint8_t data;
+
+    if (host_sd_response_index < host_sd_response_count)  return host_sd_response[host_sd_response_index++];
+
+    switch (host_sd_state)  {
+        case SdReadToken:
+            if (host_sd_delay!=0)  { host_sd_delay--;  return 0xFF; }
+            if (host_sd_lba >= host_sd_sectors)  { host_sd_state=SdCommand;  return 0x08; }      // Out of range error token
+            fseek(host_sd_file, (long)host_sd_lba*512, SEEK_SET);
+            if (fread(host_sd_sector, 1, 512, host_sd_file)!=512)  memset(host_sd_sector, 0, 512);
+            host_sd_sectors_read++;
+            host_sd_index = 0;
+            host_sd_state = SdReadData;
+            return 0xFE;
+
+        case SdReadData:
+            data = (host_sd_index<512) ? host_sd_sector[host_sd_index] : 0x55;                 // Then two CRC bytes
+            if (++host_sd_index == 514)  {
+                if (host_sd_multi)  { host_sd_lba++;  host_sd_delay=2;  host_sd_state=SdReadToken; }
+                else                host_sd_state = SdCommand;
+            }
+            return data;
+
+        case SdBusy:
+            if (host_sd_delay!=0)  { host_sd_delay--;  return 0x00; }
+            host_sd_state = host_sd_multi ? SdWriteToken : SdCommand;
+            if (host_sd_multi)  host_sd_lba++;
+            return 0xFF;
+
+        default:
+            return 0xFF;
+    }
+}
+
+void host_sd_byte_received(uint8_t data) {
+
+    if (host_sd_frame_index!=0)  {
+        host_sd_frame[host_sd_frame_index++] = data;
+        if (host_sd_frame_index==6)  { host_sd_frame_index=0;  host_sd_command(); }
+        return;
+    }
+
+    switch (host_sd_state)  {
+        case SdWriteToken:
+            if (data==0xFE || data==0xFC)  { host_sd_index=0;  host_sd_state=SdWriteData; }
+            if (data==0xFD)                { host_sd_multi=0;  host_sd_delay=4;  host_sd_state=SdBusy; }
+            return;
+
+        case SdWriteData:
+            if (host_sd_index<512)  host_sd_sector[host_sd_index] = data;
+            if (++host_sd_index == 514)  {
+                if (host_sd_lba >= host_sd_sectors)  {
+                    host_sd_respond(1, 0x0D);                                                // Write error past the end of a multiple block write
+                }
+                else  {
+                    fseek(host_sd_file, (long)host_sd_lba*512, SEEK_SET);
+                    fwrite(host_sd_sector, 1, 512, host_sd_file);
+                    host_sd_sectors_written++;
+                    host_sd_respond(1, 0x05);                                                // Data accepted
+                }
+                host_sd_delay = 16;
+                host_sd_state = SdBusy;
+            }
+            return;
+
+        default:
+            if ((data&0xC0)==0x40)  {                                                        // CMD12 can interrupt a read stream
+                host_sd_frame[0]    = data;
+                host_sd_frame_index = 1;
+            }
+            return;
+    }
+}
+
+void host_sd_pin_write(uint8_t pin, uint32_t value) {
+
+    if (host_sd_file==NULL)  return;
+
+    if (pin==PIN_SD_CS_n)  {
+        if (value!=0 && host_sd_cs_n==0)  {
+            host_sd_frame_index = 0;
+            host_sd_response_count = 0;
+            if (host_sd_state!=SdBusy)  host_sd_state = SdCommand;
+        }
+        host_sd_cs_n = (value!=0);
+        host_sd_bit  = 0;
+    }
+    else if (pin==PIN_SD_MOSI)  {
+        host_sd_mosi = (value!=0);
+    }
+    else if (pin==PIN_SD_CLK)  {
+        if (value!=0 && host_sd_clk==0 && host_sd_cs_n==0)  {                               // Rising edge - both sides sample
+            if (host_sd_bit==0)  host_sd_out = host_sd_next_byte();
+            host_sd_in = (host_sd_in<<1) | host_sd_mosi;
+            host_sd_miso_bit = (host_sd_out >> (7-host_sd_bit)) & 1;
+            if (++host_sd_bit==8)  { host_sd_bit=0;  host_sd_byte_received(host_sd_in); }
+        }
+        host_sd_clk = (value!=0);
+    }
+}
+
+uint8_t host_sd_miso() {
+    if (host_sd_file==NULL || host_sd_cs_n!=0)  return 1;
+    return host_sd_miso_bit;
+}
+
+
+// -------------------------------------------------
+// Simulated memory and IO map
+// -------------------------------------------------
+uint8_t host_bus_read(uint8_t biu_operation, uint32_t local_address) {
+
+    switch (biu_operation&0xF)  {
+        case INTERRUPT_ACK:  host_intr=0;  return 0x08;
+        case IO_READ_BYTE:   if ((local_address&0xFFFF)==0x3DA || (local_address&0xFFFF)==0x3BA)  {
+                                 host_retrace = host_retrace ^ 0x09;                    // Toggle video retrace status
+                                 return host_retrace;
+                             }
+                             return host_io[local_address&0xFFFF];
+        default:             return host_memory[local_address&0xFFFFF];
+    }
+}
+
+void host_bus_write(uint8_t biu_operation, uint32_t local_address, uint8_t local_data) {
+
+    if ((biu_operation&0xF)==IO_WRITE_BYTE)  {
+        host_io[local_address&0xFFFF] = local_data;
+        if ((local_address&0xFFFF)==0x80)  host_post_code = local_data;
+    }
+    else if (local_address < HOST_RAM_TOP)  {
+        host_memory[local_address] = local_data;
+    }
+    return;
+}
+
+
+// -------------------------------------------------
+// Benchmark driver
+// -------------------------------------------------
+int main(int argc, char *argv[]) {
+    struct timespec start_time, end_time;
+    double seconds;
+    const char * program_file = NULL;
+    const char * disk_file = NULL;
+    FILE * fp;
+    size_t program_size;
+
+    for (int i=1 ; i<argc ; i++)  {
+             if (strcmp(argv[i],"-c")==0 && i+1<argc)  host_clock_budget = strtoull(argv[++i], NULL, 0);
+        else if (strcmp(argv[i],"-n")==0 && i+1<argc)  host_instruction_budget = strtoull(argv[++i], NULL, 0);
+        else if (strcmp(argv[i],"-a")==0 && i+1<argc)  acceleration_mode = (uint8_t)strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i],"-t")==0)              host_timer_enable = 1;
+        else if (strcmp(argv[i],"-l")==0 && i+1<argc)  program_file = argv[++i];
+        else if (strcmp(argv[i],"-d")==0 && i+1<argc)  disk_file = argv[++i];
+        else  { printf("Usage: %s [-c clocks] [-n instructions] [-a acceleration_mode] [-t] [-l program.bin] [-d disk.img]\n", argv[0]);  return 1; }
+    }
+
+    if (disk_file!=NULL)  {
+        host_sd_file = fopen(disk_file, "r+b");
+        if (host_sd_file==NULL)  { printf("Cannot open %s\n", disk_file);  return 1; }
+        fseek(host_sd_file, 0, SEEK_END);
+        host_sd_sectors = ftell(host_sd_file) / 512;
+    }
+
+    memset(host_memory+HOST_RAM_TOP, 0xFF, 0x100000-HOST_RAM_TOP);
+    memcpy(host_memory+0x100000-sizeof(Test_Image), Test_Image, sizeof(Test_Image));
+    memset(host_io, 0xFF, sizeof(host_io));
+
+    if (program_file!=NULL)  {
+        fp = fopen(program_file, "rb");
+        if (fp==NULL)  { printf("Cannot open %s\n", program_file);  return 1; }
+        program_size = fread(host_memory+0x7C00, 1, HOST_RAM_TOP-0x7C00, fp);
+        fclose(fp);
+        Region_Init();
+        for (uint32_t j=0x7C00 ; j<0x7C00+program_size ; j++)  Internal_RAM_Write(j, host_memory[j]);   // In case acceleration starts enabled
+
+        Test_Image[sizeof(Test_Image)-16] = 0xEA;                    // JMP 0000:7C00 at the reset vector
+        Test_Image[sizeof(Test_Image)-15] = 0x00;
+        Test_Image[sizeof(Test_Image)-14] = 0x7C;
+        Test_Image[sizeof(Test_Image)-13] = 0x00;
+        Test_Image[sizeof(Test_Image)-12] = 0x00;
+    }
+
+    setup();
+
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    loop();
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+    seconds = (end_time.tv_sec-start_time.tv_sec) + (end_time.tv_nsec-start_time.tv_nsec)/1e9;
+
+    printf("MCLV20_Max host benchmark\n");
+    printf("  acceleration_mode       : %u\n",    acceleration_mode);
+    printf("  clocks                  : %llu\n",  (unsigned long long)host_clocks);
+    printf("  instructions            : %llu\n",  (unsigned long long)host_instructions);
+    printf("  pin samples without CLK : %llu\n",  (unsigned long long)host_samples);
+    printf("  host seconds            : %.3f\n",  seconds);
+    printf("  instructions per second : %.0f\n",  host_instructions/seconds);
+    printf("  clocks per instruction  : %.2f\n",  host_instructions ? (double)host_clocks/host_instructions : 0.0);
+    printf("  emulated clock rate     : %.2f MHz\n", host_clocks/seconds/1e6);
+    printf("  final CS:IP             : %04X:%04X\n", register_cs, register_ip);
+    printf("  last POST code          : %02X\n",  host_post_code);
+    if (host_sd_file!=NULL)  {
+        printf("  SD commands             : %llu\n",  (unsigned long long)host_sd_commands);
+        printf("  SD sectors read/written : %llu / %llu\n", (unsigned long long)host_sd_sectors_read, (unsigned long long)host_sd_sectors_written);
+        fclose(host_sd_file);
+    }
+    return 0;
+}
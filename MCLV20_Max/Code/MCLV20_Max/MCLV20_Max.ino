@@ -24,6 +24,30 @@
 // Revision 3 7/9/2025
 // Added BootROM to allow booting from the MicroSD
 //
+// Revision 4 10/18/2026
+// Added HOST_BUILD bus abstraction so the core can be compiled and benchmarked on Linux - see ../Host
+//
+// Revision 5 10/18/2026
+// Opcode dispatch through a handler table, ModRM decode table, prefixes handled within execute_new_instruction
+//
+// Revision 6 10/18/2026
+// acceleration_mode 3 fetches code and accesses data in internal RAM directly, without waiting for bus clocks
+//
+// Revision 7 10/18/2026
+// Entering acceleration_mode 2 no longer copies 640KB up front - 4KB pages are shadowed on first touch or in the background
+//
+// Revision 8 10/18/2026
+// Memory cycles are routed through a 2KB page region policy table. Upper memory pages can be shadowed at runtime through IO ports 0x264-0x266
+//
+// Revision 9 10/18/2026
+// Repeated string opcodes run in bulk on internal memory when accelerated, checking for interrupts every STRING_BULK_CHUNK elements
+//
+// Revision 10 10/18/2026
+// EMS PSRAM reads are served from a direct-mapped line cache filled with one Quad Read burst per line
+//
+// Revision 11 10/18/2026
+// The PSRAM line cache is shared with the XTMax through ../../../XTMax/Code/XTMax/psramcache.h
+//
 //
 //------------------------------------------------------------------------
 //
@@ -52,9 +76,14 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "bootrom.h"
 
+#ifdef HOST_BUILD
+#include "host_bus.h"       // Teensy stand-ins and the simulated 8088 bus used by the Linux benchmark build
+#endif
+
 
 // Teensy 4.1 pin assignments
 //
@@ -188,6 +217,8 @@
 #define PSRAM_RESET_VALUE  0x01000000
 #define PSRAM_CLK_HIGH     0x02000000
 
+#define PSRAM_CACHE_DATA   DMAMEM   // PSRAM line cache (psramcache.h)
+
 #define SD_LPT_BASE        0x280    
 
 // --------------------------------------------------------------------------------------------------
@@ -262,10 +293,38 @@ uint32_t  psram_address = 0;
 
 
 DMAMEM  uint8_t  internal_RAM1[0x60000];
+
         uint8_t  internal_RAM2[0x40000];
 uint8_t   local_array_data = 0;
 uint8_t   acceleration_mode = 0;
 
+#define SHADOW_PAGE_SIZE    0x1000                                  // Motherboard RAM is shadowed into internal RAM in 4KB pages
+#define SHADOW_PAGES        (0xA0000/SHADOW_PAGE_SIZE)
+
+uint32_t  shadow_valid[(SHADOW_PAGES+31)/32];                       // One bit per page, set once the page has been copied from the motherboard
+uint32_t  shadow_pages_pending = 0;
+uint32_t  shadow_fill_address = 0;                                  // Next byte for the background filler
+
+#define REGION_PAGE_SIZE      0x800                                 // Region policy table covers the 1MB address space in 2KB pages
+#define REGION_PAGES          (0x100000/REGION_PAGE_SIZE)
+#define REGION_SLOTS          32                                    // 2KB pages of internal memory for shadowing the upper memory area
+
+#define REGION_BUS            0                                     // Motherboard bus cycle
+#define REGION_INTERNAL       1                                     // Internal RAM only
+#define REGION_SHADOW_ROM     2                                     // Reads from an internal copy of a motherboard ROM, writes are dropped
+#define REGION_WRITE_THROUGH  3                                     // Reads from an internal copy, writes update the copy and the motherboard
+#define REGION_ROM_IMAGE      4                                     // Bus cycle for timing, data from Test_Image or BOOTROM
+#define REGION_SD_DATA        5                                     // Bus cycle, data through the MicroSD SPI
+#define REGION_EMS            6                                     // Expanded RAM page frame in PSRAM
+
+#define region_reads_internal(policy)  ( ((policy)>=REGION_INTERNAL) && ((policy)<=REGION_WRITE_THROUGH) )
+
+uint8_t   region_policy[REGION_PAGES];
+uint8_t * region_data[REGION_PAGES];                                // Internal copy of each page, 0 if it has none
+DMAMEM  uint8_t  region_RAM[REGION_SLOTS*REGION_PAGE_SIZE];
+uint8_t   region_slots_used = 0;
+uint16_t  region_select = 0;                                        // Page addressed through IO ports 0x264-0x266
+
 uint8_t   sd_scratch_register[6] = {0, 0, 0, 0, 0, 0};
 uint16_t  sd_requested_timeout = 0;
 elapsedMillis sd_timeout;
@@ -292,8 +351,8 @@ uint8_t read_data_array[0x10000] = { 0x0,0x0,0x1,0x1,0x10,0x10,0x11,0x11,0x8,0x8
 
 // BIOS ROMS
 // ----------
-//   Uncomment the one you wish to use, then uncomment the appropriately sized
-//   Internal BIOS ROM Selector at the end of the BIU_Bus_Cycle code.
+//   Uncomment the one you wish to use. It is mapped at the top of memory
+//   according to its size by Region_Init().
 // ----------
 
 // SuperSoft Diagnostic ROM
@@ -325,6 +384,8 @@ uint8_t read_data_array[0x10000] = { 0x0,0x0,0x1,0x1,0x10,0x10,0x11,0x11,0x8,0x8
 
 // Anonymous BIOS 3.1
 uint8_t  Test_Image[8192] = {  0x54,0x75,0x72,0x62,0x6f,0x20,0x58,0x54,0x20,0x42,0x49,0x4f,0x53,0x20,0x76,0x32,0x2e,0x36,0x20,0x66,0x6f,0x72,0x20,0x38,0x30,0x38,0x38,0x2f,0x56,0x32,0x30,0x0,0xc3,0x20,0x45,0x47,0x41,0x2f,0x56,0x47,0x41,0x20,0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x0,0xc3,0x20,0x50,0x61,0x72,0x61,0x6c,0x6c,0x65,0x6c,0x20,0x50,0x6f,0x72,0x74,0x20,0x61,0x74,0x20,0x0,0xc3,0x20,0x47,0x61,0x6d,0x65,0x20,0x50,0x6f,0x72,0x74,0x20,0x61,0x74,0x20,0x32,0x30,0x31,0x68,0x0,0xfa,0xfc,0xb0,0x0,0xe6,0xa0,0xba,0xd8,0x3,0xee,0xba,0xb8,0x3,0xfe,0xc0,0xee,0xb0,0x99,0xe6,0x63,0xb0,0xa5,0xe6,0x61,0xb0,0x54,0xe6,0x43,0xb0,0x12,0xe6,0x41,0xb0,0x40,0xe6,0x43,0xb0,0x0,0xe6,0x81,0xe6,0x82,0xe6,0x83,0xe6,0xd,0xb0,0x58,0xe6,0xb,0xb0,0x41,0xe6,0xb,0xb0,0x42,0xe6,0xb,0xb0,0x43,0xe6,0xb,0xb0,0xff,0xe6,0x1,0xe6,0x1,0xb0,0x0,0xe6,0x8,0xe6,0xa,0xb0,0x36,0xe6,0x43,0xb0,0x0,0xe6,0x40,0xe6,0x40,0xba,0x13,0x2,0xb0,0x1,0xee,0xb8,0x40,0x0,0x8e,0xd8,0x8b,0x36,0x72,0x0,0x33,0xc0,0x8b,0xe8,0x8b,0xd8,0xba,0xaa,0x55,0xfc,0x33,0xff,0x8e,0xc3,0x26,0x89,0x15,0x26,0x3b,0x15,0x75,0xd,0xb9,0x0,0x20,0xf3,0xab,0x80,0xc7,0x4,0x80,0xff,0xa0,0x72,0xe7,0x33,0xc0,0x8e,0xc0,0xb8,0x80,0x0,0x8e,0xd0,0xbc,0x0,0x1,0x55,0x53,0xbd,0x2,0x0,0xe8,0x24,0x19,0x89,0x36,0x72,0x0,0x58,0xb1,0x6,0xd3,0xe8,0xa3,0x13,0x0,0x58,0x73,0x2,0xc,0x10,0xa2,0x15,0x0,0x33,0xc0,0x50,0x50,0x50,0x50,0x50,0xb8,0x30,0x0,0x8e,0xd0,0xbc,0x0,0x1,0x1e,0xbb,0x0,0xe0,0xe,0x1f,0xb4,0x1,0xe8,0xe9,0x18,0x1f,0x74,0x5,0x80,0xe,0x15,0x0,0x1,0xfa,0xb0,0x13,0xe6,0x20,0xb0,0x8,0xe6,0x21,0xb0,0x9,0xe6,0x21,0xb0,0xff,0xe6,0x21,0x1e,0x33,0xc0,0x8e,0xc0,0xe,0x1f,0xb9,0x8,0x0,0x33,0xff,0xb8,0x23,0xff,0xab,0x8c,0xc8,0xab,0xe2,0xf7,0xbe,0xf3,0xfe,0xb9,0x18,0x0,0xa5,0x8c,0xc8,0xab,0xe2,0xfa,0xb8,0x0,0xf6,0x8e,0xd8,0x33,0xdb,0xb4,0x4,0x8b,0xec,0xe,0xba,0x7d,0xe1,0x52,0xba,0x90,0xea,0x52,0xba,0x8b,0x17,0x52,0x16,0x8b,0xd4,0x83,0xc2,0x2,0x52,0xcb,0x8b,0xe5,0x3a,0xd6,0x74,0x15,0xe8,0x86,0x18,0x75,0x10,0xfe,0xcc,0x75,0xf7,0x1f,0xbf,0x60,0x0,0x33,0xc0,0xab,0xb8,0x0,0xf6,0xab,0x1e,0x1f,0x26,0xc7,0x6,0x8,0x0,0x5f,0xf8,0x26,0xc7,0x6,0x14,0x0,0x54,0xff,0x26,0xc7,0x6,0x7c,0x0,0x0,0x0,0x26,0xc7,0x6,0x7e,0x0,0x0,0x0,0xba,0x61,0x0,0xec,0xc,0x30,0xee,0x24,0xcf,0xee,0xb0,0x80,0xe6,0xa0,0xb8,0x30,0x0,0xa3,0x10,0x0,0xcd,0x10,0xb8,0x20,0x0,0xa3,0x10,0x0,0xcd,0x10,0xe4,0x62,0x24,0xf,0x8a,0xe0,0xb0,0xad,0xee,0xe4,0x62,0xb1,0x4,0xd2,0xe0,0xa,0xc4,0xb4,0x0,0xa3,0x10,0x0,0x24,0x30,0x75,0x9,0xb8,0x53,0xff,0x26,0xa3,0x40,0x0,0xeb,0x3,0xe8,0xce,0x17,0xb0,0x8,0xee,0xb9,0x56,0x29,0xe2,0xfe,0xb0,0xc8,0xee,0x34,0x80,0xee,0xb8,0x1e,0x0,0xa3,0x1a,0x0,0xa3,0x1c,0x0,0xa3,0x80,0x0,0x5,0x20,0x0,0xa3,0x82,0x0,0xb8,0x14,0x14,0xa3,0x78,0x0,0xa3,0x7a,0x0,0xb8,0x1,0x1,0xa3,0x7c,0x0,0xa3,0x7e,0x0,0xbe,0x13,0xf9,0x33,0xff,0xb9,0x3,0x0,0x2e,0x8b,0x14,0xb0,0xaa,0xee,0xb0,0xff,0xe6,0xc0,0xec,0x3c,0xaa,0x75,0x5,0x89,0x55,0x8,0x47,0x47,0x46,0x46,0xe2,0xe8,0x8b,0xc7,0xb1,0x3,0xd2,0xc8,0xa2,0x11,0x0,0x33,0xff,0xba,0xfb,0x3,0xb0,0x1a,0xee,0xb0,0xff,0xe6,0xc0,0xec,0x3c,0x1a,0x75,0x6,0xc7,0x5,0xf8,0x3,0x47,0x47,0xba,0xfb,0x2,0xb0,0x1a,0xee,0xb0,0xff,0xe6,0xc0,0xec,0x3c,0x1a,0x75,0x6,0xc7,0x5,0xf8,0x2,0x47,0x47,0x8b,0xc7,0x8,0x6,0x11,0x0,0xb9,0x64,0x0,0xba,0x1,0x2,0xec,0x3c,0xff,0x75,0x5,0x49,0xe3,0x7,0xeb,0xf6,0x80,0xe,0x11,0x0,0x10,0xe8,0x67,0x4,0xba,0x0,0xc0,0x8b,0x1e,0x72,0x0,0x53,0x1e,0xe4,0x61,0x34,0xc,0xe6,0x61,0x8e,0xda,0xeb,0x15,0xb8,0x40,0x0,0x8e,0xd8,0xc7,0x6,0x72,0x0,0x0,0x0,0xe9,0x9c,0xfd,0xff,0xff,0xff,0xff,0xe9,0x99,0x15,0x33,0xdb,0x8b,0x7,0x3d,0x55,0xaa,0x75,0x36,0xb8,0x40,0x0,0x8e,0xc0,0xb4,0x0,0x8a,0x47,0x2,0xb1,0x5,0xd3,0xe0,0x3,0xd0,0xb1,0x4,0xd3,0xe0,0x8b,0xc8,0xe8,0x27,0x17,0x75,0x15,0x52,0x26,0xc7,0x6,0x67,0x0,0x3,0x0,0x26,0x8c,0x1e,0x69,0x0,0x26,0xff,0x1e,0x67,0x0,0x5a,0xeb,0xa,0x26,0x80,0xe,0x15,0x0,0x20,0x81,0xc2,0x80,0x0,0x81,0xfa,0x0,0xf6,0x7c,0x9e,0x1f,0x5b,0x89,0x1e,0x72,0x0,0xe4,0x21,0x24,0xbc,0xe6,0x21,0xb4,0x12,0xbb,0x10,0xff,0xcd,0x10,0x80,0xff,0xff,0x74,0x7,0x80,0x26,0x10,0x0,0xcf,0xeb,0x9,0xa0,0x49,0x0,0xe8,0xdf,0xb,0xe8,0x90,0x16,0xb4,0x1,0xb5,0xf0,0xcd,0x10,0xe8,0xdb,0x1,0xc6,0x6,0x96,0x0,0x10,0x81,0x3e,0x72,0x0,0x34,0x12,0x1e,0x7,0xe,0x1f,0x75,0x5,0xb7,0xfd,0xe9,0x28,0x1,0xbe,0x0,0xe0,0xe8,0x3e,0x16,0xbe,0x5c,0xe5,0xe8,0x20,0x16,0x26,0xf6,0x6,0x15,0x0,0xff,0x74,0x3e,0xb8,0x0,0x3,0xe8,0x1d,0x16,0xbe,0xf9,0xe7,0xe8,0xc,0x16,0x26,0xa0,0x15,0x0,0xe8,0xe2,0x15,0xbe,0x42,0xf9,0xe8,0xff,0x15,0xb3,0x2,0xe8,0x60,0x16,0xe8,0x58,0x16,0x50,0xe8,0xe8,0x15,0x58,0x3c,0x59,0x74,0x9,0x3c,0x79,0x74,0x5,0xea,0xb1,0xe2,0x0,0xf0,0x26,0xc6,0x6,0x15,0x0,0x0,0xe8,0x75,0x1,0xeb,0xae,0xb8,0x0,0x3,0xe8,0xdf,0x15,0xe8,0x84,0x1,0xbe,0xb2,0xe5,0xb8,0x7,0x4,0xe8,0xd3,0x15,0x26,0xa0,0x49,0x0,0x3c,0x7,0x74,0x10,0x26,0xa0,0x10,0x0,0x24,0x30,0x75,0x5,0xbe,0x20,0xe0,0xeb,0x3,0xbe,0x36,0xf0,0xe8,0xad,0x15,0xbb,0x7,0x5,0x26,0xa0,0x11,0x0,0x50,0xb1,0x6,0xd2,0xc8,0x24,0x3,0x74,0x9,0xbd,0x8,0x0,0xbe,0x33,0xe0,0xe8,0xc9,0x0,0x58,0x50,0xbe,0x19,0xf9,0xd0,0xc8,0x24,0x3,0x74,0x5,0x33,0xed,0xe8,0xb9,0x0,0x58,0xbe,0x47,0xe0,0xa8,0x10,0x74,0xa,0x8b,0xc3,0xe8,0x82,0x15,0xe8,0x74,0x15,0xfe,0xc7,0xe8,0xf0,0x0,0x72,0xd,0x8b,0xc3,0xe8,0x73,0x15,0xfe,0xc7,0xbe,0xc2,0xff,0xe8,0x60,0x15,0xfe,0xcf,0xb3,0x7,0x8b,0xc3,0xe8,0x62,0x15,0xbe,0xa2,0xf0,0xe8,0x51,0x15,0xfe,0xc7,0xfe,0xc7,0x32,0xdb,0x8b,0xc3,0xe8,0x51,0x15,0xbe,0x9d,0xe5,0xe8,0x40,0x15,0x6,0x26,0x8b,0x2e,0x13,0x0,0x4d,0x4d,0xbe,0x2,0x0,0x8b,0xd6,0xb8,0x80,0x0,0x8e,0xc0,0x80,0xc3,0xd,0x53,0x58,0x50,0x8c,0xc1,0x83,0xfd,0x1,0x74,0x9,0xf7,0xc1,0xff,0x1,0x74,0x2,0x32,0xed,0x4a,0xe8,0x20,0x15,0xe8,0x69,0x0,0x42,0xe8,0xa5,0x15,0x72,0x2d,0x4d,0x75,0xdf,0x5b,0x7,0xe8,0x13,0x13,0xb3,0x1,0xe8,0x65,0x15,0xe8,0x95,0x0,0x33,0xc0,0x8e,0xd8,0xc7,0x6,0x72,0x4,0x34,0x12,0xb4,0x1,0xb9,0xc,0xb,0x80,0x3e,0x49,0x4,0x7,0x74,0x3,0xb9,0x7,0x6,0xcd,0x10,0xcd,0x19,0x4d,0x5b,0x7,0x26,0x80,0xe,0x15,0x0,0x2,0xfe,0xc7,0xfe,0xc7,0x32,0xdb,0x8b,0xc3,0xe9,0xb6,0xfe,0x8a,0xd0,0x8b,0xc3,0xe8,0xcf,0x14,0x56,0xe8,0xc0,0x14,0x26,0x8b,0x46,0x0,0xe8,0xa3,0x14,0xbe,0x4e,0xff,0xe8,0xb3,0x14,0x5e,0x45,0x45,0xfe,0xc7,0xfe,0xca,0x75,0xe1,0xc3,0xf8,0x8a,0xc2,0xfe,0xc0,0x27,0x8a,0xd0,0x73,0x7,0x8a,0xc6,0x14,0x0,0x27,0x8a,0xf0,0x80,0xfd,0x0,0x74,0x13,0x8a,0xc6,0xe8,0x5b,0x14,0x8a,0xc2,0xb1,0x4,0xd2,0xc8,0xe8,0x52,0x14,0x8a,0xc2,0xe8,0x4d,0x14,0xc3,0xba,0x41,0x2,0xfa,0xec,0xfb,0x3c,0x99,0x76,0xc,0xba,0x41,0x3,0xfa,0xec,0xfb,0x3c,0x99,0x76,0x2,0xf9,0xc3,0xf8,0xc3,0xba,0x4f,0x18,0x33,0xc9,0xb8,0x0,0x6,0xb7,0x7,0xcd,0x10,0xb4,0x2,0x33,0xd2,0xb7,0x0,0xcd,0x10,0xb8,0x0,0x5,0xcd,0x10,0xc3,0xbe,0xe1,0xf7,0xe8,0x47,0x14,0xe8,0xb7,0x1,0xe8,0x41,0x14,0xbe,0x0,0xf8,0x26,0xf6,0x6,0x10,0x0,0x2,0x74,0x3,0xbe,0x8,0xf8,0xe8,0x30,0x14,0xc3,0x50,0x8a,0xc4,0xe8,0x6,0x14,0xe9,0x16,0x14,0xd,0xa,0x41,0x64,0x64,0x69,0x74,0x69,0x6f,0x6e,0x73,0x20,0x62,0x79,0x20,0x59,0x61,0x60,0x61,0x6b,0x6f,0x76,0x20,0x4d,0x69,0x6c,0x65,0x73,0x20,0x28,0x31,0x39,0x38,0x37,0x29,0x20,0x61,0x6e,0x64,0x20,0x4a,0x6f,0x6e,0x20,0x50,0x65,0x74,0x72,0x6f,0x73,0x6b,0x79,0x20,0x28,0x32,0x30,0x30,0x38,0x2d,0x32,0x30,0x31,0x36,0x29,0x0,0x54,0x65,0x73,0x74,0x69,0x6e,0x67,0x20,0x52,0x41,0x4d,0x3a,0x20,0x20,0x20,0x20,0x4b,0x20,0x4f,0x4b,0x0,0xc3,0x20,0x4d,0x6f,0x6e,0x6f,0x2f,0x48,0x65,0x72,0x63,0x75,0x6c,0x65,0x73,0x20,0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x0,0x49,0x6e,0x73,0x65,0x72,0x74,0x20,0x42,0x4f,0x4f,0x54,0x20,0x64,0x69,0x73,0x6b,0x20,0x69,0x6e,0x20,0x41,0x3a,0xd,0xa,0x50,0x72,0x65,0x73,0x73,0x20,0x61,0x6e,0x79,0x20,0x6b,0x65,0x79,0x20,0x77,0x68,0x65,0x6e,0x20,0x72,0x65,0x61,0x64,0x79,0xd,0xa,0xa,0x0,0xff,0xfb,0x33,0xc0,0x8e,0xd8,0xc7,0x6,0x78,0x0,0xc7,0xef,0x8c,0xe,0x7a,0x0,0xb8,0x6,0x0,0x50,0x33,0xd2,0x3c,0x2,0x77,0x3,0x80,0xca,0x80,0x52,0xb4,0x0,0xcd,0x13,0x5a,0x72,0x17,0x33,0xc0,0x8e,0xc0,0xb8,0x1,0x2,0xbb,0x0,0x7c,0xb1,0x1,0xb5,0x0,0xcd,0x13,0x72,0x5,0xea,0x0,0x7c,0x0,0x0,0x58,0xfe,0xc8,0x75,0xd2,0xa,0xe4,0x75,0x10,0xe,0x1f,0xbe,0xcb,0xe5,0xe8,0x36,0x13,0xe8,0x94,0x13,0xb8,0x8,0xff,0xeb,0xbe,0x33,0xc0,0x8e,0xd8,0xa1,0x62,0x0,0x3d,0x0,0xf6,0x75,0xe4,0xcd,0x18,0x3c,0xe0,0x75,0x10,0x80,0xcb,0x2,0x59,0x50,0x55,0x8b,0xec,0xc7,0x46,0x2,0xb3,0xe9,0x5d,0xeb,0x54,0x3c,0x57,0x74,0x55,0x3c,0x58,0x74,0x51,0xf6,0xc3,0x2,0x74,0x47,0x80,0xe3,0xfd,0x3c,0xaa,0x75,0x6,0x8a,0xc7,0xc,0x80,0x8a,0xe0,0x8a,0xf8,0x8a,0xc8,0x80,0xe1,0x7f,0x80,0xf9,0x2a,0x74,0xcd,0x80,0xf9,0x36,0x74,0xc8,0x3c,0x35,0x74,0x25,0x3c,0x1c,0x74,0x21,0x3c,0x1d,0x74,0x1d,0x3c,0x38,0x74,0x19,0x3c,0x46,0x74,0x15,0xe8,0x88,0x8,0xe8,0xfa,0x4,0x72,0xd,0xb0,0xe0,0x59,0x50,0x55,0x8b,0xec,0xc7,0x46,0x2,0xa4,0xeb,0x5d,0x89,0x1e,0x96,0x0,0xc3,0x80,0xc4,0x2e,0xa0,0x17,0x0,0xa8,0x8,0x75,0xa,0xa8,0x4,0x75,0x9,0xa8,0x3,0x75,0x8,0xeb,0x9,0x80,0xc4,0x2,0x80,0xc4,0x2,0x80,0xc4,0x2,0x32,0xc0,0xeb,0xcf,0xff,0xff,0xe9,0xb,0xff,0x32,0xc0,0xb0,0x40,0xf6,0xe0,0x74,0x4,0xbe,0xeb,0xf7,0xc3,0xbe,0xf6,0xf7,0xc3,0xdb,0xe3,0xbe,0x0,0x2,0xc6,0x44,0x1,0x0,0xd9,0x3c,0x8a,0x64,0x1,0x80,0xfc,0x3,0x75,0x6,0x80,0xe,0x10,0x0,0x2,0xc3,0x80,0x26,0x10,0x0,0xfd,0xc3,0xff,0xff,0xff,0xff,0xff,0x17,0x4,0x0,0x3,0x80,0x1,0xc0,0x0,0x60,0x0,0x30,0x0,0x18,0x0,0xc,0x0,0xfb,0x1e,0x52,0x56,0x57,0x51,0x53,0xbb,0x40,0x0,0x8e,0xdb,0x8b,0xfa,0x8b,0xda,0xd1,0xe3,0x8b,0x17,0xb,0xd2,0x74,0x10,0xa,0xe4,0x74,0x13,0xfe,0xcc,0x74,0x3a,0xfe,0xcc,0x74,0x53,0xfe,0xcc,0x74,0x63,0x5b,0x59,0x5f,0x5e,0x5a,0x1f,0xcf,0x50,0x8a,0xd8,0x83,0xc2,0x3,0xb0,0x80,0xee,0xb1,0x4,0xd2,0xc3,0x83,0xe3,0xe,0x2e,0x8b,0x87,0x29,0xe7,0x83,0xea,0x3,0xee,0x42,0x8a,0xc4,0xee,0x58,0x42,0x42,0x24,0x1f,0xee,0xb0,0x0,0x4a,0x4a,0xee,0x4a,0xeb,0x31,0x50,0xb0,0x3,0xb7,0x30,0xb3,0x20,0xe8,0x48,0x0,0x75,0x9,0x83,0xea,0x5,0x59,0x8a,0xc1,0xee,0xeb,0xb9,0x59,0x8a,0xc1,0x80,0xcc,0x80,0xeb,0xb1,0xb0,0x1,0xb7,0x20,0xb3,0x1,0xe8,0x2c,0x0,0x75,0xf0,0x80,0xe4,0x1e,0x83,0xea,0x5,0xec,0xeb,0x9d,0x83,0xc2,0x5,0xec,0x8a,0xe0,0x42,0xec,0xeb,0x93,0x8a,0x5d,0x7c,0x2b,0xc9,0xec,0x8a,0xe0,0x22,0xc7,0x3a,0xc7,0x74,0x8,0xe2,0xf5,0xfe,0xcb,0x75,0xef,0xa,0xff,0xc3,0x83,0xc2,0x4,0xee,0x42,0x42,0x53,0xe8,0xdf,0xff,0x5b,0x75,0x6,0x4a,0x8a,0xfb,0xe8,0xd6,0xff,0xc3,0x53,0x79,0x73,0x74,0x65,0x6d,0x20,0x45,0x72,0x72,0x6f,0x72,0x3a,0x20,0x0,0xfa,0x8b,0x1e,0x1a,0x0,0x3b,0x1e,0x1c,0x0,0x8b,0x7,0xfb,0x5b,0x1f,0xca,0x2,0x0,0xa1,0x17,0x0,0xeb,0x2e,0x8b,0xc1,0xe8,0xba,0x3,0xb0,0x0,0x73,0x25,0xfe,0xc0,0xeb,0x21,0xff,0xff,0xff,0xfb,0x1e,0x53,0xbb,0x40,0x0,0x8e,0xdb,0x80,0xfc,0x5,0x74,0xe3,0x8b,0xd8,0x80,0xe4,0xf,0xa,0xe4,0x74,0xb,0xfe,0xcc,0x74,0xc0,0xfe,0xcc,0x74,0xcd,0x5b,0x1f,0xcf,0xfa,0xa1,0x1a,0x0,0x3b,0x6,0x1c,0x0,0x75,0x3,0xfb,0xeb,0xf3,0xf6,0xc7,0x10,0x9c,0x93,0x8b,0x7,0x9d,0x75,0x6,0x3c,0xe0,0x75,0x2,0x32,0xc0,0x43,0x43,0x89,0x1e,0x1a,0x0,0x3b,0x1e,0x82,0x0,0x75,0xd4,0x8b,0x1e,0x80,0x0,0x89,0x1e,0x1a,0x0,0xeb,0xca,0xff,0xff,0xff,0x0,0x37,0x2e,0x20,0x2f,0x30,0x31,0x21,0x32,0x33,0x34,0x35,0x22,0x36,0x38,0x3e,0x11,0x17,0x5,0x12,0x14,0x19,0x15,0x9,0xf,0x10,0x39,0x3a,0x3b,0x84,0x1,0x13,0x4,0x6,0x7,0x8,0xa,0xb,0xc,0x3f,0x40,0x41,0x82,0x3c,0x1a,0x18,0x3,0x16,0x2,0xe,0xd,0x42,0x43,0x44,0x81,0x3d,0x88,0x2d,0xc0,0x23,0x24,0x25,0x26,0x27,0x28,0x29,0x2a,0x2b,0x2c,0xa0,0x90,0x32,0x36,0x2d,0xbb,0xbc,0xbd,0xbe,0xbf,0xc0,0xc1,0xc2,0xc3,0xc4,0x20,0x31,0x33,0x34,0x35,0x37,0x38,0x39,0x30,0x3d,0x1b,0x8,0x5b,0x5d,0xd,0x5c,0x2a,0x9,0x3b,0x27,0x60,0x2c,0x2e,0x2f,0x40,0x5e,0x5f,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xdb,0xdc,0xdd,0x20,0x21,0x23,0x24,0x25,0x26,0x2a,0x28,0x29,0x2b,0x1b,0x8,0x7b,0x7d,0xd,0x7c,0x5,0x8f,0x3a,0x22,0x7e,0x3c,0x3e,0x3f,0x3,0x1e,0x1f,0xde,0xdf,0xe0,0xe1,0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0x20,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x1b,0x7f,0x1b,0x1d,0xa,0x1c,0xf2,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0xf9,0xfd,0x2,0xe8,0xe9,0xea,0xeb,0xec,0xed,0xee,0xef,0xf0,0xf1,0x20,0xf8,0xfa,0xfb,0xfc,0xfe,0xff,0x0,0x1,0x3,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x37,0x38,0x39,0x2d,0x34,0x35,0x36,0x2b,0x31,0x32,0x33,0x30,0x2e,0xf7,0x5,0x4,0x5,0xf3,0x5,0xf4,0x5,0xf5,0x5,0xf6,0x5,0x5,0xc7,0xc8,0xc9,0x2d,0xcb,0x5,0xcd,0x2b,0xcf,0xd0,0xd1,0xd2,0xd3,0xfb,0x50,0x53,0x51,0x52,0x56,0x57,0x1e,0xfc,0xb8,0x40,0x0,0x8e,0xd8,0xe4,0x60,0x50,0xe4,0x61,0x50,0xc,0x80,0xe6,0x61,0x58,0xe6,0x61,0x58,0x8a,0xe0,0x8b,0x1e,0x96,0x0,0xe8,0xb6,0xfc,0x3c,0xff,0x75,0xf,0xe9,0xf6,0x1,0xb0,0x20,0xe6,0x20,0x1f,0x5f,0x5e,0x5a,0x59,0x5b,0x58,0xcf,0x24,0x7f,0x3c,0x46,0x76,0x3,0xe9,0x22,0x1,0xbb,0x85,0xe8,0x2e,0xd7,0xa,0xc0,0x78,0x6,0xa,0xe4,0x78,0xde,0xeb,0x4d,0x24,0x7f,0xa,0xe4,0x78,0x21,0x3c,0x10,0x73,0x6,0x8,0x6,0x17,0x0,0xeb,0xcc,0xf6,0x6,0x17,0x0,0x4,0x75,0x36,0x84,0x6,0x18,0x0,0x75,0xbf,0x8,0x6,0x18,0x0,0x30,0x6,0x17,0x0,0xeb,0xb5,0x3c,0x10,0x73,0x1a,0xf6,0xd0,0x20,0x6,0x17,0x0,0x3c,0xf7,0x75,0xa7,0xa0,0x19,0x0,0xb4,0x0,0x88,0x26,0x19,0x0,0x3a,0xc4,0x74,0x9a,0xe9,0x95,0x1,0xf6,0xd0,0x20,0x6,0x18,0x0,0xeb,0x8f,0xf6,0x6,0x18,0x0,0x8,0x74,0xd,0x80,0xfc,0x45,0x74,0x5,0x80,0x26,0x18,0x0,0xf7,0xe9,0x7b,0xff,0x8a,0x16,0x17,0x0,0xf6,0xc2,0x8,0x75,0x1d,0xf6,0xc2,0x4,0x75,0x2b,0xf6,0xc2,0x3,0x75,0x7e,0x3c,0x1a,0x77,0x5,0x4,0x60,0xe9,0x16,0x1,0xbb,0xcc,0xe8,0x2c,0x20,0x2e,0xd7,0xe9,0xc,0x1,0x3c,0x1a,0x77,0x5,0xb0,0x0,0xe9,0x3d,0x1,0xbb,0x3b,0xe9,0x2c,0x20,0x2e,0xd7,0xe9,0xf9,0x0,0x80,0xfc,0x46,0x75,0x15,0xc6,0x6,0x71,0x0,0x80,0xa1,0x80,0x0,0xa3,0x1c,0x0,0xa3,0x1a,0x0,0xcd,0x1b,0x2b,0xc0,0xe9,0xf1,0x0,0x80,0xfc,0x45,0x75,0x21,0x80,0xe,0x18,0x0,0x8,0xb0,0x20,0xe6,0x20,0x80,0x3e,0x49,0x0,0x7,0x74,0x7,0xba,0xd8,0x3,0xa0,0x65,0x0,0xee,0xf6,0x6,0x18,0x0,0x8,0x75,0xf9,0xe9,0x6,0xff,0x80,0xfc,0x3,0x75,0x5,0xb0,0x0,0xe9,0xe9,0x0,0x3c,0x1a,0x76,0xf9,0xbb,0x16,0xe9,0x2c,0x20,0x2e,0xd7,0xe9,0xa1,0x0,0x80,0xfc,0x37,0x75,0x9,0xb0,0x20,0xe6,0x20,0xcd,0x5,0xe9,0xe0,0xfe,0x3c,0x1a,0x77,0x5,0x4,0x40,0xe9,0x8a,0x0,0xbb,0xf1,0xe8,0x2c,0x20,0x2e,0xd7,0xe9,0x80,0x0,0x2c,0x47,0x8a,0x1e,0x17,0x0,0xf6,0xc3,0x8,0x75,0x18,0xf6,0xc3,0x4,0x75,0x50,0xf6,0xc3,0x20,0x74,0x7,0xf6,0xc3,0x3,0x75,0x51,0xeb,0x5b,0xf6,0xc3,0x3,0x74,0x4a,0xeb,0x54,0xa,0xe4,0x78,0x36,0xf6,0x6,0x17,0x0,0x4,0x74,0x16,0x80,0xfc,0x53,0x75,0x9,0xc7,0x6,0x72,0x0,0x34,0x12,0xe9,0x35,0xf5,0x80,0xfc,0x4a,0x75,0x3,0xe8,0xd1,0x0,0xbb,0x60,0xe9,0x2e,0xd7,0x3c,0x30,0x72,0x10,0x2c,0x30,0x8a,0xd8,0xa0,0x19,0x0,0xb4,0xa,0xf6,0xe4,0x2,0xc3,0xa2,0x19,0x0,0xe9,0x69,0xfe,0xa,0xe4,0x78,0xf9,0xbb,0x6d,0xe9,0x2e,0xd7,0xeb,0x15,0xe8,0x5d,0x0,0x72,0xed,0xbb,0x7a,0xe9,0x2e,0xd7,0xeb,0x9,0xa,0xe4,0x78,0xe2,0xbb,0x60,0xe9,0x2e,0xd7,0x3c,0x5,0x74,0x40,0x3c,0x4,0x77,0x4,0xc,0x80,0xeb,0x6,0xa8,0x80,0x74,0x6,0x24,0x7f,0x8a,0xe0,0xb0,0x0,0xf6,0x6,0x17,0x0,0x40,0x74,0x1d,0xf6,0x6,0x17,0x0,0x3,0x74,0xc,0x3c,0x41,0x72,0x12,0x3c,0x5a,0x77,0xe,0x4,0x20,0xeb,0xa,0x3c,0x61,0x72,0x6,0x3c,0x7a,0x77,0x2,0x2c,0x20,0xe8,0x36,0x0,0x73,0x5,0xb3,0x1,0xe8,0x3a,0xe,0xe9,0x2,0xfe,0xb4,0x38,0xeb,0xef,0x80,0xfc,0xd2,0x75,0x7,0x80,0x26,0x18,0x0,0x7f,0xf9,0xc3,0xa,0xe4,0x78,0xfa,0x80,0xfc,0x52,0x75,0x11,0xf6,0x6,0x18,0x0,0x80,0x75,0xa,0x80,0x36,0x17,0x0,0x80,0x80,0xe,0x18,0x0,0x80,0xf8,0xc3,0x8b,0x1e,0x1c,0x0,0x8b,0xfb,0x43,0x43,0x3b,0x1e,0x82,0x0,0x75,0x4,0x8b,0x1e,0x80,0x0,0x3b,0x1e,0x1a,0x0,0x75,0x2,0xf9,0xc3,0x89,0x5,0x89,0x1e,0x1c,0x0,0xf8,0xc3,0x50,0x53,0x51,0xe4,0x61,0x34,0xc,0xe6,0x61,0xbb,0x89,0xf,0x24,0x4,0x74,0x3,0xbb,0x2e,0x5,0xb0,0xb6,0xe6,0x43,0x8b,0xc3,0xe6,0x42,0x8a,0xc4,0xe6,0x42,0xe4,0x61,0x50,0xc,0x3,0xe6,0x61,0xb9,0x0,0x20,0xe2,0xfe,0x58,0xe6,0x61,0x59,0x5b,0x58,0xc3,0x4e,0x6f,0x20,0x52,0x4f,0x4d,0x20,0x42,0x41,0x53,0x49,0x43,0x2c,0x20,0x62,0x6f,0x6f,0x74,0x69,0x6e,0x67,0x20,0x66,0x72,0x6f,0x6d,0x20,0x64,0x69,0x73,0x6b,0x2e,0x2e,0x2e,0x0,0xff,0xff,0xff,0xff,0xff,0xfb,0x55,0x56,0x57,0x1e,0x6,0x53,0x8b,0xf8,0x33,0xc0,0x8e,0xd8,0xc4,0x36,0x78,0x0,0xb8,0x40,0x0,0x8e,0xd8,0xbb,0x5,0x0,0x26,0x8b,0x0,0x50,0x4b,0x4b,0x26,0x8b,0x0,0x50,0x86,0xce,0x86,0xd1,0x52,0x51,0x57,0x8b,0xec,0xe8,0x22,0x0,0x26,0x8a,0x64,0x2,0x88,0x26,0x40,0x0,0x8a,0x26,0x41,0x0,0x80,0xfc,0x1,0xf5,0x5b,0x59,0x5a,0x86,0xd1,0x86,0xce,0x5b,0x5b,0x5b,0x7,0x1f,0x5f,0x5e,0x5d,0xca,0x2,0x0,0x8a,0x46,0x1,0xa,0xc0,0x74,0x1b,0xfe,0xc8,0x74,0x13,0x80,0x7e,0x2,0x3,0x77,0x4,0x3c,0x5,0x76,0x6,0xc6,0x6,0x41,0x0,0x1,0xc3,0xe9,0x81,0x0,0xa0,0x41,0x0,0xc3,0xba,0xf2,0x3,0xfa,0x80,0x26,0x3f,0x0,0xf,0xa0,0x3f,0x0,0xb1,0x4,0xd2,0xe0,0xa8,0x20,0x75,0xc,0xa8,0x40,0x75,0x6,0xa8,0x80,0x74,0x6,0xfe,0xc0,0xfe,0xc0,0xfe,0xc0,0xc6,0x6,0x3e,0x0,0x0,0xc6,0x6,0x41,0x0,0x0,0xc,0x8,0xee,0xc,0x4,0xee,0xfb,0xe8,0xb3,0x1,0xe8,0x66,0x2,0xa0,0x42,0x0,0x3c,0xc0,0x74,0x7,0xc6,0x6,0x41,0x0,0x20,0xeb,0x12,0xb0,0x3,0xe8,0x7b,0x2,0x26,0x8a,0x4,0xe8,0x75,0x2,0x26,0x8a,0x44,0x1,0xe8,0x6e,0x2,0xc3,0x3,0x0,0xe6,0xc5,0xe6,0x4d,0x0,0x0,0x46,0x4a,0x42,0x4a,0x0,0x0,0x0,0x80,0x0,0x80,0x1,0x2,0x4,0x8,0x80,0x20,0x10,0x4,0x2,0x1,0x4,0x10,0x8,0x4,0x3,0x2,0x20,0xfa,0xc6,0x6,0x41,0x0,0x0,0x8a,0x46,0x1,0xb4,0x0,0x8b,0xf8,0xe6,0xc,0x2e,0x8a,0x85,0x2c,0xed,0xe6,0xb,0x8b,0x46,0xc,0xb1,0x4,0xd3,0xc0,0x8a,0xe8,0x80,0xe5,0xf,0x24,0xf0,0x3,0x46,0xa,0x80,0xd5,0x0,0x8b,0xd0,0xe6,0x4,0x8a,0xc4,0xe6,0x4,0x8a,0xc5,0xe6,0x81,0x8a,0x66,0x0,0xb0,0x0,0xd1,0xe8,0x8a,0x4e,0x6,0xd3,0xe0,0x48,0xe6,0x5,0x86,0xc4,0xe6,0x5,0x86,0xc4,0x3,0xc2,0x73,0x9,0xfb,0xc6,0x6,0x41,0x0,0x9,0xe9,0x11,0x1,0xb0,0x2,0xe6,0xa,0xc6,0x6,0x40,0x0,0xff,0x8a,0x5e,0x2,0xb7,0x0,0x2e,0x8a,0x87,0x38,0xed,0x8a,0xe8,0xb1,0x4,0xd2,0xe0,0xa,0xc3,0xc,0xc,0xba,0xf2,0x3,0xee,0xfb,0x2e,0x8a,0x85,0x32,0xed,0x8,0x6,0x3f,0x0,0xa,0xc0,0x79,0x11,0x26,0x8a,0x64,0xa,0xa,0xe4,0x74,0x9,0x84,0x2e,0x3f,0x0,0x75,0x3,0xe8,0x27,0x1,0x8,0x2e,0x3f,0x0,0x84,0x2e,0x3e,0x0,0x75,0x14,0x8,0x2e,0x3e,0x0,0xb0,0x7,0xe8,0x9f,0x1,0x8a,0xc3,0xe8,0x9a,0x1,0xe8,0xb9,0x0,0xe8,0xbb,0x1,0xb0,0xf,0xe8,0x8f,0x1,0x8a,0xc3,0xe8,0x8a,0x1,0x8a,0x46,0x3,0xe8,0x84,0x1,0xe8,0xa3,0x0,0xe8,0x56,0x1,0x26,0x8a,0x44,0x9,0xa,0xc0,0x74,0x9,0xb9,0x26,0x2,0xe2,0xfe,0xfe,0xc8,0x75,0xf7,0x2e,0x8a,0x85,0x26,0xed,0xe8,0x65,0x1,0x8a,0x46,0x4,0x24,0x1,0xd0,0xe0,0xd0,0xe0,0xa,0xc3,0xe8,0x57,0x1,0x80,0x7e,0x1,0x5,0x75,0x1c,0x8a,0x46,0x6,0xe8,0x4b,0x1,0x8a,0x46,0x7,0xe8,0x45,0x1,0x26,0x8a,0x44,0x7,0xe8,0x3e,0x1,0x26,0x8a,0x44,0x8,0xe8,0x37,0x1,0xeb,0xe,0xb9,0x7,0x0,0xbf,0x3,0x0,0x8a,0x3,0xe8,0x2a,0x1,0x47,0xe2,0xf8,0xe8,0x46,0x0,0xe8,0xfe,0x0,0xa0,0x42,0x0,0x24,0xc0,0x74,0x25,0x3c,0x40,0x74,0x7,0xc6,0x6,0x41,0x0,0x20,0xeb,0x1a,0xa0,0x43,0x0,0xb9,0x6,0x0,0x33,0xdb,0x2e,0x84,0x87,0x3c,0xed,0x75,0x3,0x43,0xe2,0xf6,0x2e,0x8a,0x87,0x42,0xed,0xa2,0x41,0x0,0xa0,0x45,0x0,0x3a,0x46,0x3,0xa0,0x47,0x0,0x74,0x5,0x8a,0x46,0x7,0xfe,0xc0,0x2a,0x46,0x5,0xc3,0xb0,0x0,0xc3,0xfb,0x33,0xc9,0xb0,0x2,0xf6,0x6,0x3e,0x0,0x80,0xf8,0x75,0x10,0xe2,0xf6,0xfe,0xc8,0x75,0xf2,0xc6,0x6,0x41,0x0,0x80,0x58,0xb0,0x0,0xf9,0xc3,0x80,0x26,0x3e,0x0,0x7f,0xc3,0x51,0x33,0xc9,0xba,0xf4,0x3,0xec,0xa,0xc0,0x78,0x9,0xe2,0xf9,0xc6,0x6,0x41,0x0,0x80,0xeb,0x9,0xa8,0x40,0x75,0x8,0xc6,0x6,0x41,0x0,0x20,0x59,0xf9,0xc3,0x42,0xec,0x50,0xb9,0xa,0x0,0xe2,0xfe,0x4a,0xec,0xa8,0x10,0xf8,0x58,0x59,0xc3,0x51,0x33,0xc9,0xe2,0xfe,0xfe,0xcc,0x75,0xf8,0x59,0xc3,0xbd,0x4,0x0,0xbb,0x0,0xb0,0x3c,0x7,0x74,0x6,0xbd,0x10,0x0,0xbb,0x0,0xb8,0x53,0x7,0xa0,0x65,0x0,0x24,0xf7,0x8b,0x16,0x63,0x0,0x83,0xc2,0x4,0xee,0xe8,0xe4,0xa,0x4d,0x75,0xfa,0x73,0x5,0x80,0xe,0x15,0x0,0x4,0xc3,0x3c,0x53,0x75,0x11,0x8a,0xe,0x17,0x0,0xf6,0xc1,0x4,0x74,0x8,0xf6,0xc1,0x8,0x74,0x3,0xe9,0xc8,0xfb,0xc3,0xff,0xfb,0x1e,0x50,0xb8,0x40,0x0,0x8e,0xd8,0x80,0xe,0x3e,0x0,0x80,0xb0,0x20,0xe6,0x20,0x58,0x1f,0xcf,0xb0,0x8,0xe8,0x23,0x0,0x53,0x51,0xb9,0x7,0x0,0x33,0xdb,0xe8,0x5e,0xff,0x72,0xd,0x88,0x47,0x42,0x74,0xf,0x43,0xe2,0xf3,0xc6,0x6,0x41,0x0,0x20,0xf9,0x59,0x5b,0x58,0xb0,0x0,0xc3,0x59,0x5b,0xc3,0x51,0x52,0x50,0x33,0xc9,0xba,0xf4,0x3,0xec,0xa,0xc0,0x78,0x9,0xe2,0xf9,0xc6,0x6,0x41,0x0,0x80,0xeb,0x12,0xa8,0x40,0x74,0x7,0xc6,0x6,0x41,0x0,0x20,0xeb,0x7,0x42,0x58,0xee,0xf8,0x5a,0x59,0xc3,0x58,0x5a,0x59,0x58,0xb0,0x0,0xf9,0xc3,0xff,0xff,0xff,0xff,0xcf,0x2,0x25,0x2,0x8,0x2a,0xff,0x50,0xf6,0x19,0x4,0xfb,0x1e,0x53,0x51,0x52,0xbb,0x40,0x0,0x8e,0xdb,0x8b,0xda,0xd1,0xe3,0x8b,0x57,0x8,0xb,0xd2,0x74,0xc,0xa,0xe4,0x74,0xd,0xfe,0xcc,0x74,0x39,0xfe,0xcc,0x74,0x29,0x5a,0x59,0x5b,0x1f,0xcf,0xee,0x42,0x8a,0x7f,0x78,0x8a,0xe0,0x33,0xc9,0xec,0xa,0xc0,0x78,0xc,0xe2,0xf9,0xfe,0xcf,0x75,0xf3,0xc,0x1,0x24,0xf9,0xeb,0x10,0x42,0xb0,0xd,0xee,0xb0,0xc,0xee,0x4a,0xeb,0x3,0x8a,0xe0,0x42,0xec,0x24,0xf8,0x34,0x48,0x86,0xc4,0xeb,0xcb,0x8a,0xe0,0x42,0x42,0xb0,0x8,0xee,0xb9,0xdc,0x5,0xe2,0xfe,0xeb,0xe0,0xc3,0x20,0x43,0x47,0x41,0x20,0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x0,0x15,0xf1,0xbc,0xf1,0xc9,0xf1,0xd9,0xf1,0xf5,0xf1,0x76,0xf2,0x96,0xf2,0x96,0xf2,0xe2,0xf3,0xe2,0xf3,0xe2,0xf3,0xbc,0xf5,0xe7,0xf5,0x2a,0xf6,0x53,0xf6,0xd1,0xf6,0xfb,0xfc,0x55,0x6,0x1e,0x56,0x57,0x52,0x51,0x53,0x50,0xbb,0x40,0x0,0x8e,0xdb,0x8a,0x1e,0x10,0x0,0x80,0xe3,0x30,0x80,0xfb,0x30,0xbb,0x0,0xb8,0x75,0x3,0xbb,0x0,0xb0,0x53,0x8b,0xec,0xe8,0x77,0x0,0x5e,0x58,0x5b,0x59,0x5a,0x5f,0x5e,0x1f,0x7,0x5d,0xcf,0x52,0xb4,0x0,0xf7,0xe3,0x5a,0x8b,0x4e,0x0,0xc3,0xc0,0x0,0x38,0x28,0x2d,0xa,0x1f,0x6,0x19,0x1c,0x2,0x7,0x6,0x7,0x0,0x0,0x0,0x0,0x71,0x50,0x5a,0xa,0x1f,0x6,0x19,0x1c,0x2,0x7,0x6,0x7,0x0,0x0,0x0,0x0,0x38,0x28,0x2d,0xa,0x7f,0x6,0x64,0x70,0x2,0x1,0x6,0x7,0x0,0x0,0x0,0x0,0x61,0x50,0x52,0xf,0x19,0x6,0x19,0x19,0x2,0xd,0xb,0xc,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x10,0x0,0x40,0x0,0x40,0x28,0x28,0x50,0x50,0x28,0x28,0x50,0x50,0x2c,0x28,0x2d,0x29,0x2a,0x2e,0x1e,0x29,0x0,0x0,0x10,0x10,0x20,0x20,0x20,0x30,0x80,0xfc,0xf,0x76,0x1,0xc3,0xd0,0xe4,0x8a,0xdc,0xb7,0x0,0x2e,0xff,0xa7,0x45,0xf0,0xa0,0x10,0x0,0xba,0xb4,0x3,0x24,0x30,0x3c,0x30,0xb0,0x1,0xb3,0x7,0x74,0x7,0x8a,0x5e,0x2,0xb2,0xd4,0xfe,0xc8,0x89,0x16,0x63,0x0,0x80,0xc2,0x4,0xee,0x88,0x1e,0x49,0x0,0x1e,0x33,0xc0,0x8e,0xd8,0xc4,0x36,0x74,0x0,0x1f,0xb7,0x0,0x53,0x2e,0x8a,0x9f,0xfc,0xf0,0x3,0xf3,0xb9,0x10,0x0,0x26,0x8a,0x4,0xe8,0x2d,0x6,0xfe,0xc4,0x46,0xe2,0xf5,0x8b,0x5e,0x0,0x8e,0xc3,0x33,0xff,0xe8,0x80,0x5,0xb9,0x0,0x20,0xb8,0x0,0x0,0x72,0x8,0x75,0x3,0xb9,0x0,0x8,0xb8,0x20,0x7,0xf3,0xab,0x8b,0x16,0x63,0x0,0x80,0xc2,0x4,0x5b,0x2e,0x8a,0x87,0xf4,0xf0,0xee,0xa2,0x65,0x0,0x42,0xb0,0x30,0x80,0xfb,0x6,0x75,0x2,0xb0,0x3f,0xa2,0x66,0x0,0xee,0x33,0xc0,0xa3,0x4e,0x0,0xa2,0x62,0x0,0xb9,0x8,0x0,0xbf,0x50,0x0,0x89,0x5,0x47,0xe2,0xfb,0x2e,0x8a,0x87,0xec,0xf0,0xa3,0x4a,0x0,0x80,0xe3,0xfe,0x2e,0x8b,0x87,0xe4,0xf0,0xa3,0x4c,0x0,0xc3,0x8b,0x4e,0x6,0x89,0xe,0x60,0x0,0xb4,0xa,0xe8,0xb1,0x5,0xc3,0x8a,0x5e,0x5,0xd0,0xe3,0xb7,0x0,0x8b,0x46,0x8,0x89,0x47,0x50,0xe9,0x8b,0x5,0x8a,0x5e,0x5,0xd0,0xe3,0xb7,0x0,0x8b,0x47,0x50,0x89,0x46,0x8,0xa1,0x60,0x0,0x89,0x46,0x6,0xc3,0x3,0x3,0x5,0x5,0x3,0x3,0x3,0x4,0x8b,0x16,0x63,0x0,0x80,0xc2,0x6,0xc6,0x46,0x3,0x0,0xec,0xa8,0x4,0x74,0x68,0xa8,0x2,0x75,0x1,0xc3,0xb4,0x10,0xe8,0x10,0x5,0x8a,0x1e,0x49,0x0,0x8a,0xcb,0xb7,0x0,0x2e,0x8a,0x9f,0xed,0xf1,0x2b,0xcb,0x79,0x2,0x33,0xc0,0xe8,0xbf,0x4,0x73,0x25,0xb5,0x28,0xf6,0xf2,0x8a,0xdc,0xb7,0x0,0xb1,0x3,0xd3,0xe3,0x8a,0xe8,0xd0,0xe5,0x8a,0xd4,0x8a,0xf0,0xd0,0xee,0xd0,0xee,0x80,0x3e,0x49,0x0,0x6,0x75,0x1a,0xd0,0xe2,0xd1,0xe3,0xeb,0x14,0xf6,0x36,0x4a,0x0,0x86,0xc4,0x8b,0xd0,0xb1,0x3,0xd2,0xe4,0x8a,0xec,0x8a,0xd8,0xb7,0x0,0xd3,0xe3,0xc6,0x46,0x3,0x1,0x89,0x56,0x8,0x89,0x5e,0x4,0x88,0x6e,0x7,0x8b,0x16,0x63,0x0,0x83,0xc2,0x7,0xee,0xc3,0x8a,0x46,0x2,0xa2,0x62,0x0,0xb4,0x0,0x50,0x8b,0x1e,0x4c,0x0,0xf7,0xe3,0xa3,0x4e,0x0,0xd1,0xe8,0x8b,0xc8,0xb4,0xc,0xe8,0xe8,0x4,0x5b,0xe8,0xd7,0x4,0xc3,0xe8,0x4b,0x4,0x73,0x3,0xe9,0x9b,0x0,0xfc,0x80,0x3e,0x49,0x0,0x2,0x72,0x15,0x80,0x3e,0x49,0x0,0x3,0x77,0xe,0xba,0xda,0x3,0xec,0xa8,0x8,0x74,0xfb,0xba,0xd8,0x3,0xb0,0x25,0xee,0x8b,0x46,0x8,0x50,0x80,0x7e,0x3,0x7,0x74,0x3,0x8b,0x46,0x6,0xe8,0x75,0x4,0x3,0x6,0x4e,0x0,0x8b,0xf0,0x8b,0xf8,0x5a,0x2b,0x56,0x6,0x81,0xc2,0x1,0x1,0x8b,0x1e,0x4a,0x0,0xd1,0xe3,0x1e,0x8a,0x46,0x2,0xe8,0xb0,0xfd,0x8e,0xc1,0x8e,0xd9,0x80,0x7e,0x3,0x6,0x74,0x5,0xf7,0xd8,0xf7,0xdb,0xfd,0x8a,0x4e,0x2,0xa,0xc9,0x74,0x1a,0x3,0xf0,0x2a,0x76,0x2,0xb5,0x0,0x8a,0xca,0x57,0x56,0xf3,0xa5,0x5e,0x5f,0x3,0xf3,0x3,0xfb,0xfe,0xce,0x75,0xee,0x8a,0x76,0x2,0xb5,0x0,0x8a,0x66,0x5,0xb0,0x20,0x8a,0xca,0x57,0xf3,0xab,0x5f,0x3,0xfb,0xfe,0xce,0x75,0xf4,0x1f,0xe8,0xb5,0x3,0x74,0x7,0xa0,0x65,0x0,0xba,0xd8,0x3,0xee,0xc3,0xfc,0x8b,0x46,0x8,0x50,0x80,0x7e,0x3,0x7,0x74,0x3,0x8b,0x46,0x6,0xe8,0x7,0x4,0x8b,0xf8,0x5a,0x2b,0x56,0x6,0x81,0xc2,0x1,0x1,0xd0,0xe6,0xd0,0xe6,0x8a,0x46,0x3,0x80,0x3e,0x49,0x0,0x6,0x74,0x9,0xd0,0xe2,0xd1,0xe7,0x3c,0x7,0x75,0x1,0x47,0x3c,0x7,0x75,0x4,0x81,0xc7,0xf0,0x0,0x8a,0x5e,0x2,0xd0,0xe3,0xd0,0xe3,0x53,0x2a,0xf3,0xb0,0x50,0xf6,0xe3,0xbb,0xb0,0x1f,0x80,0x7e,0x3,0x6,0x74,0x6,0xf7,0xd8,0xbb,0x50,0x20,0xfd,0x8b,0xf7,0x3,0xf0,0x58,0xa,0xc0,0x8b,0x4e,0x0,0x8e,0xd9,0x8e,0xc1,0x74,0x26,0x50,0xb5,0x0,0x8a,0xca,0x56,0x57,0xf3,0xa4,0x5f,0x5e,0x81,0xc6,0x0,0x20,0x81,0xc7,0x0,0x20,0x8a,0xca,0x56,0x57,0xf3,0xa4,0x5f,0x5e,0x2b,0xf3,0x2b,0xfb,0xfe,0xce,0x75,0xde,0x58,0x8a,0xf0,0x8a,0x46,0x5,0xb5,0x0,0x8a,0xca,0x57,0xf3,0xaa,0x5f,0x81,0xc7,0x0,0x20,0x8a,0xca,0x57,0xf3,0xaa,0x5f,0x2b,0xfb,0xfe,0xce,0x75,0xea,0xc3,0xe8,0xff,0x2,0x72,0x70,0x8a,0x5e,0x5,0xb7,0x0,0x53,0xe8,0x49,0x3,0x8b,0xf8,0x58,0xf7,0x26,0x4c,0x0,0x3,0xf8,0x8b,0xf7,0x8b,0x16,0x63,0x0,0x83,0xc2,0x6,0x1e,0x8b,0x5e,0x0,0x8e,0xdb,0x8e,0xc3,0x8a,0x46,0x3,0x3c,0x8,0x75,0x14,0xec,0xa8,0x1,0x75,0xfb,0xfa,0xec,0xa8,0x1,0x74,0xfb,0xad,0x1f,0x88,0x46,0x2,0x88,0x66,0x3,0xc3,0x8a,0x5e,0x2,0x8a,0x7e,0x4,0x8b,0x4e,0x6,0x3c,0xa,0x74,0x12,0xec,0xa8,0x1,0x75,0xfb,0xfa,0xec,0xa8,0x1,0x74,0xfb,0x8b,0xc3,0xab,0xe2,0xf0,0x1f,0xc3,0xec,0xa8,0x1,0x75,0xfb,0xfa,0xec,0xa8,0x1,0x74,0xfb,0x8a,0xc3,0xaa,0x47,0xe2,0xef,0x1f,0xc3,0x80,0x7e,0x3,0x8,0x75,0x3,0xe9,0xb8,0x0,0xa1,0x50,0x0,0xe8,0xeb,0x2,0x8b,0xf8,0x1e,0x8a,0x46,0x2,0xb4,0x0,0xa,0xc0,0x78,0x7,0x8c,0xca,0xbe,0x6e,0xfa,0xeb,0xc,0x24,0x7f,0x33,0xdb,0x8e,0xdb,0xc5,0x36,0x7c,0x0,0x8c,0xda,0x1f,0xb1,0x3,0xd3,0xe0,0x3,0xf0,0x8b,0x46,0x0,0x8e,0xc0,0x8b,0x4e,0x6,0x80,0x3e,0x49,0x0,0x6,0x1e,0x8e,0xda,0x74,0x51,0xd1,0xe7,0x8a,0x46,0x4,0x25,0x3,0x0,0xbb,0x55,0x55,0xf7,0xe3,0x8b,0xd0,0x8a,0x5e,0x4,0xb7,0x8,0x57,0x56,0xac,0x51,0x53,0x33,0xdb,0xb9,0x8,0x0,0xd0,0xe8,0xd1,0xdb,0xd1,0xfb,0xe2,0xf8,0x8b,0xc3,0x5b,0x59,0x23,0xc2,0x86,0xe0,0xa,0xdb,0x79,0x3,0x26,0x33,0x5,0x26,0x89,0x5,0x81,0xf7,0x0,0x20,0xf7,0xc7,0x0,0x20,0x75,0x3,0x83,0xc7,0x50,0xfe,0xcf,0x75,0xcd,0x5e,0x5f,0x47,0x47,0xe2,0xc3,0x1f,0xc3,0x8a,0x5e,0x4,0xba,0x0,0x20,0xb7,0x8,0x57,0x56,0xac,0xa,0xdb,0x79,0x3,0x26,0x32,0x5,0x26,0x88,0x5,0x33,0xfa,0x85,0xfa,0x75,0x3,0x83,0xc7,0x50,0xfe,0xcf,0x75,0xe8,0x5e,0x5f,0x47,0xe2,0xdf,0x1f,0xc3,0xfc,0xa1,0x50,0x0,0xe8,0x32,0x2,0x8b,0xf0,0x83,0xec,0x8,0x8b,0xfc,0x80,0x3e,0x49,0x0,0x6,0x8b,0x46,0x0,0x1e,0x57,0x8e,0xd8,0x74,0x31,0xb6,0x8,0xd1,0xe6,0xbb,0x0,0x20,0x8b,0x4,0x86,0xe0,0xb9,0x0,0xc0,0xb2,0x0,0x85,0xc1,0xf8,0x74,0x1,0xf9,0xd0,0xd2,0xd1,0xe9,0xd1,0xe9,0x73,0xf2,0x36,0x88,0x15,0x47,0x33,0xf3,0x85,0xf3,0x75,0x3,0x83,0xc6,0x50,0xfe,0xce,0x75,0xd8,0xeb,0x17,0xb6,0x4,0x8a,0x24,0x36,0x88,0x25,0x47,0x8a,0xa4,0x0,0x20,0x36,0x88,0x25,0x47,0x83,0xc6,0x50,0xfe,0xce,0x75,0xeb,0x8c,0xca,0xbf,0x6e,0xfa,0x8e,0xc2,0x8c,0xd2,0x8e,0xda,0x5e,0xb0,0x0,0xba,0x80,0x0,0x56,0x57,0xb9,0x8,0x0,0xf3,0xa6,0x5f,0x5e,0x74,0x1c,0xfe,0xc0,0x83,0xc7,0x8,0x4a,0x75,0xed,0xa,0xc0,0x74,0x10,0x33,0xdb,0x8e,0xdb,0xc4,0x3e,0x7c,0x0,0x8c,0xc3,0xb,0xdf,0x74,0x2,0xeb,0xd6,0x88,0x46,0x2,0x1f,0x83,0xc4,0x8,0xc3,0x8b,0x16,0x63,0x0,0x83,0xc2,0x5,0xa0,0x66,0x0,0x8a,0x66,0x5,0xa,0xe4,0x8a,0x66,0x4,0x75,0x9,0x24,0xe0,0x80,0xe4,0x1f,0xa,0xc4,0xeb,0x9,0x24,0xdf,0xf6,0xc4,0x1,0x74,0x2,0xc,0x20,0xa2,0x66,0x0,0xee,0xc3,0x8b,0x46,0x0,0x8e,0xc0,0x8b,0x56,0x8,0x8b,0x4e,0x6,0xe8,0x1,0x1,0x75,0xd,0x8a,0x46,0x2,0x8a,0xd8,0x24,0x1,0xd0,0xc8,0xb4,0x7f,0xeb,0xf,0xd0,0xe1,0x8a,0x46,0x2,0x8a,0xd8,0x24,0x3,0xd0,0xc8,0xd0,0xc8,0xb4,0x3f,0xd2,0xcc,0xd2,0xe8,0x26,0x8a,0xc,0xa,0xdb,0x79,0x4,0x32,0xc8,0xeb,0x4,0x22,0xcc,0xa,0xc8,0x26,0x88,0xc,0xc3,0x8b,0x46,0x0,0x8e,0xc0,0x8b,0x56,0x8,0x8b,0x4e,0x6,0xe8,0xbe,0x0,0x26,0x8a,0x4,0x75,0x8,0xd2,0xe0,0xd0,0xc0,0x24,0x1,0xeb,0xa,0xd0,0xe1,0xd2,0xe0,0xd0,0xc0,0xd0,0xc0,0x24,0x3,0x88,0x46,0x2,0xc3,0x8a,0x1e,0x62,0x0,0xd0,0xe3,0xb7,0x0,0x8b,0x57,0x50,0x8a,0x46,0x2,0x3c,0x8,0x74,0x22,0x3c,0xa,0x74,0x3d,0x3c,0x7,0x74,0x23,0x3c,0xd,0x74,0x25,0x8a,0x5e,0x4,0xb4,0xa,0xb9,0x1,0x0,0xcd,0x10,0xfe,0xc2,0x3a,0x16,0x4a,0x0,0x75,0x15,0xb2,0x0,0xeb,0x1f,0x80,0xfa,0x0,0x74,0xc,0xfe,0xca,0xeb,0x8,0xb3,0x1,0xe8,0x53,0x3,0xc3,0xb2,0x0,0x8a,0x1e,0x62,0x0,0xd0,0xe3,0xb7,0x0,0x89,0x57,0x50,0xe9,0xbe,0x0,0x80,0xfe,0x18,0x74,0x4,0xfe,0xc6,0x75,0xe9,0xb4,0x2,0xcd,0x10,0xe8,0x2e,0x0,0xb7,0x0,0x72,0x6,0xb4,0x8,0xcd,0x10,0x8a,0xfc,0xb4,0x6,0xb0,0x1,0x33,0xc9,0xb6,0x18,0x8a,0x16,0x4a,0x0,0xfe,0xca,0xcd,0x10,0xc3,0xa0,0x4a,0x0,0x88,0x46,0x3,0xa0,0x49,0x0,0x88,0x46,0x2,0xa0,0x62,0x0,0x88,0x46,0x5,0xc3,0x50,0xa0,0x49,0x0,0x3c,0x7,0x74,0x8,0x3c,0x4,0xf5,0x73,0x3,0x1a,0xc0,0xf9,0x58,0xc3,0xb0,0x50,0x33,0xf6,0xd0,0xea,0x73,0x3,0xbe,0x0,0x20,0xf6,0xe2,0x3,0xf0,0x8b,0xd1,0xb9,0x2,0x3,0x80,0x3e,0x49,0x0,0x6,0x9c,0x75,0x3,0xb9,0x3,0x7,0x22,0xea,0xd3,0xea,0x3,0xf2,0x86,0xcd,0x9d,0xc3,0xe8,0xa,0x0,0x8a,0xe8,0xfe,0xc4,0xe8,0x3,0x0,0x8a,0xc8,0xc3,0x52,0x8b,0x16,0x63,0x0,0x86,0xc4,0xee,0xfe,0xc2,0xec,0x5a,0xc3,0xb7,0x0,0xd1,0xe3,0x8b,0x47,0x50,0x53,0x8a,0xd8,0x8a,0xc4,0xf6,0x26,0x4a,0x0,0xb7,0x0,0x3,0xc3,0xd1,0xe0,0x5b,0xc3,0x53,0x8a,0xd8,0x8a,0xc4,0xf6,0x26,0x4a,0x0,0xd1,0xe0,0xd1,0xe0,0xb7,0x0,0x3,0xc3,0x5b,0xc3,0xd0,0xeb,0x38,0x1e,0x62,0x0,0x75,0x24,0xe8,0xca,0xff,0x3,0x6,0x4e,0x0,0xd1,0xe8,0x8b,0xc8,0xb4,0xe,0x8a,0xc5,0xe8,0x4,0x0,0xfe,0xc4,0x8a,0xc1,0x52,0x8b,0x16,0x63,0x0,0x86,0xc4,0xee,0x86,0xc4,0xfe,0xc2,0xee,0x5a,0xc3,0x33,0xc9,0x8e,0xc1,0x26,0x8b,0xe,0x62,0x0,0x32,0xdb,0x80,0xc7,0x3,0x8b,0xc3,0xe8,0xe9,0x1,0xbe,0x31,0xec,0x32,0xd2,0x81,0xf9,0x0,0xf6,0x75,0x5,0xbe,0x12,0xf8,0xfe,0xc2,0xe8,0xcb,0x1,0xfb,0xbb,0x36,0x0,0x26,0x3,0x1e,0x6c,0x4,0xb4,0x1,0xcd,0x16,0x75,0xb,0x26,0x8b,0xe,0x6c,0x4,0x2b,0xcb,0x72,0xf1,0xfa,0xc3,0x32,0xe4,0xcd,0x16,0xa,0xd2,0x74,0xf6,0x3c,0x20,0x74,0x2,0xeb,0xf0,0xcd,0x18,0x53,0x79,0x73,0x74,0x65,0x6d,0x20,0xc2,0x20,0x0,0x38,0x30,0x38,0x38,0x20,0x43,0x50,0x55,0x20,0x28,0x0,0x56,0x32,0x30,0x20,0x43,0x50,0x55,0x20,0x28,0x0,0x4e,0x6f,0x20,0x46,0x50,0x55,0x29,0x0,0x38,0x30,0x38,0x37,0x20,0x46,0x50,0x55,0x29,0x0,0x50,0x72,0x65,0x73,0x73,0x20,0x53,0x50,0x41,0x43,0x45,0x20,0x74,0x6f,0x20,0x62,0x6f,0x6f,0x74,0x20,0x52,0x4f,0x4d,0x20,0x42,0x41,0x53,0x49,0x43,0x2e,0x2e,0x2e,0x0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x1e,0xb8,0x40,0x0,0x8e,0xd8,0xa1,0x13,0x0,0x1f,0xcf,0xfb,0x1e,0xb8,0x40,0x0,0x8e,0xd8,0xa1,0x10,0x0,0x1f,0xcf,0xf9,0xb4,0x86,0xca,0x2,0x0,0x50,0xe4,0x62,0xa8,0xc0,0x75,0x3,0xe9,0xa8,0x0,0x53,0x51,0x52,0x56,0x57,0x55,0x1e,0x6,0xb8,0x40,0x0,0x8e,0xd8,0xe8,0x4e,0x1,0x1e,0xe,0x1f,0xbe,0x2b,0xf9,0xe8,0x0,0x1,0x1f,0xb8,0x11,0x0,0xe8,0x4,0x1,0xb0,0x0,0xe6,0xa0,0xba,0x61,0x0,0xec,0xc,0x30,0xee,0x24,0xcf,0xee,0xb1,0x6,0x8b,0x1e,0x13,0x0,0xd3,0xe3,0x42,0x33,0xc0,0x8e,0xd8,0xb9,0x10,0x0,0x33,0xf6,0x8a,0x24,0xec,0xa8,0xc0,0x75,0xe,0x46,0xe2,0xf6,0x8c,0xd8,0x40,0x8e,0xd8,0x3b,0xc3,0x75,0xe8,0xeb,0xc,0x88,0x24,0x8c,0xd8,0xe8,0x8e,0xec,0x8b,0xc6,0xe8,0x85,0x0,0xb8,0x16,0x0,0xe8,0xbd,0x0,0x1e,0xe,0x1f,0xbe,0x42,0xf9,0xe8,0xa9,0x0,0x1f,0xe4,0x21,0x50,0xb0,0xfc,0xe6,0x21,0xfb,0xe8,0xfe,0x0,0x50,0xe8,0x8e,0x0,0x58,0x3c,0x59,0x74,0x7,0x3c,0x79,0x74,0x3,0xe9,0xbc,0xe9,0xe8,0x23,0xec,0x58,0xe6,0x21,0xba,0x61,0x0,0xec,0xc,0x30,0xee,0x24,0xcf,0xee,0xb0,0x80,0xe6,0xa0,0x7,0x1f,0x5d,0x5f,0x5e,0x5a,0x59,0x5b,0x58,0xcf,0xbc,0x3,0x78,0x3,0x78,0x2,0xc3,0x20,0x53,0x65,0x72,0x69,0x61,0x6c,0x20,0x50,0x6f,0x72,0x74,0x20,0x61,0x74,0x20,0x0,0x50,0x61,0x72,0x69,0x74,0x79,0x20,0x65,0x72,0x72,0x6f,0x72,0x20,0x61,0x74,0x3a,0x20,0x3f,0x3f,0x3f,0x3f,0x3f,0x0,0xd,0xa,0x43,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3f,0x20,0x0,0x50,0x24,0xf,0x3c,0x9,0x76,0x2,0x4,0x7,0x4,0x30,0xe8,0x1a,0x0,0x58,0xc3,0x50,0xb1,0x4,0xd2,0xe8,0xe8,0xe8,0xff,0x58,0xe8,0xe4,0xff,0xc3,0x50,0x8a,0xc4,0xe8,0xdd,0xff,0x58,0xe8,0xe9,0xff,0xc3,0x53,0x50,0xb4,0xe,0xb3,0x7,0xcd,0x10,0x58,0x5b,0xc3,0xac,0xa,0xc0,0x74,0x5,0xe8,0xed,0xff,0xeb,0xf6,0xc3,0x52,0x53,0x8b,0xd0,0xb4,0x2,0xb7,0x0,0xcd,0x10,0x5b,0x5a,0xc3,0xbb,0x70,0x0,0x26,0x80,0x3e,0x49,0x0,0x7,0x74,0x3,0xbb,0x1f,0x0,0xb9,0x1,0x0,0xac,0xa,0xc0,0x74,0x5,0xe8,0x5,0x0,0xeb,0xf3,0xb9,0x31,0x0,0xb4,0x9,0xcd,0x10,0xb4,0x3,0xcd,0x10,0xb4,0x2,0xfe,0xc2,0xcd,0x10,0xc3,0x8a,0x26,0x10,0x0,0x80,0xe4,0x30,0xb0,0x0,0x80,0xfc,0x30,0x74,0x9,0xb0,0x1,0x80,0xfc,0x10,0x74,0x2,0xb0,0x3,0xb4,0x0,0xcd,0x10,0xc3,0xb4,0x0,0xcd,0x16,0xc3,0x50,0x51,0xb0,0xb6,0xe6,0x43,0xb8,0x28,0x5,0xe6,0x42,0x8a,0xc4,0xe6,0x42,0xe4,0x61,0x50,0xc,0x3,0xe6,0x61,0x33,0xc9,0xe2,0xfe,0xfe,0xcb,0x75,0xfa,0x58,0xe6,0x61,0x59,0x58,0xc3,0xb9,0x0,0x20,0xb0,0x0,0x2,0x7,0x43,0xe2,0xfb,0xa,0xc0,0xc3,0xbb,0x0,0x4,0xb0,0x55,0x33,0xff,0x8b,0xcb,0xf3,0xaa,0x33,0xff,0x8b,0xcb,0xf3,0xae,0xe3,0x2,0xf9,0xc3,0x33,0xff,0x8b,0xcb,0xf6,0xd0,0xf3,0xaa,0x33,0xff,0x8b,0xcb,0xf3,0xae,0xe3,0x2,0xf9,0xc3,0x33,0xff,0x8b,0xcb,0x32,0xc0,0xf6,0xd0,0xf3,0xaa,0x33,0xff,0x8b,0xcb,0xf3,0xae,0xe3,0x2,0xf9,0xc3,0x33,0xff,0x8b,0xcb,0x32,0xc0,0xf3,0xaa,0x33,0xff,0x8b,0xcb,0xf3,0xae,0xe3,0x2,0xf9,0xc3,0x8c,0xc0,0x5,0x40,0x0,0x8e,0xc0,0xc3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7e,0x81,0xa5,0x81,0xbd,0x99,0x81,0x7e,0x7e,0xff,0xdb,0xff,0xc3,0xe7,0xff,0x7e,0x6c,0xfe,0xfe,0xfe,0x7c,0x38,0x10,0x0,0x10,0x38,0x7c,0xfe,0x7c,0x38,0x10,0x0,0x38,0x7c,0x38,0xfe,0xfe,0x7c,0x38,0x7c,0x10,0x10,0x38,0x7c,0xfe,0x7c,0x38,0x7c,0x0,0x0,0x18,0x3c,0x3c,0x18,0x0,0x0,0xff,0xff,0xe7,0xc3,0xc3,0xe7,0xff,0xff,0x0,0x3c,0x66,0x42,0x42,0x66,0x3c,0x0,0xff,0xc3,0x99,0xbd,0xbd,0x99,0xc3,0xff,0xf,0x7,0xf,0x7d,0xcc,0xcc,0xcc,0x78,0x3c,0x66,0x66,0x66,0x3c,0x18,0x7e,0x18,0x3f,0x33,0x3f,0x30,0x30,0x70,0xf0,0xe0,0x7f,0x63,0x7f,0x63,0x63,0x67,0xe6,0xc0,0x99,0x5a,0x3c,0xe7,0xe7,0x3c,0x5a,0x99,0x80,0xe0,0xf8,0xfe,0xf8,0xe0,0x80,0x0,0x2,0xe,0x3e,0xfe,0x3e,0xe,0x2,0x0,0x18,0x3c,0x7e,0x18,0x18,0x7e,0x3c,0x18,0x66,0x66,0x66,0x66,0x66,0x0,0x66,0x0,0x7f,0xdb,0xdb,0x7b,0x1b,0x1b,0x1b,0x0,0x3e,0x63,0x38,0x6c,0x6c,0x38,0xcc,0x78,0x0,0x0,0x0,0x0,0x7e,0x7e,0x7e,0x0,0x18,0x3c,0x7e,0x18,0x7e,0x3c,0x18,0xff,0x18,0x3c,0x7e,0x18,0x18,0x18,0x18,0x0,0x18,0x18,0x18,0x18,0x7e,0x3c,0x18,0x0,0x0,0x18,0xc,0xfe,0xc,0x18,0x0,0x0,0x0,0x30,0x60,0xfe,0x60,0x30,0x0,0x0,0x0,0x0,0xc0,0xc0,0xc0,0xfe,0x0,0x0,0x0,0x24,0x66,0xff,0x66,0x24,0x0,0x0,0x0,0x18,0x3c,0x7e,0xff,0xff,0x0,0x0,0x0,0xff,0xff,0x7e,0x3c,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x78,0x78,0x30,0x30,0x0,0x30,0x0,0x6c,0x6c,0x6c,0x0,0x0,0x0,0x0,0x0,0x6c,0x6c,0xfe,0x6c,0xfe,0x6c,0x6c,0x0,0x30,0x7c,0xc0,0x78,0xc,0xf8,0x30,0x0,0x0,0xc6,0xcc,0x18,0x30,0x66,0xc6,0x0,0x38,0x6c,0x38,0x76,0xdc,0xcc,0x76,0x0,0x60,0x60,0xc0,0x0,0x0,0x0,0x0,0x0,0x18,0x30,0x60,0x60,0x60,0x30,0x18,0x0,0x60,0x30,0x18,0x18,0x18,0x30,0x60,0x0,0x0,0x66,0x3c,0xff,0x3c,0x66,0x0,0x0,0x0,0x30,0x30,0xfc,0x30,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x30,0x60,0x0,0x0,0x0,0xfc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x30,0x0,0x6,0xc,0x18,0x30,0x60,0xc0,0x80,0x0,0x7c,0xc6,0xce,0xde,0xf6,0xe6,0x7c,0x0,0x30,0x70,0x30,0x30,0x30,0x30,0xfc,0x0,0x78,0xcc,0xc,0x38,0x60,0xcc,0xfc,0x0,0x78,0xcc,0xc,0x38,0xc,0xcc,0x78,0x0,0x1c,0x3c,0x6c,0xcc,0xfe,0xc,0x1e,0x0,0xfc,0xc0,0xf8,0xc,0xc,0xcc,0x78,0x0,0x38,0x60,0xc0,0xf8,0xcc,0xcc,0x78,0x0,0xfc,0xcc,0xc,0x18,0x30,0x30,0x30,0x0,0x78,0xcc,0xcc,0x78,0xcc,0xcc,0x78,0x0,0x78,0xcc,0xcc,0x7c,0xc,0x18,0x70,0x0,0x0,0x30,0x30,0x0,0x0,0x30,0x30,0x0,0x0,0x30,0x30,0x0,0x0,0x30,0x30,0x60,0x18,0x30,0x60,0xc0,0x60,0x30,0x18,0x0,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0x60,0x30,0x18,0xc,0x18,0x30,0x60,0x0,0x78,0xcc,0xc,0x18,0x30,0x0,0x30,0x0,0x7c,0xc6,0xde,0xde,0xde,0xc0,0x78,0x0,0x30,0x78,0xcc,0xcc,0xfc,0xcc,0xcc,0x0,0xfc,0x66,0x66,0x7c,0x66,0x66,0xfc,0x0,0x3c,0x66,0xc0,0xc0,0xc0,0x66,0x3c,0x0,0xf8,0x6c,0x66,0x66,0x66,0x6c,0xf8,0x0,0xfe,0x62,0x68,0x78,0x68,0x62,0xfe,0x0,0xfe,0x62,0x68,0x78,0x68,0x60,0xf0,0x0,0x3c,0x66,0xc0,0xc0,0xce,0x66,0x3e,0x0,0xcc,0xcc,0xcc,0xfc,0xcc,0xcc,0xcc,0x0,0x78,0x30,0x30,0x30,0x30,0x30,0x78,0x0,0x1e,0xc,0xc,0xc,0xcc,0xcc,0x78,0x0,0xe6,0x66,0x6c,0x78,0x6c,0x66,0xe6,0x0,0xf0,0x60,0x60,0x60,0x62,0x66,0xfe,0x0,0xc6,0xee,0xfe,0xfe,0xd6,0xc6,0xc6,0x0,0xc6,0xe6,0xf6,0xde,0xce,0xc6,0xc6,0x0,0x38,0x6c,0xc6,0xc6,0xc6,0x6c,0x38,0x0,0xfc,0x66,0x66,0x7c,0x60,0x60,0xf0,0x0,0x78,0xcc,0xcc,0xcc,0xdc,0x78,0x1c,0x0,0xfc,0x66,0x66,0x7c,0x6c,0x66,0xe6,0x0,0x78,0xcc,0xe0,0x70,0x1c,0xcc,0x78,0x0,0xfc,0xb4,0x30,0x30,0x30,0x30,0x78,0x0,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xfc,0x0,0xcc,0xcc,0xcc,0xcc,0xcc,0x78,0x30,0x0,0xc6,0xc6,0xc6,0xd6,0xfe,0xee,0xc6,0x0,0xc6,0xc6,0x6c,0x38,0x38,0x6c,0xc6,0x0,0xcc,0xcc,0xcc,0x78,0x30,0x30,0x78,0x0,0xfe,0xc6,0x8c,0x18,0x32,0x66,0xfe,0x0,0x78,0x60,0x60,0x60,0x60,0x60,0x78,0x0,0xc0,0x60,0x30,0x18,0xc,0x6,0x2,0x0,0x78,0x18,0x18,0x18,0x18,0x18,0x78,0x0,0x10,0x38,0x6c,0xc6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff,0x30,0x30,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0xc,0x7c,0xcc,0x76,0x0,0xe0,0x60,0x60,0x7c,0x66,0x66,0xdc,0x0,0x0,0x0,0x78,0xcc,0xc0,0xcc,0x78,0x0,0x1c,0xc,0xc,0x7c,0xcc,0xcc,0x76,0x0,0x0,0x0,0x78,0xcc,0xfc,0xc0,0x78,0x0,0x38,0x6c,0x60,0xf0,0x60,0x60,0xf0,0x0,0x0,0x0,0x76,0xcc,0xcc,0x7c,0xc,0xf8,0xe0,0x60,0x6c,0x76,0x66,0x66,0xe6,0x0,0x30,0x0,0x70,0x30,0x30,0x30,0x78,0x0,0xc,0x0,0xc,0xc,0xc,0xcc,0xcc,0x78,0xe0,0x60,0x66,0x6c,0x78,0x6c,0xe6,0x0,0x70,0x30,0x30,0x30,0x30,0x30,0x78,0x0,0x0,0x0,0xcc,0xfe,0xfe,0xd6,0xc6,0x0,0x0,0x0,0xf8,0xcc,0xcc,0xcc,0xcc,0x0,0x0,0x0,0x78,0xcc,0xcc,0xcc,0x78,0x0,0x0,0x0,0xdc,0x66,0x66,0x7c,0x60,0xf0,0x0,0x0,0x76,0xcc,0xcc,0x7c,0xc,0x1e,0x0,0x0,0xdc,0x76,0x66,0x60,0xf0,0x0,0x0,0x0,0x7c,0xc0,0x78,0xc,0xf8,0x0,0x10,0x30,0x7c,0x30,0x30,0x34,0x18,0x0,0x0,0x0,0xcc,0xcc,0xcc,0xcc,0x76,0x0,0x0,0x0,0xcc,0xcc,0xcc,0x78,0x30,0x0,0x0,0x0,0xc6,0xd6,0xfe,0xfe,0x6c,0x0,0x0,0x0,0xc6,0x6c,0x38,0x6c,0xc6,0x0,0x0,0x0,0xcc,0xcc,0xcc,0x7c,0xc,0xf8,0x0,0x0,0xfc,0x98,0x30,0x64,0xfc,0x0,0x1c,0x30,0x30,0xe0,0x30,0x30,0x1c,0x0,0x18,0x18,0x18,0x0,0x18,0x18,0x18,0x0,0xe0,0x30,0x30,0x1c,0x30,0x30,0xe0,0x0,0x76,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x38,0x6c,0xc6,0xc6,0xfe,0x0,0xfb,0x1e,0x50,0xb8,0x40,0x0,0x8e,0xd8,0x58,0xfa,0xa,0xe4,0x74,0x13,0xfe,0xcc,0x75,0x1a,0x89,0x16,0x6c,0x0,0x89,0xe,0x6e,0x0,0xc6,0x6,0x70,0x0,0x0,0xeb,0xb,0x8b,0xe,0x6e,0x0,0x8b,0x16,0x6c,0x0,0xe8,0x3,0x0,0xfb,0x1f,0xcf,0xa0,0x70,0x0,0x30,0x6,0x70,0x0,0xc3,0xfb,0x1e,0x52,0x50,0xb8,0x40,0x0,0x8e,0xd8,0xfe,0xe,0x40,0x0,0x75,0xb,0x80,0x26,0x3f,0x0,0xf0,0xb0,0xc,0xba,0xf2,0x3,0xee,0xff,0x6,0x6c,0x0,0x75,0x4,0xff,0x6,0x6e,0x0,0x83,0x3e,0x6e,0x0,0x18,0x75,0x19,0x81,0x3e,0x6c,0x0,0xb0,0x0,0x75,0x11,0xc7,0x6,0x6e,0x0,0x0,0x0,0xc7,0x6,0x6c,0x0,0x0,0x0,0xc6,0x6,0x70,0x0,0x1,0xcd,0x1c,0xb0,0x20,0xe6,0x20,0x58,0x5a,0x1f,0xcf,0xa5,0xfe,0x87,0xe9,0x23,0xff,0x23,0xff,0x23,0xff,0x23,0xff,0x57,0xef,0x23,0xff,0x65,0xf0,0x4d,0xf8,0x41,0xf8,0x59,0xec,0x39,0xe7,0x59,0xf8,0x2e,0xe8,0xd2,0xef,0x23,0xff,0xf2,0xe6,0x6e,0xfe,0x53,0xff,0x53,0xff,0xa4,0xf0,0xc7,0xef,0x0,0x0,0x1e,0x52,0x50,0xb8,0x40,0x0,0x8e,0xd8,0xb0,0xb,0xe6,0x20,0x90,0xe4,0x20,0x8a,0xe0,0xa,0xc0,0x75,0x4,0xb0,0xff,0xeb,0xa,0xe4,0x21,0xa,0xc4,0xe6,0x21,0xb0,0x20,0xe6,0x20,0x88,0x26,0x6b,0x0,0x58,0x5a,0x1f,0xcf,0x68,0x0,0xff,0xff,0xff,0xcf,0xfb,0x1e,0x50,0x53,0x51,0x52,0xb8,0x40,0x0,0x8e,0xd8,0x80,0x3e,0x0,0x1,0x1,0x74,0x56,0xc6,0x6,0x0,0x1,0x1,0xe8,0x5d,0x0,0xb4,0xf,0xcd,0x10,0x50,0xb4,0x3,0xcd,0x10,0x58,0x52,0xb5,0x19,0x8a,0xcc,0x33,0xd2,0xb4,0x2,0xcd,0x10,0xb4,0x8,0xcd,0x10,0xa,0xc0,0x75,0x2,0xb0,0x20,0x52,0x33,0xd2,0x8a,0xe2,0xcd,0x17,0x5a,0xf6,0xc4,0x25,0x74,0x7,0xc6,0x6,0x0,0x1,0xff,0xeb,0x16,0xfe,0xc2,0x3a,0xca,0x75,0xd8,0xb2,0x0,0xe8,0x1f,0x0,0xfe,0xc6,0x3a,0xf5,0x75,0xcd,0xc6,0x6,0x0,0x1,0x0,0x5a,0xb4,0x2,0xcd,0x10,0x5a,0x59,0x5b,0x58,0x1f,0xcf,0xc3,0x20,0x54,0x69,0x6d,0x65,0x72,0x0,0xff,0x52,0x33,0xd2,0x8a,0xe2,0xb0,0xa,0xcd,0x17,0xb4,0x0,0xb0,0xd,0xcd,0x17,0x5a,0xc3,0xc7,0x6,0x60,0x0,0x7,0x6,0x80,0x3e,0x49,0x0,0x7,0x75,0x6,0xc7,0x6,0x60,0x0,0xc,0xb,0xc3,0xea,0x5b,0xe0,0x0,0xf0,0x30,0x34,0x2f,0x31,0x38,0x2f,0x31,0x36,0xff,0xfe,0x84 };
+
+#define TEST_IMAGE_ADDR  (0x100000-sizeof(Test_Image))      // Internal BIOS ROM sits at the top of memory
  
 // ------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------
@@ -406,23 +467,168 @@ void setup() {
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
 
+inline uint8_t Maximum_Mode_Bus_Cycle(uint8_t biu_operation, uint32_t local_address , uint8_t local_data);
+
+#define shadow_page_valid(page)  ( (shadow_valid[(page)>>5] & (1<<((page)&0x1F))) != 0 )
+
+
+// Copy the rest of a page from the motherboard and mark it valid
+//
+void Shadow_Page_Fill(uint32_t local_page) {
+    uint32_t local_address;
+    uint32_t local_end;
+    uint8_t  local_data;
+   
+    if ( (shadow_fill_address/SHADOW_PAGE_SIZE) == local_page )  local_address = shadow_fill_address;     // Background filler already has part of this page
+    else                                                         local_address = local_page*SHADOW_PAGE_SIZE;
+    local_end = (local_page+1)*SHADOW_PAGE_SIZE;
+   
+    for ( ; local_address<local_end ; local_address++)  {
+        local_data = Maximum_Mode_Bus_Cycle(MEM_READ_BYTE , local_address , 0x00);
+        if (local_address<0x60000)  internal_RAM1[local_address]         = local_data;
+        else                        internal_RAM2[local_address-0x60000] = local_data;
+    }
+   
+    shadow_valid[local_page>>5] = shadow_valid[local_page>>5] | (1<<(local_page&0x1F));
+    shadow_pages_pending--;
+    return;
+}
+
+
+// Copy one byte of the lowest page not yet shadowed
+//
+void Shadow_Background_Fill() {
+    uint32_t local_page;
+    uint8_t  local_data;
+   
+    while ( shadow_page_valid(shadow_fill_address/SHADOW_PAGE_SIZE) )  {                                 // Skip pages already filled on first touch
+        shadow_fill_address = (shadow_fill_address/SHADOW_PAGE_SIZE + 1) * SHADOW_PAGE_SIZE;
+    }
+   
+    local_data = Maximum_Mode_Bus_Cycle(MEM_READ_BYTE , shadow_fill_address , 0x00);
+   
+    if (shadow_fill_address<0x60000)  internal_RAM1[shadow_fill_address]         = local_data;
+    else                              internal_RAM2[shadow_fill_address-0x60000] = local_data;
+    shadow_fill_address++;
+   
+    if ( (shadow_fill_address%SHADOW_PAGE_SIZE) == 0 )  {
+        local_page = (shadow_fill_address/SHADOW_PAGE_SIZE) - 1;
+        shadow_valid[local_page>>5] = shadow_valid[local_page>>5] | (1<<(local_page&0x1F));
+        shadow_pages_pending--;
+    }
+    return;
+}
+
+
+// Point the motherboard RAM and BIOS pages at internal memory or the bus to match acceleration_mode
+//
+void Region_Update_Acceleration() {
+    uint32_t local_page;
+   
+    for (local_page=0 ; local_page<(0xA0000/REGION_PAGE_SIZE) ; local_page++)  {
+        if (acceleration_mode==3)  region_policy[local_page] = REGION_INTERNAL;
+        else                       region_policy[local_page] = REGION_BUS;
+    }
+    for (local_page=(TEST_IMAGE_ADDR/REGION_PAGE_SIZE) ; local_page<REGION_PAGES ; local_page++)  {
+        if (acceleration_mode==3)  region_policy[local_page] = REGION_SHADOW_ROM;
+        else                       region_policy[local_page] = REGION_ROM_IMAGE;
+    }
+    return;
+}
+
+
+// Enter acceleration with every page still on the motherboard
+//
+void Shadow_Begin() {
+   
+    for (uint32_t i=0 ; i<sizeof(shadow_valid)/4 ; i++)  shadow_valid[i]=0;
+    shadow_pages_pending = SHADOW_PAGES;
+    shadow_fill_address  = 0;
+    acceleration_mode    = 3;
+    Region_Update_Acceleration();
+    return;
+}
+
+
+// Build the region table for the fixed memory map
+//
+void Region_Init() {
+    uint32_t local_page;
+   
+    for (local_page=0 ; local_page<REGION_PAGES ; local_page++)  {
+        region_policy[local_page] = REGION_BUS;
+        region_data[local_page]   = 0;
+    }
+    for (local_page=0 ; local_page<(0xA0000/REGION_PAGE_SIZE) ; local_page++)  {
+        if (local_page<(0x60000/REGION_PAGE_SIZE))  region_data[local_page] = &internal_RAM1[local_page*REGION_PAGE_SIZE];
+        else                                        region_data[local_page] = &internal_RAM2[local_page*REGION_PAGE_SIZE-0x60000];
+    }
+    for (local_page=(TEST_IMAGE_ADDR/REGION_PAGE_SIZE) ; local_page<REGION_PAGES ; local_page++)  {
+        region_data[local_page] = &Test_Image[local_page*REGION_PAGE_SIZE-TEST_IMAGE_ADDR];
+    }
+    for (local_page=(0xE0000/REGION_PAGE_SIZE) ; local_page<(0xF0000/REGION_PAGE_SIZE) ; local_page++)  {
+        region_policy[local_page] = REGION_EMS;
+    }
+   
+    region_policy[BOOTROM_ADDR/REGION_PAGE_SIZE]     = REGION_ROM_IMAGE;
+    region_data[BOOTROM_ADDR/REGION_PAGE_SIZE]       = BOOTROM;
+    region_policy[(BOOTROM_ADDR/REGION_PAGE_SIZE)+1] = REGION_SD_DATA;
+   
+    region_slots_used = 0;
+    Region_Update_Acceleration();
+    return;
+}
+
+
+// Change the policy of an upper memory page through IO port 0x266
+//   Pages below 0xA0000 follow acceleration_mode, and the BIOS, BootROM,
+//   MicroSD and EMS windows keep their fixed policies.
+//
+void Region_Set_Policy(uint32_t local_page , uint8_t local_policy) {
+    uint32_t local_offset;
+   
+    if ( (local_page < (0xA0000/REGION_PAGE_SIZE)) || (local_page >= (TEST_IMAGE_ADDR/REGION_PAGE_SIZE)) )  return;
+    if ( (region_policy[local_page] > REGION_WRITE_THROUGH) || (local_policy > REGION_WRITE_THROUGH) )      return;
+   
+    if ( (region_policy[local_page]==REGION_BUS) && (local_policy!=REGION_BUS) )  {     // Take a fresh copy of the page from the motherboard
+        if (region_data[local_page]==0)  {
+            if (region_slots_used==REGION_SLOTS)  return;                                 // Out of internal memory, so the page stays on the bus
+            region_data[local_page] = &region_RAM[region_slots_used*REGION_PAGE_SIZE];
+            region_slots_used++;
+        }
+        for (local_offset=0 ; local_offset<REGION_PAGE_SIZE ; local_offset++)  {
+            region_data[local_page][local_offset] = Maximum_Mode_Bus_Cycle(MEM_READ_BYTE , local_page*REGION_PAGE_SIZE+local_offset , 0x00);
+        }
+    }
+    region_policy[local_page] = local_policy;
+    return;
+}
+
+
 inline uint8_t Internal_RAM_Read(uint32_t local_address) {
-    uint8_t local_temp;
    
-    if (local_address<0x60000)  local_temp = internal_RAM1[local_address];
-    else                        local_temp = internal_RAM2[local_address-0x60000];
+    if ( (shadow_pages_pending!=0) && (local_address<0xA0000) && !shadow_page_valid(local_address/SHADOW_PAGE_SIZE) )  Shadow_Page_Fill(local_address/SHADOW_PAGE_SIZE);
    
-    return local_temp;
+    return region_data[local_address/REGION_PAGE_SIZE][local_address&(REGION_PAGE_SIZE-1)];
 }
 
 inline void Internal_RAM_Write(uint32_t local_address, uint8_t local_data) {
    
-    if (local_address<0x60000)  internal_RAM1[local_address]         = (local_data&0xFF);
-    else                        internal_RAM2[local_address-0x60000] = (local_data&0xFF);
+    if ( (shadow_pages_pending!=0) && (local_address<0xA0000) && !shadow_page_valid(local_address/SHADOW_PAGE_SIZE) )  Shadow_Page_Fill(local_address/SHADOW_PAGE_SIZE);
    
+    region_data[local_address/REGION_PAGE_SIZE][local_address&(REGION_PAGE_SIZE-1)] = local_data;
     return;
 }
 
+// Internal copy of an address, valid up to the end of its 2KB page
+//
+inline uint8_t * Internal_RAM_Pointer(uint32_t local_address) {
+   
+    if ( (shadow_pages_pending!=0) && (local_address<0xA0000) && !shadow_page_valid(local_address/SHADOW_PAGE_SIZE) )  Shadow_Page_Fill(local_address/SHADOW_PAGE_SIZE);
+   
+    return &region_data[local_address/REGION_PAGE_SIZE][local_address&(REGION_PAGE_SIZE-1)];
+}
+
  
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
@@ -481,7 +687,14 @@ inline void PSRAM_Configure() {
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
 
-inline uint8_t PSRAM_Read(uint32_t address_in) {
+// Read byte_count sequential bytes with one Quad Read command. The burst must not cross a 1KB PSRAM page.
+//
+inline void PSRAM_Read_Burst(uint32_t address_in , uint8_t * buffer , uint32_t byte_count) {
+
+#ifdef HOST_BUILD
+  memcpy(buffer, &host_psram[address_in & (HOST_PSRAM_SIZE-1)], byte_count);
+  return;
+#endif
 
 // Send Command = Quad Read = 0x0B
 //
@@ -508,24 +721,51 @@ inline uint8_t PSRAM_Read(uint32_t address_in) {
  PSRAM_Write_Clk_Cycle(); 
 
 
-// Clock in the data
+// Clock in the data - the PSRAM keeps streaming sequential bytes for as long as CS_n is held low
 //
-                   
-  PSRAM_Read_Clk_Cycle();  read_byte = nibble_in;
-  PSRAM_Read_Clk_Cycle();  read_byte = (read_byte<<4) | nibble_in;
+  for (uint32_t i=0 ; i<byte_count ; i++)  {
+    PSRAM_Read_Clk_Cycle();  read_byte = nibble_in;
+    PSRAM_Read_Clk_Cycle();  read_byte = (read_byte<<4) | nibble_in;
+    buffer[i] = read_byte;
+  }
 
   GPIO9_DR = PSRAM_RESET_VALUE;                       // Drive  CLK=0 , CS_n=1
   GPIO9_GDIR = GPIO9_GDIR | 0x3F000000;               // Change Data[3:0] to inputs quickly
 
-return read_byte;
+return;
  }
 
  
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
 
+#include "../../../XTMax/Code/XTMax/psramcache.h"
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+// A miss fills the whole line in one burst, following sequential reads are served from internal RAM
+//
+inline uint8_t PSRAM_Read(uint32_t address_in) {
+
+return PSRAM_Cache_Read(address_in);
+ }
+
+ 
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+// Writes go straight through to the PSRAM and update the cached copy of the line if present
+//
 inline uint8_t PSRAM_Write(uint32_t address_in , int8_t local_data) {
 
+  PSRAM_Cache_Write(address_in , local_data);
+
+#ifdef HOST_BUILD
+  host_psram[address_in & (HOST_PSRAM_SIZE-1)] = local_data;
+  return read_byte;
+#endif
+
 
 // Send Command = Quad Write = 0x02
 //
@@ -615,10 +855,14 @@ inline void SD_SPI_Cycle()  {
 // Wait for the CLK rising edge  
 // -------------------------------------------------         
 inline void wait_for_CLK_rising_edge() {
+#ifdef HOST_BUILD
+    host_clock_rising_edge();
+#else
     uint32_t  gpio6_data=0;
 
     while ( (GPIO6_DR&0x08000000) != 0) {}                                      // First ensure clock is at a low level
     do { gpio6_data = GPIO6_DR;   } while ( (gpio6_data&0x08000000) == 0);      // Then poll for the first instance where clock is not low
+#endif
     return;
 }
     
@@ -633,19 +877,43 @@ inline void wait_for_CLK_falling_edge() {
     if (nmi_d==0 && direct_nmi!=0) nmi_latched=1;                               // Latch rising edge of NMI
     nmi_d = direct_nmi;
 
+#ifdef HOST_BUILD
+    GPIO6_raw_data = host_clock_falling_edge();                                 // Simulated CLK, READY, INTR, NMI and RESET
+#else
     while ( (GPIO6_DR&0x08000000) == 0) {}                                      // First ensure clock is at a high level
     do {    } while ( (GPIO6_DR&0x08000000) != 0);                              // Then poll for the first instance where clock is not high
     
     GPIO6_raw_data = GPIO6_DR;                                                  // Store slightly-delayed version of GPIO6 in a global register
+#endif
     direct_nmi     = (GPIO6_raw_data&0x00010000);         
     return;
 }
     
 
 // -------------------------------------------------
-// Initiate a 8088 Bus Cycle
+// Sample signals without waiting for a CLK edge
+//   Used when accelerated accesses to internal RAM
+//   do not wait for the bus clock
 // -------------------------------------------------
-inline uint8_t BIU_Bus_Cycle(uint8_t biu_operation, uint32_t local_address , uint8_t local_data)  {
+inline void sample_input_pins() {
+    
+    if (nmi_d==0 && direct_nmi!=0) nmi_latched=1;                               // Latch rising edge of NMI
+    nmi_d = direct_nmi;
+
+#ifdef HOST_BUILD
+    GPIO6_raw_data = host_sample_pins();
+#else
+    GPIO6_raw_data = GPIO6_DR;
+#endif
+    direct_nmi     = (GPIO6_raw_data&0x00010000);         
+    return;
+}
+    
+
+// -------------------------------------------------
+// Execute an 8088 Maximum Mode Bus Cycle on the motherboard
+// -------------------------------------------------
+inline uint8_t Maximum_Mode_Bus_Cycle(uint8_t biu_operation, uint32_t local_address , uint8_t local_data)  {
     uint8_t  read_cycle=0;
     uint32_t writeback_data6=0;
     uint32_t gpio7_out=0;
@@ -655,93 +923,10 @@ inline uint8_t BIU_Bus_Cycle(uint8_t biu_operation, uint32_t local_address , uin
     uint32_t local_address_low=0;
     uint32_t new_sbits=0;
     uint32_t local_read_data;
-    uint8_t biu_operation_type;
-    uint32_t local_address16;
-    
     
-    biu_operation_type = biu_operation&0xF;   // Strips off byte/word nibble
-    local_address16 = local_address&0xFFFF;
-
-
-    if (acceleration_mode==3) {
     
-           if (( biu_operation_type==0x4) && (local_address<0xA0000) ) { wait_for_CLK_falling_edge();  return (Internal_RAM_Read(local_address)); }                    // Internal Code RAM Reads
-      else if (( biu_operation_type==0x5) && (local_address<0xA0000) ) { wait_for_CLK_falling_edge();  return (Internal_RAM_Read(local_address)); }                    // Internal Memory RAM Reads
-      else if (( biu_operation_type==0x6) && (local_address<0xA0000) ) { Internal_RAM_Write(local_address,local_data);  wait_for_CLK_falling_edge(); return 0xEE;  }   // Internal RAM Writes
-     
-
-      // Internal BIOS ROM Selector
-      // ----------------------------
-      //
-      //if ( (biu_operation_type>=0x4) && (local_address >= 0xF0000) ) return (Test_Image[local_address-0xF0000]);     // 64KB ROMs
-      //if ( (biu_operation_type>=0x4) && (local_address >= 0xF8000) ) return (Test_Image[local_address-0xF8000]);     // 32KB ROMs
-      //if ( (biu_operation_type>=0x4) && (local_address >= 0xFC000) ) return (Test_Image[local_address-0xFC000]);     // 16KB ROMs
-        if ( (biu_operation_type>=0x4) && (local_address >= 0xFE000) ) return (Test_Image[local_address-0xFE000]);     // 8K ROMs 
-
-    }
-
-
-    // Support for EMS and MicroSD    
-    //
-    // IO Reads
-    if (biu_operation_type==0x1) {
-        if (local_address16==SD_LPT_BASE+0) { sd_spi_dataout = 0xff;      SD_SPI_Cycle();       return sd_spi_datain;  }
-        if (local_address16==SD_LPT_BASE+1) { return SD_CONFIG_BYTE;                      }
-        if (local_address16==SD_LPT_BASE+2) { return sd_scratch_register[0];              }
-        if (local_address16==SD_LPT_BASE+3) { return sd_scratch_register[1];              }
-        if (local_address16==SD_LPT_BASE+4) { return sd_scratch_register[2];              }
-        if (local_address16==SD_LPT_BASE+5) { return sd_scratch_register[3];              }
-        if (local_address16==SD_LPT_BASE+6) { return sd_scratch_register[4];              }
-        if (local_address16==SD_LPT_BASE+7) { return sd_timeout >= sd_requested_timeout;  }
-        
-        if (local_address16==0x260) {  return reg_0x260;  }
-        if (local_address16==0x261) {  return reg_0x261;  }
-        if (local_address16==0x262) {  return reg_0x262;  }
-        if (local_address16==0x263) {  return reg_0x263;  }
-
-    }
-                                    
-
-    // IO Writes
-    if (biu_operation_type==0x2) {
-        if (local_address16==SD_LPT_BASE+0) { sd_spi_dataout = (local_data&0xFF);  SD_SPI_Cycle();       return 0xEE;           }
-        if (local_address16==SD_LPT_BASE+1) { digitalWriteFast(PIN_SD_CS_n,(local_data&0x1));            return 0xEE;           }
-        if (local_address16==SD_LPT_BASE+2) { sd_scratch_register[0] = local_data;                       return 0xEE;           }
-        if (local_address16==SD_LPT_BASE+3) { sd_scratch_register[1] = local_data;                       return 0xEE;           }
-        if (local_address16==SD_LPT_BASE+4) { sd_scratch_register[2] = local_data;                       return 0xEE;           }
-        if (local_address16==SD_LPT_BASE+5) { sd_scratch_register[3] = local_data;                       return 0xEE;           }
-        if (local_address16==SD_LPT_BASE+6) { sd_scratch_register[4] = local_data;                       return 0xEE;           }
-        if (local_address16==SD_LPT_BASE+7) { sd_timeout = 0; sd_requested_timeout = local_data * 10;    return 0xEE;           }
-        
-        if (local_address16==0x260) { reg_0x260 = local_data;  return 0xEE; }
-        if (local_address16==0x261) { reg_0x261 = local_data;  return 0xEE; }
-        if (local_address16==0x262) { reg_0x262 = local_data;  return 0xEE; }
-        if (local_address16==0x263) { reg_0x263 = local_data;  return 0xEE; }
-        
-        // Set the acceleration mode
-        if ( (local_address16==0x267) && ( (local_data&0xF0)==0x90) ) {  acceleration_mode = (0x0F&local_data);   return 0xEE;   }
-    
-    }
-
-
     if ( (biu_operation & 0x2)==0x0 ) read_cycle=1; else read_cycle=0;
     
-  
-    if ( (local_address>=0xE0000) && (local_address<0xF0000) )  {    // Expanded RAM page frame
-     
-      page_base_address   = (local_address & 0xFC000);
- 
-           if (page_base_address == 0xEC000)  {  psram_address = (reg_0x263<<14) | (local_address & 0x03FFF);  }
-      else if (page_base_address == 0xE8000)  {  psram_address = (reg_0x262<<14) | (local_address & 0x03FFF);  }
-      else if (page_base_address == 0xE4000)  {  psram_address = (reg_0x261<<14) | (local_address & 0x03FFF);  }
-      else if (page_base_address == 0xE0000)  {  psram_address = (reg_0x260<<14) | (local_address & 0x03FFF);  }
-     
-
-      if (read_cycle==1) {  return PSRAM_Read(psram_address);  }
-      else               {  PSRAM_Write(psram_address , local_data); return 0xEE;  } 
-    }    
-    
-    
     
     // For HALT, just drive the S pins on the next rising edge of CLK, then exit
     //
@@ -815,31 +1000,137 @@ inline uint8_t BIU_Bus_Cycle(uint8_t biu_operation, uint32_t local_address , uin
 
     if (read_cycle==0) {
         
-        if ( (local_address >= (BOOTROM_ADDR+0x800) ) && (local_address < (BOOTROM_ADDR+0x1000) )) {
-            sd_spi_dataout = (local_data&0xFF);  SD_SPI_Cycle();
-        }
+#ifdef HOST_BUILD
+        host_bus_write(biu_operation, local_address, local_data);
+#endif
         return 0xEE; 
     }
     else
     {
+#ifdef HOST_BUILD
+        local_read_data = host_bus_read(biu_operation, local_address);
+#else
         local_read_data = read_data_array[ (GPIO6_raw_data>>16) ];  // Read the 8088 bus data, re-arranging bits through read_data_array
+#endif
+        return  local_read_data;
+    }
+    }
+}
 
 
-   // Internal BIOS ROM Selector
-   // ----------------------------
-   //
-   //if ( ((biu_operation&0xF)>=0x4) && (local_address >= 0xF0000) ) return (Test_Image[local_address-0xF0000]);   else return local_read_data;    // 64KB ROMs
-   //if ( ((biu_operation&0xF)>=0x4) && (local_address >= 0xF8000) ) return (Test_Image[local_address-0xF8000]);   else return local_read_data;    // 32KB ROMs
-   //if ( ((biu_operation&0xF)>=0x4) && (local_address >= 0xFC000) ) return (Test_Image[local_address-0xFC000]);   else return local_read_data;    // 16KB ROMs
-   if ( ((biu_operation&0xF)>=0x4) && (local_address >= 0xFE000) ) return (Test_Image[local_address-0xFE000]);      // 8K ROMs  
-   if ( ((biu_operation&0xF)>=0x4) && (local_address >= BOOTROM_ADDR) && (local_address < (BOOTROM_ADDR+0x800)) ) return (BOOTROM[local_address-BOOTROM_ADDR]);   
-   if ( ((biu_operation&0xF)>=0x4) && (local_address >= (BOOTROM_ADDR+0x800)) && (local_address < ((BOOTROM_ADDR+0x1000))) ) { sd_spi_dataout = 0xff;      SD_SPI_Cycle();       return sd_spi_datain;   }
 
-  return  local_read_data;
+// -------------------------------------------------
+// Initiate a 8088 Bus Cycle
+//   Memory cycles are routed by the policy of their 
+//   2KB page in the region table
+// -------------------------------------------------
+inline uint8_t BIU_Bus_Cycle(uint8_t biu_operation, uint32_t local_address , uint8_t local_data)  {
+    uint8_t  biu_operation_type;
+    uint32_t local_address16;
+    
     
+    biu_operation_type = biu_operation&0xF;   // Strips off byte/word nibble
+    local_address16 = local_address&0xFFFF;
+
+
+    // Memory and code cycles
+    //
+    if (biu_operation_type>=0x4) {
+        switch (region_policy[local_address/REGION_PAGE_SIZE])  {
+        
+            case REGION_INTERNAL:
+                if (biu_operation_type==0x6) { Internal_RAM_Write(local_address,local_data);  wait_for_CLK_falling_edge(); return 0xEE;  }
+                else                         { wait_for_CLK_falling_edge();  return (Internal_RAM_Read(local_address));           }
+            
+            case REGION_SHADOW_ROM:
+                if (biu_operation_type==0x6) return 0xEE;
+                else                         return (Internal_RAM_Read(local_address));
+            
+            case REGION_WRITE_THROUGH:
+                if (biu_operation_type==0x6) { Internal_RAM_Write(local_address,local_data);  return (Maximum_Mode_Bus_Cycle(biu_operation, local_address, local_data));  }
+                else                         return (Internal_RAM_Read(local_address));
+            
+            case REGION_ROM_IMAGE:
+                if (biu_operation_type==0x6) return (Maximum_Mode_Bus_Cycle(biu_operation, local_address, local_data));
+                Maximum_Mode_Bus_Cycle(biu_operation, local_address, local_data);
+                return (region_data[local_address/REGION_PAGE_SIZE][local_address&(REGION_PAGE_SIZE-1)]);
+            
+            case REGION_SD_DATA:
+                Maximum_Mode_Bus_Cycle(biu_operation, local_address, local_data);
+                if (biu_operation_type==0x6) { sd_spi_dataout = (local_data&0xFF);  SD_SPI_Cycle();  return 0xEE;           }
+                else                         { sd_spi_dataout = 0xff;               SD_SPI_Cycle();  return sd_spi_datain;  }
+            
+            case REGION_EMS:                 // Expanded RAM page frame
+                page_base_address   = (local_address & 0xFC000);
+ 
+                     if (page_base_address == 0xEC000)  {  psram_address = (reg_0x263<<14) | (local_address & 0x03FFF);  }
+                else if (page_base_address == 0xE8000)  {  psram_address = (reg_0x262<<14) | (local_address & 0x03FFF);  }
+                else if (page_base_address == 0xE4000)  {  psram_address = (reg_0x261<<14) | (local_address & 0x03FFF);  }
+                else if (page_base_address == 0xE0000)  {  psram_address = (reg_0x260<<14) | (local_address & 0x03FFF);  }
+               
+                if (biu_operation_type==0x6) {  PSRAM_Write(psram_address , local_data); return 0xEE;  } 
+                else                         {  return PSRAM_Read(psram_address);                      }
+            
+            default:
+                return (Maximum_Mode_Bus_Cycle(biu_operation, local_address, local_data));
+        }
     }
-   
-}
+
+
+    // Support for EMS, MicroSD and the region table    
+    //
+    // IO Reads
+    if (biu_operation_type==0x1) {
+        if (local_address16==SD_LPT_BASE+0) { sd_spi_dataout = 0xff;      SD_SPI_Cycle();       return sd_spi_datain;  }
+        if (local_address16==SD_LPT_BASE+1) { return SD_CONFIG_BYTE;                      }
+        if (local_address16==SD_LPT_BASE+2) { return sd_scratch_register[0];              }
+        if (local_address16==SD_LPT_BASE+3) { return sd_scratch_register[1];              }
+        if (local_address16==SD_LPT_BASE+4) { return sd_scratch_register[2];              }
+        if (local_address16==SD_LPT_BASE+5) { return sd_scratch_register[3];              }
+        if (local_address16==SD_LPT_BASE+6) { return sd_scratch_register[4];              }
+        if (local_address16==SD_LPT_BASE+7) { return sd_timeout >= sd_requested_timeout;  }
+        
+        if (local_address16==0x260) {  return reg_0x260;  }
+        if (local_address16==0x261) {  return reg_0x261;  }
+        if (local_address16==0x262) {  return reg_0x262;  }
+        if (local_address16==0x263) {  return reg_0x263;  }
+        
+        if (local_address16==0x264) {  return (region_select&0xFF);          }
+        if (local_address16==0x265) {  return (region_select>>8);            }
+        if (local_address16==0x266) {  return region_policy[region_select];  }
+
+    }
+                                    
+
+    // IO Writes
+    if (biu_operation_type==0x2) {
+        if (local_address16==SD_LPT_BASE+0) { sd_spi_dataout = (local_data&0xFF);  SD_SPI_Cycle();       return 0xEE;           }
+        if (local_address16==SD_LPT_BASE+1) { digitalWriteFast(PIN_SD_CS_n,(local_data&0x1));            return 0xEE;           }
+        if (local_address16==SD_LPT_BASE+2) { sd_scratch_register[0] = local_data;                       return 0xEE;           }
+        if (local_address16==SD_LPT_BASE+3) { sd_scratch_register[1] = local_data;                       return 0xEE;           }
+        if (local_address16==SD_LPT_BASE+4) { sd_scratch_register[2] = local_data;                       return 0xEE;           }
+        if (local_address16==SD_LPT_BASE+5) { sd_scratch_register[3] = local_data;                       return 0xEE;           }
+        if (local_address16==SD_LPT_BASE+6) { sd_scratch_register[4] = local_data;                       return 0xEE;           }
+        if (local_address16==SD_LPT_BASE+7) { sd_timeout = 0; sd_requested_timeout = local_data * 10;    return 0xEE;           }
+        
+        if (local_address16==0x260) { reg_0x260 = local_data;  return 0xEE; }
+        if (local_address16==0x261) { reg_0x261 = local_data;  return 0xEE; }
+        if (local_address16==0x262) { reg_0x262 = local_data;  return 0xEE; }
+        if (local_address16==0x263) { reg_0x263 = local_data;  return 0xEE; }
+        
+        // Select a 2KB page, then write its policy to 0x266 - the selection advances so a run of pages can be written back to back
+        if (local_address16==0x264) { region_select = (region_select&0x100) | local_data;             return 0xEE; }
+        if (local_address16==0x265) { region_select = (region_select&0x0FF) | ((local_data&0x1)<<8);  return 0xEE; }
+        if (local_address16==0x266) { Region_Set_Policy(region_select,local_data);  region_select = (region_select+1) & (REGION_PAGES-1);  return 0xEE; }
+        
+        // Set the acceleration mode
+        if ( (local_address16==0x267) && ( (local_data&0xF0)==0x90) ) {  acceleration_mode = (0x0F&local_data);  Region_Update_Acceleration();  return 0xEE;   }
+    
+    }
+
+
+
+    return (Maximum_Mode_Bus_Cycle(biu_operation, local_address, local_data));
 }
 
 
@@ -885,6 +1176,26 @@ inline uint8_t BIU_Bus_Cycle(uint8_t biu_operation, uint32_t local_address , uin
 }
 
 
+// ------------------------------------------------------
+// Accelerated bus cycle
+//   In acceleration_mode 3, reads from pages with an internal
+//   copy and writes to internal RAM pages take no bus clocks.
+//   Everything else takes the full BIU_Bus_Cycle path.
+// ------------------------------------------------------
+inline uint8_t Fast_Bus_Cycle(uint8_t biu_operation, uint32_t local_address , uint8_t local_data)  {
+    uint8_t biu_operation_type;
+    uint8_t local_policy;
+    
+    if (acceleration_mode==3)  {
+        biu_operation_type = biu_operation&0xF;
+        local_policy       = region_policy[local_address/REGION_PAGE_SIZE];
+        if ( ((biu_operation_type==0x4) || (biu_operation_type==0x5)) && region_reads_internal(local_policy) )  { sample_input_pins();  return Internal_RAM_Read(local_address);                }  // Code and memory reads
+        if (  (biu_operation_type==0x6)                               && (local_policy==REGION_INTERNAL) )     { sample_input_pins();  Internal_RAM_Write(local_address,local_data);  return 0xEE; }  // Memory writes
+    }
+    return BIU_Bus_Cycle(biu_operation, local_address, local_data);
+}
+
+
 // ------------------------------------------------------
 // Initiate Bus Interface cycles
 // ------------------------------------------------------
@@ -904,16 +1215,16 @@ uint16_t Biu_Operation(uint8_t biu_operation , uint8_t segment_overridable ,uint
    
     else if (biu_operation > 0x0F)  { // Word cycle
         local_biu_full_address = Calculate_Full_Address(segment_overridable , local_segment , local_address);
-        read_data_lower = BIU_Bus_Cycle(biu_operation, local_biu_full_address , (0x00ff&local_write_data) );
+        read_data_lower = Fast_Bus_Cycle(biu_operation, local_biu_full_address , (0x00ff&local_write_data) );
         local_address ++; // 16-bit value allows for wrapping within a segment
         local_biu_full_address = Calculate_Full_Address(segment_overridable , local_segment , local_address);
-        read_data_upper = BIU_Bus_Cycle(biu_operation, local_biu_full_address , (local_write_data>>8) );
+        read_data_upper = Fast_Bus_Cycle(biu_operation, local_biu_full_address , (local_write_data>>8) );
         read_data = (read_data_upper<<8) | read_data_lower;
     }
    
     else  {
         local_biu_full_address = Calculate_Full_Address(segment_overridable , local_segment , local_address);
-        read_data = BIU_Bus_Cycle(biu_operation, local_biu_full_address , (0x00ff&local_write_data) );
+        read_data = Fast_Bus_Cycle(biu_operation, local_biu_full_address , (0x00ff&local_write_data) );
 
     }
     return read_data;
@@ -949,6 +1260,18 @@ void pfq_add_byte()  {
 // ------------------------------------------------------
 uint8_t pfq_fetch_byte()  {
     uint8_t pfq_top_byte;
+    uint32_t local_address;
+   
+    // Accelerated code with an internal copy is read directly, bypassing the prefetch queue
+    //
+    if ( (acceleration_mode==3) && (prefetch_queue_count==0) )  {
+        local_address = ((register_cs<<4) + pfq_in_address) & 0xFFFFF;
+        if (region_reads_internal(region_policy[local_address/REGION_PAGE_SIZE]))  {
+            pfq_in_address++;
+            register_ip++;
+            return Internal_RAM_Read(local_address);
+        }
+    }
    
     if (prefetch_queue_count==0) pfq_add_byte();  // Prefetch queue empty, so must fill at least one byte in the queue
  
@@ -969,6 +1292,18 @@ uint8_t pfq_fetch_byte()  {
 // ------------------------------------------------------
 uint16_t pfq_fetch_word()  {
     uint16_t local_temp;
+    uint32_t local_address;
+   
+    // Both bytes read directly when they are in the same accelerated page and do not wrap the segment
+    //
+    if ( (acceleration_mode==3) && (prefetch_queue_count==0) && (pfq_in_address!=0xFFFF) )  {
+        local_address = ((register_cs<<4) + pfq_in_address) & 0xFFFFF;
+        if ( ((local_address&(REGION_PAGE_SIZE-1))!=(REGION_PAGE_SIZE-1)) && region_reads_internal(region_policy[local_address/REGION_PAGE_SIZE]) )  {
+            pfq_in_address = pfq_in_address + 2;
+            register_ip    = register_ip + 2;
+            return (Internal_RAM_Read(local_address+1)<<8) | Internal_RAM_Read(local_address);
+        }
+    }
     local_temp = pfq_fetch_byte();                     
     local_temp = ( pfq_fetch_byte()<<8) | local_temp;
     return local_temp;
@@ -1054,13 +1389,13 @@ void opcode_0x9E()  { clock_counter=4;  register_flags=0x02| ((register_flags&0x
 // ------------------------------------------------------
 // Set Prefixes
 // ------------------------------------------------------
-void opcode_0xF0()  { clock_counter=2; prefix_count++; prefix_flags=(prefix_flags|0x01); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF0 - LOCK  Prefix
-void opcode_0xF2()  { clock_counter=2; prefix_count++; prefix_flags=(prefix_flags|0x02); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF2 - REPNZ Prefix
-void opcode_0xF3()  { clock_counter=2; prefix_count++; prefix_flags=(prefix_flags|0x04); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF3 - REPZ  Prefix
-void opcode_0x26()  { clock_counter=2; prefix_count++; prefix_flags=(prefix_flags|0x10); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x26 - Segment Override Prefix - ES
-void opcode_0x2E()  { clock_counter=2; prefix_count++; prefix_flags=(prefix_flags|0x20); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x2E - Segment Override Prefix - CS
-void opcode_0x36()  { clock_counter=2; prefix_count++; prefix_flags=(prefix_flags|0x40); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x36 - Segment Override Prefix - SS
-void opcode_0x3E()  { clock_counter=2; prefix_count++; prefix_flags=(prefix_flags|0x80); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x3E - Segment Override Prefix - DS
+void opcode_0xF0()  { clock_counter=clock_counter+2; prefix_count++; prefix_flags=(prefix_flags|0x01); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF0 - LOCK  Prefix
+void opcode_0xF2()  { clock_counter=clock_counter+2; prefix_count++; prefix_flags=(prefix_flags|0x02); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF2 - REPNZ Prefix
+void opcode_0xF3()  { clock_counter=clock_counter+2; prefix_count++; prefix_flags=(prefix_flags|0x04); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0xF3 - REPZ  Prefix
+void opcode_0x26()  { clock_counter=clock_counter+2; prefix_count++; prefix_flags=(prefix_flags|0x10); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x26 - Segment Override Prefix - ES
+void opcode_0x2E()  { clock_counter=clock_counter+2; prefix_count++; prefix_flags=(prefix_flags|0x20); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x2E - Segment Override Prefix - CS
+void opcode_0x36()  { clock_counter=clock_counter+2; prefix_count++; prefix_flags=(prefix_flags|0x40); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x36 - Segment Override Prefix - SS
+void opcode_0x3E()  { clock_counter=clock_counter+2; prefix_count++; prefix_flags=(prefix_flags|0x80); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x3E - Segment Override Prefix - DS
 
 
 void opcode_0x98()  { clock_counter=2;  register_ax = Sign_Extended_Byte(register_ax);  return;                       }  // 0x98 - CBW - Sign extend AL Register into AH Register
@@ -1251,10 +1586,67 @@ void Write_Register(uint16_t local_regsel , uint16_t local_data )  {
     return;
 }
 
+// ------------------------------------------------------
+// ModRM decode table
+//   Indexed by the ModRM byte. Gives the default segment, the number of displacement
+//   bytes, the EA calculation clocks and the two registers summed to form the EA.
+// ------------------------------------------------------
+struct modrm_decode_entry  {
+    uint8_t    ea_is_a_register;        // MOD=11
+    uint8_t    ea_segment;              // Default segment, may be replaced by a segment override prefix
+    uint8_t    ea_displacement;         // 0, 1 or 2 displacement bytes follow the ModRM byte
+    uint8_t    ea_clocks;               // Effective address calculation clocks
+    uint16_t * ea_base;                 // EA = *ea_base + *ea_index + displacement
+    uint16_t * ea_index;
+};
+
+uint16_t register_zero=0;
+
+constexpr modrm_decode_entry modrm_decode_table[256] = {
+    // MOD=00  -  [BX+SI]  [BX+DI]  [BP+SI]  [BP+DI]  [SI]  [DI]  [disp16]  [BX]
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x00 - 0x07
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x08 - 0x0F
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x10 - 0x17
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x18 - 0x1F
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x20 - 0x27
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x28 - 0x2F
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x30 - 0x37
+    {0,SEGMENT_DS,0,7 ,&register_bx,&register_si} , {0,SEGMENT_DS,0,8 ,&register_bx,&register_di} , {0,SEGMENT_SS,0,8 ,&register_bp,&register_si} , {0,SEGMENT_SS,0,7 ,&register_bp,&register_di} , {0,SEGMENT_DS,0,5 ,&register_si,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_di,&register_zero} , {0,SEGMENT_DS,2,6 ,&register_zero,&register_zero} , {0,SEGMENT_DS,0,5 ,&register_bx,&register_zero} ,   // 0x38 - 0x3F
+    // MOD=01  -  Same registers plus a sign-extended 8-bit displacement, R/M=110 is [BP+disp8]
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x40 - 0x47
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x48 - 0x4F
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x50 - 0x57
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x58 - 0x5F
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x60 - 0x67
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x68 - 0x6F
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x70 - 0x77
+    {0,SEGMENT_DS,1,11,&register_bx,&register_si} , {0,SEGMENT_DS,1,12,&register_bx,&register_di} , {0,SEGMENT_SS,1,12,&register_bp,&register_si} , {0,SEGMENT_SS,1,11,&register_bp,&register_di} , {0,SEGMENT_DS,1,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,1,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,1,9 ,&register_bx,&register_zero} ,   // 0x78 - 0x7F
+    // MOD=10  -  Same registers plus a 16-bit displacement, R/M=110 is [BP+disp16]
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0x80 - 0x87
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0x88 - 0x8F
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0x90 - 0x97
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0x98 - 0x9F
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0xA0 - 0xA7
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0xA8 - 0xAF
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0xB0 - 0xB7
+    {0,SEGMENT_DS,2,11,&register_bx,&register_si} , {0,SEGMENT_DS,2,12,&register_bx,&register_di} , {0,SEGMENT_SS,2,12,&register_bp,&register_si} , {0,SEGMENT_SS,2,11,&register_bp,&register_di} , {0,SEGMENT_DS,2,9 ,&register_si,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_di,&register_zero} , {0,SEGMENT_SS,2,9 ,&register_bp,&register_zero} , {0,SEGMENT_DS,2,9 ,&register_bx,&register_zero} ,   // 0xB8 - 0xBF
+    // MOD=11  -  R/M selects a register
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xC0 - 0xC7
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xC8 - 0xCF
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xD0 - 0xD7
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xD8 - 0xDF
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xE0 - 0xE7
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xE8 - 0xEF
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} ,   // 0xF0 - 0xF7
+    {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero} , {1,0         ,0,0 ,&register_zero,&register_zero}     // 0xF8 - 0xFF
+};
+
+
 // ------------------------------------------------------
 // Calculate the Effective Address
 // ------------------------------------------------------
 void Calculate_EA()  {
+    const modrm_decode_entry * modrm_decode;
    
     word_operation = (0x01&opcode_first_byte);                      // Isolate the R/W bit from the opcode
     opcode_second_byte = pfq_fetch_byte();                          // Fetch the MOD/REG/RM byte from the prefetch queue
@@ -1267,47 +1659,16 @@ void Calculate_EA()  {
     REG_field_table = word_operation<<3 |  REG_field;               // Concatinate W and MOD=11 register field bits
     RM_field_table  = word_operation<<3 |  R_M_field;               // Concatinate W and R/M register field bits
 
-    ea_is_a_register=0; // Default
-
-
-    if (MOD_field==3)  ea_is_a_register=1;   
-   
-    else if (MOD_field==0)  {
-        switch (R_M_field) {
-            case 0x00:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_si;                                         clock_counter=clock_counter+7;   break;
-            case 0x01:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_di;                                         clock_counter=clock_counter+8;   break;
-            case 0x02:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_si;                                         clock_counter=clock_counter+8;   break;
-            case 0x03:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_di;                                         clock_counter=clock_counter+7;   break;
-            case 0x04:  ea_segment=SEGMENT_DS;  ea_address = register_si;                                                       clock_counter=clock_counter+5;   break;
-            case 0x05:  ea_segment=SEGMENT_DS;  ea_address = register_di;                                                       clock_counter=clock_counter+5;   break;
-            case 0x06:  ea_segment=SEGMENT_DS;  ea_address = pfq_fetch_word();                                                  clock_counter=clock_counter+6;   break;
-            case 0x07:  ea_segment=SEGMENT_DS;  ea_address = register_bx;                                                       clock_counter=clock_counter+5;   break;
-        }
+    modrm_decode = &modrm_decode_table[opcode_second_byte];
+    ea_is_a_register = modrm_decode->ea_is_a_register;
+    
+    if (ea_is_a_register==0)  {
+        ea_segment = modrm_decode->ea_segment;
+        ea_address = *modrm_decode->ea_base + *modrm_decode->ea_index;
+        if      (modrm_decode->ea_displacement==1)  ea_address = ea_address + Sign_Extended_Byte(pfq_fetch_byte());
+        else if (modrm_decode->ea_displacement==2)  ea_address = ea_address + pfq_fetch_word();
+        clock_counter = clock_counter + modrm_decode->ea_clocks;
     }
-    else if (MOD_field==1)  {
-        switch (R_M_field) {
-            case 0x00:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_si + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+11;  break;
-            case 0x01:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_di + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+12;  break;
-            case 0x02:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_si + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+12;  break;
-            case 0x03:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_di + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+11;  break;
-            case 0x04:  ea_segment=SEGMENT_DS;  ea_address = register_si               + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+9;   break;
-            case 0x05:  ea_segment=SEGMENT_DS;  ea_address = register_di               + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+9;   break;
-            case 0x06:  ea_segment=SEGMENT_SS;  ea_address = register_bp               + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+9;   break;
-            case 0x07:  ea_segment=SEGMENT_DS;  ea_address = register_bx               + Sign_Extended_Byte(pfq_fetch_byte());  clock_counter=clock_counter+9;   break;
-        }
-    }   
-    else if (MOD_field==2)  {
-        switch (R_M_field) {
-            case 0x00:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_si + pfq_fetch_word();                      clock_counter=clock_counter+11;  break;
-            case 0x01:  ea_segment=SEGMENT_DS;  ea_address = register_bx + register_di + pfq_fetch_word();                      clock_counter=clock_counter+12;  break;
-            case 0x02:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_si + pfq_fetch_word();                      clock_counter=clock_counter+12;  break;
-            case 0x03:  ea_segment=SEGMENT_SS;  ea_address = register_bp + register_di + pfq_fetch_word();                      clock_counter=clock_counter+11;  break;
-            case 0x04:  ea_segment=SEGMENT_DS;  ea_address = register_si               + pfq_fetch_word();                      clock_counter=clock_counter+9;   break;
-            case 0x05:  ea_segment=SEGMENT_DS;  ea_address = register_di               + pfq_fetch_word();                      clock_counter=clock_counter+9;   break;
-            case 0x06:  ea_segment=SEGMENT_SS;  ea_address = register_bp               + pfq_fetch_word();                      clock_counter=clock_counter+9;   break;
-            case 0x07:  ea_segment=SEGMENT_DS;  ea_address = register_bx               + pfq_fetch_word();                      clock_counter=clock_counter+9;   break;
-        }
-    }   
     return ;
 }
 
@@ -2320,6 +2681,172 @@ void opcode_0xC7() { Calculate_EA(); if (ea_is_a_register==1) clock_counter=cloc
 // String Opcodes
 // ------------------------------------------------------
 
+#define STRING_BULK_CHUNK   256         // Most elements a repeated string opcode runs between interrupt checks
+
+
+// ------------------------------------------------------
+// Number of elements, up to local_count, that stay within
+// both the segment and the 2KB region page of a string
+// ------------------------------------------------------
+uint32_t String_Bulk_Limit(uint32_t local_count , uint16_t local_offset , uint32_t local_address , uint8_t local_size)  {
+    uint32_t local_limit;
+    uint32_t local_page_offset;
+   
+    local_page_offset = local_address&(REGION_PAGE_SIZE-1);
+   
+    if (flag_d==0)  {
+        local_limit = (0x10000-local_offset)/local_size;
+        if ( ((REGION_PAGE_SIZE-local_page_offset)/local_size) < local_limit )  local_limit = (REGION_PAGE_SIZE-local_page_offset)/local_size;
+    }
+    else  {
+        if ( (local_offset+local_size > 0x10000) || (local_page_offset+local_size > REGION_PAGE_SIZE) )  return 0;     // First element wraps
+        local_limit = (local_offset/local_size) + 1;
+        if ( ((local_page_offset/local_size) + 1) < local_limit )  local_limit = (local_page_offset/local_size) + 1;
+    }
+   
+    if (local_limit < local_count)  return local_limit;  else return local_count;
+}
+
+
+// ------------------------------------------------------
+// Bulk REP string engine
+//   In acceleration_mode 3, runs up to STRING_BULK_CHUNK elements
+//   of a repeated string opcode directly on the internal copy of
+//   memory, then samples the pins once. Returns 0 when the next
+//   element must take the Biu_Operation path instead, such as when
+//   it is not in an accelerated page or it wraps a page or segment.
+// ------------------------------------------------------
+uint8_t String_Bulk(uint8_t local_opcode)  {
+    uint8_t   local_size;
+    int32_t   local_step;
+    uint8_t   local_clocks;
+    uint8_t   local_has_src;
+    uint8_t   local_has_dst;
+    uint16_t  local_src_segment;
+    uint16_t  local_data1=0;
+    uint16_t  local_data2=0;
+    int32_t   local_count;
+    int32_t   local_done;
+    uint32_t  local_length;
+    uint32_t  local_src_address=0;
+    uint32_t  local_dst_address=0;
+    uint8_t * local_src=0;
+    uint8_t * local_dst=0;
+    uint8_t * local_src_low=0;
+    uint8_t * local_dst_low=0;
+    uint8_t * local_match;
+   
+    if (acceleration_mode!=3)  return 0;
+   
+    switch (prefix_flags&0x306)  {                              // Exactly one repeat prefix
+        case 0x002:  case 0x004:  case 0x100:  case 0x200:  break;
+        default:     return 0;
+    }
+    switch (prefix_flags&0xF0)  {                               // Source segment, and the two clocks Calculate_Full_Address adds per overridden access
+        case 0x00:       local_src_segment = register_ds;  local_clocks = 0;  break;
+        case SEGMENT_ES: local_src_segment = register_es;  local_clocks = 2;  break;
+        case SEGMENT_SS: local_src_segment = register_ss;  local_clocks = 2;  break;
+        case SEGMENT_DS: local_src_segment = register_ds;  local_clocks = 2;  break;
+        case SEGMENT_CS: local_src_segment = register_cs;  local_clocks = 2;  break;
+        default:         return 0;
+    }
+   
+    local_size    = (local_opcode&0x1) + 1;
+    local_step    = (flag_d==0) ? local_size : -local_size;
+    local_has_src = (local_opcode<=0xA7) || (local_opcode==0xAC) || (local_opcode==0xAD);    // MOVS, CMPS, LODS
+    local_has_dst = (local_opcode!=0xAC) && (local_opcode!=0xAD);                            // MOVS, CMPS, STOS, SCAS
+    local_count   = (register_cx < STRING_BULK_CHUNK) ? register_cx : STRING_BULK_CHUNK;
+   
+    if (local_has_src==1)  {
+        local_src_address = ((local_src_segment<<4) + register_si) & 0xFFFFF;
+        local_count       = String_Bulk_Limit(local_count , register_si , local_src_address , local_size);
+        if ( (local_count==0) || !region_reads_internal(region_policy[local_src_address/REGION_PAGE_SIZE]) )  return 0;
+    }
+    if (local_has_dst==1)  {
+        local_dst_address = ((register_es<<4) + register_di) & 0xFFFFF;
+        local_count       = String_Bulk_Limit(local_count , register_di , local_dst_address , local_size);
+        if (local_count==0)  return 0;
+        if ( (local_opcode==0xA6) || (local_opcode==0xA7) || (local_opcode==0xAE) || (local_opcode==0xAF) )  {
+            if (!region_reads_internal(region_policy[local_dst_address/REGION_PAGE_SIZE]))  return 0;
+        }
+        else if (region_policy[local_dst_address/REGION_PAGE_SIZE]!=REGION_INTERNAL)  return 0;
+    }
+   
+    local_length = local_count*local_size;
+    if (local_has_src==1)  { local_src = Internal_RAM_Pointer(local_src_address);  local_src_low = (flag_d==0) ? local_src : local_src-(local_length-local_size);  }    // Lowest byte each string touches
+    if (local_has_dst==1)  { local_dst = Internal_RAM_Pointer(local_dst_address);  local_dst_low = (flag_d==0) ? local_dst : local_dst-(local_length-local_size);  }
+    local_done   = local_count;
+   
+    switch (local_opcode)  {
+    
+        case 0xA4:                                                              // MOVS is a memmove unless the strings overlap
+        case 0xA5:
+            if ( (local_src_low+local_length <= local_dst_low) || (local_dst_low+local_length <= local_src_low) )  memmove(local_dst_low , local_src_low , local_length);
+            else  {
+                for (int32_t i=0 ; i<local_count ; i++)  {                      // Overlapping strings repeat their pattern one element at a time
+                    local_data1 = local_src[i*local_step];  if (local_size==2) local_data2 = local_src[i*local_step+1];
+                    local_dst[i*local_step] = local_data1;  if (local_size==2) local_dst[i*local_step+1] = local_data2;
+                }
+            }
+            local_clocks = 17 + (local_clocks*local_size);
+            break;
+        
+        case 0xAA:                                                              // STOS is a memset
+        case 0xAB:
+            if ( (local_size==1) || ((register_ax>>8)==(register_ax&0xFF)) )  memset(local_dst_low , register_ax&0xFF , local_length);
+            else  {
+                for (uint32_t i=0 ; i<local_length ; i=i+2)  { local_dst_low[i] = register_ax&0xFF;  local_dst_low[i+1] = register_ax>>8; }
+            }
+            local_clocks = 10;
+            break;
+        
+        case 0xAC:                                                              // LODS keeps only the last element read
+        case 0xAD:
+            local_src = local_src + (local_count-1)*local_step;
+            if (local_size==1)  Write_Register(REG_AL , local_src[0]);
+            else                register_ax = (local_src[1]<<8) | local_src[0];
+            local_clocks = 12 + (local_clocks*local_size);
+            break;
+        
+        default:                                                                // CMPS and SCAS stop on the first element failing the repeat condition
+            if ( (local_opcode==0xAE) && (flag_d==0) && ((prefix_flags&0x306)==0x002) )  {      // REPNZ SCASB is a memchr
+                local_match = (uint8_t *) memchr(local_dst , register_ax&0xFF , local_count);
+                if (local_match!=0)  local_done = (local_match-local_dst) + 1;
+                local_data1 = register_ax&0xFF;
+                local_data2 = local_dst[local_done-1];
+            }
+            else  {
+                for (local_done=0 ; local_done<local_count ; )  {
+                    if (local_size==1)  {
+                        local_data2 = local_dst[local_done*local_step];
+                        if (local_has_src==1)  local_data1 = local_src[local_done*local_step];  else local_data1 = register_ax&0xFF;
+                    }
+                    else  {
+                        local_data2 = (local_dst[local_done*local_step+1]<<8) | local_dst[local_done*local_step];
+                        if (local_has_src==1)  local_data1 = (local_src[local_done*local_step+1]<<8) | local_src[local_done*local_step];  else local_data1 = register_ax;
+                    }
+                    local_done++;
+                         if ( ((prefix_flags&0x306)==0x004) && (local_data1!=local_data2) )  break;      // REPZ
+                    else if ( ((prefix_flags&0x306)==0x002) && (local_data1==local_data2) )  break;      // REPNZ
+                    else if ( ((prefix_flags&0x306)==0x200) && (local_data1>=local_data2) )  break;      // REPC
+                    else if ( ((prefix_flags&0x306)==0x100) && (local_data1< local_data2) )  break;      // REPNC
+                }
+            }
+            if (local_size==1)  SUB_Bytes(local_data1 , local_data2);         // Flags are those of the last comparison
+            else                SUB_Words(local_data1 , local_data2);
+            if (local_has_src==1)  local_clocks = 22 + (local_clocks*local_size);  else local_clocks = 15;
+            break;
+    }
+   
+    register_cx   = register_cx - local_done;
+    if (local_has_src==1)  register_si = register_si + local_done*local_step;
+    if (local_has_dst==1)  register_di = register_di + local_done*local_step;
+    clock_counter = clock_counter + local_done*local_clocks;
+   
+    sample_input_pins();
+    return 1;
+}
+
 // ------------------------------------------------------
 // # 0xA4 - MOVSB - Move String - Byte
 // ------------------------------------------------------
@@ -2333,6 +2860,7 @@ void opcode_0xA4() {
       if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1)  || (prefix_repnc==1)  )  {
           if (register_cx==0)                                         return;                     // Exit from loop if repeat prefix and CX=0
                                 if (interrupt_pending==1) { register_ip = register_ip - (prefix_count+1);  return; }                   // Exit from loop to service interrupt - adjusting IP to address of prefix
+                                if (String_Bulk(0xA4)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
                                 register_cx--;
                              }
        
@@ -2363,6 +2891,7 @@ void opcode_0xA5() {
       if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1)  || (prefix_repnc==1)  )  {
           if (register_cx==0)                                         return;                     // Exit from loop if repeat prefix and CX=0
                                 if (interrupt_pending==1) { register_ip = register_ip -(prefix_count+1);  return; }                   // Exit from loop to service interrupt - adjusting IP to address of prefix
+                                if (String_Bulk(0xA5)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
                                 register_cx--;
                              }
        
@@ -2395,6 +2924,7 @@ void opcode_0xA6() {
        if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1) || (prefix_repnc==1) )  {
           if (register_cx==0)                                                        return;        // Exit from loop if repeat prefix and CX=0
           if (interrupt_pending==1) { register_ip = register_ip - (prefix_count+1);  return; }      // Exit from loop to service interrupt - adjusting IP to address of prefix
+          if (String_Bulk(0xA6)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
           register_cx--;
         }
        
@@ -2428,6 +2958,7 @@ void opcode_0xA7() {
         if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1) || (prefix_repnc==1) )  {
           if (register_cx==0)                                                        return;        // Exit from loop if repeat prefix and CX=0
           if (interrupt_pending==1) { register_ip = register_ip - (prefix_count+1);  return; }      // Exit from loop to service interrupt - adjusting IP to address of prefix
+          if (String_Bulk(0xA7)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
           register_cx--;
         }
        
@@ -2458,6 +2989,7 @@ void opcode_0xAA() {
         if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1) || (prefix_repnc==1) )  {
           if (register_cx==0)                                         return;                     // Exit from loop if repeat prefix and CX=0
                                 if (interrupt_pending==1) { register_ip = register_ip - (prefix_count+1);  return; }                   // Exit from loop to service interrupt - adjusting IP to address of prefix
+                                if (String_Bulk(0xAA)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
                                 register_cx--;
                              }
        
@@ -2486,6 +3018,7 @@ void opcode_0xAB() {
         if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1) || (prefix_repnc==1) )  {
           if (register_cx==0)                                         return;                     // Exit from loop if repeat prefix and CX=0
                                 if (interrupt_pending==1) { register_ip = register_ip - (prefix_count+1);  return; }                   // Exit from loop to service interrupt - adjusting IP to address of prefix
+                                if (String_Bulk(0xAB)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
                                 register_cx--;
                              }
        
@@ -2515,6 +3048,7 @@ void opcode_0xAC() {
       if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1)  || (prefix_repnc==1)  )  {
           if (register_cx==0)                                         return;                     // Exit from loop if repeat prefix and CX=0
                                 if (interrupt_pending==1) { register_ip = register_ip - (prefix_count+1);  return; }                   // Exit from loop to service interrupt - adjusting IP to address of prefix
+                                if (String_Bulk(0xAC)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
                                 register_cx--;
                              }
        
@@ -2545,6 +3079,7 @@ void opcode_0xAD() {
       if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1)  || (prefix_repnc==1)  )  {
           if (register_cx==0)                                         return;                     // Exit from loop if repeat prefix and CX=0
                                 if (interrupt_pending==1) { register_ip = register_ip - (prefix_count+1);  return; }                   // Exit from loop to service interrupt - adjusting IP to address of prefix
+                                if (String_Bulk(0xAD)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
                                 register_cx--;
                              }
        
@@ -2576,6 +3111,7 @@ void opcode_0xAE() {
       if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1)  || (prefix_repnc==1)  )  {
           if (register_cx==0)                                         return;        // Exit from loop if repeat prefix and CX=0
                                                          if (interrupt_pending==1) { register_ip = register_ip - (prefix_count+1);  return; }      // Exit from loop to service interrupt - adjusting IP to address of prefix
+                                                         if (String_Bulk(0xAE)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
                                                          register_cx--;
                                                       }
        
@@ -2607,6 +3143,7 @@ void opcode_0xAF() {
       if ( (prefix_repz==1) || (prefix_repnz==1) || (prefix_repc==1)  || (prefix_repnc==1)  )  {
           if (register_cx==0)                                         return;        // Exit from loop if repeat prefix and CX=0
                                                          if (interrupt_pending==1) { register_ip = register_ip - (prefix_count+1);  return; }      // Exit from loop to service interrupt - adjusting IP to address of prefix
+                                                         if (String_Bulk(0xAF)==1)  { if ( (nmi_latched==1) || (direct_intr_raw!=0 && (flag_i)!=0) ) interrupt_pending=1; else interrupt_pending=0;  continue; }   // Chunk run directly on internal memory
                                                          register_cx--;
                                                       }
        
@@ -2720,6 +3257,7 @@ void opcode_0xF7()  {
     int32_t  signed_local_numr;
     int16_t  signed_local_divr;
     uint64_t local_overflow_test;
+    int32_t  local_overflow_test2;
 
 
     Calculate_EA();  
@@ -3450,8 +3988,8 @@ void opcode_0x63() {
 // ------------------------------------------------------
 // V20 New String Repeat Prefixes
 // ------------------------------------------------------
-void opcode_0x64() {  clock_counter=2; prefix_count++; prefix_flags=(prefix_flags|0x100); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x64 - REPNC Prefix
-void opcode_0x65() {  clock_counter=2; prefix_count++; prefix_flags=(prefix_flags|0x200); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x65 - REPC Prefix
+void opcode_0x64() {  clock_counter=clock_counter+2; prefix_count++; prefix_flags=(prefix_flags|0x100); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x64 - REPNC Prefix
+void opcode_0x65() {  clock_counter=clock_counter+2; prefix_count++; prefix_flags=(prefix_flags|0x200); last_instruction_set_a_prefix=1; pause_interrupts=1; return;  }  // 0x65 - REPC Prefix
 
 
 
@@ -3688,273 +4226,71 @@ void opcode_0x0F()  {
 
 
 
+// ------------------------------------------------------------------------------------------------------------
+// Opcode handler table - indexed by the first byte of the opcode
+// ------------------------------------------------------------------------------------------------------------
+constexpr void (*opcode_table[256])() = {
+    opcode_0x00 , opcode_0x01 , opcode_0x02 , opcode_0x03 , opcode_0x04 , opcode_0x05 , opcode_0x06 , opcode_0x07 ,   // 0x00
+    opcode_0x08 , opcode_0x09 , opcode_0x0A , opcode_0x0B , opcode_0x0C , opcode_0x0D , opcode_0x0E , opcode_0x0F ,   // 0x08
+    opcode_0x10 , opcode_0x11 , opcode_0x12 , opcode_0x13 , opcode_0x14 , opcode_0x15 , opcode_0x16 , opcode_0x17 ,   // 0x10
+    opcode_0x18 , opcode_0x19 , opcode_0x1A , opcode_0x1B , opcode_0x1C , opcode_0x1D , opcode_0x1E , opcode_0x1F ,   // 0x18
+    opcode_0x20 , opcode_0x21 , opcode_0x22 , opcode_0x23 , opcode_0x24 , opcode_0x25 , opcode_0x26 , opcode_0x27 ,   // 0x20
+    opcode_0x28 , opcode_0x29 , opcode_0x2A , opcode_0x2B , opcode_0x2C , opcode_0x2D , opcode_0x2E , opcode_0x2F ,   // 0x28
+    opcode_0x30 , opcode_0x31 , opcode_0x32 , opcode_0x33 , opcode_0x34 , opcode_0x35 , opcode_0x36 , opcode_0x37 ,   // 0x30
+    opcode_0x38 , opcode_0x39 , opcode_0x3A , opcode_0x3B , opcode_0x3C , opcode_0x3D , opcode_0x3E , opcode_0x3F ,   // 0x38
+    opcode_0x40 , opcode_0x41 , opcode_0x42 , opcode_0x43 , opcode_0x44 , opcode_0x45 , opcode_0x46 , opcode_0x47 ,   // 0x40
+    opcode_0x48 , opcode_0x49 , opcode_0x4A , opcode_0x4B , opcode_0x4C , opcode_0x4D , opcode_0x4E , opcode_0x4F ,   // 0x48
+    opcode_0x50 , opcode_0x51 , opcode_0x52 , opcode_0x53 , opcode_0x54 , opcode_0x55 , opcode_0x56 , opcode_0x57 ,   // 0x50
+    opcode_0x58 , opcode_0x59 , opcode_0x5A , opcode_0x5B , opcode_0x5C , opcode_0x5D , opcode_0x5E , opcode_0x5F ,   // 0x58
+    opcode_0x60 , opcode_0x61 , opcode_0x62 , opcode_0x63 , opcode_0x64 , opcode_0x65 , opcode_0x66 , opcode_0x77 ,   // 0x60
+    opcode_0x68 , opcode_0x69 , opcode_0x6A , opcode_0x6B , opcode_0x6C , opcode_0x6D , opcode_0x6E , opcode_0x6F ,   // 0x68
+    opcode_0x70 , opcode_0x71 , opcode_0x72 , opcode_0x73 , opcode_0x74 , opcode_0x75 , opcode_0x76 , opcode_0x77 ,   // 0x70
+    opcode_0x78 , opcode_0x79 , opcode_0x7A , opcode_0x7B , opcode_0x7C , opcode_0x7D , opcode_0x7E , opcode_0x7F ,   // 0x78
+    opcode_0x80 , opcode_0x81 , opcode_0x80 , opcode_0x83 , opcode_0x84 , opcode_0x85 , opcode_0x86 , opcode_0x87 ,   // 0x80
+    opcode_0x88 , opcode_0x89 , opcode_0x8A , opcode_0x8B , opcode_0x8C , opcode_0x8D , opcode_0x8E , opcode_0x8F ,   // 0x88
+    opcode_0x90 , opcode_0x91 , opcode_0x92 , opcode_0x93 , opcode_0x94 , opcode_0x95 , opcode_0x96 , opcode_0x97 ,   // 0x90
+    opcode_0x98 , opcode_0x99 , opcode_0x9A , opcode_0x9B , opcode_0x9C , opcode_0x9D , opcode_0x9E , opcode_0x9F ,   // 0x98
+    opcode_0xA0 , opcode_0xA1 , opcode_0xA2 , opcode_0xA3 , opcode_0xA4 , opcode_0xA5 , opcode_0xA6 , opcode_0xA7 ,   // 0xA0
+    opcode_0xA8 , opcode_0xA9 , opcode_0xAA , opcode_0xAB , opcode_0xAC , opcode_0xAD , opcode_0xAE , opcode_0xAF ,   // 0xA8
+    opcode_0xB0 , opcode_0xB1 , opcode_0xB2 , opcode_0xB3 , opcode_0xB4 , opcode_0xB5 , opcode_0xB6 , opcode_0xB7 ,   // 0xB0
+    opcode_0xB8 , opcode_0xB9 , opcode_0xBA , opcode_0xBB , opcode_0xBC , opcode_0xBD , opcode_0xBE , opcode_0xBF ,   // 0xB8
+    opcode_0xC0 , opcode_0xC1 , opcode_0xC2 , opcode_0xC3 , opcode_0xC4 , opcode_0xC5 , opcode_0xC6 , opcode_0xC7 ,   // 0xC0
+    opcode_0xC8 , opcode_0xC9 , opcode_0xCA , opcode_0xCB , opcode_0xCC , opcode_0xCD , opcode_0xCE , opcode_0xCF ,   // 0xC8
+    opcode_0xD0 , opcode_0xD1 , opcode_0xD2 , opcode_0xD3 , opcode_0xD4 , opcode_0xD5 , opcode_0xD6 , opcode_0xD7 ,   // 0xD0
+    opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 , opcode_0xD8 ,   // 0xD8
+    opcode_0xE0 , opcode_0xE1 , opcode_0xE2 , opcode_0xE3 , opcode_0xE4 , opcode_0xE5 , opcode_0xE6 , opcode_0xE7 ,   // 0xE0
+    opcode_0xE8 , opcode_0xE9 , opcode_0xEA , opcode_0xEB , opcode_0xEC , opcode_0xED , opcode_0xEE , opcode_0xEF ,   // 0xE8
+    opcode_0xF0 , opcode_0xF0 , opcode_0xF2 , opcode_0xF3 , opcode_0xF4 , opcode_0xF5 , opcode_0xF6 , opcode_0xF7 ,   // 0xF0
+    opcode_0xF8 , opcode_0xF9 , opcode_0xFA , opcode_0xFB , opcode_0xFC , opcode_0xFD , opcode_0xFE , opcode_0xFF     // 0xF8
+};
+
+#define opcode_is_prefix(op)  ( ((op)&0xE7)==0x26 || ((op)&0xFC)==0xF0 || ((op)&0xFE)==0x64 )      // ES: CS: SS: DS: LOCK REPNZ REPZ REPNC REPC
+
+
 // ------------------------------------------------------------------------------------------------------------
 // Decode the first byte of the opcode
+//   Prefixes are executed here and the following opcode is dispatched straight away, so interrupts
+//   and the main loop are never entered between a prefix and its instruction.
+//   Each prefix's clocks are spent filling the prefetch queue the same way the main loop spends them
+//   between instructions, so the clock count is unchanged from running the prefix on its own.
 // ------------------------------------------------------------------------------------------------------------
 void execute_new_instruction()  {
     
     opcode_first_byte = pfq_fetch_byte();
-
-    switch (opcode_first_byte)  {
-        
-        case 0x00:  opcode_0x00();   break; 
-        case 0x01:  opcode_0x01();   break; 
-        case 0x02:  opcode_0x02();   break; 
-        case 0x03:  opcode_0x03();   break; 
-        case 0x04:  opcode_0x04();   break; 
-        case 0x05:  opcode_0x05();   break; 
-        case 0x06:  opcode_0x06();   break; 
-        case 0x07:  opcode_0x07();   break; 
-        case 0x08:  opcode_0x08();   break; 
-        case 0x09:  opcode_0x09();   break; 
-        case 0x0A:  opcode_0x0A();   break; 
-        case 0x0B:  opcode_0x0B();   break; 
-        case 0x0C:  opcode_0x0C();   break; 
-        case 0x0D:  opcode_0x0D();   break; 
-        case 0x0E:  opcode_0x0E();   break; 
-        case 0x0F:  opcode_0x0F();   break; 
-        case 0x10:  opcode_0x10();   break; 
-        case 0x11:  opcode_0x11();   break; 
-        case 0x12:  opcode_0x12();   break; 
-        case 0x13:  opcode_0x13();   break; 
-        case 0x14:  opcode_0x14();   break; 
-        case 0x15:  opcode_0x15();   break; 
-        case 0x16:  opcode_0x16();   break; 
-        case 0x17:  opcode_0x17();   break; 
-        case 0x18:  opcode_0x18();   break; 
-        case 0x19:  opcode_0x19();   break; 
-        case 0x1A:  opcode_0x1A();   break; 
-        case 0x1B:  opcode_0x1B();   break; 
-        case 0x1C:  opcode_0x1C();   break; 
-        case 0x1D:  opcode_0x1D();   break; 
-        case 0x1E:  opcode_0x1E();   break; 
-        case 0x1F:  opcode_0x1F();   break; 
-        case 0x20:  opcode_0x20();   break; 
-        case 0x21:  opcode_0x21();   break; 
-        case 0x22:  opcode_0x22();   break; 
-        case 0x23:  opcode_0x23();   break; 
-        case 0x24:  opcode_0x24();   break; 
-        case 0x25:  opcode_0x25();   break; 
-        case 0x26:  opcode_0x26();   break; 
-        case 0x27:  opcode_0x27();   break; 
-        case 0x28:  opcode_0x28();   break; 
-        case 0x29:  opcode_0x29();   break; 
-        case 0x2A:  opcode_0x2A();   break; 
-        case 0x2B:  opcode_0x2B();   break; 
-        case 0x2C:  opcode_0x2C();   break; 
-        case 0x2D:  opcode_0x2D();   break; 
-        case 0x2E:  opcode_0x2E();   break; 
-        case 0x2F:  opcode_0x2F();   break; 
-        case 0x30:  opcode_0x30();   break; 
-        case 0x31:  opcode_0x31();   break; 
-        case 0x32:  opcode_0x32();   break; 
-        case 0x33:  opcode_0x33();   break; 
-        case 0x34:  opcode_0x34();   break; 
-        case 0x35:  opcode_0x35();   break; 
-        case 0x36:  opcode_0x36();   break; 
-        case 0x37:  opcode_0x37();   break; 
-        case 0x38:  opcode_0x38();   break; 
-        case 0x39:  opcode_0x39();   break; 
-        case 0x3A:  opcode_0x3A();   break; 
-        case 0x3B:  opcode_0x3B();   break; 
-        case 0x3C:  opcode_0x3C();   break; 
-        case 0x3D:  opcode_0x3D();   break; 
-        case 0x3E:  opcode_0x3E();   break; 
-        case 0x3F:  opcode_0x3F();   break; 
-        case 0x40:  opcode_0x40();   break; 
-        case 0x41:  opcode_0x41();   break; 
-        case 0x42:  opcode_0x42();   break; 
-        case 0x43:  opcode_0x43();   break; 
-        case 0x44:  opcode_0x44();   break; 
-        case 0x45:  opcode_0x45();   break; 
-        case 0x46:  opcode_0x46();   break; 
-        case 0x47:  opcode_0x47();   break; 
-        case 0x48:  opcode_0x48();   break; 
-        case 0x49:  opcode_0x49();   break; 
-        case 0x4A:  opcode_0x4A();   break; 
-        case 0x4B:  opcode_0x4B();   break; 
-        case 0x4C:  opcode_0x4C();   break; 
-        case 0x4D:  opcode_0x4D();   break; 
-        case 0x4E:  opcode_0x4E();   break; 
-        case 0x4F:  opcode_0x4F();   break; 
-        case 0x50:  opcode_0x50();   break; 
-        case 0x51:  opcode_0x51();   break; 
-        case 0x52:  opcode_0x52();   break; 
-        case 0x53:  opcode_0x53();   break; 
-        case 0x54:  opcode_0x54();   break; 
-        case 0x55:  opcode_0x55();   break; 
-        case 0x56:  opcode_0x56();   break; 
-        case 0x57:  opcode_0x57();   break; 
-        case 0x58:  opcode_0x58();   break; 
-        case 0x59:  opcode_0x59();   break; 
-        case 0x5A:  opcode_0x5A();   break; 
-        case 0x5B:  opcode_0x5B();   break; 
-        case 0x5C:  opcode_0x5C();   break; 
-        case 0x5D:  opcode_0x5D();   break; 
-        case 0x5E:  opcode_0x5E();   break; 
-        case 0x5F:  opcode_0x5F();   break; 
-        case 0x60:  opcode_0x60();   break; 
-        case 0x61:  opcode_0x61();   break; 
-        case 0x62:  opcode_0x62();   break; 
-        case 0x63:  opcode_0x63();   break; 
-        case 0x64:  opcode_0x64();   break; 
-        case 0x65:  opcode_0x65();   break; 
-        case 0x66:  opcode_0x66();   break; 
-        case 0x67:  opcode_0x77();   break; 
-        case 0x68:  opcode_0x68();   break; 
-        case 0x69:  opcode_0x69();   break; 
-        case 0x6A:  opcode_0x6A();   break; 
-        case 0x6B:  opcode_0x6B();   break; 
-        case 0x6C:  opcode_0x6C();   break; 
-        case 0x6D:  opcode_0x6D();   break; 
-        case 0x6E:  opcode_0x6E();   break; 
-        case 0x6F:  opcode_0x6F();   break; 
-        case 0x70:  opcode_0x70();   break; 
-        case 0x71:  opcode_0x71();   break; 
-        case 0x72:  opcode_0x72();   break; 
-        case 0x73:  opcode_0x73();   break; 
-        case 0x74:  opcode_0x74();   break; 
-        case 0x75:  opcode_0x75();   break; 
-        case 0x76:  opcode_0x76();   break; 
-        case 0x77:  opcode_0x77();   break; 
-        case 0x78:  opcode_0x78();   break; 
-        case 0x79:  opcode_0x79();   break; 
-        case 0x7A:  opcode_0x7A();   break; 
-        case 0x7B:  opcode_0x7B();   break; 
-        case 0x7C:  opcode_0x7C();   break; 
-        case 0x7D:  opcode_0x7D();   break; 
-        case 0x7E:  opcode_0x7E();   break; 
-        case 0x7F:  opcode_0x7F();   break; 
-        case 0x80:  opcode_0x80();   break; 
-        case 0x81:  opcode_0x81();   break; 
-        case 0x82:  opcode_0x80();   break; 
-        case 0x83:  opcode_0x83();   break; 
-        case 0x84:  opcode_0x84();   break; 
-        case 0x85:  opcode_0x85();   break; 
-        case 0x86:  opcode_0x86();   break; 
-        case 0x87:  opcode_0x87();   break; 
-        case 0x88:  opcode_0x88();   break; 
-        case 0x89:  opcode_0x89();   break; 
-        case 0x8A:  opcode_0x8A();   break; 
-        case 0x8B:  opcode_0x8B();   break; 
-        case 0x8C:  opcode_0x8C();   break; 
-        case 0x8D:  opcode_0x8D();   break; 
-        case 0x8E:  opcode_0x8E();   break; 
-        case 0x8F:  opcode_0x8F();   break; 
-        case 0x90:  opcode_0x90();   break;   
-        case 0x91:  opcode_0x91();   break;  
-        case 0x92:  opcode_0x92();   break;  
-        case 0x93:  opcode_0x93();   break;  
-        case 0x94:  opcode_0x94();   break;  
-        case 0x95:  opcode_0x95();   break;  
-        case 0x96:  opcode_0x96();   break;  
-        case 0x97:  opcode_0x97();   break;  
-        case 0x98:  opcode_0x98();   break; 
-        case 0x99:  opcode_0x99();   break; 
-        case 0x9A:  opcode_0x9A();   break; 
-        case 0x9B:  opcode_0x9B();   break; 
-        case 0x9C:  opcode_0x9C();   break; 
-        case 0x9D:  opcode_0x9D();   break; 
-        case 0x9E:  opcode_0x9E();   break; 
-        case 0x9F:  opcode_0x9F();   break; 
-        case 0xA0:  opcode_0xA0();   break; 
-        case 0xA1:  opcode_0xA1();   break; 
-        case 0xA2:  opcode_0xA2();   break; 
-        case 0xA3:  opcode_0xA3();   break; 
-        case 0xA4:  opcode_0xA4();   break; 
-        case 0xA5:  opcode_0xA5();   break; 
-        case 0xA6:  opcode_0xA6();   break; 
-        case 0xA7:  opcode_0xA7();   break; 
-        case 0xA8:  opcode_0xA8();   break; 
-        case 0xA9:  opcode_0xA9();   break; 
-        case 0xAA:  opcode_0xAA();   break; 
-        case 0xAB:  opcode_0xAB();   break; 
-        case 0xAC:  opcode_0xAC();   break; 
-        case 0xAD:  opcode_0xAD();   break; 
-        case 0xAE:  opcode_0xAE();   break; 
-        case 0xAF:  opcode_0xAF();   break; 
-        case 0xB0:  opcode_0xB0();   break; 
-        case 0xB1:  opcode_0xB1();   break; 
-        case 0xB2:  opcode_0xB2();   break; 
-        case 0xB3:  opcode_0xB3();   break; 
-        case 0xB4:  opcode_0xB4();   break; 
-        case 0xB5:  opcode_0xB5();   break; 
-        case 0xB6:  opcode_0xB6();   break; 
-        case 0xB7:  opcode_0xB7();   break; 
-        case 0xB8:  opcode_0xB8();   break; 
-        case 0xB9:  opcode_0xB9();   break; 
-        case 0xBA:  opcode_0xBA();   break; 
-        case 0xBB:  opcode_0xBB();   break; 
-        case 0xBC:  opcode_0xBC();   break; 
-        case 0xBD:  opcode_0xBD();   break; 
-        case 0xBE:  opcode_0xBE();   break; 
-        case 0xBF:  opcode_0xBF();   break; 
-        case 0xC0:  opcode_0xC0();   break; 
-        case 0xC1:  opcode_0xC1();   break; 
-        case 0xC2:  opcode_0xC2();   break; 
-        case 0xC3:  opcode_0xC3();   break; 
-        case 0xC4:  opcode_0xC4();   break; 
-        case 0xC5:  opcode_0xC5();   break; 
-        case 0xC6:  opcode_0xC6();   break; 
-        case 0xC7:  opcode_0xC7();   break; 
-        case 0xC8:  opcode_0xC8();   break; 
-        case 0xC9:  opcode_0xC9();   break; 
-        case 0xCA:  opcode_0xCA();   break; 
-        case 0xCB:  opcode_0xCB();   break; 
-        case 0xCC:  opcode_0xCC();   break; 
-        case 0xCD:  opcode_0xCD();   break; 
-        case 0xCE:  opcode_0xCE();   break; 
-        case 0xCF:  opcode_0xCF();   break; 
-        case 0xD0:  opcode_0xD0();   break; 
-        case 0xD1:  opcode_0xD1();   break; 
-        case 0xD2:  opcode_0xD2();   break; 
-        case 0xD3:  opcode_0xD3();   break; 
-        case 0xD4:  opcode_0xD4();   break; 
-        case 0xD5:  opcode_0xD5();   break; 
-        case 0xD6:  opcode_0xD6();   break; 
-        case 0xD7:  opcode_0xD7();   break; 
-        case 0xD8:  opcode_0xD8();   break; 
-        case 0xD9:  opcode_0xD8();   break; 
-        case 0xDA:  opcode_0xD8();   break; 
-        case 0xDB:  opcode_0xD8();   break; 
-        case 0xDC:  opcode_0xD8();   break; 
-        case 0xDD:  opcode_0xD8();   break; 
-        case 0xDE:  opcode_0xD8();   break; 
-        case 0xDF:  opcode_0xD8();   break; 
-        case 0xE0:  opcode_0xE0();   break; 
-        case 0xE1:  opcode_0xE1();   break; 
-        case 0xE2:  opcode_0xE2();   break; 
-        case 0xE3:  opcode_0xE3();   break; 
-        case 0xE4:  opcode_0xE4();   break; 
-        case 0xE5:  opcode_0xE5();   break; 
-        case 0xE6:  opcode_0xE6();   break; 
-        case 0xE7:  opcode_0xE7();   break; 
-        case 0xE8:  opcode_0xE8();   break; 
-        case 0xE9:  opcode_0xE9();   break; 
-        case 0xEA:  opcode_0xEA();   break; 
-        case 0xEB:  opcode_0xEB();   break; 
-        case 0xEC:  opcode_0xEC();   break; 
-        case 0xED:  opcode_0xED();   break; 
-        case 0xEE:  opcode_0xEE();   break; 
-        case 0xEF:  opcode_0xEF();   break; 
-        case 0xF0:  opcode_0xF0();   break; 
-        case 0xF1:  opcode_0xF0();   break; 
-        case 0xF2:  opcode_0xF2();   break; 
-        case 0xF3:  opcode_0xF3();   break; 
-        case 0xF4:  opcode_0xF4();   break; 
-        case 0xF5:  opcode_0xF5();   break;   
-        case 0xF6:  opcode_0xF6();   break;  
-        case 0xF7:  opcode_0xF7();   break;  
-        case 0xF8:  opcode_0xF8();   break;   
-        case 0xF9:  opcode_0xF9();   break;   
-        case 0xFA:  opcode_0xFA();   break;  
-        case 0xFB:  opcode_0xFB();   break;  
-        case 0xFC:  opcode_0xFC();   break;   
-        case 0xFD:  opcode_0xFD();   break;   
-        case 0xFE:  opcode_0xFE();   break;   
-        case 0xFF:  opcode_0xFF();   break;   
-      }
-return;
+    
+    while (opcode_is_prefix(opcode_first_byte))  {
+        opcode_table[opcode_first_byte]();
+        while ( (clock_counter>0) && (acceleration_mode==0) ) {
+          if (prefetch_queue_count<4) { pfq_add_byte();               }
+          else                        { wait_for_CLK_falling_edge();  }
+        }
+        opcode_first_byte = pfq_fetch_byte();
+    }
+    
+    last_instruction_set_a_prefix=0;
+    pause_interrupts=0;
+    opcode_table[opcode_first_byte]();
+    return;
 }
 
 
@@ -3976,6 +4312,9 @@ return;
   prefetch_queue_count=0; 
   
   PSRAM_Configure();
+  PSRAM_Cache_Invalidate();
+  
+  Region_Init();
 
   reset_sequence();
 
@@ -3983,7 +4322,9 @@ return;
 
   while(1) {
 
-
+#ifdef HOST_BUILD
+      if (host_stop!=0) return;                 // Benchmark clock budget has expired
+#endif
     
       if (direct_reset_raw!=0) reset_sequence();
       
@@ -3996,6 +4337,16 @@ return;
       }  
       
       
+      // While entering acceleration, spend the clocks the last instruction would have taken on shadowing motherboard RAM
+      //
+      while ( (acceleration_mode==3) && (shadow_pages_pending!=0) && (clock_counter>=4) )  Shadow_Background_Fill();
+      
+      
+      // Internal RAM accesses do not wait for CLK when accelerated, so sample the pins once per instruction
+      //
+      if (acceleration_mode==3) sample_input_pins();
+      
+      
       // Dont poll for interrupts between a Prefixes and instructions
       //
       if (pause_interrupts==0){  
@@ -4012,11 +4363,11 @@ return;
       pause_interrupts=0;
       execute_new_instruction();   
       if (last_instruction_set_a_prefix==0) { prefix_flags=0x00; prefix_count=0; }
+#ifdef HOST_BUILD
+      if (last_instruction_set_a_prefix==0) host_instructions++;
+#endif
 
-      if  (acceleration_mode==0x2)  {
-        for (uint32_t j=0; j < 0xA0000; j++)  {  Internal_RAM_Write(j, BIU_Bus_Cycle(MEM_READ_BYTE  , j , 0x00) ); }
-        acceleration_mode = 0x3;
-        }
+      if  (acceleration_mode==0x2)  Shadow_Begin();
   }
  } 
     
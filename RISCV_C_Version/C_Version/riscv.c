@@ -9,7 +9,38 @@
 // Description:
 // ============
 //  
-// Simple and compact RISC-V RS32I implementation written in C.
+// Simple and compact RISC-V RV32IM implementation written in C.
+//
+// Usage:
+//   riscv [options] [program]  Single-step the reference interpreter, printing every instruction
+//   riscv -b [options] program Batch run of the reference interpreter
+//   riscv -p [options] program Batch run of the predecoded engine
+//   riscv -x [options] program Batch run of translated code, x86-64 hosts only (-p elsewhere, or with -t)
+//         -m <size>            Guest memory size in bytes, K and M suffixes allowed (default 16M)
+//         -a <address>         Load address for flat binaries (default 0)
+//         -n <count>           Halt after <count> instructions
+//         -t <file>            Keep a trace ring buffer and write it to <file> on halt
+//         -T <entries>         Size of the trace ring buffer, rounded up to a power of two (default 65536)
+//         -j <threads>         Worker threads when running several programs (default all CPUs)
+//         -H <count>           Run <count> harts of each program (default 1)
+//   riscv -d <file>            Print a trace file
+//
+// Giving more than one program, or -H, runs each as an independent hart on
+// a pool of worker threads and prints one result line per hart. The exit
+// status is then 0 only if every hart halted on ECALL/EBREAK with a0==0.
+// Harts of the same program share its file pages through the host page
+// cache; each hart's stores stay private to it.
+//
+// The program is either a flat binary, which starts at its load address, or a 
+// 32-bit RISC-V ELF executable whose PT_LOAD segments are placed at their
+// p_vaddr and which starts at e_entry.
+// Guest memory is a single byte-addressable region starting at address 0.
+// Misaligned LH/LHU/LW/SH/SW and jump targets halt the core, as do accesses
+// beyond the end of memory. The host is assumed to be little-endian.
+//
+// In batch mode ECALL and EBREAK halt the core and the exit status is a0 (x10).
+// Running out of budget exits with 124, an invalid instruction or a memory 
+// fault exits with 125.
 //
 //------------------------------------------------------------------------
 //
@@ -22,6 +53,31 @@
 // Revision 2 4/3/2020
 // Fixed BLTU
 //
+// Revision 3 10/18/2026
+// Added the predecoded, threaded-dispatch execution engine
+// Registers and memory are now explicitly 32-bits wide so the engines behave the same on 64-bit hosts
+// JALR now reads rs1 before writing rd, SLTI compares against the signed immediate
+//
+// Revision 4 10/18/2026
+// Added a batch run mode with an instruction budget and ECALL/EBREAK halt
+// Added a binary trace ring buffer which is written out on halt, and a trace printer
+//
+// Revision 5 10/18/2026
+// Code and data now share one byte-addressable guest memory, mmap'd and sized from the command line
+// Loads and stores are range and alignment checked, stores invalidate predecoded instructions
+// Added a flat binary and ELF loader which maps the file into guest memory
+//
+// Revision 6 10/18/2026
+// Moved all core state into a hart context so many harts can run in one process
+// Added a multi-threaded, work-stealing runner for many independent programs
+//
+// Revision 7 10/18/2026
+// Added a basic block translator to x86-64 code with block chaining, the interpreters remain the reference
+//
+// Revision 8 10/18/2026
+// Added the RV32M multiply and divide instructions
+// SRA and SRAI shift in one step instead of one bit per loop, and no longer misread rs2 when rd==rs2
+//
 //
 //------------------------------------------------------------------------
 //
@@ -48,6 +104,17 @@
 //------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <elf.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #define U_immediate rv5_opcode >> 12
 #define J_immediate_SE (rv5_opcode&0x80000000) ? 0xFFE00000 | (rv5_opcode&0x000FF000) | (rv5_opcode&0x00100000)>>9 | (rv5_opcode&0x80000000)>>11 | (rv5_opcode&0x7FE00000)>>20 : (rv5_opcode&0x000FF000) | (rv5_opcode&0x00100000)>>9 | (rv5_opcode&0x80000000)>>11 | (rv5_opcode&0x7FE00000)>>20  
@@ -63,71 +130,1479 @@
 #define opcode ((rv5_opcode&0x0000007F) )
 
 
-unsigned int shamt;
-unsigned long rv5_reg[32];
-unsigned long rv5_instruction_RAM[4096];
-unsigned long rv5_user_memory[4096] ;
-unsigned long rv5_opcode;
-unsigned long rv5_pc=0;
-unsigned long temp;
+#ifndef EM_RISCV
+#define EM_RISCV 243
+#endif
+
+
+enum { RV5_ENGINE_REFERENCE=0, RV5_ENGINE_PREDECODED, RV5_ENGINE_TRANSLATED };
+
+enum { RV5_RUNNING=0, RV5_HALT_ECALL, RV5_HALT_EBREAK, RV5_HALT_BUDGET, RV5_HALT_INVALID, RV5_HALT_MISALIGNED, RV5_HALT_FAULT, RV5_HALT_LOAD_ERROR };
+const char *rv5_halt_name[] = { "RUNNING", "ECALL", "EBREAK", "BUDGET", "INVALID", "MISALIGNED", "FAULT", "LOAD ERROR" };
+
+
+// One predecoded instruction, see the predecoded engine below
+//
+typedef struct
+{
+  unsigned char handler;
+  unsigned char dst;
+  unsigned char src1;
+  unsigned char src2;
+  uint32_t imm;
+} rv5_decoded_t;
+
+
+// One trace record, see the trace ring buffer below
+//
+typedef struct
+{
+  uint32_t pc;
+  uint32_t instruction;
+  uint32_t reg;
+  uint32_t value;
+} rv5_trace_t;
+
+
+// Translated code arena of each hart, see the basic block translator
+//
+#define RV5_JIT_ARENA  0x2000000   // 32MB, flushed when full
+
+
+// Everything belonging to one hart. The engines only touch state through
+// the hart pointer they are given, so harts can run on separate threads.
+//
+typedef struct
+{
+  uint32_t reg[32];
+  uint32_t pc;
+  uint32_t instruction;                 // Last instruction run by the reference interpreter
+
+  uint8_t *memory;
+  uint32_t memory_size;
+  rv5_decoded_t *decode_cache;
+  uint8_t *code_page;                   // One flag per 4KB page of guest memory, set once anything in it is decoded
+
+  uint64_t budget;                      // Instruction budget for one run, 0 is unlimited
+  uint64_t instret;                     // Instructions retired
+  uint32_t fault_address;
+  int halt;
+
+  rv5_trace_t *trace_buffer;
+  uint32_t trace_mask;
+  uint64_t trace_count;
+
+  uint8_t *jit_arena;                   // Translated code, see the basic block translator
+  uint32_t jit_start;                   // Arena offset of the first block, after the entry and exit sequences
+  uint32_t jit_exit;
+  uint32_t jit_used;
+  uint32_t jit_flushes;
+  uint32_t *jit_block;                  // Arena offset of the block starting at each word of guest memory, 0 if none
+  uint8_t *jit_code_word;               // One flag per word of guest memory covered by a translated block
+
+  const char *program;
+} rv5_hart_t;
+
+
+// Guest memory accessors. Each function using them keeps the hart's memory
+// pointer in a local called memory. Addresses must already have passed
+// RV5_BAD_ACCESS().
+//
+#define RV5_MEM8(address)   (*(uint8_t  *)(memory + (address)))
+#define RV5_MEM16(address)  (*(uint16_t *)(memory + (address)))
+#define RV5_MEM32(address)  (*(uint32_t *)(memory + (address)))
+
+#define RV5_BAD_ACCESS(address, size)   ( ((address) & ((size)-1)) || (address) >= h->memory_size )
+#define RV5_FAULT_REASON(address, size) ( ((address) & ((size)-1)) ? RV5_HALT_MISALIGNED : RV5_HALT_FAULT )
+
+
+// Settings shared by every hart
+//
+unsigned char rv5_interactive=1;
+uint32_t rv5_memory_size=0x1000000;
+uint64_t rv5_budget=0;
+uint32_t rv5_trace_entries=0;           // 0 when tracing is off
+
+
+// ------------------------------------------------------------------------
+// Trace ring buffer
+//
+// One fixed size record per retired instruction. reg is zero for instructions
+// which do not write a register. Only the last (trace_mask+1) records
+// are kept and they are written to a file when the hart halts.
+// With tracing off the cost is one test of trace_buffer per instruction.
+// ------------------------------------------------------------------------
+
+#define RV5_TRACE_MAGIC 0x54355652      // "RV5T"
+
+#define RV5_TRACE(tpc, topcode, trd)  if (trace) { rv5_trace_t *t = &trace[h->trace_count++ & h->trace_mask]; \
+                                        t->pc=(tpc); t->instruction=(topcode); t->reg=(trd); t->value=h->reg[t->reg]; }
+
+
+// ------------------------------------------------------------------------
+// Predecoded engine
+//
+// Each word of guest memory is decoded once, the first time it is
+// executed, into a compact record holding a handler index, the register 
+// numbers and the already sign-extended immediate. Execution then jumps
+// straight to the handler through a computed goto, or a switch on
+// compilers without the GCC labels-as-values extension.
+// A store into a 4KB page which holds decoded code drops the record for the
+// word it writes, so self-modifying code is re-decoded on its next execution.
+// The cache has one record per word of guest memory plus one past the end,
+// and is mmap'd like the guest memory so only the pages holding executed
+// code are ever committed.
+// ------------------------------------------------------------------------
+
+enum { RV5_UNDECODED=0, RV5_LUI, RV5_AUIPC, RV5_JAL, RV5_JALR, RV5_BEQ, RV5_BNE, RV5_BLT, RV5_BGE, RV5_BLTU, RV5_BGEU,
+       RV5_LB, RV5_LH, RV5_LW, RV5_LBU, RV5_LHU, RV5_SB, RV5_SH, RV5_SW, RV5_ADDI, RV5_SLTI, RV5_SLTIU, RV5_XORI, RV5_ORI,
+       RV5_ANDI, RV5_SLLI, RV5_SRAI, RV5_SRLI, RV5_SUB, RV5_ADD, RV5_SLL, RV5_SLT, RV5_SLTU, RV5_XOR, RV5_SRA, RV5_SRL,
+       RV5_OR, RV5_AND, RV5_MUL, RV5_MULH, RV5_MULHSU, RV5_MULHU, RV5_DIV, RV5_DIVU, RV5_REM, RV5_REMU,
+       RV5_ECALL, RV5_EBREAK, RV5_INVALID };
+
+const char *rv5_mnemonic[] = { "?", "LUI", "AUIPC", "JAL", "JALR", "BEQ", "BNE", "BLT", "BGE", "BLTU", "BGEU",
+       "LB", "LH", "LW", "LBU", "LHU", "SB", "SH", "SW", "ADDI", "SLTI", "SLTIU", "XORI", "ORI",
+       "ANDI", "SLLI", "SRAI", "SRLI", "SUB", "ADD", "SLL", "SLT", "SLTU", "XOR", "SRA", "SRL",
+       "OR", "AND", "MUL", "MULH", "MULHSU", "MULHU", "DIV", "DIVU", "REM", "REMU",
+       "ECALL", "EBREAK", "**INVALID**" };
+
+#define RV5_STORED(address)  if (h->code_page[(address)>>12]) h->decode_cache[(address)>>2].handler = RV5_UNDECODED
+
+
+// Same decode rules, and the same order, as the if-chain in rv5_step_reference()
+//
+unsigned char rv5_decode(uint32_t rv5_opcode)
+{
+  if (opcode==0b0110111) return RV5_LUI;
+  if (opcode==0b0010111) return RV5_AUIPC;
+  if (opcode==0b1101111) return RV5_JAL;
+  if (opcode==0b1100111) return RV5_JALR;
+  if (opcode==0b1100011 && funct3==0b000) return RV5_BEQ;
+  if (opcode==0b1100011 && funct3==0b001) return RV5_BNE;
+  if (opcode==0b1100011 && funct3==0b100) return RV5_BLT;
+  if (opcode==0b1100011 && funct3==0b101) return RV5_BGE;
+  if (opcode==0b1100011 && funct3==0b110) return RV5_BLTU;
+  if (opcode==0b1100011 && funct3==0b111) return RV5_BGEU;
+  if (opcode==0b0000011 && funct3==0b000) return RV5_LB;
+  if (opcode==0b0000011 && funct3==0b001) return RV5_LH;
+  if (opcode==0b0000011 && funct3==0b010) return RV5_LW;
+  if (opcode==0b0000011 && funct3==0b100) return RV5_LBU;
+  if (opcode==0b0000011 && funct3==0b101) return RV5_LHU;
+  if (opcode==0b0100011 && funct3==0b000) return RV5_SB;
+  if (opcode==0b0100011 && funct3==0b001) return RV5_SH;
+  if (opcode==0b0100011 && funct3==0b010) return RV5_SW;
+  if (opcode==0b0010011 && funct3==0b000) return RV5_ADDI;
+  if (opcode==0b0010011 && funct3==0b010) return RV5_SLTI;
+  if (opcode==0b0010011 && funct3==0b011) return RV5_SLTIU;
+  if (opcode==0b0010011 && funct3==0b100) return RV5_XORI;
+  if (opcode==0b0010011 && funct3==0b110) return RV5_ORI;
+  if (opcode==0b0010011 && funct3==0b111) return RV5_ANDI;
+  if (opcode==0b0010011 && funct3==0b001 && funct7==0b0000000) return RV5_SLLI;
+  if (opcode==0b0010011 && funct3==0b101 && funct7==0b0100000) return RV5_SRAI;
+  if (opcode==0b0010011 && funct3==0b101 && funct7==0b0000000) return RV5_SRLI;
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b000) return RV5_MUL;
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b001) return RV5_MULH;
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b010) return RV5_MULHSU;
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b011) return RV5_MULHU;
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b100) return RV5_DIV;
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b101) return RV5_DIVU;
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b110) return RV5_REM;
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b111) return RV5_REMU;
+  if (opcode==0b0110011 && funct3==0b000 && funct7==0b0100000) return RV5_SUB;
+  if (opcode==0b0110011 && funct3==0b000) return RV5_ADD;
+  if (opcode==0b0110011 && funct3==0b001) return RV5_SLL;
+  if (opcode==0b0110011 && funct3==0b010) return RV5_SLT;
+  if (opcode==0b0110011 && funct3==0b011) return RV5_SLTU;
+  if (opcode==0b0110011 && funct3==0b100) return RV5_XOR;
+  if (opcode==0b0110011 && funct3==0b101 && funct7==0b0100000) return RV5_SRA;
+  if (opcode==0b0110011 && funct3==0b101 && funct7==0b0000000) return RV5_SRL;
+  if (opcode==0b0110011 && funct3==0b110) return RV5_OR;
+  if (opcode==0b0110011 && funct3==0b111) return RV5_AND;
+  if (opcode==0b1110011 && funct3==0b000 && (rv5_opcode>>20)==0x000) return RV5_ECALL;
+  if (opcode==0b1110011 && funct3==0b000 && (rv5_opcode>>20)==0x001) return RV5_EBREAK;
+  return RV5_INVALID;
+}
+
+
+void rv5_predecode(rv5_hart_t *h, uint32_t index)
+{
+  rv5_decoded_t *d = &h->decode_cache[index];
+  uint8_t *memory = h->memory;
+  uint32_t rv5_opcode = RV5_MEM32(index<<2);
+
+  h->code_page[index>>10] = 1;
+  d->handler = rv5_decode(rv5_opcode);
+  d->dst  = rd;
+  d->src1 = rs1;
+  d->src2 = rs2;
+
+  switch (d->handler)
+    {
+      case RV5_LUI:  case RV5_AUIPC:                                        d->imm = U_immediate << 12;  break;
+      case RV5_JAL:                                                         d->imm = J_immediate_SE;     break;
+      case RV5_BEQ:  case RV5_BNE:  case RV5_BLT: case RV5_BGE: case RV5_BLTU: case RV5_BGEU: d->imm = B_immediate_SE; break;
+      case RV5_SB:   case RV5_SH:   case RV5_SW:                            d->imm = S_immediate_SE;     break;
+      case RV5_SLLI: case RV5_SRAI: case RV5_SRLI:                          d->imm = rs2;                break;
+      default:                                                              d->imm = I_immediate_SE;     break;
+    }
+
+  // Only instructions which write rd keep it, so the tracer can record rd and its new value unconditionally
+  if (opcode==0b1100011 || opcode==0b0100011 || opcode==0b1110011 || d->handler==RV5_INVALID) d->dst = 0;
+}
+
+
+#if defined(__GNUC__)
+#define RV5_HANDLER(name)  L_##name:
+#define RV5_DISPATCH       ipc = pc; d = &cache[pc>>2]; goto *rv5_handlers[d->handler]
+#else
+#define RV5_HANDLER(name)  case name:
+#define RV5_DISPATCH       goto dispatch
+#endif
+
+#define RV5_RETIRE         rv5_reg[0]=0; \
+                           RV5_TRACE(ipc, RV5_MEM32(ipc), d->dst); \
+                           if (--budget==0) { halt=RV5_HALT_BUDGET; goto done; }
+#define RV5_NEXT           pc = pc + 0x4; RV5_RETIRE; RV5_DISPATCH
+#define RV5_JUMP(target)   pc = (target); RV5_RETIRE; \
+                           if ((pc & 3) || pc >= limit) { h->fault_address=pc; halt=RV5_FAULT_REASON(pc, 4); goto done; } \
+                           RV5_DISPATCH
+#define RV5_CHECK(address, size) \
+                           if (((address) & ((size)-1)) || (address) >= limit) { h->fault_address=(address); halt=RV5_FAULT_REASON(address, size); goto done; }
+#define X(n)               rv5_reg[d->n]
+
+
+// Runs until a halt. pc is left pointing at the halting instruction, or
+// at the next instruction when the budget runs out. A jump to a bad address
+// completes and then halts on the fetch, with pc holding the target.
+//
+int rv5_run_predecoded(rv5_hart_t *h)
+{
+  uint32_t pc = h->pc;
+  uint32_t ipc, temp;
+  uint64_t budget = h->budget ? h->budget : UINT64_MAX;
+  uint64_t start = budget;
+  int halt;
+  rv5_decoded_t *d;
+  uint32_t *rv5_reg = h->reg;                   // Locals, so stores to guest memory do not force them to be reloaded
+  uint8_t *memory = h->memory;
+  rv5_decoded_t *cache = h->decode_cache;
+  rv5_trace_t *trace = h->trace_buffer;
+  uint32_t limit = h->memory_size;
+
+#if defined(__GNUC__)
+  static void *rv5_handlers[] = { &&L_RV5_UNDECODED, &&L_RV5_LUI, &&L_RV5_AUIPC, &&L_RV5_JAL, &&L_RV5_JALR, &&L_RV5_BEQ,
+    &&L_RV5_BNE, &&L_RV5_BLT, &&L_RV5_BGE, &&L_RV5_BLTU, &&L_RV5_BGEU, &&L_RV5_LB, &&L_RV5_LH, &&L_RV5_LW, &&L_RV5_LBU,
+    &&L_RV5_LHU, &&L_RV5_SB, &&L_RV5_SH, &&L_RV5_SW, &&L_RV5_ADDI, &&L_RV5_SLTI, &&L_RV5_SLTIU, &&L_RV5_XORI, &&L_RV5_ORI,
+    &&L_RV5_ANDI, &&L_RV5_SLLI, &&L_RV5_SRAI, &&L_RV5_SRLI, &&L_RV5_SUB, &&L_RV5_ADD, &&L_RV5_SLL, &&L_RV5_SLT,
+    &&L_RV5_SLTU, &&L_RV5_XOR, &&L_RV5_SRA, &&L_RV5_SRL, &&L_RV5_OR, &&L_RV5_AND, &&L_RV5_MUL, &&L_RV5_MULH,
+    &&L_RV5_MULHSU, &&L_RV5_MULHU, &&L_RV5_DIV, &&L_RV5_DIVU, &&L_RV5_REM, &&L_RV5_REMU, &&L_RV5_ECALL, &&L_RV5_EBREAK,
+    &&L_RV5_INVALID };
+
+  RV5_DISPATCH;
+#else
+  dispatch:
+  ipc = pc;
+  d = &cache[pc>>2];
+  switch (d->handler)
+    {
+#endif
+
+  RV5_HANDLER(RV5_UNDECODED)
+    if (pc >= limit) { h->fault_address=pc; halt=RV5_HALT_FAULT; goto done; }   // Ran off the end of memory
+    rv5_predecode(h, pc>>2);
+    RV5_DISPATCH;
+
+  RV5_HANDLER(RV5_LUI)   X(dst) = d->imm;                                   RV5_NEXT;
+  RV5_HANDLER(RV5_AUIPC) X(dst) = d->imm + pc;                              RV5_NEXT;
+  RV5_HANDLER(RV5_JAL)   X(dst) = pc + 0x4;                                 RV5_JUMP(pc + d->imm);
+  RV5_HANDLER(RV5_JALR)  temp = (d->imm + X(src1)) & 0xFFFFFFFE; X(dst) = pc + 0x4;  RV5_JUMP(temp);
+
+  RV5_HANDLER(RV5_BEQ)   if (X(src1)==X(src2))                   { RV5_JUMP(pc + d->imm); }  RV5_NEXT;
+  RV5_HANDLER(RV5_BNE)   if (X(src1)!=X(src2))                   { RV5_JUMP(pc + d->imm); }  RV5_NEXT;
+  RV5_HANDLER(RV5_BLT)   if ((int32_t)X(src1)< (int32_t)X(src2)) { RV5_JUMP(pc + d->imm); }  RV5_NEXT;
+  RV5_HANDLER(RV5_BGE)   if ((int32_t)X(src1)>=(int32_t)X(src2)) { RV5_JUMP(pc + d->imm); }  RV5_NEXT;
+  RV5_HANDLER(RV5_BLTU)  if (X(src1)< X(src2))                   { RV5_JUMP(pc + d->imm); }  RV5_NEXT;
+  RV5_HANDLER(RV5_BGEU)  if (X(src1)>=X(src2))                   { RV5_JUMP(pc + d->imm); }  RV5_NEXT;
+
+  RV5_HANDLER(RV5_LB)    temp = d->imm + X(src1);  RV5_CHECK(temp, 1);  X(dst) = (int8_t)  RV5_MEM8(temp);    RV5_NEXT;
+  RV5_HANDLER(RV5_LH)    temp = d->imm + X(src1);  RV5_CHECK(temp, 2);  X(dst) = (int16_t) RV5_MEM16(temp);   RV5_NEXT;
+  RV5_HANDLER(RV5_LW)    temp = d->imm + X(src1);  RV5_CHECK(temp, 4);  X(dst) = RV5_MEM32(temp);            RV5_NEXT;
+  RV5_HANDLER(RV5_LBU)   temp = d->imm + X(src1);  RV5_CHECK(temp, 1);  X(dst) = RV5_MEM8(temp);             RV5_NEXT;
+  RV5_HANDLER(RV5_LHU)   temp = d->imm + X(src1);  RV5_CHECK(temp, 2);  X(dst) = RV5_MEM16(temp);            RV5_NEXT;
+  RV5_HANDLER(RV5_SB)    temp = d->imm + X(src1);  RV5_CHECK(temp, 1);  RV5_MEM8(temp)  = X(src2);  RV5_STORED(temp);  RV5_NEXT;
+  RV5_HANDLER(RV5_SH)    temp = d->imm + X(src1);  RV5_CHECK(temp, 2);  RV5_MEM16(temp) = X(src2);  RV5_STORED(temp);  RV5_NEXT;
+  RV5_HANDLER(RV5_SW)    temp = d->imm + X(src1);  RV5_CHECK(temp, 4);  RV5_MEM32(temp) = X(src2);  RV5_STORED(temp);  RV5_NEXT;
+
+  RV5_HANDLER(RV5_ADDI)  X(dst) = X(src1) + d->imm;                         RV5_NEXT;
+  RV5_HANDLER(RV5_SLTI)  X(dst) = ((int32_t)X(src1) < (int32_t)d->imm);     RV5_NEXT;
+  RV5_HANDLER(RV5_SLTIU) X(dst) = (X(src1) < d->imm);                       RV5_NEXT;
+  RV5_HANDLER(RV5_XORI)  X(dst) = X(src1) ^ d->imm;                         RV5_NEXT;
+  RV5_HANDLER(RV5_ORI)   X(dst) = X(src1) | d->imm;                         RV5_NEXT;
+  RV5_HANDLER(RV5_ANDI)  X(dst) = X(src1) & d->imm;                         RV5_NEXT;
+  RV5_HANDLER(RV5_SLLI)  X(dst) = X(src1) << d->imm;                        RV5_NEXT;
+  RV5_HANDLER(RV5_SRAI)  X(dst) = (uint32_t)((int32_t)X(src1) >> d->imm);   RV5_NEXT;
+  RV5_HANDLER(RV5_SRLI)  X(dst) = X(src1) >> d->imm;                        RV5_NEXT;
+
+  RV5_HANDLER(RV5_SUB)   X(dst) = X(src1) - X(src2);                        RV5_NEXT;
+  RV5_HANDLER(RV5_ADD)   X(dst) = X(src1) + X(src2);                        RV5_NEXT;
+  RV5_HANDLER(RV5_SLL)   X(dst) = X(src1) << (X(src2)&0x1F);                RV5_NEXT;
+  RV5_HANDLER(RV5_SLT)   X(dst) = ((int32_t)X(src1) < (int32_t)X(src2));    RV5_NEXT;
+  RV5_HANDLER(RV5_SLTU)  X(dst) = (X(src1) < X(src2));                      RV5_NEXT;
+  RV5_HANDLER(RV5_XOR)   X(dst) = X(src1) ^ X(src2);                        RV5_NEXT;
+  RV5_HANDLER(RV5_SRA)   X(dst) = (uint32_t)((int32_t)X(src1) >> (X(src2)&0x1F));  RV5_NEXT;
+  RV5_HANDLER(RV5_SRL)   X(dst) = X(src1) >> (X(src2)&0x1F);                RV5_NEXT;
+  RV5_HANDLER(RV5_OR)    X(dst) = X(src1) | X(src2);                        RV5_NEXT;
+  RV5_HANDLER(RV5_AND)   X(dst) = X(src1) & X(src2);                        RV5_NEXT;
+
+  // Division by zero and the one signed overflow do not trap, they give the results the spec defines
+  RV5_HANDLER(RV5_MUL)    X(dst) = X(src1) * X(src2);                                                   RV5_NEXT;
+  RV5_HANDLER(RV5_MULH)   X(dst) = (uint32_t)(((int64_t)(int32_t)X(src1) * (int32_t)X(src2)) >> 32);   RV5_NEXT;
+  RV5_HANDLER(RV5_MULHSU) X(dst) = (uint32_t)(((int64_t)(int32_t)X(src1) * (int64_t)X(src2)) >> 32);   RV5_NEXT;
+  RV5_HANDLER(RV5_MULHU)  X(dst) = (uint32_t)(((uint64_t)X(src1) * X(src2)) >> 32);                     RV5_NEXT;
+  RV5_HANDLER(RV5_DIV)    temp = X(src2); X(dst) = (temp==0) ? 0xFFFFFFFF : (X(src1)==0x80000000 && temp==0xFFFFFFFF) ? 0x80000000 : (uint32_t)((int32_t)X(src1) / (int32_t)temp);  RV5_NEXT;
+  RV5_HANDLER(RV5_DIVU)   temp = X(src2); X(dst) = (temp==0) ? 0xFFFFFFFF : X(src1) / temp;            RV5_NEXT;
+  RV5_HANDLER(RV5_REM)    temp = X(src2); X(dst) = (temp==0) ? X(src1) : (X(src1)==0x80000000 && temp==0xFFFFFFFF) ? 0 : (uint32_t)((int32_t)X(src1) % (int32_t)temp);  RV5_NEXT;
+  RV5_HANDLER(RV5_REMU)   temp = X(src2); X(dst) = (temp==0) ? X(src1) : X(src1) % temp;              RV5_NEXT;
+
+  RV5_HANDLER(RV5_ECALL)   halt=RV5_HALT_ECALL;    budget--; RV5_TRACE(ipc, RV5_MEM32(ipc), 0); goto done;
+  RV5_HANDLER(RV5_EBREAK)  halt=RV5_HALT_EBREAK;   budget--; RV5_TRACE(ipc, RV5_MEM32(ipc), 0); goto done;
+  RV5_HANDLER(RV5_INVALID) halt=RV5_HALT_INVALID;  goto done;
+
+#if !defined(__GNUC__)
+    }
+#endif
+
+  done:
+  h->pc = pc;
+  h->instret = h->instret + (start - budget);
+  h->halt = halt;
+  return halt;
+}
+
+
+// ------------------------------------------------------------------------
+// Reference interpreter
+// ------------------------------------------------------------------------
 
+#define RV5_PRINT(x)  if (rv5_interactive) printf(x)
+#define RV5_REF_CHECK(address, size)  if (RV5_BAD_ACCESS(address, size)) { h->fault_address=(address); RV5_PRINT(" **FAULT** "); return h->halt=RV5_FAULT_REASON(address, size); }
 
-int main()
 
+// Executes one instruction. Returns RV5_RUNNING, or the halt reason with pc left on the halting instruction.
+//
+int rv5_step_reference(rv5_hart_t *h)
 {
-  while (1)
-  {
+  uint32_t *rv5_reg = h->reg;
+  uint8_t *memory = h->memory;
+  rv5_trace_t *trace = h->trace_buffer;
+  uint32_t rv5_pc = h->pc;
+  uint32_t ipc = rv5_pc;
+  uint32_t rv5_opcode, temp;
+  unsigned int shamt;
+  int halt = RV5_RUNNING;
+
+  if (RV5_BAD_ACCESS(rv5_pc, 4)) { h->fault_address=rv5_pc; return h->halt=RV5_FAULT_REASON(rv5_pc, 4); }
 
-  rv5_opcode = rv5_instruction_RAM[rv5_pc>>2]; 
+  rv5_opcode = RV5_MEM32(rv5_pc); 
+  h->instruction = rv5_opcode;
   shamt=rs2;
    
-  printf("PC:0x%x Opcode:0x%x ", rv5_pc, rv5_opcode);
+  if (rv5_interactive) printf("PC:0x%x Opcode:0x%x ", rv5_pc, rv5_opcode);
    
-  if (opcode==0b0110111) { rv5_reg[rd] = U_immediate << 12; printf(" LUI "); } else // LUI
-  if (opcode==0b0010111) { rv5_reg[rd] = (U_immediate << 12) + rv5_pc; printf(" AUIPC "); } else // AUIPC
-  if (opcode==0b1101111) { rv5_reg[rd] = rv5_pc + 0x4; rv5_pc = (J_immediate_SE) + rv5_pc - 0x4; printf(" JAL "); } else // JAL
-  if (opcode==0b1100111) { rv5_reg[rd] = rv5_pc + 0x4; rv5_pc = (((I_immediate_SE) + rv5_reg[rs1]) & 0xFFFFFFFE) - 0x4; printf(" JALR "); } else // JALR
-  if (opcode==0b1100011 && funct3==0b000) { if (rv5_reg[rs1]==rv5_reg[rs2]) rv5_pc = ( (B_immediate_SE) + rv5_pc) - 0x4; printf(" BEQ "); } else // BEQ
-  if (opcode==0b1100011 && funct3==0b001) { if (rv5_reg[rs1]!=rv5_reg[rs2]) rv5_pc = ( (B_immediate_SE) + rv5_pc) - 0x4; printf(" BNE "); } else // BNE
-  if (opcode==0b1100011 && funct3==0b100) { if ((signed long)rv5_reg[rs1]< (signed long)rv5_reg[rs2]) rv5_pc = ((B_immediate_SE) + rv5_pc) - 0x4; printf(" BLT "); } else // BLT
-  if (opcode==0b1100011 && funct3==0b101) { if ((signed long)rv5_reg[rs1]>=(signed long)rv5_reg[rs2]) rv5_pc = ((B_immediate_SE) + rv5_pc) - 0x4; printf(" BGE "); } else // BGE
-  if (opcode==0b1100011 && funct3==0b110) { if (rv5_reg[rs1]<rv5_reg[rs2]) rv5_pc = ( (B_immediate_SE) + rv5_pc) - 0x4; printf(" BLTU ");  } else // BLTU
-  if (opcode==0b1100011 && funct3==0b111) { if (rv5_reg[rs1]>=rv5_reg[rs2]) rv5_pc = ( (B_immediate_SE) + rv5_pc) - 0x4; printf(" BGTU "); } else // BGTU
-  if (opcode==0b0000011 && funct3==0b000) { rv5_reg[rd] = (rv5_user_memory[(I_immediate_SE)+rv5_reg[rs1]] & 0x80) ? 0xFFFFFF00| rv5_user_memory[(I_immediate_SE)+rv5_reg[rs1]] : (rv5_user_memory[(I_immediate_SE)+rv5_reg[rs1]] & 0xFF); printf(" LB "); } else // LB
-  if (opcode==0b0000011 && funct3==0b001) { rv5_reg[rd] = (rv5_user_memory[(I_immediate_SE)+rv5_reg[rs1]] & 0x8000) ? 0xFFFF0000| rv5_user_memory[(I_immediate_SE)+rv5_reg[rs1]] : (rv5_user_memory[(I_immediate_SE)+rv5_reg[rs1]] & 0xFFFF); printf(" LH "); } else // LH
-  if (opcode==0b0000011 && funct3==0b010) { rv5_reg[rd] = rv5_user_memory[(I_immediate_SE)+rv5_reg[rs1]]; printf(" LW "); } else // LW
-  if (opcode==0b0000011 && funct3==0b100) { rv5_reg[rd] = rv5_user_memory[(I_immediate_SE)+rv5_reg[rs1]] & 0x000000FF; printf(" LBU "); } else // LBU
-  if (opcode==0b0000011 && funct3==0b101) { rv5_reg[rd] = rv5_user_memory[(I_immediate_SE)+rv5_reg[rs1]] & 0x0000FFFF; printf(" LHU "); } else // LHU
-  if (opcode==0b0100011 && funct3==0b000) { rv5_user_memory[(S_immediate_SE)+rv5_reg[rs1]] = (rv5_user_memory[(S_immediate_SE)+rv5_reg[rs1]]&0xFFFFFF00) | (rv5_reg[rs2]&0xFF); printf(" SB "); } else // SB
-  if (opcode==0b0100011 && funct3==0b001) { rv5_user_memory[(S_immediate_SE)+rv5_reg[rs1]] = (rv5_user_memory[(S_immediate_SE)+rv5_reg[rs1]]&0xFFFF0000) | (rv5_reg[rs2]&0xFFFF); printf(" SH "); } else // SH
-  if (opcode==0b0100011 && funct3==0b010) { rv5_user_memory[(S_immediate_SE)+rv5_reg[rs1]] = rv5_reg[rs2]; printf(" SW "); } else // SW
-  if (opcode==0b0010011 && funct3==0b000) { rv5_reg[rd] = (I_immediate_SE) + rv5_reg[rs1]; printf(" ADDI "); } else // ADDI
-  if (opcode==0b0010011 && funct3==0b010) { if ((signed long)rv5_reg[rs1] < ((signed long)I_immediate_SE)) rv5_reg[rd]=1; else rv5_reg[rd]=0; printf(" SLTI "); } else // SLTI
-  if (opcode==0b0010011 && funct3==0b011) { if (rv5_reg[rs1] < (I_immediate_SE)) rv5_reg[rd]=1; else rv5_reg[rd]=0; printf(" SLTIU "); } else // SLTIU
-  if (opcode==0b0010011 && funct3==0b100) { rv5_reg[rd] = rv5_reg[rs1] ^ (I_immediate_SE); printf(" XORI "); } else // XORI
-  if (opcode==0b0010011 && funct3==0b110) { rv5_reg[rd] = rv5_reg[rs1] | (I_immediate_SE); printf(" ORI "); } else // ORI
-  if (opcode==0b0010011 && funct3==0b111) { rv5_reg[rd] = rv5_reg[rs1] & (I_immediate_SE); printf(" ANDI "); } else // ANDI
-  if (opcode==0b0010011 && funct3==0b001 && funct7==0b0000000) { rv5_reg[rd] = rv5_reg[rs1] << shamt; printf(" SLLI "); } else // SLLI
-  if (opcode==0b0010011 && funct3==0b101 && funct7==0b0100000) {rv5_reg[rd]=rv5_reg[rs1]; temp=rv5_reg[rs1]&0x80000000; while (shamt>0) { rv5_reg[rd]=(rv5_reg[rd]>>1)|temp; shamt--;} printf(" SRAI "); } else // SRAI
-  if (opcode==0b0010011 && funct3==0b101 && funct7==0b0000000) { rv5_reg[rd] = rv5_reg[rs1] >> shamt; printf(" SRLI "); } else // SRLI
-  if (opcode==0b0110011 && funct3==0b000 && funct7==0b0100000) { rv5_reg[rd] = rv5_reg[rs1] - rv5_reg[rs2]; printf(" SUB "); } else // SUB
-  if (opcode==0b0110011 && funct3==0b000) { rv5_reg[rd] = rv5_reg[rs1] + rv5_reg[rs2]; printf(" ADD "); } else // ADD
-  if (opcode==0b0110011 && funct3==0b001) { rv5_reg[rd] = rv5_reg[rs1] << (rv5_reg[rs2]&0x1F); printf(" SLL "); } else // SLL
-  if (opcode==0b0110011 && funct3==0b010) { if ((signed long)rv5_reg[rs1] < (signed long)rv5_reg[rs2]) rv5_reg[rd]=1; else rv5_reg[rd]=0; printf(" SLT "); } else // SLT
-  if (opcode==0b0110011 && funct3==0b011) { if (rv5_reg[rs1] < rv5_reg[rs2]) rv5_reg[rd]=1; else rv5_reg[rd]=0; printf(" SLTU "); } else // SLTU
-  if (opcode==0b0110011 && funct3==0b100) { rv5_reg[rd] = rv5_reg[rs1] ^ rv5_reg[rs2]; printf(" XOR "); } else // XOR
-  if (opcode==0b0110011 && funct3==0b101 && funct7==0b0100000) {rv5_reg[rd]=rv5_reg[rs1]; shamt=(rv5_reg[rs2]&0x1F); temp=rv5_reg[rs1]&0x80000000; while (shamt>0) { rv5_reg[rd]=(rv5_reg[rd]>>1)|temp; shamt--;} printf(" SRA "); } else // SRA
-  if (opcode==0b0110011 && funct3==0b101 && funct7==0b0000000) { rv5_reg[rd] = rv5_reg[rs1] >> (rv5_reg[rs2]&0x1F); printf(" SRL "); } else // SRL
-  if (opcode==0b0110011 && funct3==0b110) { rv5_reg[rd] = rv5_reg[rs1] | rv5_reg[rs2]; printf(" OR "); } else // OR
-  if (opcode==0b0110011 && funct3==0b111) { rv5_reg[rd] = rv5_reg[rs1] & rv5_reg[rs2]; printf(" AND "); } else printf(" **INVALID** "); // AND
+  if (opcode==0b0110111) { rv5_reg[rd] = U_immediate << 12; RV5_PRINT(" LUI "); } else // LUI
+  if (opcode==0b0010111) { rv5_reg[rd] = (U_immediate << 12) + rv5_pc; RV5_PRINT(" AUIPC "); } else // AUIPC
+  if (opcode==0b1101111) { rv5_reg[rd] = rv5_pc + 0x4; rv5_pc = (J_immediate_SE) + rv5_pc - 0x4; RV5_PRINT(" JAL "); } else // JAL
+  if (opcode==0b1100111) { temp = rv5_reg[rs1]; rv5_reg[rd] = rv5_pc + 0x4; rv5_pc = (((I_immediate_SE) + temp) & 0xFFFFFFFE) - 0x4; RV5_PRINT(" JALR "); } else // JALR
+  if (opcode==0b1100011 && funct3==0b000) { if (rv5_reg[rs1]==rv5_reg[rs2]) rv5_pc = ( (B_immediate_SE) + rv5_pc) - 0x4; RV5_PRINT(" BEQ "); } else // BEQ
+  if (opcode==0b1100011 && funct3==0b001) { if (rv5_reg[rs1]!=rv5_reg[rs2]) rv5_pc = ( (B_immediate_SE) + rv5_pc) - 0x4; RV5_PRINT(" BNE "); } else // BNE
+  if (opcode==0b1100011 && funct3==0b100) { if ((int32_t)rv5_reg[rs1]< (int32_t)rv5_reg[rs2]) rv5_pc = ((B_immediate_SE) + rv5_pc) - 0x4; RV5_PRINT(" BLT "); } else // BLT
+  if (opcode==0b1100011 && funct3==0b101) { if ((int32_t)rv5_reg[rs1]>=(int32_t)rv5_reg[rs2]) rv5_pc = ((B_immediate_SE) + rv5_pc) - 0x4; RV5_PRINT(" BGE "); } else // BGE
+  if (opcode==0b1100011 && funct3==0b110) { if (rv5_reg[rs1]<rv5_reg[rs2]) rv5_pc = ( (B_immediate_SE) + rv5_pc) - 0x4; RV5_PRINT(" BLTU ");  } else // BLTU
+  if (opcode==0b1100011 && funct3==0b111) { if (rv5_reg[rs1]>=rv5_reg[rs2]) rv5_pc = ( (B_immediate_SE) + rv5_pc) - 0x4; RV5_PRINT(" BGTU "); } else // BGTU
+  if (opcode==0b0000011 && funct3==0b000) { temp=(I_immediate_SE)+rv5_reg[rs1]; RV5_REF_CHECK(temp,1); rv5_reg[rd] = (RV5_MEM8(temp) & 0x80) ? 0xFFFFFF00 | RV5_MEM8(temp) : RV5_MEM8(temp); RV5_PRINT(" LB "); } else // LB
+  if (opcode==0b0000011 && funct3==0b001) { temp=(I_immediate_SE)+rv5_reg[rs1]; RV5_REF_CHECK(temp,2); rv5_reg[rd] = (RV5_MEM16(temp) & 0x8000) ? 0xFFFF0000 | RV5_MEM16(temp) : RV5_MEM16(temp); RV5_PRINT(" LH "); } else // LH
+  if (opcode==0b0000011 && funct3==0b010) { temp=(I_immediate_SE)+rv5_reg[rs1]; RV5_REF_CHECK(temp,4); rv5_reg[rd] = RV5_MEM32(temp); RV5_PRINT(" LW "); } else // LW
+  if (opcode==0b0000011 && funct3==0b100) { temp=(I_immediate_SE)+rv5_reg[rs1]; RV5_REF_CHECK(temp,1); rv5_reg[rd] = RV5_MEM8(temp); RV5_PRINT(" LBU "); } else // LBU
+  if (opcode==0b0000011 && funct3==0b101) { temp=(I_immediate_SE)+rv5_reg[rs1]; RV5_REF_CHECK(temp,2); rv5_reg[rd] = RV5_MEM16(temp); RV5_PRINT(" LHU "); } else // LHU
+  if (opcode==0b0100011 && funct3==0b000) { temp=(S_immediate_SE)+rv5_reg[rs1]; RV5_REF_CHECK(temp,1); RV5_MEM8(temp)  = rv5_reg[rs2]; RV5_STORED(temp); RV5_PRINT(" SB "); } else // SB
+  if (opcode==0b0100011 && funct3==0b001) { temp=(S_immediate_SE)+rv5_reg[rs1]; RV5_REF_CHECK(temp,2); RV5_MEM16(temp) = rv5_reg[rs2]; RV5_STORED(temp); RV5_PRINT(" SH "); } else // SH
+  if (opcode==0b0100011 && funct3==0b010) { temp=(S_immediate_SE)+rv5_reg[rs1]; RV5_REF_CHECK(temp,4); RV5_MEM32(temp) = rv5_reg[rs2]; RV5_STORED(temp); RV5_PRINT(" SW "); } else // SW
+  if (opcode==0b0010011 && funct3==0b000) { rv5_reg[rd] = (I_immediate_SE) + rv5_reg[rs1]; RV5_PRINT(" ADDI "); } else // ADDI
+  if (opcode==0b0010011 && funct3==0b010) { if ((int32_t)rv5_reg[rs1] < ((int32_t)(I_immediate_SE))) rv5_reg[rd]=1; else rv5_reg[rd]=0; RV5_PRINT(" SLTI "); } else // SLTI
+  if (opcode==0b0010011 && funct3==0b011) { if (rv5_reg[rs1] < (I_immediate_SE)) rv5_reg[rd]=1; else rv5_reg[rd]=0; RV5_PRINT(" SLTIU "); } else // SLTIU
+  if (opcode==0b0010011 && funct3==0b100) { rv5_reg[rd] = rv5_reg[rs1] ^ (I_immediate_SE); RV5_PRINT(" XORI "); } else // XORI
+  if (opcode==0b0010011 && funct3==0b110) { rv5_reg[rd] = rv5_reg[rs1] | (I_immediate_SE); RV5_PRINT(" ORI "); } else // ORI
+  if (opcode==0b0010011 && funct3==0b111) { rv5_reg[rd] = rv5_reg[rs1] & (I_immediate_SE); RV5_PRINT(" ANDI "); } else // ANDI
+  if (opcode==0b0010011 && funct3==0b001 && funct7==0b0000000) { rv5_reg[rd] = rv5_reg[rs1] << shamt; RV5_PRINT(" SLLI "); } else // SLLI
+  if (opcode==0b0010011 && funct3==0b101 && funct7==0b0100000) { rv5_reg[rd] = (uint32_t)((int32_t)rv5_reg[rs1] >> shamt); RV5_PRINT(" SRAI "); } else // SRAI
+  if (opcode==0b0010011 && funct3==0b101 && funct7==0b0000000) { rv5_reg[rd] = rv5_reg[rs1] >> shamt; RV5_PRINT(" SRLI "); } else // SRLI
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b000) { rv5_reg[rd] = rv5_reg[rs1] * rv5_reg[rs2]; RV5_PRINT(" MUL "); } else // MUL
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b001) { rv5_reg[rd] = (uint32_t)(((int64_t)(int32_t)rv5_reg[rs1] * (int32_t)rv5_reg[rs2]) >> 32); RV5_PRINT(" MULH "); } else // MULH
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b010) { rv5_reg[rd] = (uint32_t)(((int64_t)(int32_t)rv5_reg[rs1] * (int64_t)rv5_reg[rs2]) >> 32); RV5_PRINT(" MULHSU "); } else // MULHSU
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b011) { rv5_reg[rd] = (uint32_t)(((uint64_t)rv5_reg[rs1] * rv5_reg[rs2]) >> 32); RV5_PRINT(" MULHU "); } else // MULHU
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b100) { temp=rv5_reg[rs2]; if (temp==0) rv5_reg[rd]=0xFFFFFFFF; else if (rv5_reg[rs1]==0x80000000 && temp==0xFFFFFFFF) rv5_reg[rd]=0x80000000; else rv5_reg[rd] = (uint32_t)((int32_t)rv5_reg[rs1] / (int32_t)temp); RV5_PRINT(" DIV "); } else // DIV
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b101) { temp=rv5_reg[rs2]; if (temp==0) rv5_reg[rd]=0xFFFFFFFF; else rv5_reg[rd] = rv5_reg[rs1] / temp; RV5_PRINT(" DIVU "); } else // DIVU
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b110) { temp=rv5_reg[rs2]; if (temp==0) rv5_reg[rd]=rv5_reg[rs1]; else if (rv5_reg[rs1]==0x80000000 && temp==0xFFFFFFFF) rv5_reg[rd]=0; else rv5_reg[rd] = (uint32_t)((int32_t)rv5_reg[rs1] % (int32_t)temp); RV5_PRINT(" REM "); } else // REM
+  if (opcode==0b0110011 && funct7==0b0000001 && funct3==0b111) { temp=rv5_reg[rs2]; if (temp==0) rv5_reg[rd]=rv5_reg[rs1]; else rv5_reg[rd] = rv5_reg[rs1] % temp; RV5_PRINT(" REMU "); } else // REMU
+  if (opcode==0b0110011 && funct3==0b000 && funct7==0b0100000) { rv5_reg[rd] = rv5_reg[rs1] - rv5_reg[rs2]; RV5_PRINT(" SUB "); } else // SUB
+  if (opcode==0b0110011 && funct3==0b000) { rv5_reg[rd] = rv5_reg[rs1] + rv5_reg[rs2]; RV5_PRINT(" ADD "); } else // ADD
+  if (opcode==0b0110011 && funct3==0b001) { rv5_reg[rd] = rv5_reg[rs1] << (rv5_reg[rs2]&0x1F); RV5_PRINT(" SLL "); } else // SLL
+  if (opcode==0b0110011 && funct3==0b010) { if ((int32_t)rv5_reg[rs1] < (int32_t)rv5_reg[rs2]) rv5_reg[rd]=1; else rv5_reg[rd]=0; RV5_PRINT(" SLT "); } else // SLT
+  if (opcode==0b0110011 && funct3==0b011) { if (rv5_reg[rs1] < rv5_reg[rs2]) rv5_reg[rd]=1; else rv5_reg[rd]=0; RV5_PRINT(" SLTU "); } else // SLTU
+  if (opcode==0b0110011 && funct3==0b100) { rv5_reg[rd] = rv5_reg[rs1] ^ rv5_reg[rs2]; RV5_PRINT(" XOR "); } else // XOR
+  if (opcode==0b0110011 && funct3==0b101 && funct7==0b0100000) { rv5_reg[rd] = (uint32_t)((int32_t)rv5_reg[rs1] >> (rv5_reg[rs2]&0x1F)); RV5_PRINT(" SRA "); } else // SRA
+  if (opcode==0b0110011 && funct3==0b101 && funct7==0b0000000) { rv5_reg[rd] = rv5_reg[rs1] >> (rv5_reg[rs2]&0x1F); RV5_PRINT(" SRL "); } else // SRL
+  if (opcode==0b0110011 && funct3==0b110) { rv5_reg[rd] = rv5_reg[rs1] | rv5_reg[rs2]; RV5_PRINT(" OR "); } else // OR
+  if (opcode==0b0110011 && funct3==0b111) { rv5_reg[rd] = rv5_reg[rs1] & rv5_reg[rs2]; RV5_PRINT(" AND "); } else // AND
+  if (opcode==0b1110011 && funct3==0b000 && (rv5_opcode>>20)==0x000) { halt=RV5_HALT_ECALL; RV5_PRINT(" ECALL "); } else // ECALL
+  if (opcode==0b1110011 && funct3==0b000 && (rv5_opcode>>20)==0x001) { halt=RV5_HALT_EBREAK; RV5_PRINT(" EBREAK "); } else // EBREAK
+  { RV5_PRINT(" **INVALID** "); return h->halt=RV5_HALT_INVALID; }
  
-  rv5_pc = rv5_pc + 0x4;
   rv5_reg[0]=0;
+  h->instret++;
+  RV5_TRACE(ipc, rv5_opcode, (opcode==0b1100011 || opcode==0b0100011 || opcode==0b1110011) ? 0 : rd);
+
+  if (halt==RV5_RUNNING) rv5_pc = rv5_pc + 0x4;
+  h->pc = rv5_pc;
+  return h->halt=halt;
+}
+
+
+int rv5_run_reference(rv5_hart_t *h)
+{
+  uint64_t start = h->instret;
+  int halt;
+
+  do
+    {
+      halt = rv5_step_reference(h);
+      if (halt==RV5_RUNNING && h->budget!=0 && h->instret-start>=h->budget) halt = h->halt = RV5_HALT_BUDGET;
+    } while (halt==RV5_RUNNING);
+
+  return halt;
+}
+
+
+// ------------------------------------------------------------------------
+// Trace file output and printer
+//
+// File layout: four 32-bit words { RV5_TRACE_MAGIC, record count, index of
+// the first record (low, high) } followed by the records, oldest first.
+// ------------------------------------------------------------------------
+
+void rv5_trace_dump(rv5_hart_t *h, const char *filename)
+{
+  FILE *f;
+  uint64_t first, entries = (uint64_t)h->trace_mask + 1;
+  uint32_t header[4];
+  uint32_t start, count;
+
+  if (h->trace_buffer==NULL) return;
+
+  first  = (h->trace_count > entries) ? h->trace_count - entries : 0;
+  start  = first & h->trace_mask;
+  count  = (uint32_t)(h->trace_count - first);
+
+  f = fopen(filename, "wb");
+  if (f==NULL) { perror(filename); return; }
+
+  header[0] = RV5_TRACE_MAGIC;
+  header[1] = count;
+  header[2] = (uint32_t)first;
+  header[3] = (uint32_t)(first >> 32);
+  fwrite(header, sizeof(header), 1, f);
+
+  // Oldest records run from start to the end of the buffer, then wrap to the beginning
+  if (start + count > entries)
+    {
+      fwrite(&h->trace_buffer[start], sizeof(rv5_trace_t), entries - start, f);
+      fwrite(&h->trace_buffer[0],     sizeof(rv5_trace_t), count - (entries - start), f);
+    }
+  else
+      fwrite(&h->trace_buffer[start], sizeof(rv5_trace_t), count, f);
+
+  fclose(f);
+}
+
+
+int rv5_trace_print(const char *filename)
+{
+  FILE *f;
+  rv5_trace_t t;
+  uint32_t header[4];
+  uint64_t index;
+
+  f = fopen(filename, "rb");
+  if (f==NULL) { perror(filename); return 1; }
+
+  if (fread(header, sizeof(header), 1, f)!=1 || header[0]!=RV5_TRACE_MAGIC)
+    {
+      fprintf(stderr, "%s: not a trace file\n", filename);
+      fclose(f);
+      return 1;
+    }
+
+  index = ((uint64_t)header[3] << 32) | header[2];
+  while (fread(&t, sizeof(t), 1, f)==1)
+    {
+      printf("%10llu PC:0x%08x Opcode:0x%08x %-8s", (unsigned long long)index++, t.pc, t.instruction, rv5_mnemonic[rv5_decode(t.instruction)]);
+      if (t.reg!=0) printf(" r%d:%x", t.reg, t.value);
+      printf("\n");
+    }
+
+  fclose(f);
+  return 0;
+}
+
+
+// ------------------------------------------------------------------------
+// Guest memory and program loader
+//
+// Each hart's guest memory, decode cache and code page flags are anonymous
+// mappings with MAP_NORESERVE, so the host only commits pages as they are
+// touched. Program files are mapped copy-on-write straight over guest memory
+// when the file offset and guest address share the same offset within a
+// host page, which is the normal case for both flat binaries at a page
+// aligned address and linked ELF executables. Nothing is read from the
+// file until the guest touches it. Anything else falls back to pread().
+// ------------------------------------------------------------------------
+
+void *rv5_map_anonymous(uint64_t size)
+{
+  void *p = mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE, -1, 0);
+  return (p==MAP_FAILED) ? NULL : p;
+}
+
+
+// Maps guest memory and allocates the trace buffer using the shared settings.
+// h->program must already be set.
+//
+int rv5_hart_init(rv5_hart_t *h)
+{
+  const char *program = h->program;
+
+  memset(h, 0, sizeof(rv5_hart_t));
+  h->program      = program;
+  h->memory_size  = rv5_memory_size;
+  h->budget       = rv5_budget;
+  h->memory       = rv5_map_anonymous(h->memory_size);
+  h->decode_cache = rv5_map_anonymous(((uint64_t)h->memory_size/4 + 1) * sizeof(rv5_decoded_t));
+  h->code_page    = rv5_map_anonymous(((uint64_t)h->memory_size + 0xFFF) >> 12);
+
+  if (h->memory==NULL || h->decode_cache==NULL || h->code_page==NULL)
+    {
+      fprintf(stderr, "Cannot map %u bytes of guest memory\n", h->memory_size);
+      return 1;
+    }
+
+  if (rv5_trace_entries!=0)
+    {
+      for (h->trace_mask=1; h->trace_mask<rv5_trace_entries && h->trace_mask<0x80000000; h->trace_mask<<=1);
+      h->trace_buffer = malloc(h->trace_mask * sizeof(rv5_trace_t));
+      if (h->trace_buffer==NULL) { fprintf(stderr, "Cannot allocate the trace buffer\n"); return 1; }
+      h->trace_mask = h->trace_mask - 1;
+    }
+  return 0;
+}
+
+
+// Releases guest memory and the trace buffer. Registers, pc and the counters are kept for reporting.
+//
+void rv5_hart_free(rv5_hart_t *h)
+{
+  if (h->memory)        munmap(h->memory, h->memory_size);
+  if (h->decode_cache)  munmap(h->decode_cache, ((uint64_t)h->memory_size/4 + 1) * sizeof(rv5_decoded_t));
+  if (h->code_page)     munmap(h->code_page, ((uint64_t)h->memory_size + 0xFFF) >> 12);
+  if (h->jit_arena)     munmap(h->jit_arena, RV5_JIT_ARENA);
+  if (h->jit_block)     munmap(h->jit_block, h->memory_size);
+  if (h->jit_code_word) munmap(h->jit_code_word, h->memory_size/4);
+  free(h->trace_buffer);
+  h->memory = NULL;
+  h->jit_arena = NULL;
+  h->jit_block = NULL;
+  h->jit_code_word = NULL;
+  h->decode_cache = NULL;
+  h->code_page = NULL;
+  h->trace_buffer = NULL;
+}
+
+
+int rv5_map_file(rv5_hart_t *h, int fd, uint64_t offset, uint32_t address, uint32_t length)
+{
+  uint64_t page = sysconf(_SC_PAGESIZE);
+  uint64_t delta = address % page;
+
+  if (length==0) return 0;
+  if ((uint64_t)address + length > h->memory_size)
+    {
+      fprintf(stderr, "%s: segment at 0x%x, 0x%x bytes, does not fit in guest memory\n", h->program, address, length);
+      return 1;
+    }
+
+  if ((offset % page)==delta)
+    {
+      if (mmap(h->memory + address - delta, length + delta, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_FIXED, fd, offset - delta)!=MAP_FAILED) return 0;
+    }
+
+  if (pread(fd, h->memory + address, length, offset)!=(ssize_t)length)
+    {
+      fprintf(stderr, "%s: cannot read 0x%x bytes at file offset 0x%llx\n", h->program, length, (unsigned long long)offset);
+      return 1;
+    }
+  return 0;
+}
+
+
+int rv5_load_elf(rv5_hart_t *h, int fd)
+{
+  Elf32_Ehdr eh;
+  Elf32_Phdr ph;
+  uint64_t page = sysconf(_SC_PAGESIZE);
+  uint32_t bss_start, bss_end;
+  int i;
+
+  if (pread(fd, &eh, sizeof(eh), 0)!=sizeof(eh) || eh.e_ident[EI_CLASS]!=ELFCLASS32 || eh.e_ident[EI_DATA]!=ELFDATA2LSB || eh.e_machine!=EM_RISCV)
+    {
+      fprintf(stderr, "%s: not a 32-bit little-endian RISC-V ELF file\n", h->program);
+      return 1;
+    }
+
+  for (i=0; i<eh.e_phnum; i++)
+    {
+      if (pread(fd, &ph, sizeof(ph), eh.e_phoff + (uint64_t)i*eh.e_phentsize)!=sizeof(ph)) { fprintf(stderr, "%s: truncated ELF file\n", h->program); return 1; }
+      if (ph.p_type!=PT_LOAD) continue;
+
+      if (ph.p_memsz < ph.p_filesz || (uint64_t)ph.p_vaddr + ph.p_memsz > h->memory_size)
+        {
+          fprintf(stderr, "%s: segment at 0x%x, 0x%x bytes, does not fit in guest memory\n", h->program, ph.p_vaddr, ph.p_memsz);
+          return 1;
+        }
+      if (rv5_map_file(h, fd, ph.p_offset, ph.p_vaddr, ph.p_filesz)) return 1;
+
+      // The last file page also holds whatever follows the segment in the file, so clear the
+      // start of .bss by hand. Pages beyond it are still untouched anonymous memory.
+      bss_start = ph.p_vaddr + ph.p_filesz;
+      bss_end   = ph.p_vaddr + ph.p_memsz;
+      if (bss_end > bss_start)
+        {
+          if ((uint64_t)bss_end - bss_start > page - bss_start%page) bss_end = bss_start + (page - bss_start%page);
+          memset(h->memory + bss_start, 0, bss_end - bss_start);
+        }
+    }
+
+  h->pc = eh.e_entry;
+  return 0;
+}
+
+
+int rv5_load_program(rv5_hart_t *h, uint32_t load_address)
+{
+  struct stat st;
+  unsigned char ident[4];
+  int fd, result;
+
+  fd = open(h->program, O_RDONLY);
+  if (fd<0 || fstat(fd, &st)!=0) { perror(h->program); if (fd>=0) close(fd); return 1; }
+
+  if (pread(fd, ident, 4, 0)==4 && memcmp(ident, ELFMAG, SELFMAG)==0)
+      result = rv5_load_elf(h, fd);
+  else
+    {
+      if (st.st_size > 0xFFFFFFFF) st.st_size = 0xFFFFFFFF;
+      result = rv5_map_file(h, fd, 0, load_address, (uint32_t)st.st_size);
+      h->pc = load_address;
+    }
+
+  close(fd);   // The mappings stay valid after the descriptor is closed
+  return result;
+}
+
+
+// Parses a size with an optional K, M or G suffix
+//
+uint64_t rv5_parse_size(const char *text)
+{
+  char *end;
+  uint64_t size = strtoull(text, &end, 0);
+
+  if (*end=='K' || *end=='k') size = size << 10;
+  if (*end=='M' || *end=='m') size = size << 20;
+  if (*end=='G' || *end=='g') size = size << 30;
+  return size;
+}
+
+
+// ------------------------------------------------------------------------
+// Basic block translator (x86-64 hosts)
+//
+// Straight-line runs of guest code ending at a JAL, JALR or branch are
+// translated into native code in an executable arena, keyed by the guest pc
+// of their first instruction. Guest registers stay in the hart's reg[]
+// array, addressed through rbx, and guest memory through r12.
+// Every block starts by charging its instruction count against the budget
+// held in r13, and leaves to the interpreter if not enough is left.
+//
+// Block exits load the next pc into eax and the arena offset of the exit
+// itself into edx, then jump to a common exit sequence which returns to
+// rv5_run_translated(). Once the target has been translated the exit is
+// patched into a direct jump, so hot loops stay in native code. JALR looks
+// up its target in the block table inline.
+//
+// Each word of guest memory covered by a block has a flag. A store which
+// hits a flagged word leaves the block straight after it and the whole
+// arena is flushed, so modified code is translated again on its next
+// execution. Faulting loads and stores, ECALL, EBREAK and invalid
+// instructions are left to the reference interpreter, which is also the
+// reference for what the translated code does.
+// ------------------------------------------------------------------------
+
+#if defined(__x86_64__) && !defined(_WIN32)
+
+#define RV5_JIT_BLOCK_MAX   64          // Guest instructions per block
+#define RV5_JIT_BLOCK_BYTES 0x3000      // Worst case arena space for one block
+
+#define RV5_JIT_UNLINKED    0xFFFFFFFF  // Exit codes in edx. Anything smaller is the offset of a patchable exit
+#define RV5_JIT_BAIL        0xFFFFFFFE  // Not enough budget left for the block at pc
+#define RV5_JIT_STEP        0xFFFFFFFD  // The instruction at pc is left to the reference interpreter
+#define RV5_JIT_FLUSH       0xFFFFFFFC  // A store hit translated code
+
+// Shared with the entry and exit sequences, which address it through rdi
+//
+typedef struct
+{
+  uint32_t *reg;
+  uint8_t *memory;
+  uint64_t budget;
+  uint8_t *code_word;
+  uint32_t *block;
+  uint8_t *arena;
+  uint32_t pc;
+  uint32_t link;
+} rv5_jit_context_t;
+
+typedef void (*rv5_jit_entry_t)(rv5_jit_context_t *context, uint8_t *code);
+
+
+#define RV5_X86_B(x)        *p++ = (uint8_t)(x)
+#define RV5_X86_D(x)        { uint32_t v_ = (x); memcpy(p, &v_, 4); p = p + 4; }
+#define RV5_X86_REL(at, to) { int32_t r_ = (int32_t)((to) - ((at) + 4)); memcpy((at), &r_, 4); }
+
+// op r32, [rbx + 4*guest register]
+#define RV5_X86_REG(op, r32, n)    { RV5_X86_B(op); RV5_X86_B(0x43 | ((r32)<<3)); RV5_X86_B((n)*4); }
+
+enum { RV5_EAX=0, RV5_ECX=1, RV5_EDX=2 };
+
+
+// Builds the entry and exit sequences at the start of the arena
+//
+uint8_t *rv5_jit_stubs(rv5_hart_t *h)
+{
+  uint8_t *p = h->jit_arena;
+
+  // Entry: rv5_jit_entry_t, context in rdi, code in rsi
+  RV5_X86_B(0x53); RV5_X86_B(0x55);                                               // push rbx, rbp
+  RV5_X86_B(0x41); RV5_X86_B(0x54); RV5_X86_B(0x41); RV5_X86_B(0x55);             // push r12, r13
+  RV5_X86_B(0x41); RV5_X86_B(0x56); RV5_X86_B(0x41); RV5_X86_B(0x57);             // push r14, r15
+  RV5_X86_B(0x57);                                                                // push rdi
+  RV5_X86_B(0x48); RV5_X86_B(0x8B); RV5_X86_B(0x5F); RV5_X86_B(offsetof(rv5_jit_context_t, reg));        // mov rbx, reg
+  RV5_X86_B(0x4C); RV5_X86_B(0x8B); RV5_X86_B(0x67); RV5_X86_B(offsetof(rv5_jit_context_t, memory));     // mov r12, memory
+  RV5_X86_B(0x4C); RV5_X86_B(0x8B); RV5_X86_B(0x6F); RV5_X86_B(offsetof(rv5_jit_context_t, budget));     // mov r13, budget
+  RV5_X86_B(0x4C); RV5_X86_B(0x8B); RV5_X86_B(0x77); RV5_X86_B(offsetof(rv5_jit_context_t, code_word));  // mov r14, code_word
+  RV5_X86_B(0x4C); RV5_X86_B(0x8B); RV5_X86_B(0x7F); RV5_X86_B(offsetof(rv5_jit_context_t, block));      // mov r15, block
+  RV5_X86_B(0x48); RV5_X86_B(0x8B); RV5_X86_B(0x6F); RV5_X86_B(offsetof(rv5_jit_context_t, arena));      // mov rbp, arena
+  RV5_X86_B(0xFF); RV5_X86_B(0xE6);                                               // jmp rsi
+
+  // Exit: next pc in eax, exit code in edx
+  p = h->jit_arena + ((p - h->jit_arena + 15) & ~15);
+  h->jit_exit = p - h->jit_arena;
+  RV5_X86_B(0x5F);                                                                // pop rdi
+  RV5_X86_B(0x4C); RV5_X86_B(0x89); RV5_X86_B(0x6F); RV5_X86_B(offsetof(rv5_jit_context_t, budget));     // mov budget, r13
+  RV5_X86_B(0x89); RV5_X86_B(0x47); RV5_X86_B(offsetof(rv5_jit_context_t, pc));                          // mov pc, eax
+  RV5_X86_B(0x89); RV5_X86_B(0x57); RV5_X86_B(offsetof(rv5_jit_context_t, link));                        // mov link, edx
+  RV5_X86_B(0x41); RV5_X86_B(0x5F); RV5_X86_B(0x41); RV5_X86_B(0x5E);             // pop r15, r14
+  RV5_X86_B(0x41); RV5_X86_B(0x5D); RV5_X86_B(0x41); RV5_X86_B(0x5C);             // pop r13, r12
+  RV5_X86_B(0x5D); RV5_X86_B(0x5B);                                               // pop rbp, rbx
+  RV5_X86_B(0xC3);                                                                // ret
+
+  return h->jit_arena + ((p - h->jit_arena + 15) & ~15);
+}
+
+
+// Maps the arena and the lookup tables on the first translated run. Returns 1 if the host refuses executable memory.
+//
+int rv5_jit_init(rv5_hart_t *h)
+{
+  if (h->jit_arena) return 0;
+
+  h->jit_arena = mmap(NULL, RV5_JIT_ARENA, PROT_READ|PROT_WRITE|PROT_EXEC, MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE, -1, 0);
+  if (h->jit_arena==MAP_FAILED) h->jit_arena = NULL;
+  h->jit_block = rv5_map_anonymous(h->memory_size);
+  h->jit_code_word = rv5_map_anonymous(h->memory_size/4);
+
+  if (h->jit_arena==NULL || h->jit_block==NULL || h->jit_code_word==NULL)
+    {
+      fprintf(stderr, "%s: cannot map executable memory, using the predecoded engine\n", h->program ? h->program : "riscv");
+      return 1;
+    }
+
+  h->jit_start = rv5_jit_stubs(h) - h->jit_arena;
+  h->jit_used = h->jit_start;
+  return 0;
+}
+
+
+// Drops every translated block. The tables go back to untouched zero pages.
+//
+void rv5_jit_flush(rv5_hart_t *h)
+{
+  h->jit_used = h->jit_start;
+  h->jit_flushes++;
+  madvise(h->jit_block, h->memory_size, MADV_DONTNEED);
+  madvise(h->jit_code_word, h->memory_size/4, MADV_DONTNEED);
+}
+
+
+// mov eax, target; mov edx, code; jmp exit. A patchable exit passes its own offset as the code.
+//
+uint8_t *rv5_jit_exit(rv5_hart_t *h, uint8_t *p, uint32_t target, uint32_t code)
+{
+  if (code==0) code = p - h->jit_arena;
+  RV5_X86_B(0xB8); RV5_X86_D(target);
+  RV5_X86_B(0xBA); RV5_X86_D(code);
+  RV5_X86_B(0xE9); RV5_X86_REL(p, h->jit_arena + h->jit_exit); p = p + 4;
+  return p;
+}
+
+
+// Translates the block starting at pc and returns its arena offset, or 0 if
+// the instruction at pc has to go to the reference interpreter.
+//
+uint32_t rv5_translate(rv5_hart_t *h, uint32_t pc)
+{
+  struct { uint8_t *jump; uint32_t pc; uint32_t refund; uint32_t code; } side[RV5_JIT_BLOCK_MAX*3 + 1];
+  uint32_t count, i, address, sides=0, limit=h->memory_size;
+  rv5_decoded_t *d;
+  uint8_t *start, *p;
+  unsigned char handler, ends=0;
+
+  // Find the end of the block first, the entry code needs its length
+  for (count=0, address=pc; count<RV5_JIT_BLOCK_MAX && address<limit && !ends; count++, address=address+4)
+    {
+      rv5_predecode(h, address>>2);
+      handler = h->decode_cache[address>>2].handler;
+      if (handler==RV5_ECALL || handler==RV5_EBREAK || handler==RV5_INVALID) break;
+      ends = (handler>=RV5_JAL && handler<=RV5_BGEU);
+    }
+  if (count==0) return 0;
+
+  if (h->jit_used + RV5_JIT_BLOCK_BYTES > RV5_JIT_ARENA) rv5_jit_flush(h);
+  start = p = h->jit_arena + h->jit_used;
+
+  // cmp r13, count; jb bail; sub r13, count
+  RV5_X86_B(0x49); RV5_X86_B(0x81); RV5_X86_B(0xFD); RV5_X86_D(count);
+  RV5_X86_B(0x0F); RV5_X86_B(0x82); side[sides].jump=p; side[sides].pc=pc; side[sides].refund=0; side[sides++].code=RV5_JIT_BAIL; p = p + 4;
+  RV5_X86_B(0x49); RV5_X86_B(0x81); RV5_X86_B(0xED); RV5_X86_D(count);
+
+  for (i=0, address=pc; i<count; i++, address=address+4)
+    {
+      d = &h->decode_cache[address>>2];
+      switch (d->handler)
+        {
+          case RV5_LUI:   if (d->dst) { RV5_X86_B(0xC7); RV5_X86_B(0x43); RV5_X86_B(d->dst*4); RV5_X86_D(d->imm); }            break;
+          case RV5_AUIPC: if (d->dst) { RV5_X86_B(0xC7); RV5_X86_B(0x43); RV5_X86_B(d->dst*4); RV5_X86_D(d->imm + address); }  break;
+
+          case RV5_ADDI: case RV5_XORI: case RV5_ORI: case RV5_ANDI:
+            if (d->dst==0) break;
+            RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+            RV5_X86_B(d->handler==RV5_ADDI ? 0x05 : d->handler==RV5_XORI ? 0x35 : d->handler==RV5_ORI ? 0x0D : 0x25); RV5_X86_D(d->imm);
+            RV5_X86_REG(0x89, RV5_EAX, d->dst);
+            break;
+
+          case RV5_SLTI: case RV5_SLTIU:
+            if (d->dst==0) break;
+            RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+            RV5_X86_B(0x3D); RV5_X86_D(d->imm);                                                      // cmp eax, imm
+            RV5_X86_B(0x0F); RV5_X86_B(d->handler==RV5_SLTI ? 0x9C : 0x92); RV5_X86_B(0xC0);          // setl/setb al
+            RV5_X86_B(0x0F); RV5_X86_B(0xB6); RV5_X86_B(0xC0);                                       // movzx eax, al
+            RV5_X86_REG(0x89, RV5_EAX, d->dst);
+            break;
+
+          case RV5_SLLI: case RV5_SRLI: case RV5_SRAI:
+            if (d->dst==0) break;
+            RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+            RV5_X86_B(0xC1); RV5_X86_B(d->handler==RV5_SLLI ? 0xE0 : d->handler==RV5_SRLI ? 0xE8 : 0xF8); RV5_X86_B(d->imm);
+            RV5_X86_REG(0x89, RV5_EAX, d->dst);
+            break;
+
+          case RV5_ADD: case RV5_SUB: case RV5_XOR: case RV5_OR: case RV5_AND:
+            if (d->dst==0) break;
+            RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+            RV5_X86_REG(d->handler==RV5_ADD ? 0x03 : d->handler==RV5_SUB ? 0x2B : d->handler==RV5_XOR ? 0x33 : d->handler==RV5_OR ? 0x0B : 0x23, RV5_EAX, d->src2);
+            RV5_X86_REG(0x89, RV5_EAX, d->dst);
+            break;
+
+          case RV5_SLT: case RV5_SLTU:
+            if (d->dst==0) break;
+            RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+            RV5_X86_REG(0x3B, RV5_EAX, d->src2);                                                     // cmp eax, src2
+            RV5_X86_B(0x0F); RV5_X86_B(d->handler==RV5_SLT ? 0x9C : 0x92); RV5_X86_B(0xC0);
+            RV5_X86_B(0x0F); RV5_X86_B(0xB6); RV5_X86_B(0xC0);
+            RV5_X86_REG(0x89, RV5_EAX, d->dst);
+            break;
+
+          case RV5_SLL: case RV5_SRL: case RV5_SRA:                                                  // x86 also masks the count to 5 bits
+            if (d->dst==0) break;
+            RV5_X86_REG(0x8B, RV5_ECX, d->src2);
+            RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+            RV5_X86_B(0xD3); RV5_X86_B(d->handler==RV5_SLL ? 0xE0 : d->handler==RV5_SRL ? 0xE8 : 0xF8);
+            RV5_X86_REG(0x89, RV5_EAX, d->dst);
+            break;
+
+          case RV5_MUL: case RV5_MULH: case RV5_MULHU:
+            if (d->dst==0) break;
+            RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+            if (d->handler==RV5_MUL) { RV5_X86_B(0x0F); RV5_X86_REG(0xAF, RV5_EAX, d->src2); }       // imul eax, src2
+            else
+              {
+                RV5_X86_B(0xF7); RV5_X86_B(d->handler==RV5_MULH ? 0x6B : 0x63); RV5_X86_B(d->src2*4);   // imul/mul dword src2
+                RV5_X86_B(0x89); RV5_X86_B(0xD0);                                                    // mov eax, edx
+              }
+            RV5_X86_REG(0x89, RV5_EAX, d->dst);
+            break;
+
+          case RV5_MULHSU:
+            if (d->dst==0) break;
+            RV5_X86_B(0x48); RV5_X86_REG(0x63, RV5_EAX, d->src1);                                   // movsxd rax, src1
+            RV5_X86_REG(0x8B, RV5_ECX, d->src2);                                                     // mov ecx, src2
+            RV5_X86_B(0x48); RV5_X86_B(0x0F); RV5_X86_B(0xAF); RV5_X86_B(0xC1);                      // imul rax, rcx
+            RV5_X86_B(0x48); RV5_X86_B(0xC1); RV5_X86_B(0xE8); RV5_X86_B(0x20);                      // shr rax, 32
+            RV5_X86_REG(0x89, RV5_EAX, d->dst);
+            break;
+
+          case RV5_DIV: case RV5_DIVU: case RV5_REM: case RV5_REMU:
+            {
+              uint8_t *zero, *normal=NULL, *overflow=NULL, *done;
+
+              if (d->dst==0) break;
+              RV5_X86_REG(0x8B, RV5_ECX, d->src2);
+              RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+              RV5_X86_B(0x85); RV5_X86_B(0xC9);                                                      // test ecx, ecx
+              RV5_X86_B(0x74); zero = p++;                                                           // jz zero
+              if (d->handler==RV5_DIV || d->handler==RV5_REM)
+                {
+                  RV5_X86_B(0x83); RV5_X86_B(0xF9); RV5_X86_B(0xFF);                                 // cmp ecx, -1
+                  RV5_X86_B(0x75); normal = p++;                                                     // jne normal
+                  RV5_X86_B(0x3D); RV5_X86_D(0x80000000);                                            // cmp eax, 0x80000000
+                  RV5_X86_B(0x74); overflow = p++;                                                   // je overflow
+                  *normal = p - (normal + 1);
+                  RV5_X86_B(0x99);                                                                   // cdq
+                  RV5_X86_B(0xF7); RV5_X86_B(0xF9);                                                  // idiv ecx
+                }
+              else
+                {
+                  RV5_X86_B(0x31); RV5_X86_B(0xD2);                                                  // xor edx, edx
+                  RV5_X86_B(0xF7); RV5_X86_B(0xF1);                                                  // div ecx
+                }
+              if (d->handler==RV5_REM || d->handler==RV5_REMU) { RV5_X86_B(0x89); RV5_X86_B(0xD0); }  // mov eax, edx
+              RV5_X86_B(0xEB); done = p++;                                                           // jmp done
+
+              // Divide by zero: the quotient is all ones, the remainder is the dividend already in eax
+              *zero = p - (zero + 1);
+              if (d->handler==RV5_DIV || d->handler==RV5_DIVU) { RV5_X86_B(0xB8); RV5_X86_D(0xFFFFFFFF); }
+
+              // Overflow: the quotient is the dividend already in eax, the remainder is zero
+              if (overflow)
+                {
+                  RV5_X86_B(0xEB); RV5_X86_B(d->handler==RV5_REM ? 2 : 0);                           // jmp done
+                  *overflow = p - (overflow + 1);
+                  if (d->handler==RV5_REM) { RV5_X86_B(0x31); RV5_X86_B(0xC0); }                     // xor eax, eax
+                }
+              *done = p - (done + 1);
+              RV5_X86_REG(0x89, RV5_EAX, d->dst);
+            }
+            break;
+
+          case RV5_LB: case RV5_LH: case RV5_LW: case RV5_LBU: case RV5_LHU:
+          case RV5_SB: case RV5_SH: case RV5_SW:
+            handler = d->handler;
+            if (handler>=RV5_SB) RV5_X86_REG(0x8B, RV5_ECX, d->src2);
+            RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+            RV5_X86_B(0x05); RV5_X86_D(d->imm);                                                      // add eax, imm
+
+            // Out of range or misaligned: leave with this instruction not retired
+            RV5_X86_B(0x3D); RV5_X86_D(limit);                                                       // cmp eax, limit
+            RV5_X86_B(0x0F); RV5_X86_B(0x83); side[sides].jump=p; side[sides].pc=address; side[sides].refund=count-i; side[sides++].code=RV5_JIT_STEP; p = p + 4;
+            if (handler==RV5_LH || handler==RV5_LHU || handler==RV5_SH || handler==RV5_LW || handler==RV5_SW)
+              {
+                RV5_X86_B(0xA8); RV5_X86_B((handler==RV5_LW || handler==RV5_SW) ? 3 : 1);            // test al, size-1
+                RV5_X86_B(0x0F); RV5_X86_B(0x85); side[sides].jump=p; side[sides].pc=address; side[sides].refund=count-i; side[sides++].code=RV5_JIT_STEP; p = p + 4;
+              }
+
+            switch (handler)
+              {
+                case RV5_LB:  RV5_X86_B(0x41); RV5_X86_B(0x0F); RV5_X86_B(0xBE); RV5_X86_B(0x04); RV5_X86_B(0x04);  break;  // movsx eax, byte [r12+rax]
+                case RV5_LH:  RV5_X86_B(0x41); RV5_X86_B(0x0F); RV5_X86_B(0xBF); RV5_X86_B(0x04); RV5_X86_B(0x04);  break;  // movsx eax, word [r12+rax]
+                case RV5_LW:  RV5_X86_B(0x41); RV5_X86_B(0x8B); RV5_X86_B(0x04); RV5_X86_B(0x04);                   break;  // mov eax, [r12+rax]
+                case RV5_LBU: RV5_X86_B(0x41); RV5_X86_B(0x0F); RV5_X86_B(0xB6); RV5_X86_B(0x04); RV5_X86_B(0x04);  break;  // movzx eax, byte [r12+rax]
+                case RV5_LHU: RV5_X86_B(0x41); RV5_X86_B(0x0F); RV5_X86_B(0xB7); RV5_X86_B(0x04); RV5_X86_B(0x04);  break;  // movzx eax, word [r12+rax]
+                case RV5_SB:  RV5_X86_B(0x41); RV5_X86_B(0x88); RV5_X86_B(0x0C); RV5_X86_B(0x04);                   break;  // mov [r12+rax], cl
+                case RV5_SH:  RV5_X86_B(0x66); RV5_X86_B(0x41); RV5_X86_B(0x89); RV5_X86_B(0x0C); RV5_X86_B(0x04);  break;  // mov [r12+rax], cx
+                case RV5_SW:  RV5_X86_B(0x41); RV5_X86_B(0x89); RV5_X86_B(0x0C); RV5_X86_B(0x04);                   break;  // mov [r12+rax], ecx
+              }
+
+            if (handler<RV5_SB)
+              {
+                if (d->dst) RV5_X86_REG(0x89, RV5_EAX, d->dst);
+              }
+            else
+              {
+                // The store is done. If it hit translated code, leave before the next instruction and flush
+                RV5_X86_B(0x89); RV5_X86_B(0xC2);                                                    // mov edx, eax
+                RV5_X86_B(0xC1); RV5_X86_B(0xEA); RV5_X86_B(0x02);                                   // shr edx, 2
+                RV5_X86_B(0x41); RV5_X86_B(0x80); RV5_X86_B(0x3C); RV5_X86_B(0x16); RV5_X86_B(0x00); // cmp byte [r14+rdx], 0
+                RV5_X86_B(0x0F); RV5_X86_B(0x85); side[sides].jump=p; side[sides].pc=address+4; side[sides].refund=count-i-1; side[sides++].code=RV5_JIT_FLUSH; p = p + 4;
+              }
+            break;
+
+          case RV5_JAL:
+            if (d->dst) { RV5_X86_B(0xC7); RV5_X86_B(0x43); RV5_X86_B(d->dst*4); RV5_X86_D(address + 4); }
+            p = rv5_jit_exit(h, p, address + d->imm, 0);
+            break;
+
+          case RV5_JALR:
+            RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+            RV5_X86_B(0x05); RV5_X86_D(d->imm);                                                      // add eax, imm
+            RV5_X86_B(0x83); RV5_X86_B(0xE0); RV5_X86_B(0xFE);                                       // and eax, -2
+            if (d->dst) { RV5_X86_B(0xC7); RV5_X86_B(0x43); RV5_X86_B(d->dst*4); RV5_X86_D(address + 4); }
+
+            // Jump straight to the target block if there is one, otherwise let the C side look it up
+            RV5_X86_B(0x3D); RV5_X86_D(limit);                                                       // cmp eax, limit
+            RV5_X86_B(0x73); RV5_X86_B(0x11);                                                        // jae unlinked
+            RV5_X86_B(0xA8); RV5_X86_B(0x03);                                                        // test al, 3
+            RV5_X86_B(0x75); RV5_X86_B(0x0D);                                                        // jnz unlinked
+            RV5_X86_B(0x41); RV5_X86_B(0x8B); RV5_X86_B(0x14); RV5_X86_B(0x07);                      // mov edx, [r15+rax]
+            RV5_X86_B(0x85); RV5_X86_B(0xD2);                                                        // test edx, edx
+            RV5_X86_B(0x74); RV5_X86_B(0x05);                                                        // jz unlinked
+            RV5_X86_B(0x48); RV5_X86_B(0x01); RV5_X86_B(0xEA);                                       // add rdx, rbp
+            RV5_X86_B(0xFF); RV5_X86_B(0xE2);                                                        // jmp rdx
+            RV5_X86_B(0xBA); RV5_X86_D(RV5_JIT_UNLINKED);                                            // unlinked: mov edx, code
+            RV5_X86_B(0xE9); RV5_X86_REL(p, h->jit_arena + h->jit_exit); p = p + 4;
+            break;
+
+          case RV5_BEQ: case RV5_BNE: case RV5_BLT: case RV5_BGE: case RV5_BLTU: case RV5_BGEU:
+            {
+              static const uint8_t condition[] = { 0x84, 0x85, 0x8C, 0x8D, 0x82, 0x83 };   // je, jne, jl, jge, jb, jae
+              uint8_t *taken;
+
+              RV5_X86_REG(0x8B, RV5_EAX, d->src1);
+              RV5_X86_REG(0x3B, RV5_EAX, d->src2);
+              RV5_X86_B(0x0F); RV5_X86_B(condition[d->handler - RV5_BEQ]); taken = p; p = p + 4;
+              p = rv5_jit_exit(h, p, address + 4, 0);
+              RV5_X86_REL(taken, p);
+              p = rv5_jit_exit(h, p, address + d->imm, 0);
+            }
+            break;
+        }
+    }
+
+  // Ran into the block length limit or an instruction the interpreter handles
+  if (!ends) p = rv5_jit_exit(h, p, address, 0);
+
+  for (i=0; i<sides; i++)
+    {
+      RV5_X86_REL(side[i].jump, p);
+      if (side[i].refund) { RV5_X86_B(0x49); RV5_X86_B(0x81); RV5_X86_B(0xC5); RV5_X86_D(side[i].refund); }   // add r13, refund
+      p = rv5_jit_exit(h, p, side[i].pc, side[i].code);
+    }
+
+  for (address=pc; address<pc + count*4; address=address+4) h->jit_code_word[address>>2] = 1;
+  h->jit_block[pc>>2] = start - h->jit_arena;
+  h->jit_used = (p - h->jit_arena + 15) & ~15;
+  return start - h->jit_arena;
+}
+
+
+// Runs until a halt, with the same results as rv5_run_predecoded().
+// Tracing is only done by the interpreters, so a traced hart runs predecoded.
+//
+int rv5_run_translated(rv5_hart_t *h)
+{
+  rv5_jit_context_t context;
+  rv5_jit_entry_t enter;
+  uint64_t start, instret = h->instret, saved_budget;
+  uint32_t block, flushes;
+  uint8_t *patch;
+  int halt = RV5_RUNNING, interpreted = 0;
+
+  if (h->trace_buffer || rv5_jit_init(h)) return rv5_run_predecoded(h);
+
+  enter = (rv5_jit_entry_t)h->jit_arena;
+  context.reg       = h->reg;
+  context.memory    = h->memory;
+  context.budget    = h->budget ? h->budget : UINT64_MAX;
+  context.code_word = h->jit_code_word;
+  context.block     = h->jit_block;
+  context.arena     = h->jit_arena;
+  context.pc        = h->pc;
+  context.link      = RV5_JIT_UNLINKED;
+  start = context.budget;
+
+  while (halt==RV5_RUNNING)
+    {
+      if (context.budget==0) { halt = RV5_HALT_BUDGET; break; }
+      if (context.link==RV5_JIT_FLUSH) { rv5_jit_flush(h); context.link = RV5_JIT_UNLINKED; }
+
+      block = 0;
+      if (context.link!=RV5_JIT_STEP && context.link!=RV5_JIT_BAIL && !(context.pc & 3) && context.pc < h->memory_size)
+        {
+          block = h->jit_block[context.pc>>2];
+          if (block==0)
+            {
+              flushes = h->jit_flushes;
+              block = rv5_translate(h, context.pc);
+              if (flushes!=h->jit_flushes) context.link = RV5_JIT_UNLINKED;   // The exit to patch went with the flush
+            }
+        }
+
+      // Anything the translated code does not handle runs on the reference interpreter
+      if (block==0)
+        {
+          h->pc = context.pc;
+          h->instret = instret + (start - context.budget);
+          if (context.link==RV5_JIT_BAIL)
+            {
+              saved_budget = h->budget;
+              h->budget = context.budget;
+              halt = rv5_run_reference(h);
+              h->budget = saved_budget;
+            }
+          else
+              halt = rv5_step_reference(h);
+          context.budget = start - (h->instret - instret);
+          context.pc = h->pc;
+          context.link = RV5_JIT_UNLINKED;
+          interpreted = 1;
+          continue;
+        }
+
+      // Chain the exit we came out of straight to this block
+      if (context.link < h->jit_used)
+        {
+          patch = h->jit_arena + context.link;
+          patch[0] = 0xE9;
+          RV5_X86_REL(patch + 1, h->jit_arena + block);
+        }
+
+      enter(&context, h->jit_arena + block);
+    }
+
+  // The interpreter does not check its stores against translated code
+  if (interpreted) rv5_jit_flush(h);
+
+  h->pc = context.pc;
+  h->instret = instret + (start - context.budget);
+  h->halt = halt;
+  return halt;
+}
+
+#else
+
+int rv5_run_translated(rv5_hart_t *h)
+{
+  return rv5_run_predecoded(h);
+}
+
+#endif
+
+
+int rv5_run(rv5_hart_t *h, int engine)
+{
+  switch (engine)
+    {
+      case RV5_ENGINE_PREDECODED: return rv5_run_predecoded(h);
+      case RV5_ENGINE_TRANSLATED: return rv5_run_translated(h);
+      default:                    return rv5_run_reference(h);
+    }
+}
+
+
+// Wall clock time. clock() would add up the CPU time of every worker thread.
+//
+double rv5_seconds()
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+// ------------------------------------------------------------------------
+// Multi-hart runner
+//
+// Every hart is one task, dealt round-robin onto one deque per worker
+// thread. A worker takes tasks from the tail of its own deque and, once
+// that is empty, steals from the head of the other workers' deques, so
+// workers which drew short programs pick up the work queued behind a long
+// one. Each task maps, loads, runs and unmaps its own hart.
+// ------------------------------------------------------------------------
+
+typedef struct
+{
+  pthread_mutex_t lock;
+  uint32_t *task;
+  uint32_t head;
+  uint32_t tail;
+} rv5_deque_t;
+
+typedef struct
+{
+  rv5_hart_t *harts;
+  uint32_t hart_count;
+  rv5_deque_t *deque;
+  uint32_t workers;
+  uint32_t load_address;
+  int engine;
+  const char *trace_file;
+} rv5_pool_t;
+
+typedef struct
+{
+  rv5_pool_t *pool;
+  uint32_t id;
+} rv5_worker_t;
+
+
+int rv5_take_task(rv5_pool_t *pool, uint32_t id, uint32_t *task)
+{
+  rv5_deque_t *q;
+  uint32_t i;
+
+  q = &pool->deque[id];
+  pthread_mutex_lock(&q->lock);
+  if (q->head < q->tail) { *task = q->task[--q->tail]; pthread_mutex_unlock(&q->lock); return 1; }
+  pthread_mutex_unlock(&q->lock);
+
+  for (i=1; i<pool->workers; i++)
+    {
+      q = &pool->deque[(id+i) % pool->workers];
+      pthread_mutex_lock(&q->lock);
+      if (q->head < q->tail) { *task = q->task[q->head++]; pthread_mutex_unlock(&q->lock); return 1; }
+      pthread_mutex_unlock(&q->lock);
+    }
+  return 0;
+}
+
+
+void *rv5_worker(void *arg)
+{
+  rv5_worker_t *w = (rv5_worker_t *)arg;
+  rv5_pool_t *pool = w->pool;
+  rv5_hart_t *h;
+  uint32_t task;
+  char name[4096];
+
+  while (rv5_take_task(pool, w->id, &task))
+    {
+      h = &pool->harts[task];
+
+      if (rv5_hart_init(h) || rv5_load_program(h, pool->load_address))
+          h->halt = RV5_HALT_LOAD_ERROR;
+      else
+        {
+          rv5_run(h, pool->engine);
+          if (pool->trace_file!=NULL)
+            {
+              snprintf(name, sizeof(name), "%s.%u", pool->trace_file, task);
+              rv5_trace_dump(h, name);
+            }
+        }
+      rv5_hart_free(h);
+    }
+  return NULL;
+}
+
+
+// Runs every hart and prints one line per hart. Returns the number of harts which did not pass.
+//
+uint32_t rv5_run_pool(rv5_pool_t *pool)
+{
+  pthread_t *threads;
+  rv5_worker_t *w;
+  rv5_hart_t *h;
+  uint64_t instret=0;
+  uint32_t i, failed=0;
+  double seconds;
+
+  if (pool->workers > pool->hart_count) pool->workers = pool->hart_count;
+  pool->deque = calloc(pool->workers, sizeof(rv5_deque_t));
+  threads     = calloc(pool->workers, sizeof(pthread_t));
+  w           = calloc(pool->workers, sizeof(rv5_worker_t));
+  if (pool->deque==NULL || threads==NULL || w==NULL) { fprintf(stderr, "Out of memory\n"); return pool->hart_count; }
+
+  for (i=0; i<pool->workers; i++)
+    {
+      pthread_mutex_init(&pool->deque[i].lock, NULL);
+      pool->deque[i].task = malloc(((pool->hart_count + pool->workers - 1) / pool->workers) * sizeof(uint32_t));
+      if (pool->deque[i].task==NULL) { fprintf(stderr, "Out of memory\n"); return pool->hart_count; }
+    }
+  for (i=0; i<pool->hart_count; i++)
+    {
+      rv5_deque_t *q = &pool->deque[i % pool->workers];
+      q->task[q->tail++] = i;
+    }
+
+  seconds = rv5_seconds();
+  for (i=0; i<pool->workers; i++)
+    {
+      w[i].pool = pool;
+      w[i].id   = i;
+      pthread_create(&threads[i], NULL, rv5_worker, &w[i]);
+    }
+  for (i=0; i<pool->workers; i++) pthread_join(threads[i], NULL);
+  seconds = rv5_seconds() - seconds;
+
+  for (i=0; i<pool->hart_count; i++)
+    {
+      h = &pool->harts[i];
+      instret = instret + h->instret;
+      if (!((h->halt==RV5_HALT_ECALL || h->halt==RV5_HALT_EBREAK) && h->reg[10]==0)) failed++;
+      printf("%u %s: %s at PC:0x%x a0:%x after %llu instructions\n", i, h->program, rv5_halt_name[h->halt], h->pc, h->reg[10],
+             (unsigned long long)h->instret);
+    }
+
+  fprintf(stderr, "%u harts, %u failed, %u threads, %llu instructions, %.3f seconds, %.2f MIPS\n", pool->hart_count, failed, pool->workers,
+          (unsigned long long)instret, seconds, seconds>0 ? instret/seconds/1e6 : 0.0);
+
+  for (i=0; i<pool->workers; i++) { free(pool->deque[i].task); pthread_mutex_destroy(&pool->deque[i].lock); }
+  free(pool->deque);
+  free(threads);
+  free(w);
+  return failed;
+}
+
+
+// ------------------------------------------------------------------------
+// Main
+// ------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+
+{
+  int halt, i, j;
+  int engine=RV5_ENGINE_REFERENCE;
+  const char *trace_file=NULL;
+  const char **programs;
+  int program_count=0;
+  uint32_t copies=0;
+  uint32_t workers=sysconf(_SC_NPROCESSORS_ONLN);
+  uint32_t load_address=0;
+  uint64_t memory_size;
+  clock_t start_time;
+  double seconds;
+  rv5_hart_t hart;
+  rv5_pool_t pool;
+
+  if (argc>2 && strcmp(argv[1],"-d")==0) return rv5_trace_print(argv[2]);
+
+  programs = calloc(argc, sizeof(char *));
+  if (programs==NULL) return 1;
+
+  for (i=1; i<argc; i++)
+    {
+      if      (strcmp(argv[i],"-b")==0) { rv5_interactive=0; }
+      else if (strcmp(argv[i],"-p")==0) { rv5_interactive=0; engine=RV5_ENGINE_PREDECODED; }
+      else if (strcmp(argv[i],"-x")==0) { rv5_interactive=0; engine=RV5_ENGINE_TRANSLATED; }
+      else if (strcmp(argv[i],"-m")==0 && i+1<argc) { memory_size = rv5_parse_size(argv[++i]);
+                                                      memory_size = (memory_size + 0xFFF) & ~(uint64_t)0xFFF;
+                                                      rv5_memory_size = (memory_size==0 || memory_size > 0xFFFFF000) ? 0xFFFFF000 : memory_size; }
+      else if (strcmp(argv[i],"-a")==0 && i+1<argc) { load_address = strtoul(argv[++i], NULL, 0); }
+      else if (strcmp(argv[i],"-n")==0 && i+1<argc) { rv5_budget = strtoull(argv[++i], NULL, 0); }
+      else if (strcmp(argv[i],"-t")==0 && i+1<argc) { trace_file = argv[++i]; if (rv5_trace_entries==0) rv5_trace_entries=65536; }
+      else if (strcmp(argv[i],"-T")==0 && i+1<argc) { rv5_trace_entries = strtoul(argv[++i], NULL, 0); }
+      else if (strcmp(argv[i],"-j")==0 && i+1<argc) { workers = strtoul(argv[++i], NULL, 0); }
+      else if (strcmp(argv[i],"-H")==0 && i+1<argc) { copies = strtoul(argv[++i], NULL, 0); }
+      else if (argv[i][0]!='-') { programs[program_count++] = argv[i]; }
+      else
+        {
+          fprintf(stderr, "Usage: riscv [-b|-p|-x] [-m size] [-a address] [-n count] [-t tracefile] [-T entries] [-j threads] [-H count] program...\n");
+          fprintf(stderr, "       riscv -d tracefile\n");
+          return 1;
+        }
+    }
+  if (trace_file==NULL) rv5_trace_entries = 0;
+  if (workers==0) workers = 1;
+
+
+  // Many harts across a pool of worker threads
+  //
+  if (program_count>1 || copies!=0)
+    {
+      if (copies==0) copies = 1;
+      memset(&pool, 0, sizeof(pool));
+      pool.hart_count   = program_count * copies;
+      pool.harts        = calloc(pool.hart_count, sizeof(rv5_hart_t));
+      pool.workers      = workers;
+      pool.load_address = load_address;
+      pool.engine       = engine;
+      pool.trace_file   = trace_file;
+      if (pool.harts==NULL || pool.hart_count==0) { fprintf(stderr, "No program to run\n"); return 1; }
+
+      for (i=0; i<program_count; i++)
+        for (j=0; j<(int)copies; j++) pool.harts[i*copies + j].program = programs[i];
+
+      rv5_interactive = 0;
+      return rv5_run_pool(&pool) ? 1 : 0;
+    }
+
+
+  // One hart
+  //
+  hart.program = programs[0];
+  if (rv5_hart_init(&hart)) return 1;
+  if (hart.program!=NULL && rv5_load_program(&hart, load_address)) return 1;
+  if (hart.program==NULL && !rv5_interactive) { fprintf(stderr, "No program to run\n"); return 1; }
+
+
+  // Single-step the reference interpreter, printing every instruction
+  //
+  if (rv5_interactive)
+    {
+      uint8_t *memory = hart.memory;
+      char key;
+
+      while (1)
+        {
+          uint32_t rv5_opcode;
+
+          halt = rv5_step_reference(&hart);
+          rv5_opcode = hart.instruction;
    
-  printf("rd:%d rs1:%d rs2:%d U_immediate:0x%x J_immediate:0x%x B_immediate:0x%x I_immediate:0x%x S_immediate:0x%x funct3:0x%x funct7:0x%x\n",rd,rs1,rs2,U_immediate,J_immediate_SE,B_immediate_SE,I_immediate_SE,S_immediate_SE,funct3,funct7);
-  printf("Regs: "); for (int i=0; i<32; i++) { printf("r%d:%x ",i,rv5_reg[i]); } printf("\n"); //scanf("%c",&temp);
-  printf("Memory: "); for (int i=0; i<7; i++) { printf("Addr%d:%x ",i,rv5_user_memory[i]); } printf("\n"); scanf("%c",&temp);
-    
+          printf("rd:%d rs1:%d rs2:%d U_immediate:0x%x J_immediate:0x%x B_immediate:0x%x I_immediate:0x%x S_immediate:0x%x funct3:0x%x funct7:0x%x\n",rd,rs1,rs2,U_immediate,J_immediate_SE,B_immediate_SE,I_immediate_SE,S_immediate_SE,funct3,funct7);
+          printf("Regs: "); for (int i=0; i<32; i++) { printf("r%d:%x ",i,hart.reg[i]); } printf("\n"); //scanf("%c",&key);
+          printf("Memory: "); for (int i=0; i<7; i++) { printf("Addr%d:%x ",i*4,RV5_MEM32(i*4)); } printf("\n");
+          if (halt!=RV5_RUNNING) return 0;
+          scanf("%c",&key);
+        }
+    }
+
+
+  // Batch run
+  //
+  start_time = clock();
+  halt = rv5_run(&hart, engine);
+  seconds = (double)(clock() - start_time) / CLOCKS_PER_SEC;
+
+  fprintf(stderr, "Halted: %s at PC:0x%x after %llu instructions, %.3f seconds, %.2f MIPS\n", rv5_halt_name[halt], hart.pc,
+          (unsigned long long)hart.instret, seconds, seconds>0 ? hart.instret/seconds/1e6 : 0.0);
+
+  if (trace_file!=NULL) rv5_trace_dump(&hart, trace_file);
+
+  switch (halt)
+    {
+      case RV5_HALT_ECALL:
+      case RV5_HALT_EBREAK: return hart.reg[10] & 0xFF;
+      case RV5_HALT_BUDGET: return 124;
+      default:              return 125;
     }
-  
-}
\ No newline at end of file
+}
@@ -0,0 +1,437 @@
+//
+//
+//  File Name   :  host_emsmove.cpp
+//  Used on     :  XTMax EMS move/exchange engine host test build
+//  Authors     :  Ted Fried, MicroCore Labs
+//                 Matthieu Bucchianeri
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//
+//  Runs the XTMax EMS move/exchange engine (emsmove.h) on Linux. The PSRAM and
+//  the PC's first megabyte are plain arrays:
+//
+//      00000-7FFFF  Motherboard RAM - the card does not answer here
+//      80000-9FFFF  XTMax RAM
+//      D0000-DFFFF  EMS window, four 16KB physical pages
+//
+//  A host side driver runs EMS function 57h requests the same way LTEMM does.
+//  It splits each region into chunks at 16KB logical pages and 64KB segments,
+//  and copies downwards when the source is below the destination. It maps
+//  the source at physical page 0 and the destination at physical page 1, hands
+//  each chunk to the card through MMAN_BASE+8/+9, and copies the chunk through
+//  the page frame itself when the card reports EMS_MOVE_ERROR. Every request is
+//  checked against a reference model, and the whole memory is compared at the end.
+//
+//  Before that, a few requests go straight to the engine with one side a
+//  conventional address in physical pages 2 and 3 of the window, and the other
+//  side the PSRAM mapped there. Overlapping moves must come out as with a
+//  temporary buffer, and exchanges, or moves over pages that are not contiguous
+//  in PSRAM, must be refused.
+//
+//  Build:   g++ -O2 -I../XTMax host_emsmove.cpp -o host_emsmove
+//
+//  Usage:   ./host_emsmove [-n requests] [-o] [-s seed]
+//
+//      -n   Number of random function 57h requests        (default 20000)
+//      -o   Card without the engine - MMAN_BASE+8 reads 0xFF, so every chunk
+//           is copied by the host
+//      -s   Random seed                                    (default 1)
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+// Revision 2 10/18/2026
+// Added the EMS window aliasing requests
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2024 Ted Fried
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EMS_PAGES             256                       // 4MB of EMS
+#define EMS_PAGE_SIZE         0x4000
+#define EMS_MOVE_PSRAM_SIZE   (EMS_PAGES*EMS_PAGE_SIZE)
+
+#define CONVENTIONAL_SIZE     0x100000
+#define XTMAX_RAM_START       0x80000
+#define XTMAX_RAM_END         0xA0000
+#define WINDOW_START          0xD0000
+#define WINDOW_END            0xE0000
+
+#define HANDLES               8
+
+
+// -------------------------------------------------
+// Hooks used by emsmove.h
+// -------------------------------------------------
+uint8_t * EMS_Move_Internal_RAM(uint32_t address);
+uint32_t  EMS_Move_Window(uint32_t address);
+void      PSRAM_Read_Burst(uint32_t address, uint8_t * buffer, uint32_t byte_count);
+void      PSRAM_Write_Burst(uint32_t address, const uint8_t * buffer, uint32_t byte_count);
+
+#include "emsmove.h"
+
+
+// The conventional megabyte followed by the PSRAM, so one index covers both
+uint8_t  memory[CONVENTIONAL_SIZE + EMS_MOVE_PSRAM_SIZE];
+uint8_t  expected[CONVENTIONAL_SIZE + EMS_MOVE_PSRAM_SIZE];
+uint8_t* psram = &memory[CONVENTIONAL_SIZE];
+
+uint16_t frame_pointer[4] = { 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF };
+int      old_card = 0;
+
+uint16_t handle_pages[HANDLES][16];                     // EMM logical page of each page in a handle
+uint32_t handle_page_count[HANDLES];
+
+uint64_t card_chunks=0;
+uint64_t card_bytes=0;
+uint64_t card_io_cycles=0;
+uint64_t host_chunks=0;
+uint64_t host_bytes=0;
+uint64_t host_bus_cycles=0;
+
+uint32_t rng_state=1;
+
+uint32_t rng() {
+    rng_state = rng_state*1103515245 + 12345;
+    return (rng_state >> 8);
+}
+
+
+// -------------------------------------------------
+// Card side
+// -------------------------------------------------
+uint8_t * EMS_Move_Internal_RAM(uint32_t address) {
+    if (address >= XTMAX_RAM_START && address < XTMAX_RAM_END)  return &memory[address];
+    return NULL;
+}
+
+uint32_t EMS_Move_Window(uint32_t address) {
+    if (address < WINDOW_START || address >= WINDOW_END)  return 0xFFFFFFFF;
+    return ((uint32_t)frame_pointer[(address - WINDOW_START) / EMS_PAGE_SIZE] << 14) | (address & (EMS_PAGE_SIZE-1));
+}
+
+void PSRAM_Read_Burst(uint32_t address, uint8_t * buffer, uint32_t byte_count) {
+    if ((address & (EMS_MOVE_CHUNK-1)) + byte_count > EMS_MOVE_CHUNK)  { printf("PSRAM read burst crosses a chunk at %06X\n", address); exit(1); }
+    memcpy(buffer, &psram[address], byte_count);
+}
+
+void PSRAM_Write_Burst(uint32_t address, const uint8_t * buffer, uint32_t byte_count) {
+    if ((address & (EMS_MOVE_CHUNK-1)) + byte_count > EMS_MOVE_CHUNK)  { printf("PSRAM write burst crosses a chunk at %06X\n", address); exit(1); }
+    memcpy(&psram[address], buffer, byte_count);
+}
+
+void port_write(uint32_t offset, uint8_t data) {
+    card_io_cycles++;
+    if (offset==8)  EMS_Move_Start(data);
+    if (offset==9)  EMS_Move_Param(data);
+}
+
+uint8_t port_read(uint32_t offset) {
+    card_io_cycles++;
+    if (offset==8 && !old_card)  return EMS_Move_Step();
+    return 0xFF;
+}
+
+
+// -------------------------------------------------
+// Host side - what the CPU sees through the page frame
+// -------------------------------------------------
+uint8_t* cpu_byte(uint32_t address) {
+    host_bus_cycles++;
+    if (address >= WINDOW_START && address < WINDOW_END)  return &psram[EMS_Move_Window(address)];
+    return &memory[address];
+}
+
+struct Side {
+    uint8_t  ems;
+    uint32_t handle;
+    uint32_t address;                                   // Linear address, or offset into the handle
+};
+
+// Index into memory[] of byte i of a side
+uint32_t side_index(const Side& side, uint32_t i) {
+    uint32_t a = side.address + i;
+    if (!side.ems)  return a;
+    return CONVENTIONAL_SIZE + ((uint32_t)handle_pages[side.handle][a / EMS_PAGE_SIZE] << 14) + (a % EMS_PAGE_SIZE);
+}
+
+// Bytes from a chunk position to the end of its page or segment, as LTEMM's maxlen
+uint32_t chunk_limit(const Side& side, uint32_t position, int down) {
+    uint16_t offset;
+    uint16_t limit;
+
+    if (side.ems)  return down ? (position % EMS_PAGE_SIZE) + 1 : EMS_PAGE_SIZE - (position % EMS_PAGE_SIZE);
+
+    offset = down ? ((position & 0xF) | 0xFFF0) : (position & 0xF);
+    limit  = down ? (uint16_t)(offset + 1) : (uint16_t)(0 - offset);
+    return (limit==0) ? 0xFFFF : limit;
+}
+
+// Address of the chunk's lowest byte as the card takes it
+uint32_t card_address(const Side& side, uint32_t position, uint32_t byte_count, int down) {
+    uint32_t address;
+
+    if (side.ems)  address = ((uint32_t)handle_pages[side.handle][position / EMS_PAGE_SIZE] << 14) | (position % EMS_PAGE_SIZE);
+    else           address = position;
+    return down ? address - (byte_count - 1) : address;
+}
+
+int card_move(const Side& source, uint32_t source_position, const Side& dest, uint32_t dest_position,
+              uint32_t byte_count, int exchange, int down) {
+    uint8_t  block[14];
+    uint32_t source_address = card_address(source, source_position, byte_count, down);
+    uint32_t dest_address   = card_address(dest, dest_position, byte_count, down);
+    uint8_t  status;
+
+    block[0]  = byte_count;        block[1]  = byte_count >> 8;      block[2]  = byte_count >> 16;      block[3]  = byte_count >> 24;
+    block[4]  = source.ems;
+    block[5]  = source_address;    block[6]  = source_address >> 8;  block[7]  = source_address >> 16;  block[8]  = source_address >> 24;
+    block[9]  = dest.ems;
+    block[10] = dest_address;      block[11] = dest_address >> 8;    block[12] = dest_address >> 16;    block[13] = dest_address >> 24;
+
+    port_write(8, 0);
+    for (int i=0 ; i<14 ; i++)  port_write(9, block[i]);
+    port_write(8, exchange ? 2 : 1);
+    do { status = port_read(8); } while (status==EMS_MOVE_BUSY);
+    return status==EMS_MOVE_IDLE;
+}
+
+// One function 57h request, chunked the way LTEMM does it
+void function_57(const Side& source, const Side& dest, uint32_t length, int exchange) {
+    int      down = 0;
+    uint32_t s = source.address;
+    uint32_t d = dest.address;
+
+    if (!exchange && source.ems==dest.ems && (!source.ems || source.handle==dest.handle) && s < d)  down = 1;
+    if (down)  { s = s + length - 1;  d = d + length - 1; }
+
+    while (length != 0) {
+        uint32_t byte_count = length;
+        if (chunk_limit(source, s, down) < byte_count)  byte_count = chunk_limit(source, s, down);
+        if (chunk_limit(dest, d, down) < byte_count)    byte_count = chunk_limit(dest, d, down);
+
+        if (source.ems)  frame_pointer[0] = handle_pages[source.handle][s / EMS_PAGE_SIZE];
+        if (dest.ems)    frame_pointer[1] = handle_pages[dest.handle][d / EMS_PAGE_SIZE];
+
+        if (card_move(source, s, dest, d, byte_count, exchange, down)) {
+            card_chunks++;
+            card_bytes += byte_count;
+        }
+        else {
+            uint32_t cpu_s = source.ems ? WINDOW_START + (s % EMS_PAGE_SIZE)                 : s;
+            uint32_t cpu_d = dest.ems   ? WINDOW_START + EMS_PAGE_SIZE + (d % EMS_PAGE_SIZE) : d;
+
+            for (uint32_t i=0 ; i<byte_count ; i++) {
+                uint32_t step = down ? 0 - i : i;
+                uint8_t  data = *cpu_byte(cpu_s + step);
+                if (exchange) { uint8_t* other = cpu_byte(cpu_d + step);  *cpu_byte(cpu_s + step) = *other; *other = data; host_bus_cycles++; }
+                else            *cpu_byte(cpu_d + step) = data;
+            }
+            host_chunks++;
+            host_bytes += byte_count;
+        }
+
+        s = down ? s - byte_count : s + byte_count;
+        d = down ? d - byte_count : d + byte_count;
+        length -= byte_count;
+    }
+}
+
+void reference_57(const Side& source, const Side& dest, uint32_t length, int exchange) {
+    static uint8_t source_data[0x100000];
+    static uint8_t dest_data[0x100000];
+
+    for (uint32_t i=0 ; i<length ; i++)  { source_data[i] = expected[side_index(source, i)];  dest_data[i] = expected[side_index(dest, i)]; }
+    for (uint32_t i=0 ; i<length ; i++)  expected[side_index(dest, i)] = source_data[i];
+    if (exchange)
+        for (uint32_t i=0 ; i<length ; i++)  expected[side_index(source, i)] = dest_data[i];
+}
+
+
+// -------------------------------------------------
+// EMS window aliasing - straight to the engine
+// -------------------------------------------------
+uint32_t engine_index(uint8_t type, uint32_t address) {
+    if (type)  return CONVENTIONAL_SIZE + address;
+    if (address >= WINDOW_START && address < WINDOW_END)  return CONVENTIONAL_SIZE + EMS_Move_Window(address);
+    return address;
+}
+
+// Returns 1 when the result is right: refused when refuse is set, otherwise moved as through a temporary buffer
+int alias_request(uint8_t src_type, uint32_t src, uint8_t dst_type, uint32_t dst, uint32_t length, int exchange, int refuse) {
+    static uint8_t data[0x10000];
+    static uint8_t other[0x10000];
+    uint8_t  block[14] = { (uint8_t)length, (uint8_t)(length>>8), 0, 0,
+                           src_type, (uint8_t)src, (uint8_t)(src>>8), (uint8_t)(src>>16), 0,
+                           dst_type, (uint8_t)dst, (uint8_t)(dst>>8), (uint8_t)(dst>>16), 0 };
+    uint8_t  status;
+
+    memcpy(expected, memory, sizeof(memory));
+    for (uint32_t i=0 ; i<length ; i++)  { data[i] = expected[engine_index(src_type, src+i)];  other[i] = expected[engine_index(dst_type, dst+i)]; }
+    for (uint32_t i=0 ; i<length ; i++)  expected[engine_index(dst_type, dst+i)] = data[i];
+    if (exchange)
+        for (uint32_t i=0 ; i<length ; i++)  expected[engine_index(src_type, src+i)] = other[i];
+
+    port_write(8, 0);
+    for (int i=0 ; i<14 ; i++)  port_write(9, block[i]);
+    port_write(8, exchange ? 2 : 1);
+    do { status = port_read(8); } while (status==EMS_MOVE_BUSY);
+
+    if (refuse)  { memcpy(expected, memory, sizeof(memory));  return status==EMS_MOVE_ERROR; }
+    if (status!=EMS_MOVE_IDLE)  { memcpy(expected, memory, sizeof(memory));  return 0; }
+    if (memcmp(memory, expected, sizeof(memory))!=0)  { memcpy(memory, expected, sizeof(memory));  return 0; }
+    return 1;
+}
+
+int alias_tests() {
+    const uint32_t page = 10;                           // PSRAM page of physical page 2, then 11 or 40 at physical page 3
+    const uint32_t frame2 = WINDOW_START + 2*EMS_PAGE_SIZE;
+    int errors=0;
+
+    frame_pointer[2] = page;
+    frame_pointer[3] = page + 1;
+    if (!alias_request(0, frame2+0x100, 1, (page<<14)+0x180, 0x1000, 0, 0))  { printf("Window to PSRAM move, destination above, is wrong\n"); errors++; }
+    if (!alias_request(1, (page<<14)+0x180, 0, frame2+0x100, 0x1000, 0, 0))  { printf("PSRAM to window move, destination below, is wrong\n"); errors++; }
+    if (!alias_request(0, frame2+0x100, 1, (page<<14)+0x100, 0x1000, 0, 0))  { printf("Window to the same PSRAM move is wrong\n"); errors++; }
+    if (!alias_request(0, frame2+0x100, 1, (page<<14)+0x180, 0x1000, 1, 1))  { printf("Overlapping window and PSRAM exchange was not refused\n"); errors++; }
+    if (!alias_request(0, frame2+0x3F00, 1, (page<<14)+0x3F80, 0x400, 0, 0)) { printf("Move over two contiguous window pages is wrong\n"); errors++; }
+    if (!alias_request(0, frame2+0x100, 1, (page<<14)+0x8000, 0x1000, 1, 0)) { printf("Exchange between the window and other PSRAM is wrong\n"); errors++; }
+
+    frame_pointer[3] = 40;
+    if (!alias_request(0, frame2+0x3F00, 1, (page<<14)+0x3F80, 0x400, 0, 1)) { printf("Move over two scattered window pages was not refused\n"); errors++; }
+    if (!alias_request(0, frame2+0x3F00, 1, (page<<14)+0x8000, 0x400, 0, 0)) { printf("Move from two scattered window pages is wrong\n"); errors++; }
+    if (!alias_request(0, frame2+0x3F00, 1, (40<<14)-0x100, 0x400, 0, 1))    { printf("Move onto the second scattered window page was not refused\n"); errors++; }
+
+    frame_pointer[2] = 0xFFFF;
+    frame_pointer[3] = 0xFFFF;
+    return errors;
+}
+
+
+// -------------------------------------------------
+// Random requests
+// -------------------------------------------------
+uint32_t random_side(Side& side) {
+    uint32_t region = rng() % 10;
+
+    side.ems = (rng() % 2);
+    if (side.ems) {
+        side.handle  = rng() % HANDLES;
+        side.address = rng() % (handle_page_count[side.handle] * EMS_PAGE_SIZE);
+        return handle_page_count[side.handle] * EMS_PAGE_SIZE - side.address;
+    }
+    if      (region < 5)  side.address = XTMAX_RAM_START + rng() % (XTMAX_RAM_END - XTMAX_RAM_START);
+    else if (region < 8)  side.address = rng() % XTMAX_RAM_START;                                       // Motherboard RAM
+    else                  side.address = XTMAX_RAM_START - 0x8000 + rng() % 0x10000;                    // Across the boundary
+    return XTMAX_RAM_END - side.address;
+}
+
+int overlap(const Side& a, const Side& b, uint32_t length) {
+    if (a.ems != b.ems || (a.ems && a.handle != b.handle))  return 0;
+    return a.address < b.address + length && b.address < a.address + length;
+}
+
+int main(int argc, char** argv) {
+    uint32_t requests=20000;
+    uint32_t pool[EMS_PAGES];
+    uint32_t next_page=0;
+    int errors=0;
+
+    for (int i=1 ; i<argc ; i++) {
+             if (strcmp(argv[i],"-n")==0 && i+1<argc)  requests  = strtoul(argv[++i], 0, 0);
+        else if (strcmp(argv[i],"-s")==0 && i+1<argc)  rng_state = strtoul(argv[++i], 0, 0);
+        else if (strcmp(argv[i],"-o")==0)              old_card  = 1;
+        else { fprintf(stderr, "Usage: %s [-n requests] [-o] [-s seed]\n", argv[0]); return 1; }
+    }
+
+    for (uint32_t i=0 ; i<sizeof(memory) ; i++)  memory[i] = rng();
+    memcpy(expected, memory, sizeof(memory));
+    if (!old_card)  errors += alias_tests();
+
+    // Handles own scattered EMM pages, so a region is never contiguous in PSRAM
+    for (uint32_t i=0 ; i<EMS_PAGES ; i++)  pool[i] = i;
+    for (uint32_t i=EMS_PAGES-1 ; i>0 ; i--)  { uint32_t j = rng() % (i+1);  uint32_t t = pool[i];  pool[i] = pool[j];  pool[j] = t; }
+    for (int h=0 ; h<HANDLES ; h++) {
+        handle_page_count[h] = 1 + rng() % 16;
+        for (uint32_t p=0 ; p<handle_page_count[h] ; p++)  handle_pages[h][p] = pool[next_page++];
+    }
+
+    for (uint32_t request=0 ; request<requests && errors<10 ; request++) {
+        Side     source, dest;
+        uint32_t length = random_side(source);
+        uint32_t room   = random_side(dest);
+        int      exchange = (rng() % 10) < 3;
+
+        if (room < length)  length = room;
+        switch (rng() % 4) {
+            case 0:  length = length % 64;                       break;
+            case 1:  length = length % (3*EMS_PAGE_SIZE);        break;
+            default: length = length % (5*EMS_PAGE_SIZE);        break;
+        }
+
+        // Some moves within one handle, close enough to overlap
+        if (!exchange && (rng() % 8)==0) {
+            dest = source;
+            dest.address = source.address + (rng() % 2 ? rng() % 100 : 0 - rng() % 100);
+            if (dest.address > source.address + 100 || (dest.ems ? dest.address >= handle_page_count[dest.handle]*EMS_PAGE_SIZE : dest.address >= XTMAX_RAM_END))  continue;
+            room = dest.ems ? handle_page_count[dest.handle]*EMS_PAGE_SIZE - dest.address : XTMAX_RAM_END - dest.address;
+            if (room < length)  length = room;
+            room = source.ems ? handle_page_count[source.handle]*EMS_PAGE_SIZE - source.address : XTMAX_RAM_END - source.address;
+            if (room < length)  length = room;
+        }
+        if (exchange && overlap(source, dest, length))  continue;       // LTEMM returns 97h before copying anything
+
+        function_57(source, dest, length, exchange);
+        reference_57(source, dest, length, exchange);
+
+        for (uint32_t i=0 ; i<length ; i++) {
+            if (memory[side_index(source, i)] != expected[side_index(source, i)] || memory[side_index(dest, i)] != expected[side_index(dest, i)]) {
+                printf("Request %u (%s of %u bytes, %s %X to %s %X) differs at byte %u\n", request, exchange ? "exchange" : "move", length,
+                       source.ems ? "EMS" : "conventional", source.address, dest.ems ? "EMS" : "conventional", dest.address, i);
+                memcpy(memory, expected, sizeof(memory));
+                errors++;
+                break;
+            }
+        }
+    }
+    if (memcmp(memory, expected, sizeof(memory))!=0)  { printf("Memory differs from the reference at the end\n"); errors++; }
+
+    printf("XTMax EMS move engine host test%s\n", old_card ? " - card without the engine" : "");
+    printf("  requests                : %u\n",   requests);
+    printf("  chunks moved by card    : %llu  (%llu bytes, %llu IO cycles)\n", (unsigned long long)card_chunks, (unsigned long long)card_bytes, (unsigned long long)card_io_cycles);
+    printf("  chunks copied by host   : %llu  (%llu bytes, %llu memory cycles)\n", (unsigned long long)host_chunks, (unsigned long long)host_bytes, (unsigned long long)host_bus_cycles);
+    printf("  result                  : %s\n",   errors ? "FAIL" : "PASS");
+    return errors ? 1 : 0;
+}
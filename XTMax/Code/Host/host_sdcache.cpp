@@ -0,0 +1,531 @@
+//
+//
+//  File Name   :  host_sdcache.cpp
+//  Used on     :  XTMax SD card cache host test build
+//  Authors     :  Ted Fried, MicroCore Labs
+//                 Matthieu Bucchianeri
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//
+//  Runs the XTMax SD card sector cache (sdcache.h) on Linux. The SD card is
+//  simulated in SPI mode on top of a disk image file and the cache storage is a
+//  plain array in place of the PSRAM. A host side driver issues the same
+//  command sequences as the Boot ROM INT 13h handler and checks every sector
+//  against a copy of the image kept in memory.
+//
+//  At the end the host is "reset" - it sends CMD0 and retries ACMD41 until the
+//  card reports ready, which must flush every dirty sector - and the image file
+//  is compared with the expected contents.
+//
+//  Then the card is "swapped" - the image gets new contents behind the cache's
+//  back - and the host is reset again. Every sector must read back with the new
+//  contents, nothing may come from the cache of the old card.
+//
+//  The card's CSD reports the image size rounded up to the capacity units of the
+//  CSD version. Before the reset the host writes past that capacity, which must be
+//  rejected, and between the end of the image and the capacity, which the card
+//  rejects on write-back and the cache must drop so the reset can finish.
+//
+//  Build:   g++ -O2 -I../XTMax host_sdcache.cpp -o host_sdcache
+//
+//  Usage:   ./host_sdcache disk.img [-b] [-c sectors] [-n operations] [-m] [-s seed]
+//
+//      -b   Simulate a standard capacity card - CCS=0 in the OCR and byte
+//           addresses in read/write commands
+//      -c   Create disk.img with this many sectors of a test pattern first
+//      -n   Number of random INT 13h style requests      (default 20000)
+//      -m   Use CMD18/CMD25 for multi-sector requests instead of one
+//           CMD17/CMD24 per sector
+//      -s   Random seed                                   (default 1)
+//
+//  Requests are a mix of sequential runs, random reads and random writes of 1
+//  to 16 sectors, with idle periods in between where the cache may write back.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+// Revision 2 10/18/2026
+// Added the standard capacity card mode
+//
+// Revision 3 10/18/2026
+// Added the CSD, writes past the card capacity and rejected write-backs
+//
+// Revision 4 10/18/2026
+// Added the card swap
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2024 Ted Fried
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// -------------------------------------------------
+// Hooks used by sdcache.h
+// -------------------------------------------------
+uint8_t SD_Card_Transfer(uint8_t data_out);
+void    SD_Card_Select(uint8_t cs_n);
+void    SD_Cache_Storage_Read(uint32_t offset, uint8_t * buffer, uint32_t byte_count);
+void    SD_Cache_Storage_Write(uint32_t offset, const uint8_t * buffer, uint32_t byte_count);
+
+#include "sdcache.h"
+
+
+FILE*    disk_file;
+uint32_t disk_sectors=0;
+uint8_t* disk_expected;                             // What the image must contain once everything is written back
+uint8_t  cache_storage[SD_CACHE_SECTORS*SD_SECTOR_SIZE];
+
+uint64_t card_bytes=0;                              // SPI bytes clocked on the card
+uint64_t card_commands=0;
+uint64_t card_sectors_read=0;
+uint64_t card_sectors_written=0;
+uint64_t host_bytes=0;                              // SPI bytes the host transferred
+uint64_t host_sectors_read=0;
+uint64_t host_sectors_written=0;
+
+uint32_t rng_state=1;
+
+uint32_t rng() {
+    rng_state = rng_state*1103515245 + 12345;
+    return (rng_state >> 8);
+}
+
+
+// -------------------------------------------------
+// Simulated SD card in SPI mode
+// -------------------------------------------------
+enum ModelState { ModelCommand, ModelReadToken, ModelReadData, ModelWriteToken, ModelWriteData, ModelBusy };
+
+uint8_t    card_cs_n=1;
+ModelState card_state=ModelCommand;
+uint8_t    card_frame[6];
+uint32_t   card_frame_index=0;
+uint8_t    card_response[24];
+uint32_t   card_response_count=0;
+uint32_t   card_response_index=0;
+uint8_t    card_app=0;
+uint8_t    card_initialized=0;
+uint8_t    card_byte_addressed=0;                   // -b
+uint8_t    card_multi=0;
+uint32_t   card_lba=0;
+uint32_t   card_index=0;
+uint32_t   card_delay=0;
+uint32_t   card_capacity=0;                         // Sectors reported in the CSD, the image size rounded up
+uint8_t    card_csd[16];
+uint8_t    card_sector[SD_SECTOR_SIZE];
+
+void card_respond(uint32_t byte_count, const uint8_t* bytes) {
+    memcpy(card_response, bytes, byte_count);
+    card_response_count = byte_count;
+    card_response_index = 0;
+}
+
+void card_respond_byte(uint8_t data) {
+    card_respond(1, &data);
+}
+
+// Version 2.0 CSD for a high capacity card, version 1.0 for a standard capacity card
+//
+void card_build_csd() {
+    memset(card_csd, 0, sizeof(card_csd));
+    if (!card_byte_addressed) {
+        uint32_t c_size = (disk_sectors + 1023) / 1024 - 1;
+        card_csd[0] = 0x40;
+        card_csd[7] = (c_size >> 16) & 0x3F;
+        card_csd[8] = c_size >> 8;
+        card_csd[9] = c_size;
+        card_capacity = (c_size + 1) * 1024;
+    }
+    else {
+        uint32_t c_size_mult = 0;
+        while (((disk_sectors - 1) >> (c_size_mult + 2)) >= 4096)  c_size_mult++;
+        uint32_t c_size = ((disk_sectors - 1) >> (c_size_mult + 2));
+        card_csd[5]  = 0x09;                                            // READ_BL_LEN 512
+        card_csd[6]  = (c_size >> 10) & 0x03;
+        card_csd[7]  = c_size >> 2;
+        card_csd[8]  = (c_size & 0x03) << 6;
+        card_csd[9]  = c_size_mult >> 1;
+        card_csd[10] = (c_size_mult & 1) << 7;
+        card_capacity = (c_size + 1) << (c_size_mult + 2);
+    }
+}
+
+void card_read_sector() {
+    fseek(disk_file, (long)card_lba*SD_SECTOR_SIZE, SEEK_SET);
+    if (fread(card_sector, 1, SD_SECTOR_SIZE, disk_file) != SD_SECTOR_SIZE)  memset(card_sector, 0, SD_SECTOR_SIZE);
+    card_sectors_read++;
+}
+
+void card_write_sector() {
+    fseek(disk_file, (long)card_lba*SD_SECTOR_SIZE, SEEK_SET);
+    fwrite(card_sector, 1, SD_SECTOR_SIZE, disk_file);
+    card_sectors_written++;
+}
+
+void card_command() {
+    uint8_t  command = card_frame[0] & 0x3F;
+    uint32_t arg = ((uint32_t)card_frame[1]<<24) | ((uint32_t)card_frame[2]<<16) | (card_frame[3]<<8) | card_frame[4];
+    uint8_t  app = card_app;
+    uint8_t  r1  = card_initialized ? 0x00 : 0x01;
+
+    card_commands++;
+    card_app = 0;
+
+    if (command==0)        { card_initialized=0; card_respond_byte(0x01); return; }
+    if (command==8)        { uint8_t r[5]={0x01,0x00,0x00,(uint8_t)((arg>>8)&0xF),(uint8_t)arg}; card_respond(5, r); return; }
+    if (command==55)       { card_app=1; card_respond(1, &r1); return; }
+    if (app && command==41){ card_initialized=1; card_respond_byte(0x00); return; }
+    if (command==58)       { uint8_t r[5]={r1,(uint8_t)(card_byte_addressed ? 0x80 : 0xC0),0xFF,0x80,0x00}; card_respond(5, r); return; }
+    if (command==9)        { uint8_t r[20]={r1,0xFE}; memcpy(&r[2], card_csd, 16); card_respond(20, r); return; }   // CRC bytes not sent, the cache ignores them
+    if (command==12)       { uint8_t r[3]={0xFF,0x00,0x00}; card_respond(3, r); card_state=ModelBusy; card_delay=rng()%8; return; }
+
+    if (command==17 || command==18 || command==24 || command==25) {
+        if (!card_initialized)   { card_respond_byte(0x05); return; }       // Illegal command, idle
+        if (card_byte_addressed) {
+            if (arg % SD_SECTOR_SIZE) { card_respond_byte(0x20); return; }  // Address error
+            arg = arg / SD_SECTOR_SIZE;
+        }
+        if (arg >= disk_sectors) { card_respond_byte(0x40); return; }       // Parameter error
+        card_lba   = arg;
+        card_multi = (command==18 || command==25);
+        card_respond_byte(0x00);
+        if (command==17 || command==18) { card_state=ModelReadToken; card_delay=rng()%64; }
+        else                            { card_state=ModelWriteToken; }
+        return;
+    }
+
+    card_respond_byte((uint8_t)(r1|0x04));                              // Illegal command
+}
+
+uint8_t SD_Card_Transfer(uint8_t data_out) {
+    card_bytes++;
+    if (card_cs_n)  return 0xFF;
+
+    // CMD12 interrupts a multi-block read at any point
+    if ((data_out&0xC0)==0x40 && card_frame_index==0 && card_state!=ModelWriteData && card_state!=ModelWriteToken) {
+        card_frame[card_frame_index++] = data_out;
+        card_state = ModelCommand;
+        card_response_count = 0;
+        return 0xFF;
+    }
+    if (card_frame_index!=0) {
+        card_frame[card_frame_index++] = data_out;
+        if (card_frame_index==6)  { card_frame_index=0; card_command(); }
+        return 0xFF;
+    }
+    if (card_response_index < card_response_count)  return card_response[card_response_index++];
+
+    switch (card_state) {
+        case ModelCommand:
+            return 0xFF;
+
+        case ModelReadToken:
+            if (card_delay!=0) { card_delay--; return 0xFF; }
+            if (card_lba >= disk_sectors) { card_state=ModelCommand; return 0x08; }      // Out of range error token
+            card_read_sector();
+            card_index = 0;
+            card_state = ModelReadData;
+            return 0xFE;
+
+        case ModelReadData: {
+            uint8_t data_in = (card_index < SD_SECTOR_SIZE) ? card_sector[card_index] : 0x55;   // Two CRC bytes follow the data
+            if (++card_index == SD_SECTOR_SIZE+2) {
+                if (card_multi) { card_lba++; card_state=ModelReadToken; card_delay=rng()%16; }
+                else            { card_state=ModelCommand; }
+            }
+            return data_in;
+        }
+
+        case ModelWriteToken:
+            if (data_out==0xFE || data_out==0xFC) { card_index=0; card_state=ModelWriteData; }
+            if (data_out==0xFD)                   { card_state=ModelBusy; card_delay=rng()%32; }
+            return 0xFF;
+
+        case ModelWriteData:
+            if (card_index < SD_SECTOR_SIZE)  card_sector[card_index] = data_out;
+            if (++card_index == SD_SECTOR_SIZE+2) {
+                if (card_lba >= disk_sectors) { card_respond_byte(0x0D); card_state=ModelCommand; card_multi=0; return 0xFF; }   // Write error
+                card_write_sector();
+                card_respond_byte(0x05);
+                card_delay = 1 + rng()%200;
+                card_state = ModelBusy;
+            }
+            return 0xFF;
+
+        case ModelBusy:
+            if (card_delay!=0) { card_delay--; return 0x00; }
+            if (card_multi && card_frame[0]==(0x40|25)) { card_lba++; card_state=ModelWriteToken; }
+            else                                        { card_state=ModelCommand; }
+            return 0xFF;
+    }
+    return 0xFF;
+}
+
+void SD_Card_Select(uint8_t cs_n) {
+    if (cs_n && !card_cs_n) { card_frame_index=0; card_response_count=0; if (card_state!=ModelBusy) card_state=ModelCommand; }
+    card_cs_n = cs_n;
+}
+
+void SD_Cache_Storage_Read(uint32_t offset, uint8_t * buffer, uint32_t byte_count) {
+    memcpy(buffer, &cache_storage[offset], byte_count);
+}
+
+void SD_Cache_Storage_Write(uint32_t offset, const uint8_t * buffer, uint32_t byte_count) {
+    memcpy(&cache_storage[offset], buffer, byte_count);
+}
+
+
+// -------------------------------------------------
+// Host side - the Boot ROM command sequences
+// -------------------------------------------------
+uint8_t host_block_addressed=1;                     // CCS bit of the OCR the host read
+
+uint8_t host_transfer(uint8_t data_out) {
+    host_bytes++;
+    return SD_Cache_Host_Transfer(data_out);
+}
+
+int host_command(uint8_t command, uint32_t arg, uint8_t* response, int response_bytes) {
+    uint8_t data_in=0xFF;
+
+    host_transfer(0xFF);
+    host_transfer(0x40|command);
+    host_transfer(arg>>24);
+    host_transfer(arg>>16);
+    host_transfer(arg>>8);
+    host_transfer(arg);
+    host_transfer(command==0 ? 0x95 : command==8 ? 0x87 : 0x01);
+    for (int i=0 ; i<8 && data_in==0xFF ; i++)  data_in = host_transfer(0xFF);
+    if (response)  { response[0]=data_in; for (int i=1 ; i<response_bytes ; i++) response[i]=host_transfer(0xFF); }
+    return data_in;
+}
+
+int host_init() {
+    uint8_t r[5];
+    SD_Cache_Host_Select(1);
+    for (int i=0 ; i<10 ; i++)  host_transfer(0xFF);
+    SD_Cache_Host_Select(0);
+    if (host_command(0, 0, r, 1) != 0x01)  return 0;
+    if (host_command(8, 0x1AA, r, 5) != 0x01 || r[4]!=0xAA)  return 0;
+    for (int tries=0 ; tries<1000000 ; tries++) {
+        host_command(55, 0, r, 1);
+        if (host_command(41, 0x40000000, r, 1) == 0x00)  break;
+    }
+    if (r[0]!=0x00 || host_command(58, 0, r, 5) != 0x00)  return 0;
+    host_block_addressed = (r[1] & 0x40) != 0;
+    return 1;
+}
+
+int host_wait_token() {
+    for (int polls=0 ; polls<10000000 ; polls++) {
+        uint8_t data_in = host_transfer(0xFF);
+        if (data_in==0xFE)  return 1;
+        if (data_in!=0xFF)  return 0;
+    }
+    return 0;
+}
+
+int host_wait_write() {
+    uint8_t data_in=0xFF;
+    for (int polls=0 ; polls<10000000 && data_in==0xFF ; polls++)  data_in = host_transfer(0xFF);
+    if ((data_in&0x1F)!=0x05)  return 0;
+    for (int polls=0 ; polls<10000000 ; polls++)  if (host_transfer(0xFF)!=0x00)  return 1;
+    return 0;
+}
+
+int host_read(uint32_t lba, uint32_t count, uint8_t* buffer, int multi) {
+    SD_Cache_Host_Select(0);
+    for (uint32_t s=0 ; s<count ; s++) {
+        if (!multi || s==0) { if (host_command(multi ? 18 : 17, host_block_addressed ? lba+s : (lba+s)*SD_SECTOR_SIZE, 0, 0) != 0x00)  return 0; }
+        if (!host_wait_token())  return 0;
+        for (int i=0 ; i<SD_SECTOR_SIZE ; i++)  buffer[s*SD_SECTOR_SIZE+i] = host_transfer(0xFF);
+        host_transfer(0xFF); host_transfer(0xFF);
+        host_sectors_read++;
+    }
+    if (multi)  host_command(12, 0, 0, 0);
+    SD_Cache_Host_Select(1);
+    return 1;
+}
+
+int host_write(uint32_t lba, uint32_t count, const uint8_t* buffer, int multi) {
+    SD_Cache_Host_Select(0);
+    for (uint32_t s=0 ; s<count ; s++) {
+        if (!multi || s==0) { if (host_command(multi ? 25 : 24, host_block_addressed ? lba+s : (lba+s)*SD_SECTOR_SIZE, 0, 0) != 0x00)  return 0; }
+        host_transfer(multi ? 0xFC : 0xFE);
+        for (int i=0 ; i<SD_SECTOR_SIZE ; i++)  host_transfer(buffer[s*SD_SECTOR_SIZE+i]);
+        if (!host_wait_write())  return 0;
+        host_sectors_written++;
+    }
+    if (multi) { host_transfer(0xFD); host_transfer(0xFF); for (int polls=0 ; polls<10000000 ; polls++) if (host_transfer(0xFF)!=0x00) break; }
+    SD_Cache_Host_Select(1);
+    return 1;
+}
+
+
+// -------------------------------------------------
+// Main
+// -------------------------------------------------
+int main(int argc, char** argv) {
+    const char* disk_name=0;
+    uint32_t create_sectors=0;
+    uint32_t operations=20000;
+    int multi=0;
+    int errors=0;
+
+    for (int i=1 ; i<argc ; i++) {
+             if (strcmp(argv[i],"-c")==0 && i+1<argc)  create_sectors = strtoul(argv[++i], 0, 0);
+        else if (strcmp(argv[i],"-n")==0 && i+1<argc)  operations     = strtoul(argv[++i], 0, 0);
+        else if (strcmp(argv[i],"-s")==0 && i+1<argc)  rng_state      = strtoul(argv[++i], 0, 0);
+        else if (strcmp(argv[i],"-m")==0)              multi          = 1;
+        else if (strcmp(argv[i],"-b")==0)              card_byte_addressed = 1;
+        else if (argv[i][0]!='-')                      disk_name      = argv[i];
+        else { fprintf(stderr, "Unknown option %s\n", argv[i]); return 1; }
+    }
+    if (disk_name==0) {
+        fprintf(stderr, "Usage: %s disk.img [-b] [-c sectors] [-n operations] [-m] [-s seed]\n", argv[0]);
+        return 1;
+    }
+
+    if (create_sectors!=0) {
+        FILE* f = fopen(disk_name, "wb");
+        if (f==0) { perror(disk_name); return 1; }
+        for (uint32_t s=0 ; s<create_sectors ; s++)
+            for (int i=0 ; i<SD_SECTOR_SIZE ; i+=4) { uint32_t v=s*0x9E3779B1u+i; fwrite(&v, 1, 4, f); }
+        fclose(f);
+    }
+
+    disk_file = fopen(disk_name, "r+b");
+    if (disk_file==0) { perror(disk_name); return 1; }
+    fseek(disk_file, 0, SEEK_END);
+    disk_sectors = ftell(disk_file) / SD_SECTOR_SIZE;
+    if (disk_sectors < 64) { fprintf(stderr, "%s is too small\n", disk_name); return 1; }
+    disk_expected = (uint8_t*)malloc((size_t)disk_sectors*SD_SECTOR_SIZE);
+    fseek(disk_file, 0, SEEK_SET);
+    if (fread(disk_expected, 1, (size_t)disk_sectors*SD_SECTOR_SIZE, disk_file) != (size_t)disk_sectors*SD_SECTOR_SIZE) { perror(disk_name); return 1; }
+
+    card_build_csd();
+    SD_Cache_Init();
+    if (!host_init()) { printf("Card initialization failed\n"); return 1; }
+
+    uint8_t  buffer[16*SD_SECTOR_SIZE];
+    uint32_t sequential_lba = rng() % disk_sectors;
+
+    for (uint32_t op=0 ; op<operations && errors<10 ; op++) {
+        uint32_t kind  = rng() % 10;
+        uint32_t count = 1 + rng() % 16;
+        uint32_t lba;
+
+        if (kind < 5) { lba = sequential_lba; sequential_lba += count; }            // Sequential scan
+        else            lba = rng() % disk_sectors;
+        if (lba + count > disk_sectors) { lba = disk_sectors - count; sequential_lba = rng() % disk_sectors; }
+
+        if (kind < 8) {
+            if (!host_read(lba, count, buffer, multi)) { printf("Read of %u sectors at %u failed\n", count, lba); errors++; continue; }
+            if (memcmp(buffer, &disk_expected[(size_t)lba*SD_SECTOR_SIZE], count*SD_SECTOR_SIZE)!=0) {
+                printf("Read of %u sectors at %u returned the wrong data\n", count, lba);
+                errors++;
+            }
+        }
+        else {
+            for (uint32_t i=0 ; i<count*SD_SECTOR_SIZE ; i++)  buffer[i] = rng();
+            memcpy(&disk_expected[(size_t)lba*SD_SECTOR_SIZE], buffer, count*SD_SECTOR_SIZE);
+            if (!host_write(lba, count, buffer, multi)) { printf("Write of %u sectors at %u failed\n", count, lba); errors++; }
+        }
+
+        // Sometimes the host stays away long enough for the background write-back to run
+        if (rng()%4==0) {
+            uint32_t idle = rng()%20000;
+            for (uint32_t i=0 ; i<idle && SD_Cache_Background_Pending() ; i++)  SD_Cache_Background();
+        }
+    }
+
+    // Past the capacity in the CSD nothing may reach the cache
+    uint32_t dirty_before = sd_cache_dirty_count;
+    memset(buffer, 0xA5, sizeof(buffer));
+    if (host_write(card_capacity, 1, buffer, 0))     { printf("Write past the card capacity was accepted\n"); errors++; }
+    SD_Cache_Host_Select(1);
+    if (host_read(card_capacity + 100, 1, buffer, 0)) { printf("Read past the card capacity was accepted\n"); errors++; }
+    SD_Cache_Host_Select(1);
+    if (host_write(card_capacity - 1, 2, buffer, 1)) { printf("Multiple block write past the card capacity was accepted\n"); errors++; }
+    SD_Cache_Host_Select(1);
+    if (card_capacity - 1 < disk_sectors)  memcpy(&disk_expected[(size_t)(card_capacity-1)*SD_SECTOR_SIZE], buffer, SD_SECTOR_SIZE);
+    if (sd_cache_dirty_count > dirty_before + 1) { printf("Sectors past the card capacity were cached\n"); errors++; }
+
+    // Inside the capacity but past the image the card rejects the write-back
+    if (card_capacity > disk_sectors && !host_write(disk_sectors, 1, buffer, 0)) { printf("Write past the end of the image failed\n"); errors++; }
+
+    uint32_t dirty_before_reset = sd_cache_dirty_count;
+    if (!host_init()) { printf("Card initialization after reset failed\n"); errors++; }
+    if (sd_cache_dirty_count != 0)                                  { printf("%u sectors still dirty after reset\n", sd_cache_dirty_count); errors++; }
+    if ((card_capacity > disk_sectors) != (sd_cache_write_errors != 0)) { printf("%u write-backs rejected\n", sd_cache_write_errors); errors++; }
+
+    uint8_t* disk_now = (uint8_t*)malloc((size_t)disk_sectors*SD_SECTOR_SIZE);
+    fflush(disk_file);
+    fseek(disk_file, 0, SEEK_SET);
+    if (fread(disk_now, 1, (size_t)disk_sectors*SD_SECTOR_SIZE, disk_file) != (size_t)disk_sectors*SD_SECTOR_SIZE) { perror(disk_name); return 1; }
+    for (uint32_t s=0 ; s<disk_sectors ; s++) {
+        if (memcmp(&disk_now[(size_t)s*SD_SECTOR_SIZE], &disk_expected[(size_t)s*SD_SECTOR_SIZE], SD_SECTOR_SIZE)!=0) {
+            printf("Sector %u was not written back\n", s);
+            if (++errors >= 10)  break;
+        }
+    }
+
+    // Swap the card - fill the cache with the old contents, change the image under it and reset the host
+    for (uint32_t lba=0 ; lba+16<=disk_sectors && lba<SD_CACHE_SECTORS ; lba+=16)  host_read(lba, 16, buffer, multi);
+    for (size_t i=0 ; i<(size_t)disk_sectors*SD_SECTOR_SIZE ; i++)  disk_expected[i] = rng();
+    fseek(disk_file, 0, SEEK_SET);
+    fwrite(disk_expected, 1, (size_t)disk_sectors*SD_SECTOR_SIZE, disk_file);
+    fflush(disk_file);
+    if (!host_init()) { printf("Card initialization after the card swap failed\n"); errors++; }
+    for (uint32_t lba=0 ; lba<disk_sectors && errors<10 ; lba+=16) {
+        uint32_t count = (disk_sectors-lba < 16) ? disk_sectors-lba : 16;
+        if (!host_read(lba, count, buffer, multi))  { printf("Read of %u sectors at %u after the card swap failed\n", count, lba); errors++; }
+        else if (memcmp(buffer, &disk_expected[(size_t)lba*SD_SECTOR_SIZE], count*SD_SECTOR_SIZE)!=0) {
+            printf("Read of %u sectors at %u after the card swap returned the old card's data\n", count, lba);
+            errors++;
+        }
+    }
+    fclose(disk_file);
+
+    printf("\n");
+    printf("  host sectors read/written   : %llu / %llu\n", (unsigned long long)host_sectors_read, (unsigned long long)host_sectors_written);
+    printf("  card sectors read/written   : %llu / %llu\n", (unsigned long long)card_sectors_read, (unsigned long long)card_sectors_written);
+    printf("  card commands               : %llu\n", (unsigned long long)card_commands);
+    printf("  SPI bytes host / card       : %llu / %llu\n", (unsigned long long)host_bytes, (unsigned long long)card_bytes);
+    printf("  dirty sectors at reset      : %u\n", dirty_before_reset);
+    printf("  card capacity / image       : %u / %u sectors\n", card_capacity, disk_sectors);
+    printf("  rejected write-backs        : %u\n", sd_cache_write_errors);
+    printf("  errors                      : %d\n", errors);
+    return errors!=0;
+}
@@ -52,6 +52,13 @@
 // Revision 11 03/01/2025
 // - Refactor lookup table and add support for UMBs
 //
+// Revision 12 10/18/2026
+// - Added a burst-filled PSRAM line cache for EMS window reads
+// - EMS window accesses use a per-2KB translation table updated on page register writes
+// - Added a card-side move/exchange engine for EMS function 57h on MMAN_BASE+8/+9 (emsmove.h)
+// - Added a read-ahead/write-back SD sector cache in the top 1MB of PSRAM (sdcache.h)
+// - PSRAM line cache moved to psramcache.h, shared with MCLV20_Max
+//
 //------------------------------------------------------------------------
 //
 // Copyright (c) 2024 Ted Fried
@@ -80,6 +87,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "bootrom.h"
 
@@ -174,11 +182,24 @@
 #define PSRAM_CLK_HIGH     0x02000000
 
 #define MMAN_BASE          0x260   // Must be a multiple of 16.
-#define EMS_MAX_SIZE       (16*1024*1024)
+#define EMS_MAX_SIZE       (16*1024*1024 - SD_CACHE_SIZE)
+#define EMS_SLOT_UNMAPPED  0xFFFFFFFF   // Any address at or above EMS_MAX_SIZE reads 0xFF and ignores writes
+#define PSRAM_CHIP_SIZE    (8*1024*1024)
+
+#define PSRAM_CACHE_DATA   DMAMEM   // PSRAM line cache (psramcache.h)
+
+#define EMS_MOVE_CHUNK     PSRAM_LINE_SIZE   // Bytes copied per status read, while CHRDY is held
+#define EMS_MOVE_PSRAM_SIZE EMS_MAX_SIZE
 
 #define SD_BASE            0x280    // Must be a multiple of 8.
 #define SD_CONFIG_BYTE     0
 
+#define SD_CACHE_SECTORS   2048     // 1MB sector cache at the top of PSRAM, taken from EMS
+#define SD_CACHE_SIZE      (SD_CACHE_SECTORS*512)
+#define SD_CACHE_BASE      EMS_MAX_SIZE
+#define SD_CACHE_METADATA  DMAMEM
+#define SD_CACHE_IDLE_US   2000     // Host SD inactivity before dirty sectors are written back
+
     
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
@@ -187,7 +208,6 @@ uint32_t  trigger_out = 0;
 uint32_t  gpio6_int = 0;
 uint32_t  gpio9_int = 0;
 uint32_t  isa_address = 0;
-uint32_t  page_base_address = 0;
 uint32_t  psram_address = 0;
 uint32_t  sd_pin_outputs = 0;
 uint32_t  databit_out = 0;
@@ -207,6 +227,7 @@ uint32_t  sd_spi_dataout =0;
 uint8_t   sd_scratch_register[6] = {0, 0, 0, 0, 0, 0};
 uint16_t  sd_requested_timeout = 0;
 elapsedMillis sd_timeout;
+elapsedMicros sd_cache_idle;
 
 enum MemResponse {
   AutoDetect,
@@ -282,6 +303,35 @@ Region memmap[512] = {
     /* F0000 - FFFFF */ UNUSED_64K,
 };
 
+// PSRAM base address of each 2KB page of the EMS window, so an EMS access is one lookup and one OR
+//
+uint32_t ems_slot_base[512];
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+// Refresh the eight 2KB slots covered by one 16KB EMS frame
+//
+inline void EMS_Update_Frame(unsigned int frame) {
+  const unsigned int base = (ems_base_segment >> 7) + (frame << 3);  // 64K segment to 2KB offset
+  for (unsigned int i = 0; i < 8; i++) {
+    if (base + i < 512 && memmap[base + i] == EmsWindow) {
+      ems_slot_base[base + i] = ((uint32_t)ems_frame_pointer[frame] << 14) | (i << 11);
+    }
+  }
+}
+
+// Rebuild the whole table when the EMS window moves or is resized
+//
+inline void EMS_Update_Translation() {
+  for (unsigned int i = 0; i < 512; i++) {
+    ems_slot_base[i] = EMS_SLOT_UNMAPPED;
+  }
+  for (unsigned int frame = 0; frame < 4; frame++) {
+    EMS_Update_Frame(frame);
+  }
+}
+
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
 
@@ -375,6 +425,8 @@ void setup() {
     memmap[i] = BootRom;
   }
   memmap[(BOOTROM_ADDR+sizeof(BOOTROM)) >> 11] = SdCard;
+
+  EMS_Update_Translation();
 }
 
 
@@ -494,12 +546,11 @@ inline void PSRAM_Configure() {
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
 
-inline uint8_t PSRAM_Read(uint32_t address_in) {
-    
-  if (address_in >= EMS_MAX_SIZE) {
-      return 0xff;
-  }  
-  if (address_in >= 0x7FFFFF)  psram_cs=1; else psram_cs=0;  
+// Read byte_count sequential bytes with one Quad Read command. The burst must not cross a 1KB PSRAM page.
+//
+inline void PSRAM_Read_Burst(uint32_t address_in , uint8_t * buffer , uint32_t byte_count) {
+
+  if (address_in >= PSRAM_CHIP_SIZE)  psram_cs=1; else psram_cs=0;
 
   // Send Command = Quad Read = 0x0B
   //
@@ -528,26 +579,50 @@ inline uint8_t PSRAM_Read(uint32_t address_in) {
  PSRAM_Write_Clk_Cycle(); 
 
 
-  // Clock in the data
+  // Clock in the data - the PSRAM keeps streaming sequential bytes for as long as CS_n is held low
   //                  
-  PSRAM_Read_Clk_Cycle();  read_byte = nibble_in;
-  PSRAM_Read_Clk_Cycle();  read_byte = (read_byte<<4) | nibble_in;
+  for (uint32_t i = 0; i < byte_count; i++) {
+    PSRAM_Read_Clk_Cycle();  read_byte = nibble_in;
+    PSRAM_Read_Clk_Cycle();  read_byte = (read_byte<<4) | nibble_in;
+    buffer[i] = read_byte;
+  }
 
   GPIO9_DR = PSRAM_RESET_VALUE;                       // Drive  CLK=0 , CS_n=1
   GPIO9_GDIR = 0x3F400000;                            // Change Data[3:0] to outputs quickly
+}
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+#include "psramcache.h"
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
 
-  return read_byte;
+// A miss fills the whole line in one burst, so the wait states are paid once per line
+// and the following sequential reads are served from internal RAM.
+//
+inline uint8_t PSRAM_Read(uint32_t address_in) {
+  if (address_in >= EMS_MAX_SIZE) {
+      return 0xff;
+  }  
+
+  return PSRAM_Cache_Read(address_in);
 }
 
  
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
 
+// Writes go straight through to the PSRAM and update the cached copy of the line if present.
+//
 inline void PSRAM_Write(uint32_t address_in , int8_t local_data) {
   if (address_in >= EMS_MAX_SIZE) {
     return;
   }
-  if (address_in >= 0x7FFFFF)  psram_cs=1; else psram_cs=0;  
+  if (address_in >= PSRAM_CHIP_SIZE)  psram_cs=1; else psram_cs=0;  
+
+  PSRAM_Cache_Write(address_in , local_data);
 
 
   // Send Command = Quad Write = 0x02
@@ -577,6 +652,44 @@ inline void PSRAM_Write(uint32_t address_in , int8_t local_data) {
 }
  
  
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+// Write byte_count sequential bytes with one Quad Write command. The burst must stay within one cache line.
+//
+inline void PSRAM_Write_Burst(uint32_t address_in , const uint8_t * buffer , uint32_t byte_count) {
+  if (address_in >= PSRAM_CHIP_SIZE)  psram_cs=1; else psram_cs=0;
+
+  PSRAM_Cache_Write_Burst(address_in , buffer , byte_count);
+
+
+  // Send Command = Quad Write = 0x02
+  //
+  nibble_out = 0x0;    PSRAM_Write_Clk_Cycle();
+  nibble_out = 0x2;    PSRAM_Write_Clk_Cycle();
+
+
+  // Send 24-bit address in six clock cycles
+  //
+  nibble_out = address_in >> 20;   PSRAM_Write_Clk_Cycle();
+  nibble_out = address_in >> 16;   PSRAM_Write_Clk_Cycle();
+  nibble_out = address_in >> 12;   PSRAM_Write_Clk_Cycle();
+  nibble_out = address_in >> 8;    PSRAM_Write_Clk_Cycle();
+  nibble_out = address_in >> 4;    PSRAM_Write_Clk_Cycle();
+  nibble_out = address_in;         PSRAM_Write_Clk_Cycle();
+
+
+  // Send the data two clock cycles per byte
+  //
+  for (uint32_t i = 0; i < byte_count; i++) {
+    nibble_out = buffer[i] >> 4;   PSRAM_Write_Clk_Cycle();
+    nibble_out = buffer[i];        PSRAM_Write_Clk_Cycle();
+  }
+
+  GPIO9_DR = PSRAM_RESET_VALUE;                       // Drive  CLK=0 , CS_n=1
+}
+ 
+ 
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
 
@@ -593,6 +706,54 @@ inline void Internal_RAM_Write() {
 // --------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------
 
+// SD card sector cache - sdcache.h talks to the card and the PSRAM through these
+//
+inline uint8_t SD_Card_Transfer(uint8_t data_out) {
+  sd_spi_dataout = data_out;  SD_SPI_Cycle();
+  GPIO8_DR = sd_pin_outputs + MUX_DATA_n_HIGH + CHRDY_OE_n_LOW + DATA_OE_n_HIGH;  // SD_SPI_Cycle() de-asserts CHRDY, keep the wait states
+  return sd_spi_datain;
+}
+
+inline void SD_Card_Select(uint8_t cs_n) {
+  sd_spi_cs_n = cs_n;
+  sd_pin_outputs = (sd_spi_cs_n<<17);   // SD_CS_n - SD_CLK - SD_MOSI
+}
+
+inline void SD_Cache_Storage_Read(uint32_t offset , uint8_t * buffer , uint32_t byte_count) {
+  PSRAM_Read_Burst(SD_CACHE_BASE + offset , buffer , byte_count);
+}
+
+inline void SD_Cache_Storage_Write(uint32_t offset , const uint8_t * buffer , uint32_t byte_count) {
+  PSRAM_Write_Burst(SD_CACHE_BASE + offset , buffer , byte_count);
+}
+
+#include "sdcache.h"
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+// EMS Move/Exchange engine - emsmove.h reaches conventional memory through these
+//
+inline uint8_t * EMS_Move_Internal_RAM(uint32_t address) {
+  if (memmap[address >> 11] != Ram || XTMax_MEM_Response_Array[address >> 16] != Respond) {
+    return NULL;
+  }
+  if (address < sizeof(internal_RAM1))  return &internal_RAM1[address];
+  else                                  return &internal_RAM2[address-sizeof(internal_RAM1)];
+}
+
+inline uint32_t EMS_Move_Window(uint32_t address) {
+  if (memmap[address >> 11] != EmsWindow) {
+    return EMS_SLOT_UNMAPPED;
+  }
+  return ems_slot_base[address >> 11] | (address & 0x7FF);
+}
+
+#include "emsmove.h"
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
 inline void Mem_Read_Cycle()
 {
   isa_address = ADDRESS_DATA_GPIO6_UNSCRAMBLE;
@@ -600,12 +761,7 @@ inline void Mem_Read_Cycle()
   Region region = memmap[isa_address >> 11];
   switch (region) {
     case EmsWindow:
-      page_base_address = (isa_address & 0xFC000);
-
-           if (page_base_address == ((ems_base_segment<<4) | 0xC000)) { psram_address = (ems_frame_pointer[3]<<14) | (isa_address & 0x03FFF); }
-      else if (page_base_address == ((ems_base_segment<<4) | 0x8000)) { psram_address = (ems_frame_pointer[2]<<14) | (isa_address & 0x03FFF); }
-      else if (page_base_address == ((ems_base_segment<<4) | 0x4000)) { psram_address = (ems_frame_pointer[1]<<14) | (isa_address & 0x03FFF); }
-      else if (page_base_address == ((ems_base_segment<<4) | 0x0000)) { psram_address = (ems_frame_pointer[0]<<14) | (isa_address & 0x03FFF); }
+      psram_address = ems_slot_base[isa_address >> 11] | (isa_address & 0x7FF);
 
       GPIO7_DR = MUX_ADDR_n_LOW  + CHRDY_OUT_LOW + trigger_out;
       GPIO8_DR = sd_pin_outputs + MUX_DATA_n_HIGH + CHRDY_OE_n_LOW + DATA_OE_n_LOW ;  // Assert CHRDY_n=0 to begin wait states
@@ -663,8 +819,8 @@ inline void Mem_Read_Cycle()
       GPIO7_DR = MUX_ADDR_n_LOW  + CHRDY_OUT_LOW + trigger_out;
       GPIO8_DR = sd_pin_outputs + MUX_DATA_n_HIGH + CHRDY_OE_n_LOW + DATA_OE_n_LOW ;  // Assert CHRDY_n=0 to begin wait states
 
-      // Receive a byte to the SD Card
-      sd_spi_dataout = 0xff; SD_SPI_Cycle(); isa_data_out = sd_spi_datain;
+      // Receive a byte from the SD Card
+      isa_data_out = SD_Cache_Host_Transfer(0xff);  sd_cache_idle = 0;
       GPIO7_DR = GPIO7_DATA_OUT_UNSCRAMBLE + MUX_ADDR_n_LOW  + CHRDY_OUT_LOW + trigger_out;  // Output data
       GPIO8_DR = sd_pin_outputs + MUX_DATA_n_HIGH + CHRDY_OE_n_HIGH + DATA_OE_n_LOW;  // De-assert CHRDY
 
@@ -689,12 +845,7 @@ inline void Mem_Write_Cycle()
   Region region = memmap[isa_address >> 11];
   switch (region) {
     case EmsWindow:
-      page_base_address = (isa_address & 0xFC000);
- 
-           if (page_base_address == ((ems_base_segment<<4) | 0xC000)) { psram_address = (ems_frame_pointer[3]<<14) | (isa_address & 0x03FFF); }
-      else if (page_base_address == ((ems_base_segment<<4) | 0x8000)) { psram_address = (ems_frame_pointer[2]<<14) | (isa_address & 0x03FFF); }
-      else if (page_base_address == ((ems_base_segment<<4) | 0x4000)) { psram_address = (ems_frame_pointer[1]<<14) | (isa_address & 0x03FFF); }
-      else if (page_base_address == ((ems_base_segment<<4) | 0x0000)) { psram_address = (ems_frame_pointer[0]<<14) | (isa_address & 0x03FFF); }
+      psram_address = ems_slot_base[isa_address >> 11] | (isa_address & 0x7FF);
 
       GPIO7_DR = GPIO7_DATA_OUT_UNSCRAMBLE + MUX_ADDR_n_HIGH  + CHRDY_OUT_LOW + trigger_out;
       GPIO8_DR = sd_pin_outputs + MUX_DATA_n_LOW + CHRDY_OE_n_LOW + DATA_OE_n_HIGH;    // Steer data mux to Data[7:0] and Assert CHRDY_n=0 to begin wait states
@@ -740,7 +891,7 @@ inline void Mem_Write_Cycle()
       data_in = 0xFF & ADDRESS_DATA_GPIO6_UNSCRAMBLE;
 
       // Send a byte to the SD Card
-      sd_spi_dataout = data_in;  SD_SPI_Cycle();
+      SD_Cache_Host_Transfer(data_in);  sd_cache_idle = 0;
       GPIO8_DR = sd_pin_outputs + MUX_DATA_n_LOW + CHRDY_OE_n_HIGH + DATA_OE_n_HIGH;  // De-assert CHRDY
 
       while ( (gpio9_int&0xF0) != 0xF0 ) {   // Wait here until cycle is complete
@@ -775,6 +926,11 @@ inline void IO_Read_Cycle()
       case MMAN_BASE+5 :  isa_data_out = ems_frame_pointer[2] >> 8; break;
       case MMAN_BASE+6 :  isa_data_out = ems_frame_pointer[3]; break;
       case MMAN_BASE+7 :  isa_data_out = ems_frame_pointer[3] >> 8; break;
+      case MMAN_BASE+8 :  // Move/Exchange status - runs the next chunk with wait states held
+        GPIO7_DR = MUX_ADDR_n_LOW  + CHRDY_OUT_LOW + trigger_out;
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_HIGH + CHRDY_OE_n_LOW + DATA_OE_n_LOW ;  // Assert CHRDY_n=0 to begin wait states
+        isa_data_out = EMS_Move_Step();
+        break;
       case MMAN_BASE+15:  isa_data_out = memmap[umb_base_segment >> 7]; break;   // Useful for debugging
       default:            isa_data_out = 0xff; break;
     }
@@ -788,7 +944,10 @@ inline void IO_Read_Cycle()
   }
   else if ((isa_address&0x0FF8)==SD_BASE) {   // Location of SD Card registers
     switch (isa_address)  {
-      case SD_BASE+0:  sd_spi_dataout = 0xff; SD_SPI_Cycle(); isa_data_out = sd_spi_datain; break;
+      case SD_BASE+0:  // Assert CHRDY_n=0 while the cache or card produces the byte
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_HIGH + CHRDY_OE_n_LOW + DATA_OE_n_HIGH;
+        isa_data_out = SD_Cache_Host_Transfer(0xff);  sd_cache_idle = 0;
+        break;
       case SD_BASE+1:  isa_data_out = SD_CONFIG_BYTE; break;
       case SD_BASE+2:  isa_data_out = sd_scratch_register[0]; break;
       case SD_BASE+3:  isa_data_out = sd_scratch_register[1]; break;
@@ -825,16 +984,22 @@ inline void IO_Write_Cycle()
     data_in = 0xFF & ADDRESS_DATA_GPIO6_UNSCRAMBLE;
 
     switch (isa_address)  {
-      case MMAN_BASE+0 :  ems_frame_pointer[0] = (ems_frame_pointer[0] & 0xFF00) | data_in; break;
-      case MMAN_BASE+1 :  ems_frame_pointer[0] = (ems_frame_pointer[0] & 0x00FF) | ((uint16_t)data_in << 8); break;
-      case MMAN_BASE+2 :  ems_frame_pointer[1] = (ems_frame_pointer[1] & 0xFF00) | data_in; break;
-      case MMAN_BASE+3 :  ems_frame_pointer[1] = (ems_frame_pointer[1] & 0x00FF) | ((uint16_t)data_in << 8); break;
-      case MMAN_BASE+4 :  ems_frame_pointer[2] = (ems_frame_pointer[2] & 0xFF00) | data_in; break;
-      case MMAN_BASE+5 :  ems_frame_pointer[2] = (ems_frame_pointer[2] & 0x00FF) | ((uint16_t)data_in << 8); break;
-      case MMAN_BASE+6 :  ems_frame_pointer[3] = (ems_frame_pointer[3] & 0xFF00) | data_in; break;
-      case MMAN_BASE+7 :  ems_frame_pointer[3] = (ems_frame_pointer[3] & 0x00FF) | ((uint16_t)data_in << 8); break;
-      case MMAN_BASE+10:  ems_base_segment = (ems_base_segment & 0xFF00) | data_in; break;
-      case MMAN_BASE+11:  ems_base_segment = (ems_base_segment & 0x00FF) | ((uint16_t)data_in << 8); break;
+      case MMAN_BASE+0 :  ems_frame_pointer[0] = (ems_frame_pointer[0] & 0xFF00) | data_in; EMS_Update_Frame(0); break;
+      case MMAN_BASE+1 :  ems_frame_pointer[0] = (ems_frame_pointer[0] & 0x00FF) | ((uint16_t)data_in << 8); EMS_Update_Frame(0); break;
+      case MMAN_BASE+2 :  ems_frame_pointer[1] = (ems_frame_pointer[1] & 0xFF00) | data_in; EMS_Update_Frame(1); break;
+      case MMAN_BASE+3 :  ems_frame_pointer[1] = (ems_frame_pointer[1] & 0x00FF) | ((uint16_t)data_in << 8); EMS_Update_Frame(1); break;
+      case MMAN_BASE+4 :  ems_frame_pointer[2] = (ems_frame_pointer[2] & 0xFF00) | data_in; EMS_Update_Frame(2); break;
+      case MMAN_BASE+5 :  ems_frame_pointer[2] = (ems_frame_pointer[2] & 0x00FF) | ((uint16_t)data_in << 8); EMS_Update_Frame(2); break;
+      case MMAN_BASE+6 :  ems_frame_pointer[3] = (ems_frame_pointer[3] & 0xFF00) | data_in; EMS_Update_Frame(3); break;
+      case MMAN_BASE+7 :  ems_frame_pointer[3] = (ems_frame_pointer[3] & 0x00FF) | ((uint16_t)data_in << 8); EMS_Update_Frame(3); break;
+      case MMAN_BASE+8 :  // Move/Exchange command - 0 = reset parameters, 1 = move, 2 = exchange
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_LOW + CHRDY_OE_n_LOW + DATA_OE_n_HIGH;   // Hold wait states while the regions are checked
+        EMS_Move_Start(data_in);
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_LOW + CHRDY_OE_n_HIGH + DATA_OE_n_HIGH;
+        break;
+      case MMAN_BASE+9 :  EMS_Move_Param(data_in); break;
+      case MMAN_BASE+10:  ems_base_segment = (ems_base_segment & 0xFF00) | data_in; EMS_Update_Translation(); break;
+      case MMAN_BASE+11:  ems_base_segment = (ems_base_segment & 0x00FF) | ((uint16_t)data_in << 8); EMS_Update_Translation(); break;
       case MMAN_BASE+12:  // Num 16K pages + commit operation
         if (ems_base_segment >= 0xA000 && ems_base_segment + (data_in << 10) <= 0xF000) {
           const unsigned int base = ems_base_segment >> 7;  // 64K segment to 2KB offset
@@ -842,6 +1007,7 @@ inline void IO_Write_Cycle()
           for (unsigned int i = 0; i < count; i++) {
             memmap[base + i] = EmsWindow;
           }
+          EMS_Update_Translation();
         }
         break;
       case MMAN_BASE+13:  umb_base_segment = (umb_base_segment & 0xFF00) | data_in; break;
@@ -875,8 +1041,16 @@ inline void IO_Write_Cycle()
     data_in = 0xFF & ADDRESS_DATA_GPIO6_UNSCRAMBLE;
 
     switch (isa_address)  {
-      case SD_BASE+0:  sd_spi_dataout = data_in;  SD_SPI_Cycle(); break;
-      case SD_BASE+1:  sd_spi_cs_n    = data_in&0x1; break;
+      case SD_BASE+0:  // Assert CHRDY_n=0 while the cache or card takes the byte
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_LOW + CHRDY_OE_n_LOW + DATA_OE_n_HIGH;
+        SD_Cache_Host_Transfer(data_in);  sd_cache_idle = 0;
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_LOW + CHRDY_OE_n_HIGH + DATA_OE_n_HIGH;  // De-assert CHRDY
+        break;
+      case SD_BASE+1:  // Deselect may finish a cached write, hold CHRDY_n=0 while it does
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_LOW + CHRDY_OE_n_LOW + DATA_OE_n_HIGH;
+        SD_Cache_Host_Select(data_in&0x1);  sd_cache_idle = 0;
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_LOW + CHRDY_OE_n_HIGH + DATA_OE_n_HIGH;  // De-assert CHRDY
+        break;
       case SD_BASE+2:  sd_scratch_register[0] = data_in; break;
       case SD_BASE+3:  sd_scratch_register[1] = data_in; break;
       case SD_BASE+4:  sd_scratch_register[2] = data_in; break;
@@ -913,6 +1087,8 @@ void loop() {
   //delay (1000);
  
   PSRAM_Configure();
+  PSRAM_Cache_Invalidate();
+  SD_Cache_Init();
 
   while (1) {
      
@@ -922,5 +1098,10 @@ void loop() {
       else if ((gpio9_int&0x80000020)==0)  IO_Write_Cycle();
       else if ((gpio9_int&0x00000040)==0)  Mem_Read_Cycle();
       else if ((gpio9_int&0x00000080)==0)  Mem_Write_Cycle();
+      else if (SD_Cache_Background_Pending() && sd_cache_idle >= SD_CACHE_IDLE_US)  {
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_HIGH + CHRDY_OE_n_LOW + DATA_OE_n_HIGH;   // Hold off any cycle that starts during the write-back step
+        SD_Cache_Background();
+        GPIO8_DR = sd_pin_outputs + MUX_DATA_n_HIGH + CHRDY_OE_n_HIGH + DATA_OE_n_HIGH;  // De-assert CHRDY
+      }
   }
 }
\ No newline at end of file
@@ -1,18 +1,18 @@
 #define BOOTROM_ADDR 0xce000
 unsigned char BOOTROM[] = {
-    85, 170, 4, 6, 80, 81, 82, 250, 184, 209, 5, 232, 57, 5, 184, 19,
-    6, 232, 51, 5, 140, 200, 232, 75, 5, 184, 202, 5, 232, 40, 5, 184,
-    0, 0, 232, 63, 5, 184, 206, 5, 232, 28, 5, 232, 29, 4, 115, 3,
+    85, 170, 4, 6, 80, 81, 82, 250, 184, 35, 6, 232, 139, 5, 184, 101,
+    6, 232, 133, 5, 140, 200, 232, 157, 5, 184, 28, 6, 232, 122, 5, 184,
+    0, 0, 232, 145, 5, 184, 32, 6, 232, 110, 5, 232, 46, 4, 115, 3,
     233, 151, 0, 49, 192, 142, 192, 38, 161, 78, 0, 186, 131, 2, 239, 38,
     161, 76, 0, 186, 133, 2, 239, 140, 200, 38, 163, 78, 0, 184, 208, 0,
-    38, 163, 76, 0, 184, 112, 6, 232, 237, 4, 184, 64, 0, 142, 192, 38,
-    160, 117, 0, 4, 128, 186, 130, 2, 238, 80, 232, 247, 4, 184, 206, 5,
-    232, 212, 4, 184, 139, 6, 232, 206, 4, 38, 254, 6, 117, 0, 38, 160,
-    117, 0, 48, 228, 232, 221, 4, 184, 206, 5, 232, 186, 4, 88, 49, 201,
+    38, 163, 76, 0, 184, 194, 6, 232, 63, 5, 184, 64, 0, 142, 192, 38,
+    160, 117, 0, 4, 128, 186, 130, 2, 238, 80, 232, 73, 5, 184, 32, 6,
+    232, 38, 5, 184, 221, 6, 232, 32, 5, 38, 254, 6, 117, 0, 38, 160,
+    117, 0, 48, 228, 232, 47, 5, 184, 32, 6, 232, 12, 5, 88, 49, 201,
     142, 193, 60, 128, 117, 15, 140, 200, 38, 163, 6, 1, 184, 181, 1, 38,
     163, 4, 1, 235, 13, 140, 200, 38, 163, 26, 1, 184, 181, 1, 38, 163,
-    24, 1, 140, 200, 38, 163, 98, 0, 38, 163, 102, 0, 184, 176, 3, 38,
-    163, 96, 0, 184, 138, 3, 38, 163, 100, 0, 251, 90, 89, 88, 7, 203,
+    24, 1, 140, 200, 38, 163, 98, 0, 38, 163, 102, 0, 184, 193, 3, 38,
+    163, 96, 0, 184, 155, 3, 38, 163, 100, 0, 251, 90, 89, 88, 7, 203,
     251, 85, 86, 80, 82, 186, 130, 2, 236, 90, 56, 194, 88, 116, 58, 137,
     197, 137, 214, 156, 14, 184, 249, 0, 80, 186, 131, 2, 237, 80, 186, 133,
     2, 237, 80, 137, 232, 137, 242, 250, 203, 251, 156, 80, 137, 240, 60, 128,
@@ -22,109 +22,109 @@ unsigned char BOOTROM[] = {
     235, 3, 190, 83, 1, 86, 137, 222, 136, 227, 48, 255, 208, 227, 135, 222,
     46, 255, 164, 103, 1, 140, 197, 190, 64, 0, 142, 198, 38, 136, 38, 116,
     0, 142, 197, 137, 229, 139, 118, 8, 86, 115, 4, 157, 249, 235, 2, 157,
-    248, 94, 93, 251, 202, 2, 0, 111, 3, 197, 1, 217, 1, 108, 2, 48,
-    3, 155, 1, 155, 1, 155, 1, 75, 3, 111, 3, 155, 1, 155, 1, 97,
-    3, 111, 3, 155, 1, 155, 1, 111, 3, 111, 3, 155, 1, 155, 1, 111,
-    3, 113, 3, 155, 1, 155, 1, 155, 1, 111, 3, 80, 184, 166, 6, 232,
-    165, 3, 88, 80, 136, 224, 48, 228, 232, 185, 3, 184, 206, 5, 232, 150,
-    3, 88, 233, 201, 1, 0, 4, 255, 0, 0, 255, 255, 0, 200, 0, 0,
+    248, 94, 93, 251, 202, 2, 0, 128, 3, 197, 1, 217, 1, 115, 2, 65,
+    3, 155, 1, 155, 1, 155, 1, 92, 3, 128, 3, 155, 1, 155, 1, 114,
+    3, 128, 3, 155, 1, 155, 1, 128, 3, 128, 3, 155, 1, 155, 1, 128,
+    3, 130, 3, 155, 1, 155, 1, 155, 1, 128, 3, 80, 184, 248, 6, 232,
+    247, 3, 88, 80, 136, 224, 48, 228, 232, 11, 4, 184, 32, 6, 232, 232,
+    3, 88, 233, 218, 1, 0, 4, 255, 0, 0, 255, 255, 0, 200, 0, 0,
     0, 0, 0, 63, 0, 6, 189, 64, 0, 142, 197, 48, 228, 38, 134, 38,
-    116, 0, 132, 228, 116, 1, 249, 7, 195, 132, 192, 117, 3, 233, 158, 1,
-    80, 48, 228, 137, 198, 83, 232, 17, 2, 137, 197, 1, 240, 137, 222, 131,
-    211, 0, 232, 56, 2, 91, 88, 115, 3, 233, 134, 1, 30, 83, 81, 82,
+    116, 0, 132, 228, 116, 1, 249, 7, 195, 132, 192, 117, 3, 233, 175, 1,
+    80, 48, 228, 137, 198, 83, 232, 34, 2, 137, 197, 1, 240, 137, 222, 131,
+    211, 0, 232, 73, 2, 91, 88, 115, 3, 233, 151, 1, 30, 83, 81, 82,
     87, 80, 137, 193, 48, 237, 140, 200, 142, 216, 137, 223, 186, 129, 2, 176,
-    0, 238, 81, 137, 232, 137, 243, 177, 81, 232, 3, 3, 114, 60, 186, 135,
-    2, 176, 10, 238, 186, 128, 2, 236, 60, 254, 116, 10, 186, 135, 2, 236,
-    132, 192, 117, 38, 235, 238, 185, 0, 1, 86, 190, 0, 8, 252, 243, 165,
-    173, 94, 131, 197, 1, 131, 214, 0, 89, 226, 199, 186, 129, 2, 176, 1,
-    238, 88, 95, 90, 89, 91, 31, 233, 44, 1, 186, 129, 2, 176, 1, 238,
-    89, 88, 40, 200, 95, 90, 89, 91, 31, 233, 14, 1, 132, 192, 117, 3,
-    233, 11, 1, 80, 48, 228, 137, 198, 83, 232, 126, 1, 137, 197, 1, 240,
-    137, 222, 131, 211, 0, 232, 165, 1, 91, 88, 115, 3, 233, 243, 0, 30,
-    83, 81, 82, 87, 80, 137, 193, 48, 237, 137, 223, 140, 192, 142, 216, 140,
-    200, 142, 192, 186, 129, 2, 176, 0, 238, 81, 137, 232, 137, 243, 177, 88,
-    232, 108, 2, 114, 102, 186, 128, 2, 176, 254, 238, 185, 0, 1, 86, 137,
-    254, 191, 0, 8, 252, 243, 165, 137, 247, 94, 186, 135, 2, 176, 25, 238,
-    186, 128, 2, 236, 60, 255, 117, 10, 186, 135, 2, 236, 132, 192, 117, 59,
-    235, 238, 36, 31, 60, 5, 117, 51, 186, 135, 2, 176, 25, 238, 186, 128,
-    2, 236, 132, 192, 117, 10, 186, 135, 2, 236, 132, 192, 117, 29, 235, 238,
-    131, 197, 1, 131, 214, 0, 89, 226, 160, 186, 129, 2, 176, 1, 238, 140,
-    216, 142, 192, 88, 95, 90, 89, 91, 31, 235, 107, 186, 129, 2, 176, 1,
-    238, 89, 140, 216, 142, 192, 88, 40, 200, 95, 90, 89, 91, 31, 235, 74,
-    132, 192, 116, 74, 80, 48, 228, 137, 197, 83, 232, 189, 0, 1, 232, 131,
-    211, 0, 232, 232, 0, 91, 88, 114, 57, 235, 59, 182, 254, 6, 184, 64,
-    0, 142, 192, 38, 138, 22, 117, 0, 7, 181, 254, 177, 255, 49, 192, 248,
-    195, 80, 83, 232, 148, 0, 232, 196, 0, 91, 88, 114, 21, 235, 23, 235,
-    21, 180, 3, 232, 206, 0, 135, 209, 248, 195, 180, 170, 249, 195, 180, 1,
-    249, 195, 180, 4, 249, 195, 48, 228, 248, 195, 184, 195, 6, 232, 183, 1,
-    49, 210, 232, 75, 0, 128, 62, 0, 124, 6, 114, 20, 191, 0, 124, 185,
-    8, 0, 161, 0, 124, 131, 199, 2, 59, 5, 225, 249, 116, 2, 235, 36,
-    137, 229, 54, 139, 70, 2, 133, 192, 184, 35, 7, 116, 28, 184, 228, 6,
-    232, 132, 1, 186, 128, 0, 232, 23, 0, 129, 62, 254, 125, 85, 170, 184,
-    9, 7, 117, 5, 234, 0, 124, 0, 0, 232, 107, 1, 251, 244, 235, 253,
-    49, 192, 142, 216, 142, 192, 185, 0, 1, 191, 0, 124, 243, 171, 184, 1,
-    2, 185, 1, 0, 187, 0, 124, 205, 19, 195, 49, 192, 49, 219, 82, 81,
-    82, 136, 200, 36, 192, 209, 224, 209, 224, 136, 232, 185, 255, 0, 247, 225,
-    90, 136, 241, 48, 237, 1, 200, 177, 63, 247, 225, 89, 81, 48, 237, 128,
-    225, 63, 73, 1, 200, 131, 210, 0, 137, 211, 89, 90, 195, 81, 82, 232,
-    18, 0, 57, 211, 114, 10, 119, 4, 57, 200, 114, 4, 249, 90, 89, 195,
-    248, 90, 89, 195, 186, 250, 0, 185, 63, 197, 195, 80, 30, 83, 81, 82,
-    86, 140, 200, 142, 216, 186, 129, 2, 176, 1, 238, 185, 1, 0, 186, 160,
-    134, 180, 134, 205, 21, 186, 128, 2, 176, 255, 185, 10, 0, 238, 226, 253,
-    186, 129, 2, 176, 0, 238, 187, 10, 0, 190, 7, 5, 185, 1, 0, 180,
-    1, 232, 92, 0, 115, 15, 49, 201, 186, 32, 78, 180, 134, 205, 21, 75,
-    117, 231, 249, 235, 52, 190, 13, 5, 185, 5, 0, 180, 1, 232, 64, 0,
-    114, 39, 186, 135, 2, 176, 250, 238, 190, 19, 5, 185, 1, 0, 180, 1,
-    232, 45, 0, 190, 25, 5, 185, 1, 0, 180, 0, 232, 34, 0, 115, 9,
-    186, 135, 2, 236, 132, 192, 116, 224, 249, 94, 90, 89, 91, 31, 114, 8,
-    184, 46, 6, 232, 113, 0, 88, 195, 184, 81, 6, 232, 105, 0, 88, 195,
-    186, 128, 2, 176, 255, 238, 81, 185, 6, 0, 252, 172, 238, 226, 252, 185,
-    8, 0, 236, 60, 255, 225, 251, 89, 56, 224, 118, 3, 249, 235, 4, 248,
-    236, 226, 253, 176, 255, 238, 195, 64, 0, 0, 0, 0, 149, 72, 0, 0,
-    1, 170, 135, 119, 0, 0, 0, 0, 1, 105, 64, 0, 0, 0, 1, 186,
-    128, 2, 80, 176, 255, 238, 136, 200, 238, 136, 248, 238, 136, 216, 238, 88,
-    134, 224, 238, 134, 224, 238, 176, 1, 238, 185, 8, 0, 236, 60, 255, 225,
-    251, 132, 192, 116, 1, 249, 195, 156, 30, 83, 86, 137, 198, 140, 200, 142,
-    216, 180, 14, 49, 219, 252, 172, 8, 192, 116, 4, 205, 16, 235, 247, 94,
-    91, 31, 157, 195, 156, 30, 83, 81, 82, 86, 137, 194, 140, 200, 142, 216,
-    49, 219, 252, 137, 214, 177, 12, 211, 238, 131, 230, 15, 138, 132, 186, 5,
-    180, 14, 205, 16, 137, 214, 177, 8, 211, 238, 131, 230, 15, 138, 132, 186,
-    5, 180, 14, 205, 16, 137, 214, 177, 4, 211, 238, 131, 230, 15, 138, 132,
-    186, 5, 180, 14, 205, 16, 137, 214, 131, 230, 15, 138, 132, 186, 5, 180,
-    14, 205, 16, 94, 90, 89, 91, 31, 157, 195, 48, 49, 50, 51, 52, 53,
-    54, 55, 56, 57, 65, 66, 67, 68, 69, 70, 58, 0, 32, 0, 13, 10,
-    0, 66, 111, 111, 116, 82, 79, 77, 32, 102, 111, 114, 32, 88, 84, 77,
-    97, 120, 32, 118, 49, 46, 48, 13, 10, 67, 111, 112, 121, 114, 105, 103,
-    104, 116, 32, 40, 99, 41, 32, 50, 48, 50, 53, 32, 77, 97, 116, 116,
-    104, 105, 101, 117, 32, 66, 117, 99, 99, 104, 105, 97, 110, 101, 114, 105,
-    13, 10, 0, 82, 79, 77, 32, 66, 97, 115, 101, 32, 65, 100, 100, 114,
-    101, 115, 115, 32, 32, 32, 32, 32, 32, 32, 32, 61, 32, 0, 83, 68,
-    32, 67, 97, 114, 100, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101,
-    100, 32, 115, 117, 99, 99, 101, 115, 115, 102, 117, 108, 108, 121, 13, 10,
-    0, 83, 68, 32, 67, 97, 114, 100, 32, 102, 97, 105, 108, 101, 100, 32,
-    116, 111, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 13, 10, 0,
-    70, 105, 120, 101, 100, 32, 68, 105, 115, 107, 32, 73, 68, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 61, 32, 0, 84, 111, 116, 97, 108,
-    32, 70, 105, 120, 101, 100, 32, 68, 105, 115, 107, 32, 68, 114, 105, 118,
-    101, 115, 32, 61, 32, 0, 85, 110, 115, 117, 112, 112, 111, 114, 116, 101,
-    100, 32, 73, 78, 84, 49, 51, 104, 32, 70, 117, 110, 99, 116, 105, 111,
-    110, 32, 0, 65, 116, 116, 101, 109, 112, 116, 105, 110, 103, 32, 98, 111,
-    111, 116, 32, 102, 114, 111, 109, 32, 102, 108, 111, 112, 112, 121, 46, 46,
-    46, 13, 10, 0, 65, 116, 116, 101, 109, 112, 116, 105, 110, 103, 32, 98,
-    111, 111, 116, 32, 102, 114, 111, 109, 32, 102, 105, 120, 101, 100, 32, 100,
-    105, 115, 107, 46, 46, 46, 13, 10, 0, 78, 111, 32, 98, 111, 111, 116,
-    97, 98, 108, 101, 32, 109, 101, 100, 105, 97, 32, 102, 111, 117, 110, 100,
-    13, 10, 0, 78, 111, 32, 97, 99, 116, 105, 118, 101, 32, 112, 97, 114,
-    116, 105, 116, 105, 111, 110, 32, 102, 111, 117, 110, 100, 13, 10, 0, 0,
+    0, 238, 81, 137, 232, 137, 243, 177, 82, 232, 20, 3, 114, 67, 186, 135,
+    2, 176, 10, 238, 186, 128, 2, 236, 60, 254, 116, 14, 60, 255, 117, 46,
+    186, 135, 2, 236, 132, 192, 117, 38, 235, 234, 185, 0, 1, 86, 190, 0,
+    8, 252, 243, 165, 173, 94, 89, 73, 81, 117, 211, 232, 14, 3, 89, 186,
+    129, 2, 176, 1, 238, 88, 95, 90, 89, 91, 31, 233, 57, 1, 232, 251,
+    2, 186, 129, 2, 176, 1, 238, 89, 88, 40, 200, 95, 90, 89, 91, 31,
+    233, 24, 1, 132, 192, 117, 3, 233, 21, 1, 80, 48, 228, 137, 198, 83,
+    232, 136, 1, 137, 197, 1, 240, 137, 222, 131, 211, 0, 232, 175, 1, 91,
+    88, 115, 3, 233, 253, 0, 30, 83, 81, 82, 87, 80, 137, 193, 48, 237,
+    137, 223, 140, 192, 142, 216, 140, 200, 142, 192, 186, 129, 2, 176, 0, 238,
+    81, 137, 232, 137, 243, 177, 89, 232, 118, 2, 114, 112, 186, 128, 2, 176,
+    252, 238, 185, 0, 1, 86, 137, 254, 191, 0, 8, 252, 243, 165, 137, 247,
+    94, 186, 135, 2, 176, 25, 238, 186, 128, 2, 236, 60, 255, 117, 10, 186,
+    135, 2, 236, 132, 192, 117, 66, 235, 238, 36, 31, 60, 5, 117, 58, 186,
+    135, 2, 176, 25, 238, 186, 128, 2, 236, 132, 192, 117, 10, 186, 135, 2,
+    236, 132, 192, 117, 36, 235, 238, 89, 73, 81, 117, 176, 232, 103, 2, 115,
+    5, 89, 65, 81, 235, 22, 89, 186, 129, 2, 176, 1, 238, 140, 216, 142,
+    192, 88, 95, 90, 89, 91, 31, 235, 110, 232, 74, 2, 186, 129, 2, 176,
+    1, 238, 89, 140, 216, 142, 192, 88, 40, 200, 95, 90, 89, 91, 31, 235,
+    74, 132, 192, 116, 74, 80, 48, 228, 137, 197, 83, 232, 189, 0, 1, 232,
+    131, 211, 0, 232, 232, 0, 91, 88, 114, 57, 235, 59, 182, 254, 6, 184,
+    64, 0, 142, 192, 38, 138, 22, 117, 0, 7, 181, 254, 177, 255, 49, 192,
+    248, 195, 80, 83, 232, 148, 0, 232, 196, 0, 91, 88, 114, 21, 235, 23,
+    235, 21, 180, 3, 232, 206, 0, 135, 209, 248, 195, 180, 170, 249, 195, 180,
+    1, 249, 195, 180, 4, 249, 195, 48, 228, 248, 195, 184, 21, 7, 232, 248,
+    1, 49, 210, 232, 75, 0, 128, 62, 0, 124, 6, 114, 20, 191, 0, 124,
+    185, 8, 0, 161, 0, 124, 131, 199, 2, 59, 5, 225, 249, 116, 2, 235,
+    36, 137, 229, 54, 139, 70, 2, 133, 192, 184, 117, 7, 116, 28, 184, 54,
+    7, 232, 197, 1, 186, 128, 0, 232, 23, 0, 129, 62, 254, 125, 85, 170,
+    184, 91, 7, 117, 5, 234, 0, 124, 0, 0, 232, 172, 1, 251, 244, 235,
+    253, 49, 192, 142, 216, 142, 192, 185, 0, 1, 191, 0, 124, 243, 171, 184,
+    1, 2, 185, 1, 0, 187, 0, 124, 205, 19, 195, 49, 192, 49, 219, 82,
+    81, 82, 136, 200, 36, 192, 209, 224, 209, 224, 136, 232, 185, 255, 0, 247,
+    225, 90, 136, 241, 48, 237, 1, 200, 177, 63, 247, 225, 89, 81, 48, 237,
+    128, 225, 63, 73, 1, 200, 131, 210, 0, 137, 211, 89, 90, 195, 81, 82,
+    232, 18, 0, 57, 211, 114, 10, 119, 4, 57, 200, 114, 4, 249, 90, 89,
+    195, 248, 90, 89, 195, 186, 250, 0, 185, 63, 197, 195, 80, 30, 83, 81,
+    82, 86, 140, 200, 142, 216, 186, 129, 2, 176, 1, 238, 185, 1, 0, 186,
+    160, 134, 180, 134, 205, 21, 186, 128, 2, 176, 255, 185, 10, 0, 238, 226,
+    253, 186, 129, 2, 176, 0, 238, 187, 10, 0, 190, 24, 5, 185, 1, 0,
+    180, 1, 232, 92, 0, 115, 15, 49, 201, 186, 32, 78, 180, 134, 205, 21,
+    75, 117, 231, 249, 235, 52, 190, 30, 5, 185, 5, 0, 180, 1, 232, 64,
+    0, 114, 39, 186, 135, 2, 176, 250, 238, 190, 36, 5, 185, 1, 0, 180,
+    1, 232, 45, 0, 190, 42, 5, 185, 1, 0, 180, 0, 232, 34, 0, 115,
+    9, 186, 135, 2, 236, 132, 192, 116, 224, 249, 94, 90, 89, 91, 31, 114,
+    8, 184, 128, 6, 232, 178, 0, 88, 195, 184, 163, 6, 232, 170, 0, 88,
+    195, 186, 128, 2, 176, 255, 238, 81, 185, 6, 0, 252, 172, 238, 226, 252,
+    185, 8, 0, 236, 60, 255, 225, 251, 89, 56, 224, 118, 3, 249, 235, 4,
+    248, 236, 226, 253, 176, 255, 238, 195, 64, 0, 0, 0, 0, 149, 72, 0,
+    0, 1, 170, 135, 119, 0, 0, 0, 0, 1, 105, 64, 0, 0, 0, 1,
+    232, 14, 0, 185, 8, 0, 236, 60, 255, 225, 251, 132, 192, 116, 1, 249,
+    195, 186, 128, 2, 80, 176, 255, 238, 136, 200, 238, 136, 248, 238, 136, 216,
+    238, 88, 134, 224, 238, 134, 224, 238, 176, 1, 238, 195, 49, 192, 49, 219,
+    177, 76, 232, 220, 255, 236, 185, 16, 0, 236, 168, 128, 224, 251, 117, 4,
+    132, 192, 116, 11, 249, 195, 186, 128, 2, 176, 253, 238, 176, 255, 238, 186,
+    135, 2, 176, 25, 238, 186, 128, 2, 236, 60, 255, 116, 10, 186, 135, 2,
+    236, 132, 192, 116, 240, 249, 195, 248, 195, 156, 30, 83, 86, 137, 198, 140,
+    200, 142, 216, 180, 14, 49, 219, 252, 172, 8, 192, 116, 4, 205, 16, 235,
+    247, 94, 91, 31, 157, 195, 156, 30, 83, 81, 82, 86, 137, 194, 140, 200,
+    142, 216, 49, 219, 252, 137, 214, 177, 12, 211, 238, 131, 230, 15, 138, 132,
+    12, 6, 180, 14, 205, 16, 137, 214, 177, 8, 211, 238, 131, 230, 15, 138,
+    132, 12, 6, 180, 14, 205, 16, 137, 214, 177, 4, 211, 238, 131, 230, 15,
+    138, 132, 12, 6, 180, 14, 205, 16, 137, 214, 131, 230, 15, 138, 132, 12,
+    6, 180, 14, 205, 16, 94, 90, 89, 91, 31, 157, 195, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 65, 66, 67, 68, 69, 70, 58, 0, 32, 0,
+    13, 10, 0, 66, 111, 111, 116, 82, 79, 77, 32, 102, 111, 114, 32, 88,
+    84, 77, 97, 120, 32, 118, 49, 46, 49, 13, 10, 67, 111, 112, 121, 114,
+    105, 103, 104, 116, 32, 40, 99, 41, 32, 50, 48, 50, 53, 32, 77, 97,
+    116, 116, 104, 105, 101, 117, 32, 66, 117, 99, 99, 104, 105, 97, 110, 101,
+    114, 105, 13, 10, 0, 82, 79, 77, 32, 66, 97, 115, 101, 32, 65, 100,
+    100, 114, 101, 115, 115, 32, 32, 32, 32, 32, 32, 32, 32, 61, 32, 0,
+    83, 68, 32, 67, 97, 114, 100, 32, 105, 110, 105, 116, 105, 97, 108, 105,
+    122, 101, 100, 32, 115, 117, 99, 99, 101, 115, 115, 102, 117, 108, 108, 121,
+    13, 10, 0, 83, 68, 32, 67, 97, 114, 100, 32, 102, 97, 105, 108, 101,
+    100, 32, 116, 111, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 13,
+    10, 0, 70, 105, 120, 101, 100, 32, 68, 105, 115, 107, 32, 73, 68, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 61, 32, 0, 84, 111, 116,
+    97, 108, 32, 70, 105, 120, 101, 100, 32, 68, 105, 115, 107, 32, 68, 114,
+    105, 118, 101, 115, 32, 61, 32, 0, 85, 110, 115, 117, 112, 112, 111, 114,
+    116, 101, 100, 32, 73, 78, 84, 49, 51, 104, 32, 70, 117, 110, 99, 116,
+    105, 111, 110, 32, 0, 65, 116, 116, 101, 109, 112, 116, 105, 110, 103, 32,
+    98, 111, 111, 116, 32, 102, 114, 111, 109, 32, 102, 108, 111, 112, 112, 121,
+    46, 46, 46, 13, 10, 0, 65, 116, 116, 101, 109, 112, 116, 105, 110, 103,
+    32, 98, 111, 111, 116, 32, 102, 114, 111, 109, 32, 102, 105, 120, 101, 100,
+    32, 100, 105, 115, 107, 46, 46, 46, 13, 10, 0, 78, 111, 32, 98, 111,
+    111, 116, 97, 98, 108, 101, 32, 109, 101, 100, 105, 97, 32, 102, 111, 117,
+    110, 100, 13, 10, 0, 78, 111, 32, 97, 99, 116, 105, 118, 101, 32, 112,
+    97, 114, 116, 105, 116, 105, 111, 110, 32, 102, 111, 117, 110, 100, 13, 10,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 175};
\ No newline at end of file
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215};
\ No newline at end of file
@@ -0,0 +1,302 @@
+//
+//
+//  File Name   :  emsmove.h
+//  Used on     :  XTMax
+//  Authors     :  Ted Fried, MicroCore Labs
+//                 Matthieu Bucchianeri
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//
+//  EMS Move/Exchange engine for the XTMax, used by EMS function 57h.
+//
+//  The host driver writes a command to MMAN_BASE+8 (0 = reset the parameter pointer, 1 = move, 2 = exchange)
+//  after loading the parameter block one byte at a time through MMAN_BASE+9:
+//
+//    0-3   : Length in bytes
+//    4     : Source type - 0 = conventional memory linear address, 1 = PSRAM address
+//    5-8   : Source address
+//    9     : Destination type
+//    10-13 : Destination address
+//
+//  Handle and logical page translation stays in the driver, which splits a region at
+//  non-contiguous 16KB pages. Each read of MMAN_BASE+8 copies one chunk and returns the
+//  status, so the host polls until it reads EMS_MOVE_IDLE or EMS_MOVE_ERROR.
+//  Conventional memory must be backed by XTMax RAM or the EMS window; motherboard RAM is an
+//  error, which the driver answers by copying the region itself.
+//
+//  The including file provides:
+//
+//    uint8_t * EMS_Move_Internal_RAM(uint32_t address)     XTMax RAM behind a conventional address, or NULL
+//    uint32_t  EMS_Move_Window(uint32_t address)           PSRAM address behind a conventional address in the
+//                                                          EMS window, or EMS_MOVE_PSRAM_SIZE and above
+//    void      PSRAM_Read_Burst(uint32_t address, uint8_t * buffer, uint32_t byte_count)
+//    void      PSRAM_Write_Burst(uint32_t address, const uint8_t * buffer, uint32_t byte_count)
+//
+//  PSRAM transfers never cross an EMS_MOVE_CHUNK boundary.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision, moved out of XTMax.ino
+//
+// Revision 2 10/18/2026
+// Check for overlap where the bytes really are, so a conventional address in the EMS window aliases its PSRAM page
+//
+//------------------------------------------------------------------------
+//
+#include <stdint.h>
+#include <string.h>
+
+#ifndef EMS_MOVE_CHUNK
+#define EMS_MOVE_CHUNK        32        // Bytes copied per status read. Must be a power of two.
+#endif
+#ifndef EMS_MOVE_PSRAM_SIZE
+#define EMS_MOVE_PSRAM_SIZE   (16*1024*1024)
+#endif
+
+#define EMS_MOVE_IDLE         0x00      // Status read from MMAN_BASE+8
+#define EMS_MOVE_BUSY         0x01
+#define EMS_MOVE_ERROR        0x80
+
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+enum MoveTarget {
+  MoveInvalid,
+  MoveInternal,
+  MovePsram
+};
+
+uint8_t   ems_move_param[14];
+uint8_t   ems_move_param_index = 0;
+uint8_t   ems_move_status = EMS_MOVE_IDLE;
+uint8_t   ems_move_exchange = 0;
+uint8_t   ems_move_backward = 0;
+uint8_t   ems_move_src_type = 0;
+uint8_t   ems_move_dst_type = 0;
+uint32_t  ems_move_src = 0;
+uint32_t  ems_move_dst = 0;
+uint32_t  ems_move_remaining = 0;
+
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+inline uint32_t EMS_Move_Min(uint32_t a, uint32_t b) {
+  return (a < b) ? a : b;
+}
+
+inline MoveTarget EMS_Move_Resolve(uint8_t type, uint32_t address, uint8_t ** internal_out, uint32_t * psram_out) {
+  if (type != 0) {
+    *psram_out = address;
+    return (address < EMS_MOVE_PSRAM_SIZE) ? MovePsram : MoveInvalid;
+  }
+  if (address >= 0x100000) {
+    return MoveInvalid;
+  }
+
+  *internal_out = EMS_Move_Internal_RAM(address);
+  if (*internal_out != NULL) {
+    return MoveInternal;
+  }
+  *psram_out = EMS_Move_Window(address);
+  return (*psram_out < EMS_MOVE_PSRAM_SIZE) ? MovePsram : MoveInvalid;
+}
+
+inline bool EMS_Move_Valid(uint8_t type, uint32_t address, uint32_t length) {
+  uint8_t *internal;
+  uint32_t psram;
+
+  if (length == 0) {
+    return true;
+  }
+  if (type != 0) {
+    return address < EMS_MOVE_PSRAM_SIZE && length <= EMS_MOVE_PSRAM_SIZE - address;
+  }
+  if (address >= 0x100000 || length > 0x100000 - address) {
+    return false;
+  }
+  for (uint32_t page = address & ~0x7FF; page < address + length; page += 0x800) {
+    if (EMS_Move_Resolve(type, page < address ? address : page, &internal, &psram) == MoveInvalid) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Where the bytes of a region start, up to the next 2KB page of conventional memory: a PSRAM address, or
+// an XTMax RAM pointer. Returns the byte count of that run.
+//
+inline uint32_t EMS_Move_Run(uint8_t type, uint32_t address, uint32_t length, MoveTarget * target, uintptr_t * start) {
+  uint8_t *internal = 0;
+  uint32_t psram = 0;
+
+  *target = EMS_Move_Resolve(type, address, &internal, &psram);
+  *start  = (*target == MoveInternal) ? (uintptr_t)internal : psram;
+  return (type != 0) ? length : EMS_Move_Min(length, 0x800 - (address & 0x7FF));
+}
+
+// True when the whole region is one run, which is then returned in target and start
+//
+inline bool EMS_Move_Linear(uint8_t type, uint32_t address, uint32_t length, MoveTarget * target, uintptr_t * start) {
+  MoveTarget run_target;
+  uintptr_t  run_start;
+
+  *target = MoveInvalid;
+  for (uint32_t offset = 0; offset < length; ) {
+    const uint32_t run = EMS_Move_Run(type, address + offset, length - offset, &run_target, &run_start);
+    if (offset == 0) {
+      *target = run_target;
+      *start  = run_start;
+    }
+    else if (run_target != *target || run_start != *start + offset) {
+      return false;
+    }
+    offset += run;
+  }
+  return true;
+}
+
+// True when any byte of the source is also a byte of the destination
+//
+inline bool EMS_Move_Alias(uint32_t length) {
+  MoveTarget src_target, dst_target;
+  uintptr_t  src_start, dst_start;
+  uint32_t   src_run, dst_run;
+
+  for (uint32_t src_offset = 0; src_offset < length; src_offset += src_run) {
+    src_run = EMS_Move_Run(ems_move_src_type, ems_move_src + src_offset, length - src_offset, &src_target, &src_start);
+    for (uint32_t dst_offset = 0; dst_offset < length; dst_offset += dst_run) {
+      dst_run = EMS_Move_Run(ems_move_dst_type, ems_move_dst + dst_offset, length - dst_offset, &dst_target, &dst_start);
+      if (src_target == dst_target && src_start < dst_start + dst_run && dst_start < src_start + src_run) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// A chunk never crosses an EMS_MOVE_CHUNK boundary, so it stays within one 2KB page, one PSRAM page and one cache line
+//
+inline void EMS_Move_Read_Chunk(uint8_t type, uint32_t address, uint8_t * buffer, uint32_t byte_count) {
+  uint8_t *internal = 0;
+  uint32_t psram = 0;
+
+  if (EMS_Move_Resolve(type, address, &internal, &psram) == MoveInternal)  memcpy(buffer, internal, byte_count);
+  else                                                                     PSRAM_Read_Burst(psram, buffer, byte_count);
+}
+
+inline void EMS_Move_Write_Chunk(uint8_t type, uint32_t address, const uint8_t * buffer, uint32_t byte_count) {
+  uint8_t *internal = 0;
+  uint32_t psram = 0;
+
+  if (EMS_Move_Resolve(type, address, &internal, &psram) == MoveInternal)  memcpy(internal, buffer, byte_count);
+  else                                                                     PSRAM_Write_Burst(psram, buffer, byte_count);
+}
+
+// Write to MMAN_BASE+9
+//
+inline void EMS_Move_Param(uint8_t data) {
+  if (ems_move_param_index < sizeof(ems_move_param))  ems_move_param[ems_move_param_index++] = data;
+}
+
+// Write to MMAN_BASE+8
+//
+inline void EMS_Move_Start(uint8_t command) {
+  ems_move_param_index = 0;
+
+  if (command != 1 && command != 2) {
+    ems_move_status = EMS_MOVE_IDLE;
+    return;
+  }
+
+  ems_move_remaining = ems_move_param[0] | (ems_move_param[1] << 8) | (ems_move_param[2] << 16) | ((uint32_t)ems_move_param[3] << 24);
+  ems_move_src_type  = ems_move_param[4];
+  ems_move_src       = ems_move_param[5] | (ems_move_param[6] << 8) | (ems_move_param[7] << 16) | ((uint32_t)ems_move_param[8] << 24);
+  ems_move_dst_type  = ems_move_param[9];
+  ems_move_dst       = ems_move_param[10] | (ems_move_param[11] << 8) | (ems_move_param[12] << 16) | ((uint32_t)ems_move_param[13] << 24);
+  ems_move_exchange  = (command == 2);
+
+  if (!EMS_Move_Valid(ems_move_src_type, ems_move_src, ems_move_remaining) ||
+      !EMS_Move_Valid(ems_move_dst_type, ems_move_dst, ems_move_remaining)) {
+    ems_move_status = EMS_MOVE_ERROR;
+    return;
+  }
+
+  // Overlap is checked where the bytes really are - a conventional address in the EMS window is the PSRAM page
+  // mapped there. Overlapping regions are moved from the end when the destination is higher, and cannot be exchanged.
+  // When either region is scattered over non-contiguous pages no single direction is safe, and the driver copies it.
+  MoveTarget src_target, dst_target;
+  uintptr_t  src_start = 0, dst_start = 0;
+
+  ems_move_backward = 0;
+  if (EMS_Move_Linear(ems_move_src_type, ems_move_src, ems_move_remaining, &src_target, &src_start) &&
+      EMS_Move_Linear(ems_move_dst_type, ems_move_dst, ems_move_remaining, &dst_target, &dst_start)) {
+    if (src_target == dst_target &&
+        src_start < dst_start + ems_move_remaining && dst_start < src_start + ems_move_remaining) {
+      if (ems_move_exchange) {
+        ems_move_status = EMS_MOVE_ERROR;
+        return;
+      }
+      if (dst_start > src_start) {
+        ems_move_backward = 1;
+        ems_move_src += ems_move_remaining;
+        ems_move_dst += ems_move_remaining;
+      }
+    }
+  }
+  else if (EMS_Move_Alias(ems_move_remaining)) {
+    ems_move_status = EMS_MOVE_ERROR;
+    return;
+  }
+
+  ems_move_status = (ems_move_remaining == 0) ? EMS_MOVE_IDLE : EMS_MOVE_BUSY;
+}
+
+// Read of MMAN_BASE+8 - copies the next chunk and returns the status
+//
+inline uint8_t EMS_Move_Step() {
+  uint8_t  src_buffer[EMS_MOVE_CHUNK];
+  uint8_t  dst_buffer[EMS_MOVE_CHUNK];
+  uint32_t byte_count;
+  uint32_t src;
+  uint32_t dst;
+
+  if (ems_move_status != EMS_MOVE_BUSY) {
+    return ems_move_status;
+  }
+
+  if (ems_move_backward) {
+    byte_count = EMS_Move_Min(ems_move_remaining, EMS_Move_Min(((ems_move_src-1) & (EMS_MOVE_CHUNK-1)) + 1, ((ems_move_dst-1) & (EMS_MOVE_CHUNK-1)) + 1));
+    src = ems_move_src - byte_count;
+    dst = ems_move_dst - byte_count;
+    ems_move_src = src;
+    ems_move_dst = dst;
+  }
+  else {
+    byte_count = EMS_Move_Min(ems_move_remaining, EMS_Move_Min(EMS_MOVE_CHUNK - (ems_move_src & (EMS_MOVE_CHUNK-1)), EMS_MOVE_CHUNK - (ems_move_dst & (EMS_MOVE_CHUNK-1))));
+    src = ems_move_src;
+    dst = ems_move_dst;
+    ems_move_src += byte_count;
+    ems_move_dst += byte_count;
+  }
+
+  EMS_Move_Read_Chunk(ems_move_src_type, src, src_buffer, byte_count);
+  if (ems_move_exchange) {
+    EMS_Move_Read_Chunk(ems_move_dst_type, dst, dst_buffer, byte_count);
+    EMS_Move_Write_Chunk(ems_move_src_type, src, dst_buffer, byte_count);
+  }
+  EMS_Move_Write_Chunk(ems_move_dst_type, dst, src_buffer, byte_count);
+
+  ems_move_remaining -= byte_count;
+  if (ems_move_remaining == 0) {
+    ems_move_status = EMS_MOVE_IDLE;
+  }
+  return ems_move_status;
+}
@@ -0,0 +1,123 @@
+//
+//
+//  File Name   :  psramcache.h
+//  Used on     :  XTMax, MCLV20_Max
+//  Authors     :  Ted Fried, MicroCore Labs
+//                 Matthieu Bucchianeri
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//
+//  Direct-mapped line cache in front of the Quad SPI PSRAM.
+//
+//  Each line holds PSRAM_LINE_SIZE bytes fetched with a single Quad Read burst, so
+//  the wait states of a miss are paid once per line and the following sequential
+//  reads are served from internal RAM. Writes still go through to the PSRAM; the
+//  including file sends them and calls PSRAM_Cache_Write() or
+//  PSRAM_Cache_Write_Burst() to update the cached copy of the line if present.
+//
+//  The MCLV20_Max sketch includes this file from the XTMax sketch folder.
+//
+//  The including file provides:
+//
+//    void PSRAM_Read_Burst(uint32_t address, uint8_t * buffer, uint32_t byte_count)
+//                                                  One Quad Read, never across a 1KB PSRAM page
+//
+//  and may define PSRAM_CACHE_DATA, the storage attribute for the line data (DMAMEM on the Teensy).
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision, moved out of XTMax.ino and MCLV20_Max.ino
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2024 Ted Fried
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#ifndef PSRAMCACHE_H
+#define PSRAMCACHE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef PSRAM_LINE_SIZE
+#define PSRAM_LINE_SIZE    32       // Bytes per cache line. Must be a power of two and divide the 1KB PSRAM page.
+#endif
+#ifndef PSRAM_CACHE_LINES
+#define PSRAM_CACHE_LINES  128      // Direct-mapped lines. Must be a power of two.
+#endif
+#ifndef PSRAM_CACHE_DATA
+#define PSRAM_CACHE_DATA
+#endif
+
+#define PSRAM_LINE_INVALID 0xFFFFFFFF
+
+
+                 uint32_t psram_line_tag[PSRAM_CACHE_LINES];
+PSRAM_CACHE_DATA uint8_t  psram_line_data[PSRAM_CACHE_LINES][PSRAM_LINE_SIZE];
+
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+inline void PSRAM_Cache_Invalidate() {
+  for (uint32_t i = 0; i < PSRAM_CACHE_LINES; i++) {
+    psram_line_tag[i] = PSRAM_LINE_INVALID;
+  }
+}
+
+inline uint8_t PSRAM_Cache_Read(uint32_t address_in) {
+  const uint32_t line_address = address_in & ~(PSRAM_LINE_SIZE-1);
+  const uint32_t line_index   = (address_in / PSRAM_LINE_SIZE) & (PSRAM_CACHE_LINES-1);
+
+  if (psram_line_tag[line_index] != line_address) {
+    PSRAM_Read_Burst(line_address , psram_line_data[line_index] , PSRAM_LINE_SIZE);
+    psram_line_tag[line_index] = line_address;
+  }
+
+  return psram_line_data[line_index][address_in & (PSRAM_LINE_SIZE-1)];
+}
+
+inline void PSRAM_Cache_Write(uint32_t address_in , uint8_t local_data) {
+  const uint32_t line_index = (address_in / PSRAM_LINE_SIZE) & (PSRAM_CACHE_LINES-1);
+
+  if (psram_line_tag[line_index] == (address_in & ~(PSRAM_LINE_SIZE-1))) {
+    psram_line_data[line_index][address_in & (PSRAM_LINE_SIZE-1)] = local_data;
+  }
+}
+
+// The burst must stay within one cache line
+//
+inline void PSRAM_Cache_Write_Burst(uint32_t address_in , const uint8_t * buffer , uint32_t byte_count) {
+  const uint32_t line_index = (address_in / PSRAM_LINE_SIZE) & (PSRAM_CACHE_LINES-1);
+
+  if (psram_line_tag[line_index] == (address_in & ~(PSRAM_LINE_SIZE-1))) {
+    memcpy(&psram_line_data[line_index][address_in & (PSRAM_LINE_SIZE-1)], buffer, byte_count);
+  }
+}
+
+#endif
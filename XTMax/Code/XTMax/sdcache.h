@@ -0,0 +1,1095 @@
+//
+//
+//  File Name   :  sdcache.h
+//  Used on     :  XTMax
+//  Authors     :  Ted Fried, MicroCore Labs
+//                 Matthieu Bucchianeri
+//  Creation    :  10/18/2026
+//
+//   Description:
+//   ============
+//
+//  SD card sector cache for the XTMax.
+//
+//  The host still talks to what looks like an SD card in SPI mode, one byte at
+//  a time through SD_BASE+0 or the memory mapped data window after the Boot ROM.
+//  Once the host has brought the card out of idle, read and write commands
+//  (CMD17/18/24/25/12) are answered from a sector cache kept in PSRAM instead of
+//  being passed through to the card. Other commands, CMD58 included, are still
+//  passed through.
+//
+//  The cache works in sector numbers. Once the host has initialized the card the
+//  cache reads the card's OCR and CSD itself. For a standard capacity card (CCS=0)
+//  it converts the byte addresses of the host commands to sectors and back, and
+//  read/write commands past the capacity in the CSD get a parameter error R1.
+//
+//  - 4-way set associative with LRU replacement inside each set
+//  - A miss fetches up to SD_CACHE_READ_AHEAD sectors with one CMD18, and
+//    sequential reads keep the read-ahead running in front of the host
+//  - Writes are acknowledged once they are in PSRAM and written back later with
+//    CMD24. Write-back runs while the host is idle, when more than
+//    SD_CACHE_DIRTY_MAX sectors are dirty, and after a host reset (CMD0)
+//  - After a host reset and the write-back, the whole cache is invalidated and
+//    the card itself is reset with CMD0/CMD8. The host's next command goes to the
+//    card again, so the host's own ACMD41 loop brings the card up - which also
+//    covers a card that was swapped or power cycled - before the cache takes over
+//  - A sector the card rejects on write-back is dropped from the cache and
+//    counted in sd_cache_write_errors, so write-back always comes to an end
+//
+//  The card side is a state machine that moves one SPI byte per step, so no
+//  single ISA cycle waits for more than one byte of card traffic.
+//
+//  The including file provides:
+//
+//    uint8_t SD_Card_Transfer(uint8_t data_out)    One SPI byte to and from the card
+//    void    SD_Card_Select(uint8_t cs_n)          Drive the card chip select
+//    void    SD_Cache_Storage_Read(uint32_t offset, uint8_t * buffer, uint32_t byte_count)
+//    void    SD_Cache_Storage_Write(uint32_t offset, const uint8_t * buffer, uint32_t byte_count)
+//
+//  Storage offsets are relative to the start of the cache area and transfers are
+//  SD_CACHE_CHUNK bytes, aligned to SD_CACHE_CHUNK.
+//
+//------------------------------------------------------------------------
+//
+// Modification History:
+// =====================
+//
+// Revision 1 10/18/2026
+// Initial revision
+//
+// Revision 2 10/18/2026
+// Pass CMD58 through to the card and address standard capacity cards in bytes
+//
+// Revision 3 10/18/2026
+// Reject read/write commands past the card capacity and drop sectors the card will not take
+//
+// Revision 4 10/18/2026
+// Invalidate the cache and reset the card after a host reset
+//
+//------------------------------------------------------------------------
+//
+// Copyright (c) 2024 Ted Fried
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//------------------------------------------------------------------------
+
+#ifndef SDCACHE_H
+#define SDCACHE_H
+
+#include <stdint.h>
+
+#ifndef SD_CACHE_SECTORS
+#define SD_CACHE_SECTORS      2048      // 1 MB of PSRAM. Must be a multiple of SD_CACHE_WAYS and the set count a power of two.
+#endif
+#ifndef SD_CACHE_METADATA
+#define SD_CACHE_METADATA                // Storage attribute for the tag arrays, DMAMEM on the Teensy
+#endif
+
+#define SD_CACHE_WAYS         4
+#define SD_CACHE_SETS         (SD_CACHE_SECTORS / SD_CACHE_WAYS)
+#define SD_CACHE_READ_AHEAD   16        // Sectors fetched with one CMD18
+#define SD_CACHE_DIRTY_MAX    64        // Host writes stay busy until write-back brings the count back under this
+#define SD_CACHE_CHUNK        32        // Bytes per storage transfer
+#define SD_SECTOR_SIZE        512
+
+#define SD_CARD_R1_POLLS      16
+#define SD_CARD_TOKEN_POLLS   0x40000   // SPI bytes to wait for a data token
+#define SD_CARD_BUSY_POLLS    0x100000  // SPI bytes to wait for the end of a write
+
+#define SD_SLOT_VALID         0x01
+#define SD_SLOT_DIRTY         0x02
+#define SD_SLOT_FILLING       0x04      // Being read from the card or written by the host
+#define SD_SLOT_AGE_SHIFT     4
+#define SD_SLOT_AGE_MASK      0x30
+
+#define SD_NO_LBA             0xFFFFFFFF
+
+
+// --------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------
+
+enum SdCardState {
+  CardIdle,
+  CardCommand,
+  CardResponse,
+  CardOcrCommand,
+  CardOcrResponse,
+  CardOcrData,
+  CardCsdCommand,
+  CardCsdResponse,
+  CardCsdToken,
+  CardCsdData,
+  CardReadToken,
+  CardReadData,
+  CardReadCrc,
+  CardStopCommand,
+  CardStopResponse,
+  CardWriteToken,
+  CardWriteData,
+  CardWriteCrc,
+  CardWriteResponse,
+  CardBusy,
+  CardResetClocks,
+  CardResetCommand,
+  CardResetResponse,
+  CardResetData
+};
+
+enum SdHostState {
+  HostIdle,
+  HostFrame,
+  HostPass,
+  HostReadWait,
+  HostReadData,
+  HostReadCrc,
+  HostWriteToken,
+  HostWriteData,
+  HostWriteCrc,
+  HostWriteResponse,
+  HostWriteBusy
+};
+
+SD_CACHE_METADATA uint32_t sd_cache_lba[SD_CACHE_SECTORS];
+SD_CACHE_METADATA uint8_t  sd_cache_state[SD_CACHE_SECTORS];
+
+uint8_t   sd_cache_ready = 0;            // Host has initialized the card, read/write commands are served from the cache
+uint8_t   sd_cache_flush_all = 0;        // Host sent CMD0, write back everything and reset the card before reporting ready
+uint8_t   sd_cache_reset_done = 0;       // Card was reset, give it back to the host at the next command
+uint32_t  sd_cache_dirty_count = 0;
+uint32_t  sd_cache_write_errors = 0;     // Dirty sectors dropped because the card rejected them
+uint32_t  sd_cache_flush_scan = 0;
+uint32_t  sd_cache_ahead_lba = SD_NO_LBA;
+uint32_t  sd_cache_ahead_count = 0;
+
+SdCardState sd_card_state = CardIdle;
+uint8_t   sd_card_writing = 0;
+uint8_t   sd_card_stop_request = 0;
+uint8_t   sd_card_frame[7];
+uint8_t   sd_card_chunk[SD_CACHE_CHUNK];
+int32_t   sd_card_slot = -1;
+uint32_t  sd_card_lba = 0;
+uint32_t  sd_card_count = 0;
+uint32_t  sd_card_index = 0;
+uint32_t  sd_card_polls = 0;
+uint32_t  sd_card_error_lba = SD_NO_LBA;
+uint8_t   sd_card_identified = 0;          // OCR and CSD have been read since the host initialized the card
+uint8_t   sd_card_block_addressed = 1;     // OCR CCS bit - 0 means read/write arguments are byte addresses
+uint32_t  sd_card_sectors = SD_NO_LBA;     // Capacity from the CSD, SD_NO_LBA when unknown
+
+SdHostState sd_host_state = HostIdle;
+uint8_t   sd_host_frame[6];
+uint8_t   sd_host_frame_index = 0;
+uint8_t   sd_host_app_command = 0;
+uint8_t   sd_host_multi = 0;
+uint8_t   sd_host_response[5];
+uint8_t   sd_host_response_count = 0;
+uint8_t   sd_host_response_index = 0;
+uint8_t   sd_host_chunk[SD_CACHE_CHUNK];
+uint8_t   sd_host_sector[SD_SECTOR_SIZE];
+int32_t   sd_host_slot = -1;                // Slot being streamed to or committed from the host, never evicted
+uint32_t  sd_host_lba = 0;
+uint32_t  sd_host_last_lba = SD_NO_LBA;
+uint32_t  sd_host_index = 0;
+
+
+// --------------------------------------------------------------------------------------------------
+// Sector tags
+// --------------------------------------------------------------------------------------------------
+
+inline void SD_Cache_Init() {
+  for (uint32_t i = 0; i < SD_CACHE_SECTORS; i++) {
+    sd_cache_lba[i]   = SD_NO_LBA;
+    sd_cache_state[i] = (SD_CACHE_WAYS-1) << SD_SLOT_AGE_SHIFT;
+  }
+  sd_cache_dirty_count = 0;
+}
+
+inline int32_t SD_Cache_Lookup(uint32_t lba) {
+  const uint32_t base = (lba & (SD_CACHE_SETS-1)) * SD_CACHE_WAYS;
+  for (uint32_t way = 0; way < SD_CACHE_WAYS; way++) {
+    if ((sd_cache_state[base+way] & (SD_SLOT_VALID|SD_SLOT_FILLING)) && sd_cache_lba[base+way] == lba) {
+      return base + way;
+    }
+  }
+  return -1;
+}
+
+// Make slot the most recently used of its set
+//
+inline void SD_Cache_Touch(int32_t slot) {
+  const uint32_t base = slot - (slot % SD_CACHE_WAYS);
+  const uint8_t  age  = sd_cache_state[slot] & SD_SLOT_AGE_MASK;
+  for (uint32_t way = base; way < base + SD_CACHE_WAYS; way++) {
+    if ((sd_cache_state[way] & SD_SLOT_AGE_MASK) < age) {
+      sd_cache_state[way] += 1 << SD_SLOT_AGE_SHIFT;
+    }
+  }
+  sd_cache_state[slot] &= ~SD_SLOT_AGE_MASK;
+}
+
+// Claim a clean slot for lba and mark it FILLING. Returns -1 when every usable way in the set is dirty,
+// in which case *victim is the least recently used dirty slot that can be written back.
+//
+inline int32_t SD_Cache_Allocate(uint32_t lba, int32_t * victim) {
+  const uint32_t base = (lba & (SD_CACHE_SETS-1)) * SD_CACHE_WAYS;
+  int32_t clean = -1;
+  int32_t dirty = -1;
+
+  for (uint32_t slot = base; slot < base + SD_CACHE_WAYS; slot++) {
+    const uint8_t state = sd_cache_state[slot];
+    if ((state & SD_SLOT_FILLING) || (int32_t)slot == sd_host_slot) {
+      continue;
+    }
+    if (!(state & SD_SLOT_VALID)) {
+      clean = slot;
+      break;
+    }
+    if (state & SD_SLOT_DIRTY) {
+      if (dirty < 0 || (state & SD_SLOT_AGE_MASK) > (sd_cache_state[dirty] & SD_SLOT_AGE_MASK))  dirty = slot;
+    }
+    else {
+      if (clean < 0 || (state & SD_SLOT_AGE_MASK) > (sd_cache_state[clean] & SD_SLOT_AGE_MASK))  clean = slot;
+    }
+  }
+
+  *victim = dirty;
+  if (clean >= 0) {
+    sd_cache_lba[clean]   = lba;
+    sd_cache_state[clean] = (sd_cache_state[clean] & SD_SLOT_AGE_MASK) | SD_SLOT_FILLING;
+  }
+  return clean;
+}
+
+inline int32_t SD_Cache_Find_Dirty() {
+  for (uint32_t i = 0; i < SD_CACHE_SECTORS; i++) {
+    const uint32_t slot = (sd_cache_flush_scan + i) & (SD_CACHE_SECTORS-1);
+    if ((sd_cache_state[slot] & (SD_SLOT_DIRTY|SD_SLOT_FILLING)) == SD_SLOT_DIRTY && (int32_t)slot != sd_host_slot) {
+      sd_cache_flush_scan = slot + 1;
+      return slot;
+    }
+  }
+  return -1;
+}
+
+
+// --------------------------------------------------------------------------------------------------
+// Card side - one SPI byte per call to SD_Card_Step()
+// --------------------------------------------------------------------------------------------------
+
+inline void SD_Card_Frame(uint8_t command, uint32_t lba) {
+  sd_card_frame[0] = 0xFF;
+  sd_card_frame[1] = 0x40 | command;
+  sd_card_frame[2] = lba >> 24;
+  sd_card_frame[3] = lba >> 16;
+  sd_card_frame[4] = lba >> 8;
+  sd_card_frame[5] = lba;
+  sd_card_frame[6] = 0x01;              // CRC is not checked in SPI mode
+  sd_card_index    = 0;
+  sd_card_polls    = 0;
+  sd_card_state    = CardCommand;
+}
+
+// Read/write command argument for a sector
+//
+inline uint32_t SD_Card_Address(uint32_t lba) {
+  return sd_card_block_addressed ? lba : lba << 9;
+}
+
+inline void SD_Card_Release() {
+  SD_Card_Select(1);
+  SD_Card_Transfer(0xFF);
+  sd_card_slot  = -1;
+  sd_card_state = CardIdle;
+}
+
+// Read count sectors starting at lba. Returns 0 without touching the card when the first sector has no clean slot.
+//
+inline uint8_t SD_Card_Start_Read(uint32_t lba, uint32_t count, int32_t * victim) {
+  const int32_t slot = SD_Cache_Allocate(lba, victim);
+  if (slot < 0) {
+    return 0;
+  }
+  sd_card_writing      = 0;
+  sd_card_stop_request = 0;
+  sd_card_slot         = slot;
+  sd_card_lba          = lba;
+  sd_card_count        = count;
+  SD_Card_Select(0);
+  SD_Card_Frame(18, SD_Card_Address(lba));
+  return 1;
+}
+
+inline void SD_Card_Start_Write(int32_t slot) {
+  sd_card_writing      = 1;
+  sd_card_stop_request = 0;
+  sd_card_slot         = slot;
+  sd_card_lba          = sd_cache_lba[slot];
+  sd_cache_state[slot] |= SD_SLOT_FILLING;    // Keep the host from rewriting it while it is sent
+  SD_Card_Select(0);
+  SD_Card_Frame(24, SD_Card_Address(sd_card_lba));
+}
+
+// Read the OCR with CMD58, then the CSD with CMD9
+//
+inline void SD_Card_Start_Identify() {
+  sd_card_writing = 0;
+  SD_Card_Select(0);
+  SD_Card_Frame(58, 0);
+  sd_card_state = CardOcrCommand;
+}
+
+// Sector count from the CSD in sd_card_chunk
+//
+inline void SD_Card_Csd_Capacity() {
+  const uint8_t * csd = sd_card_chunk;
+  if ((csd[0] >> 6) == 1) {                               // CSD version 2.0 - C_SIZE counts 512 KB units
+    const uint32_t c_size = ((uint32_t)(csd[7] & 0x3F) << 16) | ((uint32_t)csd[8] << 8) | csd[9];
+    sd_card_sectors = (c_size + 1) << 10;
+  }
+  else {                                                  // CSD version 1.0 - (C_SIZE+1) * 2^(C_SIZE_MULT+2) blocks of 2^READ_BL_LEN bytes
+    const uint32_t read_bl_len = csd[5] & 0x0F;
+    const uint32_t c_size      = ((uint32_t)(csd[6] & 0x03) << 10) | ((uint32_t)csd[7] << 2) | (csd[8] >> 6);
+    const uint32_t c_size_mult = ((csd[9] & 0x03) << 1) | (csd[10] >> 7);
+    sd_card_sectors = ((c_size + 1) << (c_size_mult + 2)) << (read_bl_len - 9);
+  }
+}
+
+// Card reset after a host reset: 80 clocks with chip select high, CMD0, then CMD8
+//
+inline void SD_Card_Start_Reset() {
+  sd_card_writing = 0;
+  sd_card_index   = 0;
+  SD_Card_Select(1);
+  sd_card_state   = CardResetClocks;
+}
+
+inline void SD_Card_Reset_Command(uint8_t command, uint32_t arg, uint8_t crc) {
+  SD_Card_Frame(command, arg);
+  sd_card_frame[6] = crc;                     // CMD0 and CMD8 are checked before the card is in SPI mode
+  sd_card_state    = CardResetCommand;
+}
+
+// Nothing cached can be trusted once the card may have been swapped
+//
+inline void SD_Card_Reset_Done() {
+  SD_Card_Release();
+  SD_Cache_Init();
+  sd_cache_ahead_count = 0;
+  sd_card_error_lba    = SD_NO_LBA;
+  sd_card_identified   = 0;
+  sd_card_sectors      = SD_NO_LBA;
+  sd_cache_reset_done  = 1;                   // sd_cache_flush_all stays set so CMD55/ACMD41 keep answering idle until the handover
+}
+
+inline void SD_Card_Stop_Read() {
+  SD_Card_Frame(12, 0);
+  sd_card_index = 1;                          // No gap byte, the stop command interrupts the data stream
+  sd_card_state = CardStopCommand;
+}
+
+inline void SD_Card_Read_Failed() {
+  if (sd_card_slot >= 0) {
+    sd_cache_state[sd_card_slot] &= SD_SLOT_AGE_MASK;
+    sd_card_slot = -1;
+  }
+  sd_card_error_lba = sd_card_lba;
+  SD_Card_Stop_Read();
+}
+
+// The card rejected a write-back. Retrying would keep the sector dirty forever and a flush would never
+// end, so the sector is dropped and counted instead.
+//
+inline void SD_Card_Write_Failed() {
+  sd_cache_state[sd_card_slot] &= SD_SLOT_AGE_MASK;
+  sd_cache_dirty_count--;
+  sd_cache_write_errors++;
+}
+
+inline void SD_Card_Write_Done(uint8_t success) {
+  if (success) {
+    sd_cache_state[sd_card_slot] &= ~(SD_SLOT_FILLING|SD_SLOT_DIRTY);
+    sd_cache_dirty_count--;
+  }
+  else {
+    SD_Card_Write_Failed();
+  }
+  sd_card_polls = 0;
+  sd_card_state = CardBusy;
+}
+
+inline void SD_Card_Step() {
+  uint8_t data_in;
+
+  switch (sd_card_state) {
+    case CardIdle:
+      break;
+
+    case CardCommand:
+    case CardOcrCommand:
+    case CardCsdCommand:
+    case CardStopCommand:
+    case CardResetCommand:
+      SD_Card_Transfer(sd_card_frame[sd_card_index++]);
+      if (sd_card_index == sizeof(sd_card_frame)) {
+        sd_card_polls = 0;
+        if      (sd_card_state == CardCommand)       sd_card_state = CardResponse;
+        else if (sd_card_state == CardOcrCommand)    sd_card_state = CardOcrResponse;
+        else if (sd_card_state == CardCsdCommand)    sd_card_state = CardCsdResponse;
+        else if (sd_card_state == CardResetCommand)  sd_card_state = CardResetResponse;
+        else                                         sd_card_state = CardStopResponse;
+      }
+      break;
+
+    case CardOcrResponse:
+      data_in = SD_Card_Transfer(0xFF);
+      if (data_in == 0xFF && ++sd_card_polls < SD_CARD_R1_POLLS)  break;
+      if (data_in != 0x00) {                              // Only version 1 cards lack CMD58, and those are all byte addressed
+        sd_card_block_addressed = 0;
+        SD_Card_Frame(9, 0);
+        sd_card_state = CardCsdCommand;
+        break;
+      }
+      sd_card_index = 0;
+      sd_card_state = CardOcrData;
+      break;
+
+    case CardOcrData:
+      data_in = SD_Card_Transfer(0xFF);
+      if (sd_card_index++ == 0) {
+        sd_card_block_addressed = (data_in & 0x40) != 0;
+      }
+      if (sd_card_index == 4) {
+        SD_Card_Frame(9, 0);
+        sd_card_state = CardCsdCommand;
+      }
+      break;
+
+    case CardCsdResponse:
+      data_in = SD_Card_Transfer(0xFF);
+      if (data_in == 0xFF && ++sd_card_polls < SD_CARD_R1_POLLS)  break;
+      sd_card_polls = 0;
+      if (data_in == 0x00) {
+        sd_card_state = CardCsdToken;
+        break;
+      }
+      sd_card_identified = 1;                             // No CSD, leave the capacity unknown
+      SD_Card_Release();
+      break;
+
+    case CardCsdToken:
+      data_in = SD_Card_Transfer(0xFF);
+      if (data_in == 0xFE) {
+        sd_card_index = 0;
+        sd_card_state = CardCsdData;
+      }
+      else if (data_in != 0xFF || ++sd_card_polls > SD_CARD_TOKEN_POLLS) {
+        sd_card_identified = 1;
+        SD_Card_Release();
+      }
+      break;
+
+    case CardCsdData:
+      sd_card_chunk[sd_card_index++] = SD_Card_Transfer(0xFF);
+      if (sd_card_index < 18)  break;                     // 16 bytes of CSD and two CRC bytes
+      SD_Card_Csd_Capacity();
+      sd_card_identified = 1;
+      SD_Card_Release();
+      break;
+
+    case CardResponse:
+      data_in = SD_Card_Transfer(0xFF);
+      if (data_in == 0xFF) {
+        if (++sd_card_polls < SD_CARD_R1_POLLS)  break;
+      }
+      if (data_in != 0x00) {                              // No response or an error - give up on this operation
+        if (sd_card_writing)  { SD_Card_Write_Failed(); }
+        else                  { sd_cache_state[sd_card_slot] &= SD_SLOT_AGE_MASK; sd_card_error_lba = sd_card_lba; }
+        SD_Card_Release();
+        break;
+      }
+      sd_card_index = 0;
+      sd_card_polls = 0;
+      sd_card_state = sd_card_writing ? CardWriteToken : CardReadToken;
+      break;
+
+    case CardReadToken:
+      data_in = SD_Card_Transfer(0xFF);
+      if (data_in == 0xFE) {
+        sd_card_index = 0;
+        sd_card_state = CardReadData;
+      }
+      else if (data_in != 0xFF || ++sd_card_polls > SD_CARD_TOKEN_POLLS) {
+        SD_Card_Read_Failed();
+      }
+      break;
+
+    case CardReadData:
+      sd_card_chunk[sd_card_index & (SD_CACHE_CHUNK-1)] = SD_Card_Transfer(0xFF);
+      sd_card_index++;
+      if ((sd_card_index & (SD_CACHE_CHUNK-1)) == 0) {
+        SD_Cache_Storage_Write(sd_card_slot*SD_SECTOR_SIZE + sd_card_index - SD_CACHE_CHUNK, sd_card_chunk, SD_CACHE_CHUNK);
+      }
+      if (sd_card_index == SD_SECTOR_SIZE) {
+        sd_card_index = 0;
+        sd_card_state = CardReadCrc;
+      }
+      break;
+
+    case CardReadCrc:
+      SD_Card_Transfer(0xFF);
+      if (++sd_card_index < 2)  break;
+
+      sd_cache_state[sd_card_slot] = (sd_cache_state[sd_card_slot] & SD_SLOT_AGE_MASK) | SD_SLOT_VALID;
+      SD_Cache_Touch(sd_card_slot);
+      sd_card_slot = -1;
+      sd_card_lba++;
+      sd_card_count--;
+
+      // Keep streaming while there is a clean slot for the next sector and nobody asked to stop
+      if (sd_card_count != 0 && !sd_card_stop_request && SD_Cache_Lookup(sd_card_lba) < 0) {
+        int32_t victim;
+        sd_card_slot = SD_Cache_Allocate(sd_card_lba, &victim);
+      }
+      if (sd_card_slot < 0) {
+        SD_Card_Stop_Read();
+        break;
+      }
+      sd_card_polls = 0;
+      sd_card_state = CardReadToken;
+      break;
+
+    case CardStopResponse:
+      data_in = SD_Card_Transfer(0xFF);                   // The first byte after CMD12 is a stuff byte
+      if ((data_in == 0xFF || sd_card_polls == 0) && ++sd_card_polls < SD_CARD_R1_POLLS)  break;
+      sd_card_polls = 0;
+      sd_card_state = CardBusy;
+      break;
+
+    case CardWriteToken:
+      SD_Card_Transfer(sd_card_index == 0 ? 0xFF : 0xFE);
+      if (++sd_card_index == 2) {
+        sd_card_index = 0;
+        sd_card_state = CardWriteData;
+      }
+      break;
+
+    case CardWriteData:
+      if ((sd_card_index & (SD_CACHE_CHUNK-1)) == 0) {
+        SD_Cache_Storage_Read(sd_card_slot*SD_SECTOR_SIZE + sd_card_index, sd_card_chunk, SD_CACHE_CHUNK);
+      }
+      SD_Card_Transfer(sd_card_chunk[sd_card_index & (SD_CACHE_CHUNK-1)]);
+      if (++sd_card_index == SD_SECTOR_SIZE) {
+        sd_card_index = 0;
+        sd_card_state = CardWriteCrc;
+      }
+      break;
+
+    case CardWriteCrc:
+      SD_Card_Transfer(0xFF);
+      if (++sd_card_index == 2) {
+        sd_card_polls = 0;
+        sd_card_state = CardWriteResponse;
+      }
+      break;
+
+    case CardWriteResponse:
+      data_in = SD_Card_Transfer(0xFF);
+      if (data_in == 0xFF && ++sd_card_polls < SD_CARD_R1_POLLS)  break;
+      SD_Card_Write_Done((data_in & 0x1F) == 0x05);
+      break;
+
+    case CardBusy:
+      data_in = SD_Card_Transfer(0xFF);
+      if (data_in == 0x00 && ++sd_card_polls < SD_CARD_BUSY_POLLS)  break;
+      SD_Card_Release();
+      break;
+
+    case CardResetClocks:
+      SD_Card_Transfer(0xFF);
+      if (++sd_card_index < 10)  break;
+      SD_Card_Select(0);
+      SD_Card_Reset_Command(0, 0, 0x95);
+      break;
+
+    case CardResetResponse:
+      data_in = SD_Card_Transfer(0xFF);
+      if (data_in == 0xFF && ++sd_card_polls < SD_CARD_R1_POLLS)  break;
+      if (sd_card_frame[1] == (0x40|0) && data_in == 0x01) {
+        SD_Card_Reset_Command(8, 0x1AA, 0x87);
+      }
+      else if (sd_card_frame[1] == (0x40|8) && data_in == 0x01) {
+        sd_card_index = 0;                                // R7 - version 2 card, four more bytes
+        sd_card_state = CardResetData;
+      }
+      else {                                              // No card, or a version 1 card that has no CMD8
+        SD_Card_Reset_Done();
+      }
+      break;
+
+    case CardResetData:
+      SD_Card_Transfer(0xFF);
+      if (++sd_card_index == 4) {
+        SD_Card_Reset_Done();
+      }
+      break;
+  }
+}
+
+
+// --------------------------------------------------------------------------------------------------
+// Scheduling
+// --------------------------------------------------------------------------------------------------
+
+// Advance the card by one byte, or start the next write-back or read-ahead when it is idle.
+// host_idle allows write-back of dirty sectors even while under SD_CACHE_DIRTY_MAX.
+//
+inline void SD_Cache_Service(uint8_t host_idle) {
+  int32_t slot;
+
+  if (sd_card_state != CardIdle) {
+    SD_Card_Step();
+    return;
+  }
+
+  if (sd_cache_reset_done) {                              // The card waits for the host to initialize it
+    return;
+  }
+
+  if (!sd_card_identified) {
+    SD_Card_Start_Identify();
+    return;
+  }
+
+  if (sd_cache_dirty_count != 0 && (host_idle || sd_cache_flush_all || sd_cache_dirty_count > SD_CACHE_DIRTY_MAX)) {
+    slot = SD_Cache_Find_Dirty();
+    if (slot >= 0) {
+      SD_Card_Start_Write(slot);
+      return;
+    }
+  }
+  if (sd_cache_flush_all && sd_cache_dirty_count == 0) {
+    SD_Card_Start_Reset();
+    return;
+  }
+
+  while (sd_cache_ahead_count != 0 && SD_Cache_Lookup(sd_cache_ahead_lba) >= 0) {
+    sd_cache_ahead_lba++;
+    sd_cache_ahead_count--;
+  }
+  if (sd_cache_ahead_count != 0) {
+    if (!SD_Card_Start_Read(sd_cache_ahead_lba, sd_cache_ahead_count, &slot) && slot >= 0) {
+      SD_Card_Start_Write(slot);                          // Make room in the set first
+      return;
+    }
+    sd_cache_ahead_count = 0;
+  }
+}
+
+// Called from the main loop while the host is not using the card
+//
+inline void SD_Cache_Background() {
+  if (sd_cache_ready && sd_host_state != HostPass) {
+    SD_Cache_Service(1);
+  }
+}
+
+inline uint8_t SD_Cache_Background_Pending() {
+  if (!sd_cache_ready || sd_host_state == HostPass) {
+    return 0;
+  }
+  return sd_card_state != CardIdle || sd_cache_dirty_count != 0 || sd_cache_ahead_count != 0 || (sd_cache_flush_all && !sd_cache_reset_done);
+}
+
+
+// --------------------------------------------------------------------------------------------------
+// Host side - emulates the card responses for the commands the cache handles
+// --------------------------------------------------------------------------------------------------
+
+inline void SD_Host_Respond(uint8_t byte_count, uint8_t r0, uint8_t r1 = 0, uint8_t r2 = 0, uint8_t r3 = 0, uint8_t r4 = 0) {
+  sd_host_response[0] = r0;
+  sd_host_response[1] = r1;
+  sd_host_response[2] = r2;
+  sd_host_response[3] = r3;
+  sd_host_response[4] = r4;
+  sd_host_response_count = byte_count;
+  sd_host_response_index = 0;
+}
+
+// Wait for the card side to finish what it is doing, used before handing the card to the host
+//
+inline void SD_Host_Drain_Card() {
+  sd_card_stop_request = 1;
+  while (sd_card_state != CardIdle) {
+    SD_Card_Step();
+  }
+}
+
+// Read and write commands need the card's addressing mode and capacity, which are normally known by the time they come
+//
+inline void SD_Host_Wait_Identify() {
+  SD_Host_Drain_Card();
+  if (!sd_card_identified) {
+    SD_Card_Start_Identify();
+    SD_Host_Drain_Card();
+  }
+}
+
+// Start a host read or write at the sector of a CMD17/18/24/25 argument, or answer a parameter error when it is past the end of the card
+//
+inline void SD_Host_Start_Transfer(uint32_t arg, uint8_t multi, SdHostState state) {
+  SD_Host_Wait_Identify();
+  sd_host_lba = sd_card_block_addressed ? arg : arg >> 9;
+  if (sd_host_lba >= sd_card_sectors) {
+    SD_Host_Respond(1, 0x40);
+    return;
+  }
+  sd_host_multi = multi;
+  sd_host_state = state;
+  SD_Host_Respond(1, 0x00);
+}
+
+inline void SD_Host_End_Pass() {
+  if (sd_host_state == HostPass) {
+    SD_Card_Select(1);
+    SD_Card_Transfer(0xFF);
+    sd_host_state = HostIdle;
+  }
+}
+
+inline void SD_Host_Command() {
+  const uint8_t  command = sd_host_frame[0] & 0x3F;
+  const uint32_t arg     = ((uint32_t)sd_host_frame[1] << 24) | ((uint32_t)sd_host_frame[2] << 16) | (sd_host_frame[3] << 8) | sd_host_frame[4];
+  const uint8_t  app     = sd_host_app_command;
+
+  sd_host_app_command = 0;
+  sd_host_state       = HostIdle;
+
+  switch (command) {
+    case 0:                                               // GO_IDLE_STATE - the host was reset, flush and reset the card before reporting ready
+      sd_cache_flush_all  = 1;
+      sd_cache_reset_done = 0;
+      SD_Host_Respond(1, 0x01);
+      break;
+    case 8:                                               // SEND_IF_COND - echo the check pattern
+      SD_Host_Respond(5, 0x01, 0x00, 0x00, (arg >> 8) & 0x0F, arg);
+      break;
+    case 55:                                              // APP_CMD
+      sd_host_app_command = 1;
+      SD_Host_Respond(1, sd_cache_flush_all ? 0x01 : 0x00);
+      break;
+    case 16:                                              // SET_BLOCKLEN - always 512
+      SD_Host_Respond(1, 0x00);
+      break;
+    case 12:                                              // STOP_TRANSMISSION - stuff byte, R1, never busy
+      SD_Host_Respond(2, 0xFF, 0x00);
+      break;
+    case 17:
+    case 18:
+      SD_Host_Start_Transfer(arg, command == 18, HostReadWait);
+      break;
+    case 24:
+    case 25:
+      SD_Host_Start_Transfer(arg, command == 25, HostWriteToken);
+      break;
+    default:
+      if (app && command == 41) {                         // SD_SEND_OP_COND - idle until the card is handed back to the host
+        SD_Host_Respond(1, sd_cache_flush_all ? 0x01 : 0x00);
+        break;
+      }
+      SD_Host_Drain_Card();                               // Anything else goes to the card as is
+      SD_Card_Select(0);
+      SD_Card_Transfer(0xFF);
+      for (uint32_t i = 0; i < sizeof(sd_host_frame); i++) {
+        SD_Card_Transfer(sd_host_frame[i]);
+      }
+      sd_host_response_count = 0;
+      sd_host_state = HostPass;
+      break;
+  }
+}
+
+inline uint8_t SD_Host_Read_Wait() {
+  int32_t slot = SD_Cache_Lookup(sd_host_lba);
+  int32_t victim;
+
+  if (slot >= 0 && (sd_cache_state[slot] & SD_SLOT_VALID) && !(sd_cache_state[slot] & SD_SLOT_FILLING)) {
+    SD_Cache_Touch(slot);
+    sd_host_slot  = slot;
+    sd_host_index = 0;
+    sd_host_state = HostReadData;
+
+    // Sequential reads keep the read-ahead window in front of the host
+    if (sd_host_multi || sd_host_lba == sd_host_last_lba + 1) {
+      sd_cache_ahead_lba   = sd_host_lba + 1;
+      sd_cache_ahead_count = SD_CACHE_READ_AHEAD;
+    }
+    sd_host_last_lba = sd_host_lba;
+    return 0xFE;                                          // Data token
+  }
+
+  if (sd_host_lba >= sd_card_sectors) {                   // A multiple block read ran off the end of the card
+    sd_host_state = HostIdle;
+    return 0x08;                                          // Out of range error token
+  }
+
+  if (slot < 0) {
+    if (sd_card_error_lba == sd_host_lba) {
+      sd_card_error_lba = SD_NO_LBA;
+      sd_host_state = HostIdle;
+      return 0x01;                                        // Error token
+    }
+    if (sd_card_state == CardIdle) {
+      const uint32_t count = (sd_host_multi || sd_host_lba == sd_host_last_lba + 1) ? SD_CACHE_READ_AHEAD : 1;
+      sd_cache_ahead_count = 0;
+      if (!SD_Card_Start_Read(sd_host_lba, count, &victim) && victim >= 0) {
+        SD_Card_Start_Write(victim);
+      }
+    }
+    else if (!sd_card_writing && sd_card_lba != sd_host_lba) {
+      sd_card_stop_request = 1;                           // The read-ahead went somewhere else, get it out of the way
+    }
+  }
+  return 0xFF;
+}
+
+// Move the received sector into the cache. Returns 1 once it is committed and the dirty limit allows the host to go on.
+//
+inline uint8_t SD_Host_Write_Commit() {
+  int32_t victim;
+
+  if (sd_host_slot < 0) {
+    if (sd_card_state != CardIdle) {                      // Let the card side finish so it cannot touch the sector underneath us
+      sd_card_stop_request = 1;
+      return 0;
+    }
+    sd_host_slot = SD_Cache_Lookup(sd_host_lba);
+    if (sd_host_slot >= 0) {
+      sd_cache_state[sd_host_slot] |= SD_SLOT_FILLING;
+    }
+    else {
+      sd_host_slot = SD_Cache_Allocate(sd_host_lba, &victim);
+      if (sd_host_slot < 0) {
+        if (victim >= 0)  SD_Card_Start_Write(victim);
+        return 0;
+      }
+    }
+    sd_host_index = 0;
+  }
+
+  if (sd_host_index < SD_SECTOR_SIZE) {
+    SD_Cache_Storage_Write(sd_host_slot*SD_SECTOR_SIZE + sd_host_index, &sd_host_sector[sd_host_index], SD_CACHE_CHUNK);
+    sd_host_index += SD_CACHE_CHUNK;
+    if (sd_host_index == SD_SECTOR_SIZE) {
+      if (!(sd_cache_state[sd_host_slot] & SD_SLOT_DIRTY))  sd_cache_dirty_count++;
+      sd_cache_state[sd_host_slot] = (sd_cache_state[sd_host_slot] & SD_SLOT_AGE_MASK) | SD_SLOT_VALID | SD_SLOT_DIRTY;
+      SD_Cache_Touch(sd_host_slot);
+    }
+    return 0;
+  }
+
+  return sd_cache_dirty_count <= SD_CACHE_DIRTY_MAX;
+}
+
+// The host chip select. Deselecting ends any transfer in progress.
+//
+inline void SD_Cache_Host_Select(uint8_t cs_n) {
+  if (!sd_cache_ready) {
+    SD_Card_Select(cs_n);
+    return;
+  }
+  if (cs_n) {
+    SD_Host_End_Pass();
+    if (sd_host_state == HostWriteBusy) {
+      while (!SD_Host_Write_Commit()) {
+        SD_Cache_Service(0);
+      }
+    }
+    sd_host_slot  = -1;
+    sd_host_state = HostIdle;
+    sd_host_response_count = 0;
+  }
+}
+
+// Before the host has initialized the card every byte goes through. Watch for ACMD41 reporting ready.
+//
+inline uint8_t SD_Host_Pass_Through(uint8_t data_out) {
+  const uint8_t data_in = SD_Card_Transfer(data_out);
+
+  if (sd_host_frame_index != 0 && sd_host_frame_index < sizeof(sd_host_frame)) {
+    sd_host_frame[sd_host_frame_index++] = data_out;
+  }
+  else if ((data_out & 0xC0) == 0x40) {                  // Start of a command, also when the last one got no response
+    sd_host_frame[0]    = data_out;
+    sd_host_frame_index = 1;
+  }
+  else if (sd_host_frame_index == sizeof(sd_host_frame) && data_in != 0xFF) {
+    const uint8_t command = sd_host_frame[0] & 0x3F;
+    if (sd_host_app_command && command == 41 && data_in == 0x00) {
+      sd_cache_ready = 1;
+      sd_card_identified = 0;
+      sd_host_state  = HostIdle;
+    }
+    sd_host_app_command = (command == 55);
+    sd_host_frame_index = 0;
+  }
+  return data_in;
+}
+
+// One SPI byte from the host
+//
+inline uint8_t SD_Cache_Host_Transfer(uint8_t data_out) {
+  uint8_t data_in = 0xFF;
+
+  if (!sd_cache_ready) {
+    return SD_Host_Pass_Through(data_out);
+  }
+
+  if (sd_host_state != HostPass) {
+    SD_Cache_Service(0);
+  }
+
+  // A command frame can start at any point except while the host is sending a data block
+  if ((data_out & 0xC0) == 0x40 && sd_host_state != HostFrame && sd_host_state != HostWriteData && sd_host_state != HostWriteCrc) {
+    if (sd_cache_reset_done) {                            // The card was reset after a host reset, the host initializes it itself
+      sd_cache_reset_done = 0;
+      sd_cache_flush_all  = 0;
+      sd_cache_ready      = 0;
+      sd_host_state       = HostIdle;
+      sd_host_slot        = -1;
+      sd_host_app_command = 0;
+      sd_host_frame_index = 0;
+      sd_host_response_count = 0;
+      SD_Card_Select(0);
+      return SD_Host_Pass_Through(data_out);
+    }
+    SD_Host_End_Pass();
+    if (sd_host_state == HostWriteBusy) {
+      SD_Cache_Host_Select(1);
+    }
+    sd_host_slot           = -1;
+    sd_host_response_count = 0;
+    sd_host_frame[0]       = data_out;
+    sd_host_frame_index    = 1;
+    sd_host_state          = HostFrame;
+    return 0xFF;
+  }
+
+  if (sd_host_response_index < sd_host_response_count) {
+    return sd_host_response[sd_host_response_index++];
+  }
+
+  switch (sd_host_state) {
+    case HostIdle:
+      break;
+
+    case HostFrame:
+      sd_host_frame[sd_host_frame_index++] = data_out;
+      if (sd_host_frame_index == sizeof(sd_host_frame)) {
+        SD_Host_Command();
+      }
+      break;
+
+    case HostPass:
+      data_in = SD_Card_Transfer(data_out);
+      break;
+
+    case HostReadWait:
+      data_in = SD_Host_Read_Wait();
+      break;
+
+    case HostReadData:
+      if ((sd_host_index & (SD_CACHE_CHUNK-1)) == 0) {
+        SD_Cache_Storage_Read(sd_host_slot*SD_SECTOR_SIZE + sd_host_index, sd_host_chunk, SD_CACHE_CHUNK);
+      }
+      data_in = sd_host_chunk[sd_host_index & (SD_CACHE_CHUNK-1)];
+      if (++sd_host_index == SD_SECTOR_SIZE) {
+        sd_host_index = 0;
+        sd_host_state = HostReadCrc;
+      }
+      break;
+
+    case HostReadCrc:
+      if (++sd_host_index == 2) {
+        sd_host_slot = -1;
+        if (sd_host_multi) {
+          sd_host_lba++;
+          sd_host_state = HostReadWait;
+        }
+        else {
+          sd_host_state = HostIdle;
+        }
+      }
+      break;
+
+    case HostWriteToken:
+      if (data_out == 0xFE || data_out == 0xFC) {         // Start block, single or multiple write
+        sd_host_index = 0;
+        sd_host_state = HostWriteData;
+      }
+      else if (data_out == 0xFD) {                        // Stop transmission token
+        sd_host_state = HostIdle;
+      }
+      break;
+
+    case HostWriteData:
+      sd_host_sector[sd_host_index] = data_out;
+      if (++sd_host_index == SD_SECTOR_SIZE) {
+        sd_host_index = 0;
+        sd_host_state = HostWriteCrc;
+      }
+      break;
+
+    case HostWriteCrc:
+      if (++sd_host_index == 2) {
+        sd_host_state = HostWriteResponse;
+      }
+      break;
+
+    case HostWriteResponse:
+      sd_host_slot  = -1;
+      if (sd_host_lba >= sd_card_sectors) {               // A multiple block write ran off the end of the card
+        sd_host_state = HostIdle;
+        data_in = 0x0D;                                   // Write error
+        break;
+      }
+      sd_host_state = HostWriteBusy;
+      data_in = 0x05;                                     // Data accepted
+      break;
+
+    case HostWriteBusy:
+      if (!SD_Host_Write_Commit()) {
+        data_in = 0x00;                                   // Busy
+        break;
+      }
+      sd_host_slot = -1;
+      if (sd_host_multi) {
+        sd_host_lba++;
+        sd_host_state = HostWriteToken;
+      }
+      else {
+        sd_host_state = HostIdle;
+      }
+      break;
+  }
+
+  return data_in;
+}
+
+#endif
@@ -533,18 +533,18 @@ func_02_read_sector:
     mov dx, REG_CS
     mov al, 0               ; assert chip select
     out dx, al
-.cmd17:
-    push cx
-    ; TODO: (opt) use CMD18 for multiple blocks
+.cmd18:
+    push cx                 ; number of sectors left to read
 %ifdef DEBUG_IO
-    mov ax, send_cmd17_msg
+    mov ax, send_cmd18_msg
     call print_string
 %endif
     mov ax, TEMP_LO         ; restore lba
     mov bx, TEMP_HI         ; restore lba
-    mov cl, 0x51            ; CMD17
+    mov cl, 0x52            ; CMD18, the card streams blocks until CMD12
     call send_sd_read_write_cmd
     jc .error
+.next_block:
 %ifdef DEBUG_IO
     mov ax, wait_msg
     call print_string
@@ -557,10 +557,12 @@ func_02_read_sector:
     in al, dx
     cmp al, 0xfe
     je .got_token
+    cmp al, 0xff
+    jne .error_stop         ; data error token
     mov dx, REG_TIMEOUT
     in al, dx
     test al, al
-    jnz .error
+    jnz .error_stop
     jmp .receive_token
 .got_token:
 %ifdef DEBUG_IO
@@ -576,10 +578,13 @@ func_02_read_sector:
 .receive_crc:
     lodsw                   ; discard CRC
     pop si
-    add TEMP_LO, 1          ; next block
-    adc TEMP_HI, 0          ; carry
     pop cx                  ; number of sectors left to read
-    loop .cmd17
+    dec cx
+    push cx
+    jnz .next_block
+.stop:
+    call stop_sd_read       ; all blocks are in, a card that did not stop fails the next command
+    pop cx
 .success:
 .deassert_cs1:
     mov dx, REG_CS
@@ -593,6 +598,8 @@ func_02_read_sector:
     pop bx
     pop ds
     jmp succeeded
+.error_stop:
+    call stop_sd_read
 .error:
 .deassert_cs2:
     mov dx, REG_CS
@@ -660,20 +667,20 @@ func_03_write_sector:
     mov dx, REG_CS
     mov al, 0               ; assert chip select
     out dx, al
-.cmd24:
-    push cx
-    ; TODO: (opt) use CMD25 for multiple blocks
+.cmd25:
+    push cx                 ; number of sectors left to write
 %ifdef DEBUG_IO
-    mov ax, send_cmd24_msg
+    mov ax, send_cmd25_msg
     call print_string
 %endif
     mov ax, TEMP_LO         ; restore lba
     mov bx, TEMP_HI         ; restore lba
-    mov cl, 0x58            ; CMD24
+    mov cl, 0x59            ; CMD25, the card takes blocks until the stop token
     call send_sd_read_write_cmd
     jc .error
+.next_block:
     mov dx, REG_DATA
-    mov al, 0xfe            ; send token
+    mov al, 0xfc            ; send token (multiple block write)
     out dx, al
     mov cx, 256             ; block size (in words)
     push si                 ; save si (aka TEMP1)
@@ -699,7 +706,7 @@ func_03_write_sector:
     mov dx, REG_TIMEOUT
     in al, dx
     test al, al
-    jnz .error
+    jnz .error_stop
     jmp .receive_status
 .got_status:
 %ifdef DEBUG_IO
@@ -716,7 +723,7 @@ func_03_write_sector:
 %endif
     and al, 0x1F
     cmp al, 0x5
-    jne .error
+    jne .error_stop
 %ifdef DEBUG_IO
     mov ax, wait_msg
     call print_string
@@ -732,22 +739,26 @@ func_03_write_sector:
     mov dx, REG_TIMEOUT
     in al, dx
     test al, al
-    jnz .error
+    jnz .error_stop
     jmp .receive_finish
 .got_finish:
 %ifdef DEBUG_IO
     mov ax, sd_idle_msg
     call print_string
 %endif
-    add TEMP_LO, 1          ; next block
-    adc TEMP_HI, 0          ; carry
     pop cx                  ; number of sectors left to write
-%ifndef DEBUG_IO
-    loop .cmd24
-%else
     dec cx
-    jnz .cmd24
-%endif
+    push cx
+    jnz .next_block
+.stop:
+    call stop_sd_write
+    jnc .stopped
+    pop cx
+    inc cx                  ; the last block is not known to be written
+    push cx
+    jmp .error
+.stopped:
+    pop cx
 .success:
 .deassert_cs1:
     mov dx, REG_CS
@@ -763,6 +774,8 @@ func_03_write_sector:
     pop bx
     pop ds
     jmp succeeded
+.error_stop:
+    call stop_sd_write
 .error:
 .deassert_cs2:
     mov dx, REG_CS
@@ -1265,6 +1278,26 @@ acmd41      db  0x69, 0x40, 0x00, 0x00, 0x00, 0x01
 ;      FL = <TRASH>
 ;
 send_sd_read_write_cmd:
+    call send_sd_cmd_frame
+    mov cx, 8               ; retries
+.receive_r1:
+    in al, dx
+    cmp al, 0xff
+    loope .receive_r1
+    test al, al
+    jz .exit
+    stc
+.exit:
+    ret
+
+;
+; Send a command frame to the SD card, without waiting for the response
+; in:  CL = command
+;      BX:AX = argument
+; out: AX = <TRASH>
+;      DX = data port
+;
+send_sd_cmd_frame:
     mov dx, XTMAX_IO_BASE+0 ; data port
     push ax
 .settle_before:
@@ -1284,15 +1317,77 @@ send_sd_read_write_cmd:
     out dx, al
     mov al, 0x1             ; crc (dummy)
     out dx, al
-    mov cx, 8               ; retries
+    ret
+
+;
+; Stop a multiple block read (CMD12) and wait for the card to leave the busy state
+; out: AX = <TRASH>
+;      BX = <TRASH>
+;      CX = <TRASH>
+;      DX = <TRASH>
+;      CF = 0 (success), 1 (error)
+;      FL = <TRASH>
+;
+stop_sd_read:
+%ifdef DEBUG_IO
+    mov ax, send_cmd12_msg
+    call print_string
+%endif
+    xor ax, ax
+    xor bx, bx
+    mov cl, 0x4c            ; CMD12
+    call send_sd_cmd_frame
+    in al, dx               ; stuff byte
+    mov cx, 16              ; retries
 .receive_r1:
+    in al, dx               ; data of the next block may come first, the R1 has bit 7 clear
+    test al, 0x80
+    loopnz .receive_r1
+    jnz .error
+    test al, al
+    jz wait_sd_not_busy
+.error:
+    stc
+    ret
+
+;
+; Send the stop token after a multiple block write (CMD25) and wait for the card to leave the busy state
+; out: AX = <TRASH>
+;      DX = <TRASH>
+;      CF = 0 (success), 1 (error)
+;      FL = <TRASH>
+;
+stop_sd_write:
+    mov dx, REG_DATA
+    mov al, 0xfd            ; stop token
+    out dx, al
+    mov al, 0xff            ; one byte before the card signals busy
+    out dx, al
+
+;
+; Wait for the card to leave the busy state
+; out: AX = <TRASH>
+;      DX = <TRASH>
+;      CF = 0 (success), 1 (error)
+;      FL = <TRASH>
+;
+wait_sd_not_busy:
+    mov dx, REG_TIMEOUT
+    mov al, 25              ; 250 ms
+    out dx, al
+.receive_finish:
+    mov dx, REG_DATA
+    in al, dx
+    cmp al, 0xff            ; the card drives 0 while busy
+    je .success
+    mov dx, REG_TIMEOUT
     in al, dx
-    cmp al, 0xff
-    loope .receive_r1
     test al, al
-    jz .exit
+    jz .receive_finish
     stc
-.exit:
+    ret
+.success:
+    clc
     ret
 
 ;
@@ -1321,7 +1416,7 @@ debug_handler:
 ; Strings
 ;
 
-welcome_msg     db 'BootROM for XTMax v1.0', 0xD, 0xA
+welcome_msg     db 'BootROM for XTMax v1.1', 0xD, 0xA
                 db 'Copyright (c) 2025 Matthieu Bucchianeri', 0xD, 0xA, 0
 rom_base_msg    db 'ROM Base Address        = ', 0
 init_ok_msg     db 'SD Card initialized successfully', 0xD, 0xA, 0
@@ -1343,8 +1438,9 @@ status_msg      db 'Return with ', 0
 %ifdef DEBUG_IO
 send_cmd0_msg   db 'Sending CMD0', 0xD, 0xA, 0
 send_cmd8_msg   db 'Sending CMD8', 0xD, 0xA, 0
-send_cmd17_msg  db 'Sending CMD17', 0xD, 0xA, 0
-send_cmd24_msg  db 'Sending CMD24', 0xD, 0xA, 0
+send_cmd12_msg  db 'Sending CMD12', 0xD, 0xA, 0
+send_cmd18_msg  db 'Sending CMD18', 0xD, 0xA, 0
+send_cmd25_msg  db 'Sending CMD25', 0xD, 0xA, 0
 send_acmd41_msg db 'Sending ACMD41', 0xD, 0xA, 0
 wait_msg        db 'Waiting for SD Card', 0xD, 0xA, 0
 sd_token_msg    db 'Received token', 0xD, 0xA, 0
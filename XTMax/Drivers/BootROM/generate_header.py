@@ -22,6 +22,8 @@ def to_c_array(values, ctype="float", name="table", formatter=str, colcount=8):
     # assemble components into the complete string
     return '{} {}[] = {{\n    {}}};'.format(ctype, name, body)
 
-with open("../../Code/XTMax/bootrom.h", "w") as f:
-    f.write("#define BOOTROM_ADDR {}\n".format(hex(segment << 4)))
-    f.write(to_c_array(bitstream, ctype="unsigned char", name="BOOTROM", colcount=16))
+# MCLV20_Max maps the same ROM and SD data window, keep its copy in sync
+for header in ["../../Code/XTMax/bootrom.h", "../../../MCLV20_Max/Code/MCLV20_Max/bootrom.h"]:
+    with open(header, "w") as f:
+        f.write("#define BOOTROM_ADDR {}\n".format(hex(segment << 4)))
+        f.write(to_c_array(bitstream, ctype="unsigned char", name="BOOTROM", colcount=16))